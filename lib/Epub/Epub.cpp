@@ -224,7 +224,7 @@ bool Epub::loadCssRulesFromCache() const {
   return false;
 }
 
-void Epub::parseCssFiles() const {
+void Epub::parseCssFiles(const std::function<bool()>& shouldStop) const {
   if (cssFiles.empty()) {
     LOG_DBG("EBP", "No CSS files to parse, but CssParser created for inline styles");
   }
@@ -233,32 +233,18 @@ void Epub::parseCssFiles() const {
   if (!loadCssRulesFromCache()) {
     // Cache miss - parse CSS files
     for (const auto& cssPath : cssFiles) {
+      if (shouldStop && shouldStop()) {
+        // Rules of part of the files would be cached as if they were all of them
+        LOG_DBG("EBP", "Stopped parsing CSS files");
+        return;
+      }
       LOG_DBG("EBP", "Parsing CSS file: %s", cssPath.c_str());
 
-      // Extract CSS file to temp location
-      const auto tmpCssPath = getCachePath() + "/.tmp.css";
-      FsFile tempCssFile;
-      if (!Storage.openFileForWrite("EBP", tmpCssPath, tempCssFile)) {
-        LOG_ERR("EBP", "Could not create temp CSS file");
-        continue;
-      }
-      if (!readItemContentsToStream(cssPath, tempCssFile, 1024)) {
+      // Tokenize straight from the inflater, no temp file and no whole-file buffer
+      CssParser::StreamLoader loader(*cssParser);
+      if (!readItemContentsToStream(cssPath, loader, 1024)) {
         LOG_ERR("EBP", "Could not read CSS file: %s", cssPath.c_str());
-        tempCssFile.close();
-        Storage.remove(tmpCssPath.c_str());
-        continue;
       }
-      tempCssFile.close();
-
-      // Parse the CSS file
-      if (!Storage.openFileForRead("EBP", tmpCssPath, tempCssFile)) {
-        LOG_ERR("EBP", "Could not open temp CSS file for reading");
-        Storage.remove(tmpCssPath.c_str());
-        continue;
-      }
-      cssParser->loadFromStream(tempCssFile);
-      tempCssFile.close();
-      Storage.remove(tmpCssPath.c_str());
     }
 
     // Save to cache for next time
@@ -274,7 +260,7 @@ void Epub::parseCssFiles() const {
 
 // load in the meta data for the epub file
 bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss,
-                const std::function<void()>& onMetadataBuildStart) {
+                const std::function<void()>& onMetadataBuildStart, const std::function<bool()>& shouldStop) {
   LOG_DBG("EBP", "Loading ePub: %s", filepath.c_str());
 
   // Initialize spine/TOC cache
@@ -291,7 +277,7 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss,
         LOG_ERR("EBP", "Could not parse content.opf from cached bookMetadata for CSS files");
         // continue anyway - book will work without CSS and we'll still load any inline style CSS
       }
-      parseCssFiles();
+      parseCssFiles(shouldStop);
     }
     LOG_DBG("EBP", "Loaded ePub: %s", filepath.c_str());
     return true;
@@ -333,6 +319,12 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss,
     return false;
   }
   LOG_DBG("EBP", "OPF pass completed in %lu ms", millis() - opfStart);
+  if (shouldStop && shouldStop()) {
+    LOG_DBG("EBP", "Stopped indexing after the OPF pass");
+    bookMetadataCache->endWrite();
+    bookMetadataCache->cleanupTmpFiles();
+    return false;
+  }
 
   // TOC Pass - try EPUB 3 nav first, fall back to NCX
   const uint32_t tocStart = millis();
@@ -365,6 +357,12 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss,
     return false;
   }
   LOG_DBG("EBP", "TOC pass completed in %lu ms", millis() - tocStart);
+  if (shouldStop && shouldStop()) {
+    LOG_DBG("EBP", "Stopped indexing after the TOC pass");
+    bookMetadataCache->endWrite();
+    bookMetadataCache->cleanupTmpFiles();
+    return false;
+  }
 
   // Close the cache files
   if (!bookMetadataCache->endWrite()) {
@@ -394,7 +392,7 @@ bool Epub::load(const bool buildIfMissing, const bool skipLoadingCss,
 
   if (!skipLoadingCss) {
     // Parse CSS files after cache reload
-    parseCssFiles();
+    parseCssFiles(shouldStop);
   }
 
   LOG_DBG("EBP", "Loaded ePub: %s", filepath.c_str());
@@ -460,84 +458,56 @@ std::string Epub::getCoverBmpPath(bool cropped) const {
   return cachePath + "/" + coverFileName + ".bmp";
 }
 
-bool Epub::generateCoverBmp(bool cropped) const {
-  // Already generated, return true
-  if (Storage.exists(getCoverBmpPath(cropped).c_str())) {
-    return true;
-  }
-
-  if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    LOG_ERR("EBP", "Cannot generate cover BMP, cache not loaded");
-    return false;
-  }
-
-  const auto coverImageHref = bookMetadataCache->coreMetadata.coverItemHref;
-  if (coverImageHref.empty()) {
-    LOG_ERR("EBP", "No known cover image");
-    return false;
-  }
-
-  if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
-      coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    LOG_DBG("EBP", "Generating BMP from JPG cover image (%s mode)", cropped ? "cropped" : "fit");
-    const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
+std::string Epub::getThumbBmpPath() const { return cachePath + "/thumb_[HEIGHT].bmp"; }
+std::string Epub::getThumbBmpPath(int height) const { return cachePath + "/thumb_" + std::to_string(height) + ".bmp"; }
 
-    FsFile coverJpg;
-    if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
-      return false;
-    }
-    readItemContentsToStream(coverImageHref, coverJpg, 1024);
-    coverJpg.close();
+bool Epub::generateCoverBmp(bool cropped) const { return generateCoverBmps(!cropped, cropped, {}); }
 
-    if (!Storage.openFileForRead("EBP", coverJpgTempPath, coverJpg)) {
-      return false;
-    }
+bool Epub::generateThumbBmp(int height, const std::function<bool()>& shouldStop) const {
+  return generateCoverBmps(false, false, {height}, shouldStop);
+}
 
-    FsFile coverBmp;
-    if (!Storage.openFileForWrite("EBP", getCoverBmpPath(cropped), coverBmp)) {
-      coverJpg.close();
-      return false;
+bool Epub::generateCoverBmps(const bool fit, const bool cropped, const std::vector<int>& thumbHeights,
+                             const std::function<bool()>& shouldStop) const {
+  // Only build the variants that are not on SD yet
+  std::vector<std::string> outPaths;
+  std::vector<JpegToBmpConverter::BmpVariant> variants;
+  size_t thumbCount = 0;
+  for (const bool crop : {false, true}) {
+    if ((crop ? cropped : fit) && !Storage.exists(getCoverBmpPath(crop).c_str())) {
+      outPaths.push_back(getCoverBmpPath(crop));
+      variants.push_back({nullptr, 0, 0, false, crop});
     }
-    const bool success = JpegToBmpConverter::jpegFileToBmpStream(coverJpg, coverBmp, cropped);
-    coverJpg.close();
-    coverBmp.close();
-    Storage.remove(coverJpgTempPath.c_str());
-
-    if (!success) {
-      LOG_ERR("EBP", "Failed to generate BMP from cover image");
-      Storage.remove(getCoverBmpPath(cropped).c_str());
+  }
+  const size_t coverCount = outPaths.size();
+  for (const int height : thumbHeights) {
+    if (!Storage.exists(getThumbBmpPath(height).c_str())) {
+      outPaths.push_back(getThumbBmpPath(height));
+      // 1-bit thumbnails for fast home screen rendering (no gray passes needed)
+      variants.push_back({nullptr, static_cast<int>(height * 0.6), height, true, true});
+      thumbCount++;
     }
-    LOG_DBG("EBP", "Generated BMP from cover image, success: %s", success ? "yes" : "no");
-    return success;
-  } else {
-    LOG_ERR("EBP", "Cover image is not a supported format, skipping");
   }
 
-  return false;
-}
-
-std::string Epub::getThumbBmpPath() const { return cachePath + "/thumb_[HEIGHT].bmp"; }
-std::string Epub::getThumbBmpPath(int height) const { return cachePath + "/thumb_" + std::to_string(height) + ".bmp"; }
-
-bool Epub::generateThumbBmp(int height) const {
   // Already generated, return true
-  if (Storage.exists(getThumbBmpPath(height).c_str())) {
+  if (outPaths.empty()) {
     return true;
   }
 
   if (!bookMetadataCache || !bookMetadataCache->isLoaded()) {
-    LOG_ERR("EBP", "Cannot generate thumb BMP, cache not loaded");
+    LOG_ERR("EBP", "Cannot generate cover BMP, cache not loaded");
     return false;
   }
 
   const auto coverImageHref = bookMetadataCache->coreMetadata.coverItemHref;
   if (coverImageHref.empty()) {
-    LOG_DBG("EBP", "No known cover image for thumbnail");
+    LOG_DBG("EBP", "No known cover image");
   } else if (coverImageHref.substr(coverImageHref.length() - 4) == ".jpg" ||
              coverImageHref.substr(coverImageHref.length() - 5) == ".jpeg") {
-    LOG_DBG("EBP", "Generating thumb BMP from JPG cover image");
+    LOG_DBG("EBP", "Generating %d cover BMP(s) from JPG cover image", static_cast<int>(outPaths.size()));
     const auto coverJpgTempPath = getCachePath() + "/.cover.jpg";
 
+    // Inflate the cover once; every variant is decoded from the same temp file in a single pass
     FsFile coverJpg;
     if (!Storage.openFileForWrite("EBP", coverJpgTempPath, coverJpg)) {
       return false;
@@ -549,35 +519,47 @@ bool Epub::generateThumbBmp(int height) const {
       return false;
     }
 
-    FsFile thumbBmp;
-    if (!Storage.openFileForWrite("EBP", getThumbBmpPath(height), thumbBmp)) {
-      coverJpg.close();
-      return false;
+    std::vector<FsFile> outFiles(outPaths.size());
+    bool success = true;
+    for (size_t i = 0; i < outPaths.size() && success; i++) {
+      success = Storage.openFileForWrite("EBP", outPaths[i], outFiles[i]);
+      if (i < coverCount) {
+        variants[i] = JpegToBmpConverter::coverVariant(outFiles[i], variants[i].crop);
+      } else {
+        variants[i].out = &outFiles[i];
+      }
+    }
+    if (success) {
+      success = JpegToBmpConverter::jpegFileToBmpStreams(coverJpg, variants.data(), static_cast<int>(variants.size()),
+                                                         shouldStop);
     }
-    // Use smaller target size for Continue Reading card (half of screen: 240x400)
-    // Generate 1-bit BMP for fast home screen rendering (no gray passes needed)
-    int THUMB_TARGET_WIDTH = height * 0.6;
-    int THUMB_TARGET_HEIGHT = height;
-    const bool success = JpegToBmpConverter::jpegFileTo1BitBmpStreamWithSize(coverJpg, thumbBmp, THUMB_TARGET_WIDTH,
-                                                                             THUMB_TARGET_HEIGHT);
     coverJpg.close();
-    thumbBmp.close();
+    for (auto& file : outFiles) {
+      file.close();
+    }
     Storage.remove(coverJpgTempPath.c_str());
 
     if (!success) {
-      LOG_ERR("EBP", "Failed to generate thumb BMP from JPG cover image");
-      Storage.remove(getThumbBmpPath(height).c_str());
+      // Also when stopped part way: a partial BMP must not pass for a finished one
+      if (!shouldStop || !shouldStop()) {
+        LOG_ERR("EBP", "Failed to generate BMP from cover image");
+      }
+      for (const auto& path : outPaths) {
+        Storage.remove(path.c_str());
+      }
     }
-    LOG_DBG("EBP", "Generated thumb BMP from JPG cover image, success: %s", success ? "yes" : "no");
+    LOG_DBG("EBP", "Generated BMP from cover image, success: %s", success ? "yes" : "no");
     return success;
   } else {
-    LOG_ERR("EBP", "Cover image is not a supported format, skipping thumbnail");
+    LOG_ERR("EBP", "Cover image is not a supported format, skipping");
   }
 
-  // Write an empty bmp file to avoid generation attempts in the future
-  FsFile thumbBmp;
-  Storage.openFileForWrite("EBP", getThumbBmpPath(height), thumbBmp);
-  thumbBmp.close();
+  // Write empty thumbnail files to avoid generation attempts in the future
+  for (size_t i = coverCount; i < coverCount + thumbCount; i++) {
+    FsFile thumbBmp;
+    Storage.openFileForWrite("EBP", outPaths[i], thumbBmp);
+    thumbBmp.close();
+  }
   return false;
 }
 
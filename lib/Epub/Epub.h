@@ -35,7 +35,7 @@ class Epub {
   bool parseContentOpf(BookMetadataCache::BookMetadata& bookMetadata);
   bool parseTocNcxFile() const;
   bool parseTocNavFile() const;
-  void parseCssFiles() const;
+  void parseCssFiles(const std::function<bool()>& shouldStop = nullptr) const;
   std::string getCssRulesCache() const;
   bool loadCssRulesFromCache() const;
 
@@ -46,8 +46,11 @@ class Epub {
   }
   ~Epub() = default;
   std::string& getBasePath() { return contentBasePath; }
+  // shouldStop is polled between the passes of a build and between CSS files; a build it stops fails and leaves no
+  // book.bin, stopped CSS parsing leaves the rules cache unwritten
   bool load(bool buildIfMissing = true, bool skipLoadingCss = false,
-            const std::function<void()>& onMetadataBuildStart = nullptr);
+            const std::function<void()>& onMetadataBuildStart = nullptr,
+            const std::function<bool()>& shouldStop = nullptr);
   bool clearCache() const;
   void setupCacheDir() const;
   const std::string& getCachePath() const;
@@ -59,7 +62,11 @@ class Epub {
   bool generateCoverBmp(bool cropped = false) const;
   std::string getThumbBmpPath() const;
   std::string getThumbBmpPath(int height) const;
-  bool generateThumbBmp(int height) const;
+  bool generateThumbBmp(int height, const std::function<bool()>& shouldStop = nullptr) const;
+  // Build every missing cover variant (fit, cropped and one 1-bit thumbnail per height) from a single extraction
+  // and decode of the cover image. Returns true if all requested variants exist afterwards.
+  bool generateCoverBmps(bool fit, bool cropped, const std::vector<int>& thumbHeights,
+                         const std::function<bool()>& shouldStop = nullptr) const;
   uint8_t* readItemContentsToBytes(const std::string& itemHref, size_t* size = nullptr,
                                    bool trailingNullByte = false) const;
   bool readItemContentsToStream(const std::string& itemHref, Print& out, size_t chunkSize) const;
@@ -0,0 +1,104 @@
+#include "BookPageTable.h"
+
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+namespace {
+constexpr uint8_t PAGE_TABLE_VERSION = 1;
+// version, spine item count, paginated item count
+constexpr size_t HEADER_SIZE = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t);
+}  // namespace
+
+bool BookPageTable::load(const uint16_t spineCount) {
+  this->spineCount = spineCount;
+  cumulativePages.clear();
+
+  FsFile file;
+  if (!Storage.exists(filePath.c_str()) || !Storage.openFileForRead("BPT", filePath, file)) {
+    return false;
+  }
+
+  uint8_t version;
+  uint16_t fileSpineCount;
+  uint16_t pagedCount;
+  serialization::readPod(file, version);
+  serialization::readPod(file, fileSpineCount);
+  serialization::readPod(file, pagedCount);
+  // A table cut short by a power loss while it was saved is dropped and rebuilt
+  if (version != PAGE_TABLE_VERSION || fileSpineCount != spineCount || pagedCount > spineCount ||
+      file.size() < HEADER_SIZE + pagedCount * sizeof(uint32_t)) {
+    LOG_DBG("BPT", "Discarding page table %s", filePath.c_str());
+    file.close();
+    return false;
+  }
+
+  cumulativePages.resize(pagedCount);
+  for (auto& pages : cumulativePages) {
+    serialization::readPod(file, pages);
+  }
+  file.close();
+  return true;
+}
+
+bool BookPageTable::append(const uint16_t pageCount) {
+  if (cumulativePages.size() >= spineCount) {
+    return false;
+  }
+  cumulativePages.push_back(getTotalPages() + pageCount);
+  if (!save()) {
+    cumulativePages.pop_back();
+    return false;
+  }
+  return true;
+}
+
+bool BookPageTable::verify(const int spineIndex, const uint16_t pageCount) {
+  if (spineIndex < 0 || spineIndex >= pagedSpineItems() ||
+      cumulativePages[spineIndex] - getFirstPage(spineIndex) == pageCount) {
+    return true;
+  }
+
+  // Every later total includes this item's pages, so the table is good only up to it
+  LOG_DBG("BPT", "Spine item %d now has %u pages, page table cut to %d items", spineIndex,
+          static_cast<unsigned>(pageCount), spineIndex);
+  cumulativePages.resize(spineIndex);
+  save();
+  return false;
+}
+
+bool BookPageTable::save() const {
+  // The table is a few hundred bytes, rewriting it whole keeps the header and the entries in step
+  FsFile file;
+  if (!Storage.openFileForWrite("BPT", filePath, file)) {
+    return false;
+  }
+  serialization::writePod(file, PAGE_TABLE_VERSION);
+  serialization::writePod(file, spineCount);
+  serialization::writePod(file, pagedSpineItems());
+  for (const auto pages : cumulativePages) {
+    serialization::writePod(file, pages);
+  }
+  file.close();
+  return true;
+}
+
+uint32_t BookPageTable::getFirstPage(const int spineIndex) const {
+  if (spineIndex <= 0 || cumulativePages.empty()) {
+    return 0;
+  }
+  return cumulativePages[std::min<size_t>(spineIndex, cumulativePages.size()) - 1];
+}
+
+bool BookPageTable::locate(const uint32_t bookPage, int* spineIndex, int* page) const {
+  // First spine item whose running total passes the page; empty items share their total with the one before
+  const auto it = std::upper_bound(cumulativePages.begin(), cumulativePages.end(), bookPage);
+  if (it == cumulativePages.end()) {
+    return false;
+  }
+  *spineIndex = static_cast<int>(it - cumulativePages.begin());
+  *page = static_cast<int>(bookPage - getFirstPage(*spineIndex));
+  return true;
+}
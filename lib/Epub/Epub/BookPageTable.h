@@ -0,0 +1,42 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * Page counts of a book's spine items for one layout, kept as running totals so a page of the whole book maps to its
+ * spine item with a binary search.
+ *
+ * The table lives next to the layout's sections and is filled one spine item at a time; every item is persisted as
+ * soon as it is added, so building the table can stop at any point and carry on later. A section rebuilt after its
+ * item was counted (a new section file version, a cache cleared by hand) is checked against the table with verify(),
+ * so running totals counted from an older build never outlive it.
+ */
+class BookPageTable {
+  std::string filePath;
+  uint16_t spineCount = 0;
+  // Pages in spine items 0..i, for the items paginated so far
+  std::vector<uint32_t> cumulativePages;
+
+  bool save() const;
+
+ public:
+  explicit BookPageTable(const std::string& layoutCachePath) : filePath(layoutCachePath + "/pages.bin") {}
+
+  // Reads the items paginated so far; false (and an empty table) if there is no table for a book of this size
+  bool load(uint16_t spineCount);
+  // Adds the next spine item and saves the table
+  bool append(uint16_t pageCount);
+  // Checks a paginated spine item against the page count of its section as built now; on a mismatch the item and
+  // every one after it are dropped and the table saved incomplete. False if the table was cut
+  bool verify(int spineIndex, uint16_t pageCount);
+
+  uint16_t getSpineCount() const { return spineCount; }
+  uint16_t pagedSpineItems() const { return static_cast<uint16_t>(cumulativePages.size()); }
+  bool isComplete() const { return spineCount > 0 && cumulativePages.size() == spineCount; }
+  uint32_t getTotalPages() const { return cumulativePages.empty() ? 0 : cumulativePages.back(); }
+  // Book page (0-based) of the first page of a paginated spine item
+  uint32_t getFirstPage(int spineIndex) const;
+  // Spine item and page within it of a book page, false if the page is past the paginated items
+  bool locate(uint32_t bookPage, int* spineIndex, int* page) const;
+};
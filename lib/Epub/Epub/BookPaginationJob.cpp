@@ -0,0 +1,67 @@
+#include "BookPaginationJob.h"
+
+#include <Logging.h>
+
+#include "Section.h"
+
+bool BookPaginationJob::step(const std::function<bool()>& shouldStop) {
+  if (isDone()) {
+    return false;
+  }
+
+  if (!table) {
+    // Every spine item of a layout shares one cache directory, any section can tell where it is
+    Section probe(epub, 0, renderer);
+    probe.selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                       viewportHeight, hyphenationEnabled, embeddedStyle);
+    table.reset(new BookPageTable(probe.getLayoutCachePath()));
+    table->load(static_cast<uint16_t>(epub->getSpineItemsCount()));
+    if (table->getSpineCount() == 0) {
+      failed = true;
+      return false;
+    }
+    if (table->pagedSpineItems() > 0) {
+      LOG_DBG("BPJ", "Resuming pagination at spine item %d of %d", table->pagedSpineItems(), table->getSpineCount());
+    }
+    if (table->isComplete()) {
+      return false;
+    }
+  } else {
+    // The reader or the cache warmer may have cut the table since the last step, when a rebuilt section disagreed
+    table->load(table->getSpineCount());
+  }
+
+  const int spineIndex = table->pagedSpineItems();
+  Section section(epub, spineIndex, renderer);
+  if (!section.loadSectionFile(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                               viewportHeight, hyphenationEnabled, embeddedStyle) &&
+      !section.createSectionFile(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
+                                 viewportHeight, hyphenationEnabled, embeddedStyle, nullptr,
+                                 EpubProcessingProfile::optimized(), shouldStop)) {
+    if (section.wasStopped()) {
+      // Nothing of the item was kept, the next step lays it out again
+      return true;
+    }
+    LOG_ERR("BPJ", "Could not paginate spine item %d", spineIndex);
+    failed = true;
+    return false;
+  }
+  if (!table->append(section.pageCount)) {
+    LOG_ERR("BPJ", "Could not save the page table");
+    failed = true;
+    return false;
+  }
+
+  if (table->isComplete()) {
+    LOG_DBG("BPJ", "Paginated %d spine items: %u pages", table->getSpineCount(),
+            static_cast<unsigned>(table->getTotalPages()));
+  }
+  return !table->isComplete();
+}
+
+int BookPaginationJob::progressPercent() const {
+  if (!table || table->getSpineCount() == 0) {
+    return 0;
+  }
+  return table->pagedSpineItems() * 100 / table->getSpineCount();
+}
@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "BookPageTable.h"
+#include "Epub.h"
+
+class GfxRenderer;
+
+/**
+ * Paginates every spine item of a book for one layout and records the page counts in the layout's BookPageTable.
+ *
+ * Work is done one spine item per step(). Sections that are already cached are only opened for their page count, so
+ * a job started again after a restart skips straight to the first item the table is missing. Laying out an item can
+ * take seconds; shouldStop is polled meanwhile and, when it fires, the item is dropped and laid out again next step.
+ */
+class BookPaginationJob {
+  std::shared_ptr<Epub> epub;
+  GfxRenderer& renderer;
+  int fontId;
+  float lineCompression;
+  bool extraParagraphSpacing;
+  uint8_t paragraphAlignment;
+  uint16_t viewportWidth;
+  uint16_t viewportHeight;
+  bool hyphenationEnabled;
+  bool embeddedStyle;
+  std::unique_ptr<BookPageTable> table;
+  bool failed = false;
+
+ public:
+  explicit BookPaginationJob(const std::shared_ptr<Epub>& epub, GfxRenderer& renderer, int fontId,
+                             float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                             uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
+                             bool embeddedStyle)
+      : epub(epub),
+        renderer(renderer),
+        fontId(fontId),
+        lineCompression(lineCompression),
+        extraParagraphSpacing(extraParagraphSpacing),
+        paragraphAlignment(paragraphAlignment),
+        viewportWidth(viewportWidth),
+        viewportHeight(viewportHeight),
+        hyphenationEnabled(hyphenationEnabled),
+        embeddedStyle(embeddedStyle) {}
+
+  // Paginates the next spine item; false once there is nothing left to do or a section could not be built
+  bool step(const std::function<bool()>& shouldStop = nullptr);
+  bool isDone() const { return failed || (table && table->isComplete()); }
+  bool hasFailed() const { return failed; }
+  int progressPercent() const;
+  // The table as far as it got, nullptr before the first step
+  const BookPageTable* getTable() const { return table.get(); }
+};
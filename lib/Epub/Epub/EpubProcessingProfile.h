@@ -1,17 +1,49 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 
 struct EpubProcessingProfile {
+  // The heap as the platform reports it, set once by the firmware at startup. Left unset (on the host) the low heap
+  // check never fires and adaptToHeap keeps the configured sizes.
+  struct HeapHooks {
+    std::function<size_t()> freeHeap;
+    std::function<size_t()> largestFreeBlock;
+  };
+  inline static HeapHooks heapHooks;
+
   size_t sectionStreamBufferSize = 4096;
   size_t htmlParseChunkSize = 4096;
   uint16_t pageProcessLogInterval = 25;
   bool cacheLineMetrics = true;
+  // Once a paragraph has this many words buffered its leading lines are laid out early. The last
+  // layoutLookaheadLines lines are held back so the line breaker still sees the text that follows them.
+  uint16_t layoutWindowWords = 750;
+  uint16_t layoutLookaheadLines = 1;
+  // Free heap below which a paragraph is laid out early whatever the window, 0 to never check
+  size_t lowHeapThreshold = 0;
+  // Size buffers and the layout window from the heap when the section is built, see fittedToHeap()
+  bool adaptToHeap = false;
 
   static constexpr size_t DEFAULT_CHUNK_SIZE = 1024;
+  static constexpr size_t MAX_CHUNK_SIZE = 8192;
+  // Heap left alone for everything else that runs while a section is built (pages, expat, SD, inflater)
+  static constexpr size_t RESERVED_HEAP = 32 * 1024;
+  // A buffered word on the device: three list nodes (string, style, join), its source offset and its share of the
+  // layout vectors
+  static constexpr size_t ESTIMATED_BYTES_PER_WORD = 100;
+  static constexpr uint16_t MIN_WINDOW_WORDS = 150;
+  static constexpr uint16_t MAX_WINDOW_WORDS = 2000;
+  static constexpr uint16_t WORDS_PER_LOOKAHEAD_LINE = 50;
+  static constexpr uint16_t MAX_LOOKAHEAD_LINES = 8;
 
-  static EpubProcessingProfile optimized() { return EpubProcessingProfile{}; }
+  static EpubProcessingProfile optimized() {
+    EpubProcessingProfile profile;
+    profile.adaptToHeap = true;
+    return profile;
+  }
 
   static EpubProcessingProfile baseline() {
     EpubProcessingProfile profile;
@@ -22,6 +54,34 @@ struct EpubProcessingProfile {
     return profile;
   }
 
+  // This profile with its buffers and layout window sized for the given free heap and largest allocatable block
+  [[nodiscard]] constexpr EpubProcessingProfile fittedToHeap(const size_t freeHeap,
+                                                             const size_t largestFreeBlock) const {
+    EpubProcessingProfile profile = *this;
+
+    // Stream and parse buffers: the largest power of two that takes at most an eighth of the largest block
+    size_t chunkSize = MAX_CHUNK_SIZE;
+    while (chunkSize > DEFAULT_CHUNK_SIZE && chunkSize * 8 > largestFreeBlock) {
+      chunkSize /= 2;
+    }
+    profile.sectionStreamBufferSize = chunkSize;
+    profile.htmlParseChunkSize = chunkSize;
+
+    // The configured window is the floor, a smaller one costs line breaking quality. It only shrinks when what is
+    // left after the reserve cannot hold that many words at all, and grows once half of it holds more.
+    const size_t usableHeap = freeHeap > RESERVED_HEAP ? freeHeap - RESERVED_HEAP : 0;
+    const size_t affordableWords = usableHeap / ESTIMATED_BYTES_PER_WORD;
+    const size_t windowWords =
+        affordableWords < layoutWindowWords
+            ? std::max<size_t>(affordableWords, MIN_WINDOW_WORDS)
+            : std::max<size_t>(layoutWindowWords, std::min<size_t>(affordableWords / 2, MAX_WINDOW_WORDS));
+    profile.layoutWindowWords = static_cast<uint16_t>(windowWords);
+    profile.layoutLookaheadLines = static_cast<uint16_t>(
+        std::clamp<size_t>(windowWords / WORDS_PER_LOOKAHEAD_LINE, 1, MAX_LOOKAHEAD_LINES));
+    profile.lowHeapThreshold = RESERVED_HEAP / 2;
+    return profile;
+  }
+
   [[nodiscard]] constexpr size_t sectionChunkSizeOrDefault() const {
     return sectionStreamBufferSize > 0 ? sectionStreamBufferSize : DEFAULT_CHUNK_SIZE;
   }
@@ -30,4 +90,3 @@ struct EpubProcessingProfile {
     return htmlParseChunkSize > 0 ? htmlParseChunkSize : DEFAULT_CHUNK_SIZE;
   }
 };
-
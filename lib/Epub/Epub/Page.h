@@ -37,6 +37,8 @@ class Page {
  public:
   // the list of block index and line numbers on this page
   std::vector<std::shared_ptr<PageElement>> elements;
+  // Byte offset of the first word in the chapter's XHTML. Not serialized, the section file keeps it in its LUT.
+  uint32_t sourceOffset = 0;
   void render(GfxRenderer& renderer, int fontId, int xOffset, int yOffset) const;
   bool serialize(FsFile& file) const;
   static std::unique_ptr<Page> deserialize(FsFile& file);
@@ -53,7 +53,7 @@ uint16_t measureWordWidth(const GfxRenderer& renderer, const int fontId, const s
 }  // namespace
 
 void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle, const bool underline,
-                         const bool attachToPrevious) {
+                         const bool attachToPrevious, const bool abutPrevious, const uint32_t sourceOffset) {
   if (word.empty()) return;
 
   words.push_back(std::move(word));
@@ -62,13 +62,14 @@ void ParsedText::addWord(std::string word, const EpdFontFamily::Style fontStyle,
     combinedStyle = static_cast<EpdFontFamily::Style>(combinedStyle | EpdFontFamily::UNDERLINE);
   }
   wordStyles.push_back(combinedStyle);
-  wordContinues.push_back(attachToPrevious);
+  wordJoins.push_back(attachToPrevious ? Join::ATTACHED : abutPrevious ? Join::ABUTTED : Join::SPACE);
+  wordSourceOffsets.push_back(sourceOffset);
 }
 
 // Consumes data to minimize memory usage
 void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fontId, const uint16_t viewportWidth,
                                        const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                                       const bool includeLastLine) {
+                                       const uint16_t heldBackLines) {
   if (words.empty()) {
     return;
   }
@@ -80,21 +81,34 @@ void ParsedText::layoutAndExtractLines(const GfxRenderer& renderer, const int fo
   const int spaceWidth = renderer.getSpaceWidth(fontId);
   auto wordWidths = calculateWordWidths(renderer, fontId);
 
-  // Build indexed continues vector from the parallel list for O(1) access during layout
-  std::vector<bool> continuesVec(wordContinues.begin(), wordContinues.end());
+  // Build indexed joins vector from the parallel list for O(1) access during layout
+  std::vector<Join> joins(wordJoins.begin(), wordJoins.end());
 
   std::vector<size_t> lineBreakIndices;
   if (hyphenationEnabled) {
     // Use greedy layout that can split words mid-loop when a hyphenated prefix fits.
-    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+    lineBreakIndices = computeHyphenatedLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, joins);
   } else {
-    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, continuesVec);
+    lineBreakIndices = computeLineBreaks(renderer, fontId, pageWidth, spaceWidth, wordWidths, joins);
   }
-  const size_t lineCount = includeLastLine ? lineBreakIndices.size() : lineBreakIndices.size() - 1;
+  const size_t lineCount = lineBreakIndices.size() > heldBackLines ? lineBreakIndices.size() - heldBackLines : 0;
 
   for (size_t i = 0; i < lineCount; ++i) {
-    extractLine(i, pageWidth, spaceWidth, wordWidths, continuesVec, lineBreakIndices, processLine);
+    extractLine(i, pageWidth, spaceWidth, wordWidths, joins, lineBreakIndices, processLine);
   }
+  if (lineCount > 0) {
+    wordSourceOffsets.erase(wordSourceOffsets.begin(), wordSourceOffsets.begin() + lineBreakIndices[lineCount - 1]);
+  }
+  // Whatever is left continues the paragraph, it gets no indent of its own the next time round
+  firstLineExtracted = firstLineExtracted || lineCount > 0;
+}
+
+int ParsedText::firstLineIndent() const {
+  // Only for left/justified text without extra paragraph spacing, and only on the paragraph's real first line
+  return !firstLineExtracted && blockStyle.textIndent > 0 && !extraParagraphSpacing &&
+                 (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
+             ? blockStyle.textIndent
+             : 0;
 }
 
 std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& renderer, const int fontId) {
@@ -118,25 +132,21 @@ std::vector<uint16_t> ParsedText::calculateWordWidths(const GfxRenderer& rendere
 
 std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, const int fontId, const int pageWidth,
                                                   const int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec) {
+                                                  std::vector<Join>& joins) {
   if (words.empty()) {
     return {};
   }
 
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+  const int firstLineIndent = this->firstLineIndent();
 
   // Ensure any word that would overflow even as the first entry on a line is split using fallback hyphenation.
+  WordCursor cursor = wordCursor();
   for (size_t i = 0; i < wordWidths.size(); ++i) {
     // First word needs to fit in reduced width if there's an indent
     const int effectiveWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
     while (wordWidths[i] > effectiveWidth) {
-      if (!hyphenateWordAtIndex(i, effectiveWidth, renderer, fontId, wordWidths, /*allowFallbackBreaks=*/true,
-                                &continuesVec)) {
+      if (!hyphenateWordAtIndex(cursor, i, effectiveWidth, renderer, fontId, wordWidths,
+                                /*allowFallbackBreaks=*/true, &joins)) {
         break;
       }
     }
@@ -161,8 +171,8 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
     const int effectivePageWidth = i == 0 ? pageWidth - firstLineIndent : pageWidth;
 
     for (size_t j = i; j < totalWordCount; ++j) {
-      // Add space before word j, unless it's the first word on the line or a continuation
-      const int gap = j > static_cast<size_t>(i) && !continuesVec[j] ? spaceWidth : 0;
+      // Add space before word j, unless it's the first word on the line or joins without one
+      const int gap = j > static_cast<size_t>(i) && joins[j] == Join::SPACE ? spaceWidth : 0;
       currlen += wordWidths[j] + gap;
 
       if (currlen > effectivePageWidth) {
@@ -170,7 +180,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
       }
 
       // Cannot break after word j if the next word attaches to it (continuation group)
-      if (j + 1 < totalWordCount && continuesVec[j + 1]) {
+      if (j + 1 < totalWordCount && joins[j + 1] == Join::ATTACHED) {
         continue;
       }
 
@@ -229,7 +239,7 @@ std::vector<size_t> ParsedText::computeLineBreaks(const GfxRenderer& renderer, c
 }
 
 void ParsedText::applyParagraphIndent() {
-  if (extraParagraphSpacing || words.empty()) {
+  if (extraParagraphSpacing || words.empty() || firstLineExtracted) {
     return;
   }
 
@@ -246,17 +256,13 @@ void ParsedText::applyParagraphIndent() {
 std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& renderer, const int fontId,
                                                             const int pageWidth, const int spaceWidth,
                                                             std::vector<uint16_t>& wordWidths,
-                                                            std::vector<bool>& continuesVec) {
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const int firstLineIndent =
-      blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+                                                            std::vector<Join>& joins) {
+  const int firstLineIndent = this->firstLineIndent();
 
   std::vector<size_t> lineBreakIndices;
   size_t currentIndex = 0;
   bool isFirstLine = true;
+  WordCursor cursor = wordCursor();
 
   while (currentIndex < wordWidths.size()) {
     const size_t lineStart = currentIndex;
@@ -268,7 +274,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
     // Consume as many words as possible for current line, splitting when prefixes fit
     while (currentIndex < wordWidths.size()) {
       const bool isFirstWord = currentIndex == lineStart;
-      const int spacing = isFirstWord || continuesVec[currentIndex] ? 0 : spaceWidth;
+      const int spacing = isFirstWord || joins[currentIndex] != Join::SPACE ? 0 : spaceWidth;
       const int candidateWidth = spacing + wordWidths[currentIndex];
 
       // Word fits on current line
@@ -282,8 +288,8 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
       const int availableWidth = effectivePageWidth - lineWidth - spacing;
       const bool allowFallbackBreaks = isFirstWord;  // Only for first word on line
 
-      if (availableWidth > 0 && hyphenateWordAtIndex(currentIndex, availableWidth, renderer, fontId, wordWidths,
-                                                     allowFallbackBreaks, &continuesVec)) {
+      if (availableWidth > 0 && hyphenateWordAtIndex(cursor, currentIndex, availableWidth, renderer, fontId,
+                                                     wordWidths, allowFallbackBreaks, &joins)) {
         // Prefix now fits; append it to this line and move to next line
         lineWidth += spacing + wordWidths[currentIndex];
         ++currentIndex;
@@ -300,7 +306,7 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
 
     // Don't break before a continuation word (e.g., orphaned "?" after "question").
     // Backtrack to the start of the continuation group so the whole group moves to the next line.
-    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && continuesVec[currentIndex]) {
+    while (currentIndex > lineStart + 1 && currentIndex < wordWidths.size() && joins[currentIndex] == Join::ATTACHED) {
       --currentIndex;
     }
 
@@ -311,21 +317,31 @@ std::vector<size_t> ParsedText::computeHyphenatedLineBreaks(const GfxRenderer& r
   return lineBreakIndices;
 }
 
+ParsedText::WordCursor ParsedText::wordCursor() { return {0, words.begin(), wordStyles.begin(), wordJoins.begin()}; }
+
+void ParsedText::seek(WordCursor& cursor, const size_t index) {
+  // The callers walk forward with the odd short step back, so this is a step or two per call
+  const auto delta = static_cast<std::ptrdiff_t>(index) - static_cast<std::ptrdiff_t>(cursor.index);
+  std::advance(cursor.word, delta);
+  std::advance(cursor.style, delta);
+  std::advance(cursor.join, delta);
+  cursor.index = index;
+}
+
 // Splits words[wordIndex] into prefix (adding a hyphen only when needed) and remainder when a legal breakpoint fits the
-// available width.
-bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availableWidth, const GfxRenderer& renderer,
-                                      const int fontId, std::vector<uint16_t>& wordWidths,
-                                      const bool allowFallbackBreaks, std::vector<bool>* continuesVec) {
+// available width. The cursor is moved to the word and stays valid, the remainder is inserted after it.
+bool ParsedText::hyphenateWordAtIndex(WordCursor& cursor, const size_t wordIndex, const int availableWidth,
+                                      const GfxRenderer& renderer, const int fontId,
+                                      std::vector<uint16_t>& wordWidths, const bool allowFallbackBreaks,
+                                      std::vector<Join>* joins) {
   // Guard against invalid indices or zero available width before attempting to split.
   if (availableWidth <= 0 || wordIndex >= words.size()) {
     return false;
   }
 
-  // Get iterators to target word and style.
-  auto wordIt = words.begin();
-  auto styleIt = wordStyles.begin();
-  std::advance(wordIt, wordIndex);
-  std::advance(styleIt, wordIndex);
+  seek(cursor, wordIndex);
+  const auto wordIt = cursor.word;
+  const auto styleIt = cursor.style;
 
   const std::string& word = *wordIt;
   const auto style = *styleIt;
@@ -376,21 +392,16 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
   words.insert(insertWordIt, remainder);
   wordStyles.insert(insertStyleIt, style);
 
-  // The remainder inherits whatever continuation status the original word had with the word after it.
-  // Find the continues entry for the original word and insert the remainder's entry after it.
-  auto continuesIt = wordContinues.begin();
-  std::advance(continuesIt, wordIndex);
-  const bool originalContinuedToNext = *continuesIt;
-  // The original word (now prefix) does NOT continue to remainder (hyphen separates them)
-  *continuesIt = false;
-  const auto insertContinuesIt = std::next(continuesIt);
-  wordContinues.insert(insertContinuesIt, originalContinuedToNext);
+  // The prefix keeps its join with the word before it. The remainder follows the prefix without a space and the
+  // line breaks between them.
+  wordJoins.insert(std::next(cursor.join), Join::ABUTTED);
 
   // Keep the indexed vector in sync if provided
-  if (continuesVec) {
-    (*continuesVec)[wordIndex] = false;
-    continuesVec->insert(continuesVec->begin() + wordIndex + 1, originalContinuedToNext);
+  if (joins) {
+    joins->insert(joins->begin() + wordIndex + 1, Join::ABUTTED);
   }
+  wordSourceOffsets.insert(wordSourceOffsets.begin() + wordIndex + 1,
+                           wordSourceOffsets[wordIndex] + static_cast<uint32_t>(chosenOffset));
 
   // Update cached widths to reflect the new prefix/remainder pairing.
   wordWidths[wordIndex] = static_cast<uint16_t>(chosenWidth);
@@ -400,31 +411,32 @@ bool ParsedText::hyphenateWordAtIndex(const size_t wordIndex, const int availabl
 }
 
 void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const int spaceWidth,
-                             const std::vector<uint16_t>& wordWidths, const std::vector<bool>& continuesVec,
+                             const std::vector<uint16_t>& wordWidths, const std::vector<Join>& joins,
                              const std::vector<size_t>& lineBreakIndices,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine) {
   const size_t lineBreak = lineBreakIndices[breakIndex];
   const size_t lastBreakAt = breakIndex > 0 ? lineBreakIndices[breakIndex - 1] : 0;
   const size_t lineWordCount = lineBreak - lastBreakAt;
 
-  // Calculate first line indent (only for left/justified text without extra paragraph spacing)
-  const bool isFirstLine = breakIndex == 0;
-  const int firstLineIndent =
-      isFirstLine && blockStyle.textIndent > 0 && !extraParagraphSpacing &&
-              (blockStyle.alignment == CssTextAlign::Justify || blockStyle.alignment == CssTextAlign::Left)
-          ? blockStyle.textIndent
-          : 0;
+  const int firstLineIndent = breakIndex == 0 ? this->firstLineIndent() : 0;
+  // Offsets are dropped once all lines are out, so they are still indexed like wordWidths here
+  extractedLineSourceOffset = wordSourceOffsets[lastBreakAt];
 
   // Calculate total word width for this line and count actual word gaps
-  // (continuation words attach to previous word with no gap)
+  // (attached and abutted words follow the previous word with no gap)
   int lineWordWidthSum = 0;
   size_t actualGapCount = 0;
+  size_t abuttedCount = 0;
 
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
     lineWordWidthSum += wordWidths[lastBreakAt + wordIdx];
-    // Count gaps: each word after the first creates a gap, unless it's a continuation
-    if (wordIdx > 0 && !continuesVec[lastBreakAt + wordIdx]) {
+    if (wordIdx == 0) continue;
+    // Count gaps: each word after the first creates a gap, unless it joins without a space
+    const Join join = joins[lastBreakAt + wordIdx];
+    if (join == Join::SPACE) {
       actualGapCount++;
+    } else if (join == Join::ABUTTED) {
+      abuttedCount++;
     }
   }
 
@@ -433,11 +445,17 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   const int spareSpace = effectivePageWidth - lineWordWidthSum;
 
   int spacing = spaceWidth;
+  int abuttedSpacing = 0;
   const bool isLastLine = breakIndex == lineBreakIndices.size() - 1;
 
-  // For justified text, calculate spacing based on actual gap count
-  if (blockStyle.alignment == CssTextAlign::Justify && !isLastLine && actualGapCount >= 1) {
-    spacing = spareSpace / static_cast<int>(actualGapCount);
+  // For justified text, calculate spacing based on actual gap count. A line without spaces (CJK text) is justified
+  // by spreading the spare space between its abutted pieces instead.
+  if (blockStyle.alignment == CssTextAlign::Justify && !isLastLine) {
+    if (actualGapCount >= 1) {
+      spacing = spareSpace / static_cast<int>(actualGapCount);
+    } else if (abuttedCount >= 1) {
+      abuttedSpacing = spareSpace / static_cast<int>(abuttedCount);
+    }
   }
 
   // Calculate initial x position (first line starts at indent for left/justified text)
@@ -449,7 +467,7 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   }
 
   // Pre-calculate X positions for words
-  // Continuation words attach to the previous word with no space before them
+  // Attached and abutted words follow the previous word with no space before them
   std::list<uint16_t> lineXPos;
 
   for (size_t wordIdx = 0; wordIdx < lineWordCount; wordIdx++) {
@@ -457,19 +475,20 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
 
     lineXPos.push_back(xpos);
 
-    // Add spacing after this word, unless the next word is a continuation
-    const bool nextIsContinuation = wordIdx + 1 < lineWordCount && continuesVec[lastBreakAt + wordIdx + 1];
+    // Add spacing after this word, unless the next word joins without a space
+    const Join nextJoin = wordIdx + 1 < lineWordCount ? joins[lastBreakAt + wordIdx + 1] : Join::SPACE;
+    const int gap = nextJoin == Join::SPACE ? spacing : nextJoin == Join::ABUTTED ? abuttedSpacing : 0;
 
-    xpos += currentWordWidth + (nextIsContinuation ? 0 : spacing);
+    xpos += currentWordWidth + gap;
   }
 
   // Iterators always start at the beginning as we are moving content with splice below
   auto wordEndIt = words.begin();
   auto wordStyleEndIt = wordStyles.begin();
-  auto wordContinuesEndIt = wordContinues.begin();
+  auto wordJoinsEndIt = wordJoins.begin();
   std::advance(wordEndIt, lineWordCount);
   std::advance(wordStyleEndIt, lineWordCount);
-  std::advance(wordContinuesEndIt, lineWordCount);
+  std::advance(wordJoinsEndIt, lineWordCount);
 
   // *** CRITICAL STEP: CONSUME DATA USING SPLICE ***
   std::list<std::string> lineWords;
@@ -477,9 +496,9 @@ void ParsedText::extractLine(const size_t breakIndex, const int pageWidth, const
   std::list<EpdFontFamily::Style> lineWordStyles;
   lineWordStyles.splice(lineWordStyles.begin(), wordStyles, wordStyles.begin(), wordStyleEndIt);
 
-  // Consume continues flags (not passed to TextBlock, but must be consumed to stay in sync)
-  std::list<bool> lineContinues;
-  lineContinues.splice(lineContinues.begin(), wordContinues, wordContinues.begin(), wordContinuesEndIt);
+  // Consume joins (not passed to TextBlock, but must be consumed to stay in sync)
+  std::list<Join> lineJoins;
+  lineJoins.splice(lineJoins.begin(), wordJoins, wordJoins.begin(), wordJoinsEndIt);
 
   for (auto& word : lineWords) {
     if (containsSoftHyphen(word)) {
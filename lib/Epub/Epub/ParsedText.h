@@ -14,24 +14,46 @@
 class GfxRenderer;
 
 class ParsedText {
+  // How a word joins the word before it
+  enum class Join : uint8_t {
+    SPACE,     // Separated by a space, the line may break there
+    ATTACHED,  // No space and no break (inline element boundary, non-breaking space)
+    ABUTTED,   // No space, but the line may break there (between CJK characters, pieces of a long run)
+  };
+
   std::list<std::string> words;
   std::list<EpdFontFamily::Style> wordStyles;
-  std::list<bool> wordContinues;  // true = word attaches to previous (no space before it)
+  std::list<Join> wordJoins;
+  std::vector<uint32_t> wordSourceOffsets;  // Byte offset of each word in the source document
   BlockStyle blockStyle;
   bool extraParagraphSpacing;
   bool hyphenationEnabled;
+  bool firstLineExtracted = false;  // Leading lines were laid out early, the words left continue the paragraph
+  uint32_t extractedLineSourceOffset = 0;
+
+  // List positions of one word. Lookups move it from wherever the previous one left it, so the line breakers stay
+  // linear in the paragraph length even though the words live in lists.
+  struct WordCursor {
+    size_t index = 0;
+    std::list<std::string>::iterator word;
+    std::list<EpdFontFamily::Style>::iterator style;
+    std::list<Join>::iterator join;
+  };
+  WordCursor wordCursor();
+  static void seek(WordCursor& cursor, size_t index);
 
   void applyParagraphIndent();
+  int firstLineIndent() const;
   std::vector<size_t> computeLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth, int spaceWidth,
-                                        std::vector<uint16_t>& wordWidths, std::vector<bool>& continuesVec);
+                                        std::vector<uint16_t>& wordWidths, std::vector<Join>& joins);
   std::vector<size_t> computeHyphenatedLineBreaks(const GfxRenderer& renderer, int fontId, int pageWidth,
                                                   int spaceWidth, std::vector<uint16_t>& wordWidths,
-                                                  std::vector<bool>& continuesVec);
-  bool hyphenateWordAtIndex(size_t wordIndex, int availableWidth, const GfxRenderer& renderer, int fontId,
-                            std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks,
-                            std::vector<bool>* continuesVec = nullptr);
+                                                  std::vector<Join>& joins);
+  bool hyphenateWordAtIndex(WordCursor& cursor, size_t wordIndex, int availableWidth, const GfxRenderer& renderer,
+                            int fontId, std::vector<uint16_t>& wordWidths, bool allowFallbackBreaks,
+                            std::vector<Join>* joins = nullptr);
   void extractLine(size_t breakIndex, int pageWidth, int spaceWidth, const std::vector<uint16_t>& wordWidths,
-                   const std::vector<bool>& continuesVec, const std::vector<size_t>& lineBreakIndices,
+                   const std::vector<Join>& joins, const std::vector<size_t>& lineBreakIndices,
                    const std::function<void(std::shared_ptr<TextBlock>)>& processLine);
   std::vector<uint16_t> calculateWordWidths(const GfxRenderer& renderer, int fontId);
 
@@ -41,12 +63,20 @@ class ParsedText {
       : blockStyle(blockStyle), extraParagraphSpacing(extraParagraphSpacing), hyphenationEnabled(hyphenationEnabled) {}
   ~ParsedText() = default;
 
-  void addWord(std::string word, EpdFontFamily::Style fontStyle, bool underline = false, bool attachToPrevious = false);
+  // attachToPrevious: no space and no line break before the word. abutPrevious: no space, but a line may break
+  // before the word. sourceOffset: where the word starts in the source document.
+  void addWord(std::string word, EpdFontFamily::Style fontStyle, bool underline = false, bool attachToPrevious = false,
+               bool abutPrevious = false, uint32_t sourceOffset = 0);
   void setBlockStyle(const BlockStyle& blockStyle) { this->blockStyle = blockStyle; }
   BlockStyle& getBlockStyle() { return blockStyle; }
   size_t size() const { return words.size(); }
   bool isEmpty() const { return words.empty(); }
+  // Lays out the buffered words and hands each line to processLine, consuming their words. The last heldBackLines
+  // lines are not emitted: their words stay buffered so more text can be added to the paragraph before they are
+  // laid out again.
   void layoutAndExtractLines(const GfxRenderer& renderer, int fontId, uint16_t viewportWidth,
                              const std::function<void(std::shared_ptr<TextBlock>)>& processLine,
-                             bool includeLastLine = true);
+                             uint16_t heldBackLines = 0);
+  // Source offset of the first word of the line last handed to processLine
+  uint32_t lastLineSourceOffset() const { return extractedLineSourceOffset; }
 };
\ No newline at end of file
@@ -1,18 +1,51 @@
 #include "Section.h"
 
+#include <Arduino.h>
+#include <HalSpiBus.h>
 #include <HalStorage.h>
 #include <Logging.h>
 #include <Serialization.h>
 
+#include <algorithm>
+#include <cstdio>
+
+#include "BookPageTable.h"
 #include "Page.h"
 #include "hyphenation/Hyphenator.h"
 #include "parsers/ChapterHtmlSlimParser.h"
 
 namespace {
-constexpr uint8_t SECTION_FILE_VERSION = 12;
+constexpr uint8_t SECTION_FILE_VERSION = 15;
 constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(int) + sizeof(float) + sizeof(bool) + sizeof(uint8_t) +
                                  sizeof(uint16_t) + sizeof(uint16_t) + sizeof(uint16_t) + sizeof(bool) + sizeof(bool) +
                                  sizeof(uint32_t);
+// LUT entry: page position in the file then the page's source offset
+constexpr uint32_t LUT_ENTRY_SIZE = sizeof(uint32_t) + sizeof(uint32_t);
+// Anchor table record: id hash then page
+constexpr uint32_t ANCHOR_RECORD_SIZE = sizeof(uint32_t) + sizeof(uint16_t);
+
+struct LutEntry {
+  uint32_t position;
+  uint32_t sourceOffset;
+};
+
+// Most recently used layout hashes of a book, newest first: a count then the hashes
+constexpr char LAYOUT_INDEX_FILE[] = "/layouts.bin";
+
+template <typename T>
+void hashPod(uint32_t& hash, const T& value) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+  for (size_t i = 0; i < sizeof(T); i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+}
+
+std::string layoutDirName(const uint32_t layoutHash) {
+  char name[9];
+  snprintf(name, sizeof(name), "%08x", static_cast<unsigned>(layoutHash));
+  return name;
+}
 }  // namespace
 
 uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
@@ -35,6 +68,68 @@ uint32_t Section::onPageComplete(std::unique_ptr<Page> page) {
   return position;
 }
 
+void Section::selectLayout(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
+                           const uint8_t paragraphAlignment, const uint16_t viewportWidth,
+                           const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
+  // Every header parameter goes into the hash, so each layout gets a directory of its own
+  uint32_t hash = 2166136261u;
+  hashPod(hash, fontId);
+  hashPod(hash, lineCompression);
+  hashPod(hash, extraParagraphSpacing);
+  hashPod(hash, paragraphAlignment);
+  hashPod(hash, viewportWidth);
+  hashPod(hash, viewportHeight);
+  hashPod(hash, hyphenationEnabled);
+  hashPod(hash, embeddedStyle);
+  layoutHash = hash;
+  filePath = getLayoutCachePath() + "/" + std::to_string(spineIndex) + ".bin";
+}
+
+std::string Section::getLayoutCachePath() const { return sectionsDir + "/" + layoutDirName(layoutHash); }
+
+void Section::markLayoutUsed() const {
+  const std::string indexPath = sectionsDir + LAYOUT_INDEX_FILE;
+  uint32_t layouts[MAX_CACHED_LAYOUTS + 1];
+  uint8_t count = 0;
+
+  FsFile indexFile;
+  if (Storage.exists(indexPath.c_str()) && Storage.openFileForRead("SCT", indexPath, indexFile)) {
+    serialization::readPod(indexFile, count);
+    count = std::min<uint8_t>(count, MAX_CACHED_LAYOUTS);
+    for (uint8_t i = 0; i < count; i++) {
+      serialization::readPod(indexFile, layouts[i]);
+    }
+    indexFile.close();
+  }
+  if (count > 0 && layouts[0] == layoutHash) {
+    return;  // Already the most recent, nothing to write
+  }
+
+  // Move this layout to the front, then drop the least recently used one if that makes too many
+  uint8_t position = 0;
+  while (position < count && layouts[position] != layoutHash) position++;
+  if (position == count) count++;
+  for (uint8_t i = position; i > 0; i--) {
+    layouts[i] = layouts[i - 1];
+  }
+  layouts[0] = layoutHash;
+  if (count > MAX_CACHED_LAYOUTS) {
+    count = MAX_CACHED_LAYOUTS;
+    const std::string evictedDir = sectionsDir + "/" + layoutDirName(layouts[count]);
+    LOG_DBG("SCT", "Evicting sections of layout %s", evictedDir.c_str());
+    Storage.removeDir(evictedDir.c_str());
+  }
+
+  if (!Storage.openFileForWrite("SCT", indexPath, indexFile)) {
+    return;
+  }
+  serialization::writePod(indexFile, count);
+  for (uint8_t i = 0; i < count; i++) {
+    serialization::writePod(indexFile, layouts[i]);
+  }
+  indexFile.close();
+}
+
 void Section::writeSectionFileHeader(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                      const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                      const uint16_t viewportHeight, const bool hyphenationEnabled,
@@ -64,7 +159,9 @@ void Section::writeSectionFileHeader(const int fontId, const float lineCompressi
 bool Section::loadSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                               const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                               const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle) {
-  if (!Storage.openFileForRead("SCT", filePath, file)) {
+  selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+               hyphenationEnabled, embeddedStyle);
+  if (!Storage.exists(filePath.c_str()) || !Storage.openFileForRead("SCT", filePath, file)) {
     return false;
   }
 
@@ -108,6 +205,7 @@ bool Section::loadSectionFile(const int fontId, const float lineCompression, con
 
   serialization::readPod(file, pageCount);
   file.close();
+  markLayoutUsed();
   LOG_DBG("SCT", "Deserialization succeeded: %d pages", pageCount);
   return true;
 }
@@ -131,16 +229,31 @@ bool Section::clearCache() const {
 bool Section::createSectionFile(const int fontId, const float lineCompression, const bool extraParagraphSpacing,
                                 const uint8_t paragraphAlignment, const uint16_t viewportWidth,
                                 const uint16_t viewportHeight, const bool hyphenationEnabled, const bool embeddedStyle,
-                                const std::function<void()>& popupFn, const EpubProcessingProfile& profile) {
+                                const std::function<void()>& popupFn, const EpubProcessingProfile& profile,
+                                const std::function<bool()>& shouldStop) {
+  stopped = false;
   processingProfile = profile;
+  const auto& heap = EpubProcessingProfile::heapHooks;
+  if (processingProfile.adaptToHeap && heap.freeHeap && heap.largestFreeBlock) {
+    const size_t freeHeap = heap.freeHeap();
+    const size_t largestFreeBlock = heap.largestFreeBlock();
+    processingProfile = profile.fittedToHeap(freeHeap, largestFreeBlock);
+    LOG_DBG("SCT", "Heap %u (largest block %u): %u byte chunks, %u word layout window, %u lookahead lines",
+            static_cast<unsigned>(freeHeap), static_cast<unsigned>(largestFreeBlock),
+            static_cast<unsigned>(processingProfile.htmlParseChunkSize), processingProfile.layoutWindowWords,
+            processingProfile.layoutLookaheadLines);
+  }
+  selectLayout(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth, viewportHeight,
+               hyphenationEnabled, embeddedStyle);
   const auto localPath = epub->getSpineItem(spineIndex).href;
   const auto tmpHtmlPath = epub->getCachePath() + "/.tmp_" + std::to_string(spineIndex) + ".html";
 
-  // Create cache directory if it doesn't exist
-  {
-    const auto sectionsDir = epub->getCachePath() + "/sections";
-    Storage.mkdir(sectionsDir.c_str());
+  // Create the layout's cache directory if it doesn't exist. Without a layout index the directory predates
+  // per-layout sections, so whatever is in there is stale.
+  if (!Storage.exists((sectionsDir + LAYOUT_INDEX_FILE).c_str()) && Storage.exists(sectionsDir.c_str())) {
+    Storage.removeDir(sectionsDir.c_str());
   }
+  Storage.mkdir(getLayoutCachePath().c_str());
 
   // Retry logic for SD card timing issues
   bool success = false;
@@ -178,24 +291,42 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
 
   LOG_DBG("SCT", "Streamed temp HTML to %s (%d bytes)", tmpHtmlPath.c_str(), fileSize);
 
+  if (shouldStop && shouldStop()) {
+    Storage.remove(tmpHtmlPath.c_str());
+    stopped = true;
+    return false;
+  }
+
   if (!Storage.openFileForWrite("SCT", filePath, file)) {
     return false;
   }
   writeSectionFileHeader(fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
                          viewportHeight, hyphenationEnabled, embeddedStyle);
-  std::vector<uint32_t> lut = {};
+  std::vector<LutEntry> lut = {};
 
   ChapterHtmlSlimParser visitor(
       tmpHtmlPath, renderer, fontId, lineCompression, extraParagraphSpacing, paragraphAlignment, viewportWidth,
       viewportHeight, hyphenationEnabled,
-      [this, &lut](std::unique_ptr<Page> page) { lut.emplace_back(this->onPageComplete(std::move(page))); },
-      embeddedStyle, popupFn, embeddedStyle ? epub->getCssParser() : nullptr, processingProfile);
+      [this, &lut](std::unique_ptr<Page> page) {
+        // Source offsets never go backwards, so findPageForSourceOffset can binary search them (a page without
+        // lines takes its predecessor's)
+        const uint32_t sourceOffset = lut.empty() ? page->sourceOffset
+                                                  : std::max(page->sourceOffset, lut.back().sourceOffset);
+        lut.push_back({this->onPageComplete(std::move(page)), sourceOffset});
+      },
+      embeddedStyle, popupFn, embeddedStyle ? epub->getCssParser() : nullptr, processingProfile, shouldStop);
   Hyphenator::setPreferredLanguage(epub->getLanguage());
   success = visitor.parseAndBuildPages();
+  Hyphenator::releaseLanguage();
 
   Storage.remove(tmpHtmlPath.c_str());
   if (!success) {
-    LOG_ERR("SCT", "Failed to parse XML and build pages");
+    stopped = visitor.wasStopped();
+    if (stopped) {
+      LOG_DBG("SCT", "Stopped building section %d", spineIndex);
+    } else {
+      LOG_ERR("SCT", "Failed to parse XML and build pages");
+    }
     file.close();
     Storage.remove(filePath.c_str());
     return false;
@@ -204,12 +335,13 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
   const uint32_t lutOffset = file.position();
   bool hasFailedLutRecords = false;
   // Write LUT
-  for (const uint32_t& pos : lut) {
-    if (pos == 0) {
+  for (const LutEntry& entry : lut) {
+    if (entry.position == 0) {
       hasFailedLutRecords = true;
       break;
     }
-    serialization::writePod(file, pos);
+    serialization::writePod(file, entry.position);
+    serialization::writePod(file, entry.sourceOffset);
   }
 
   if (hasFailedLutRecords) {
@@ -219,15 +351,46 @@ bool Section::createSectionFile(const int fontId, const float lineCompression, c
     return false;
   }
 
+  // Anchor table follows the LUT: a count, then records sorted by id hash so a lookup is a binary search.
+  // The first occurrence of a repeated id wins, as it does for a browser.
+  std::vector<ChapterHtmlSlimParser::Anchor> anchors = visitor.getAnchors();
+  std::stable_sort(anchors.begin(), anchors.end(),
+                   [](const ChapterHtmlSlimParser::Anchor& a, const ChapterHtmlSlimParser::Anchor& b) {
+                     return a.idHash < b.idHash;
+                   });
+  anchors.erase(std::unique(anchors.begin(), anchors.end(),
+                            [](const ChapterHtmlSlimParser::Anchor& a, const ChapterHtmlSlimParser::Anchor& b) {
+                              return a.idHash == b.idHash;
+                            }),
+                anchors.end());
+  if (anchors.size() > UINT16_MAX) {
+    anchors.resize(UINT16_MAX);
+  }
+  serialization::writePod(file, static_cast<uint16_t>(anchors.size()));
+  for (const auto& anchor : anchors) {
+    serialization::writePod(file, anchor.idHash);
+    serialization::writePod(file, anchor.page);
+  }
+  LOG_DBG("SCT", "Indexed %u anchors", static_cast<unsigned>(anchors.size()));
+
   // Go back and write LUT offset
   file.seek(HEADER_SIZE - sizeof(uint32_t) - sizeof(pageCount));
   serialization::writePod(file, pageCount);
   serialization::writePod(file, lutOffset);
   file.close();
+  markLayoutUsed();
+
+  // The book's page table may have counted this item from an earlier build of the section
+  BookPageTable pageTable(getLayoutCachePath());
+  if (pageTable.load(static_cast<uint16_t>(epub->getSpineItemsCount()))) {
+    pageTable.verify(spineIndex, pageCount);
+  }
   return true;
 }
 
 std::unique_ptr<Page> Section::loadPageFromSectionFile() {
+  // Read while the page before is refreshed, whose refresh takes the bus back when the panel is done
+  HalSpiBus::Lock bus;
   if (!Storage.openFileForRead("SCT", filePath, file)) {
     return nullptr;
   }
@@ -235,12 +398,90 @@ std::unique_ptr<Page> Section::loadPageFromSectionFile() {
   file.seek(HEADER_SIZE - sizeof(uint32_t));
   uint32_t lutOffset;
   serialization::readPod(file, lutOffset);
-  file.seek(lutOffset + sizeof(uint32_t) * currentPage);
+  file.seek(lutOffset + LUT_ENTRY_SIZE * currentPage);
   uint32_t pagePos;
   serialization::readPod(file, pagePos);
+  serialization::readPod(file, currentPageSourceOffset);
   file.seek(pagePos);
 
   auto page = Page::deserialize(file);
   file.close();
   return page;
 }
+
+int Section::findPageForAnchor(const std::string& anchor) {
+  if (anchor.empty() || pageCount == 0) {
+    return -1;
+  }
+  if (!Storage.openFileForRead("SCT", filePath, file)) {
+    return -1;
+  }
+
+  file.seek(HEADER_SIZE - sizeof(uint32_t));
+  uint32_t lutOffset;
+  serialization::readPod(file, lutOffset);
+  const uint32_t tableOffset = lutOffset + LUT_ENTRY_SIZE * pageCount;
+  file.seek(tableOffset);
+  uint16_t anchorCount = 0;
+  serialization::readPod(file, anchorCount);
+
+  const uint32_t targetHash = ChapterHtmlSlimParser::hashAnchor(anchor.c_str());
+  const uint32_t recordsOffset = tableOffset + sizeof(anchorCount);
+  int lo = 0;
+  int hi = static_cast<int>(anchorCount) - 1;
+  int page = -1;
+  while (lo <= hi) {
+    const int mid = lo + (hi - lo) / 2;
+    file.seek(recordsOffset + ANCHOR_RECORD_SIZE * mid);
+    uint32_t idHash;
+    serialization::readPod(file, idHash);
+    if (idHash < targetHash) {
+      lo = mid + 1;
+    } else if (idHash > targetHash) {
+      hi = mid - 1;
+    } else {
+      uint16_t anchorPage;
+      serialization::readPod(file, anchorPage);
+      page = anchorPage < pageCount ? anchorPage : pageCount - 1;
+      break;
+    }
+  }
+  file.close();
+
+  if (page < 0) {
+    LOG_DBG("SCT", "Anchor #%s not found", anchor.c_str());
+  }
+  return page;
+}
+
+int Section::findPageForSourceOffset(const uint32_t sourceOffset) {
+  if (pageCount == 0) {
+    return -1;
+  }
+  if (!Storage.openFileForRead("SCT", filePath, file)) {
+    return -1;
+  }
+
+  file.seek(HEADER_SIZE - sizeof(uint32_t));
+  uint32_t lutOffset;
+  serialization::readPod(file, lutOffset);
+
+  // Last page starting at or before the offset
+  int lo = 0;
+  int hi = pageCount - 1;
+  int page = 0;
+  while (lo <= hi) {
+    const int mid = lo + (hi - lo) / 2;
+    file.seek(lutOffset + LUT_ENTRY_SIZE * mid + sizeof(uint32_t));
+    uint32_t pageSourceOffset;
+    serialization::readPod(file, pageSourceOffset);
+    if (pageSourceOffset <= sourceOffset) {
+      page = mid;
+      lo = mid + 1;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  file.close();
+  return page;
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <functional>
 #include <memory>
 
@@ -12,24 +13,33 @@ class Section {
   std::shared_ptr<Epub> epub;
   const int spineIndex;
   GfxRenderer& renderer;
-  std::string filePath;
+  std::string sectionsDir;
+  std::string filePath;  // In the directory of the layout passed to loadSectionFile / createSectionFile
+  uint32_t layoutHash = 0;
   FsFile file;
   EpubProcessingProfile processingProfile = EpubProcessingProfile::optimized();
+  bool stopped = false;
 
   void writeSectionFileHeader(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                               uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled,
                               bool embeddedStyle);
   uint32_t onPageComplete(std::unique_ptr<Page> page);
+  void markLayoutUsed() const;
 
  public:
+  // A position that is not tied to a page, e.g. from an older progress file
+  static constexpr uint32_t UNKNOWN_SOURCE_OFFSET = UINT32_MAX;
+
   uint16_t pageCount = 0;
   int currentPage = 0;
+  // Byte offset in the chapter's XHTML where the page last loaded starts; unlike the page it survives a re-layout
+  uint32_t currentPageSourceOffset = UNKNOWN_SOURCE_OFFSET;
+
+  // Layouts whose sections are kept per book; switching back to one of them needs no re-pagination
+  static constexpr uint8_t MAX_CACHED_LAYOUTS = 3;
 
   explicit Section(const std::shared_ptr<Epub>& epub, const int spineIndex, GfxRenderer& renderer)
-      : epub(epub),
-        spineIndex(spineIndex),
-        renderer(renderer),
-        filePath(epub->getCachePath() + "/sections/" + std::to_string(spineIndex) + ".bin") {}
+      : epub(epub), spineIndex(spineIndex), renderer(renderer), sectionsDir(epub->getCachePath() + "/sections") {}
   ~Section() = default;
   bool loadSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                        uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
@@ -37,6 +47,18 @@ class Section {
   bool createSectionFile(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
                          uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle,
                          const std::function<void()>& popupFn = nullptr,
-                         const EpubProcessingProfile& profile = EpubProcessingProfile::optimized());
+                         const EpubProcessingProfile& profile = EpubProcessingProfile::optimized(),
+                         const std::function<bool()>& shouldStop = nullptr);
+  // True if the last createSectionFile gave up because shouldStop asked it to; nothing of it is left on the SD card
+  bool wasStopped() const { return stopped; }
+  // Points the section at the cache of a layout without reading anything; load/createSectionFile do this themselves
+  void selectLayout(int fontId, float lineCompression, bool extraParagraphSpacing, uint8_t paragraphAlignment,
+                    uint16_t viewportWidth, uint16_t viewportHeight, bool hyphenationEnabled, bool embeddedStyle);
+  // Directory holding the sections of the selected layout, shared by every spine item laid out the same way
+  std::string getLayoutCachePath() const;
   std::unique_ptr<Page> loadPageFromSectionFile();
+  // Page an element id (without '#') landed on, -1 if the section has no such id
+  int findPageForAnchor(const std::string& anchor);
+  // Page holding the given byte offset of the chapter's XHTML, -1 if the section has no pages
+  int findPageForSourceOffset(uint32_t sourceOffset);
 };
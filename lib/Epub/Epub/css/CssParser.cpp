@@ -4,139 +4,37 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 
 namespace {
 
 // Buffer size for reading CSS files
 constexpr size_t READ_BUFFER_SIZE = 512;
 
-// Maximum CSS file size we'll process (prevent memory issues)
-constexpr size_t MAX_CSS_SIZE = 64 * 1024;
+// Longest selector group and declaration block we keep; longer rules are dropped rather than buffered
+constexpr size_t MAX_SELECTOR_LENGTH = 1024;
+constexpr size_t MAX_DECLARATIONS_LENGTH = 4096;
 
 // Check if character is CSS whitespace
 bool isCssWhitespace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f'; }
 
-// Read entire file into string (with size limit)
-std::string readFileContent(FsFile& file) {
-  std::string content;
-  content.reserve(std::min(static_cast<size_t>(file.size()), MAX_CSS_SIZE));
+char toLowerAscii(const char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
 
-  char buffer[READ_BUFFER_SIZE];
-  while (file.available() && content.size() < MAX_CSS_SIZE) {
-    const int bytesRead = file.read(buffer, sizeof(buffer));
-    if (bytesRead <= 0) break;
-    content.append(buffer, bytesRead);
-  }
-  return content;
-}
-
-// Remove CSS comments (/* ... */) from content
-std::string stripComments(const std::string& css) {
-  std::string result;
-  result.reserve(css.size());
-
-  size_t pos = 0;
-  while (pos < css.size()) {
-    // Look for start of comment
-    if (pos + 1 < css.size() && css[pos] == '/' && css[pos + 1] == '*') {
-      // Find end of comment
-      const size_t endPos = css.find("*/", pos + 2);
-      if (endPos == std::string::npos) {
-        // Unterminated comment - skip rest of file
-        break;
-      }
-      pos = endPos + 2;
-    } else {
-      result.push_back(css[pos]);
-      ++pos;
-    }
-  }
-  return result;
+// Characters allowed in the tag and class names we index (identifiers, plus any non-ASCII byte)
+bool isNameChar(const char c) {
+  return std::isalnum(static_cast<unsigned char>(c)) || c == '-' || c == '_' || static_cast<unsigned char>(c) >= 0x80;
 }
 
-// Skip @-rules (like @media, @import, @font-face)
-// Returns position after the @-rule
-size_t skipAtRule(const std::string& css, const size_t start) {
-  // Find the end - either semicolon (simple @-rule) or matching brace
-  size_t pos = start + 1;  // Skip the '@'
-
-  // Skip identifier
-  while (pos < css.size() && (std::isalnum(css[pos]) || css[pos] == '-')) {
-    ++pos;
-  }
-
-  // Look for { or ;
-  int braceDepth = 0;
-  while (pos < css.size()) {
-    const char c = css[pos];
-    if (c == '{') {
-      ++braceDepth;
-    } else if (c == '}') {
-      --braceDepth;
-      if (braceDepth == 0) {
-        return pos + 1;
-      }
-    } else if (c == ';' && braceDepth == 0) {
-      return pos + 1;
-    }
-    ++pos;
-  }
-  return css.size();
-}
-
-// Extract next rule from CSS content
-// Returns true if a rule was found, with selector and body filled
-bool extractNextRule(const std::string& css, size_t& pos, std::string& selector, std::string& body) {
-  selector.clear();
-  body.clear();
-
-  // Skip whitespace and @-rules until we find a regular rule
-  while (pos < css.size()) {
-    // Skip whitespace
-    while (pos < css.size() && isCssWhitespace(css[pos])) {
-      ++pos;
-    }
-
-    if (pos >= css.size()) return false;
-
-    // Handle @-rules iteratively (avoids recursion/stack overflow)
-    if (css[pos] == '@') {
-      pos = skipAtRule(css, pos);
-      continue;  // Try again after skipping the @-rule
-    }
-
-    break;  // Found start of a regular rule
-  }
-
-  if (pos >= css.size()) return false;
-
-  // Find opening brace
-  const size_t bracePos = css.find('{', pos);
-  if (bracePos == std::string::npos) return false;
-
-  // Extract selector (everything before the brace)
-  selector = css.substr(pos, bracePos - pos);
-
-  // Find matching closing brace
-  int depth = 1;
-  const size_t bodyStart = bracePos + 1;
-  size_t bodyEnd = bodyStart;
+bool isSimpleName(const std::string& s) { return std::all_of(s.begin(), s.end(), isNameChar); }
 
-  while (bodyEnd < css.size() && depth > 0) {
-    if (css[bodyEnd] == '{')
-      ++depth;
-    else if (css[bodyEnd] == '}')
-      --depth;
-    ++bodyEnd;
+// FNV-1a over the raw bytes, for the inline style memo
+uint32_t hashBytes(const char* s) {
+  uint32_t hash = 2166136261u;
+  for (; *s; ++s) {
+    hash ^= static_cast<uint8_t>(*s);
+    hash *= 16777619u;
   }
-
-  // Extract body (between braces)
-  if (bodyEnd > bodyStart) {
-    body = css.substr(bodyStart, bodyEnd - bodyStart - 1);
-  }
-
-  pos = bodyEnd;
-  return true;
+  return hash;
 }
 
 }  // anonymous namespace
@@ -419,6 +317,307 @@ CssStyle CssParser::parseDeclarations(const std::string& declBlock) {
   return style;
 }
 
+// Name and rule tables
+
+uint32_t CssParser::hashName(const char* s, const size_t len) {
+  // FNV-1a over the lower-cased bytes, so lookups are case-insensitive without copying
+  uint32_t hash = 2166136261u;
+  for (size_t i = 0; i < len; ++i) {
+    hash ^= static_cast<uint8_t>(toLowerAscii(s[i]));
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+uint16_t CssParser::findName(const char* s, const size_t len) const {
+  if (nameSlots_.empty() || len == 0) return 0;
+
+  const size_t mask = nameSlots_.size() - 1;
+  for (size_t i = hashName(s, len) & mask;; i = (i + 1) & mask) {
+    const uint16_t id = nameSlots_[i];
+    if (id == 0) return 0;
+
+    const std::string& name = names_[id];
+    if (name.size() != len) continue;
+    size_t j = 0;
+    while (j < len && name[j] == toLowerAscii(s[j])) ++j;
+    if (j == len) return id;
+  }
+}
+
+uint16_t CssParser::internName(const std::string& name) {
+  if (const uint16_t existing = findName(name.data(), name.size())) return existing;
+  if (names_.size() >= UINT16_MAX) return 0;
+  if (names_.empty()) names_.emplace_back();  // Reserve id 0
+
+  // Keep the table at most half full so probe sequences stay short
+  if (names_.size() * 2 >= nameSlots_.size()) {
+    nameSlots_.assign(std::max<size_t>(32, nameSlots_.size() * 2), 0);
+    const size_t mask = nameSlots_.size() - 1;
+    for (size_t id = 1; id < names_.size(); ++id) {
+      size_t i = hashName(names_[id].data(), names_[id].size()) & mask;
+      while (nameSlots_[i] != 0) i = (i + 1) & mask;
+      nameSlots_[i] = static_cast<uint16_t>(id);
+    }
+  }
+
+  const auto id = static_cast<uint16_t>(names_.size());
+  names_.push_back(name);
+  const size_t mask = nameSlots_.size() - 1;
+  size_t i = hashName(name.data(), name.size()) & mask;
+  while (nameSlots_[i] != 0) i = (i + 1) & mask;
+  nameSlots_[i] = id;
+  return id;
+}
+
+const CssParser::RuleSlot* CssParser::findSlot(const std::vector<RuleSlot>& slots, const uint32_t key) {
+  if (slots.empty()) return nullptr;
+
+  const size_t mask = slots.size() - 1;
+  for (size_t i = (key * 2654435761u) & mask;; i = (i + 1) & mask) {
+    if (slots[i].key == key) return &slots[i];
+    if (slots[i].key == 0) return nullptr;
+  }
+}
+
+CssParser::RuleSlot& CssParser::insertSlot(std::vector<RuleSlot>& slots, const size_t used, const uint32_t key) {
+  if ((used + 1) * 2 > slots.size()) {
+    std::vector<RuleSlot> old(std::max<size_t>(32, slots.size() * 2));
+    slots.swap(old);
+    const size_t mask = slots.size() - 1;
+    for (const auto& slot : old) {
+      if (slot.key == 0) continue;
+      size_t i = (slot.key * 2654435761u) & mask;
+      while (slots[i].key != 0) i = (i + 1) & mask;
+      slots[i] = slot;
+    }
+  }
+
+  const size_t mask = slots.size() - 1;
+  size_t i = (key * 2654435761u) & mask;
+  while (slots[i].key != 0) i = (i + 1) & mask;
+  slots[i].key = key;
+  return slots[i];
+}
+
+void CssParser::addToBloom(uint64_t bloom[2], const uint16_t nameId, const bool isClass) {
+  // Two bits out of 128 per name; tags and classes share the id space, so the kind is part of the key
+  const uint32_t hash = ((static_cast<uint32_t>(nameId) << 1) | (isClass ? 1 : 0)) * 2654435761u;
+  const uint32_t a = hash >> 25;
+  const uint32_t b = (hash >> 18) & 127;
+  bloom[a >> 6] |= uint64_t{1} << (a & 63);
+  bloom[b >> 6] |= uint64_t{1} << (b & 63);
+}
+
+const CssStyle* CssParser::findRule(const uint32_t key) const {
+  const RuleSlot* slot = findSlot(ruleSlots_, key);
+  return slot ? &styles_[slot->index] : nullptr;
+}
+
+void CssParser::addRule(const uint32_t key, const CssStyle& style) {
+  const CssStyle* existing = findRule(key);
+  if (existing) {
+    styles_[existing - styles_.data()].applyOver(style);
+    return;
+  }
+  if (styles_.size() >= UINT16_MAX) return;
+
+  insertSlot(ruleSlots_, styles_.size() - combinatorRules_.size(), key).index =
+      static_cast<uint16_t>(styles_.size());
+  styles_.push_back(style);
+  styleKeys_.push_back(key);
+}
+
+bool CssParser::parseCompound(const std::string& compound, uint16_t& tagId, uint16_t& classId) {
+  // Only "tag", ".class" and "tag.class" are indexed, everything else is dropped
+  const size_t dotPos = compound.find('.');
+  const std::string tag = compound.substr(0, dotPos);
+  const std::string cls = dotPos == std::string::npos ? std::string() : compound.substr(dotPos + 1);
+  if ((tag.empty() && cls.empty()) || (dotPos != std::string::npos && cls.empty()) || !isSimpleName(tag) ||
+      !isSimpleName(cls)) {
+    return false;
+  }
+
+  tagId = tag.empty() ? 0 : internName(tag);
+  classId = cls.empty() ? 0 : internName(cls);
+  return (tag.empty() || tagId != 0) && (cls.empty() || classId != 0);
+}
+
+bool CssParser::addSelector(const std::string& selector, const CssStyle& style) {
+  // Split into compounds and combinators; the selector is already normalized to single spaces
+  std::vector<std::string> compounds;
+  std::vector<bool> childBefore;  // Combinator in front of each compound
+  std::string current;
+  bool sawChild = false;
+  for (const char c : selector) {
+    if (c == ' ' || c == '>') {
+      if (!current.empty()) {
+        compounds.push_back(current);
+        current.clear();
+      }
+      if (c == '>') {
+        if (compounds.empty() || sawChild) return false;
+        sawChild = true;
+      }
+      continue;
+    }
+    if (current.empty() && !compounds.empty()) {
+      childBefore.push_back(sawChild);
+      sawChild = false;
+    }
+    if (compounds.empty() && current.empty()) childBefore.push_back(false);
+    current.push_back(c);
+  }
+  if (sawChild) return false;
+  if (!current.empty()) compounds.push_back(current);
+  if (compounds.empty() || compounds.size() > MAX_SELECTOR_STEPS + 1) return false;
+
+  uint16_t tagId = 0;
+  uint16_t classId = 0;
+  if (!parseCompound(compounds.back(), tagId, classId)) return false;
+  const uint32_t subjectKey = ruleKey(tagId, classId);
+
+  if (compounds.size() == 1) {
+    addRule(subjectKey, style);
+    return true;
+  }
+
+  if (combinatorRules_.size() >= MAX_COMBINATOR_RULES || styles_.size() >= UINT16_MAX ||
+      steps_.size() + compounds.size() > UINT16_MAX) {
+    return false;
+  }
+
+  CombinatorRule rule;
+  rule.subjectKey = subjectKey;
+  rule.firstStep = static_cast<uint16_t>(steps_.size());
+  rule.specificity = (classId ? 0x100 : 0) + (tagId ? 1 : 0);
+
+  // Ancestor compounds are stored nearest first, which is the order they are matched in
+  for (size_t i = compounds.size() - 1; i-- > 0;) {
+    SelectorStep step;
+    if (!parseCompound(compounds[i], step.tagId, step.classId)) {
+      steps_.resize(rule.firstStep);
+      return false;
+    }
+    step.child = childBefore[i + 1];
+    rule.specificity += (step.classId ? 0x100 : 0) + (step.tagId ? 1 : 0);
+    steps_.push_back(step);
+  }
+  rule.stepCount = static_cast<uint16_t>(steps_.size() - rule.firstStep);
+
+  ancestorNames_.resize(names_.size(), 0);
+  for (size_t i = rule.firstStep; i < steps_.size(); ++i) {
+    const SelectorStep& step = steps_[i];
+    if (step.tagId) {
+      ancestorNames_[step.tagId] = 1;
+      addToBloom(rule.bloom, step.tagId, false);
+    }
+    if (step.classId) {
+      ancestorNames_[step.classId] = 1;
+      addToBloom(rule.bloom, step.classId, true);
+    }
+  }
+
+  // Chain onto the rules that share the subject key
+  const auto ruleIndex = static_cast<uint16_t>(combinatorRules_.size());
+  if (const RuleSlot* slot = findSlot(combinatorSlots_, subjectKey)) {
+    rule.next = slot->index;
+    combinatorSlots_[slot - combinatorSlots_.data()].index = ruleIndex;
+  } else {
+    insertSlot(combinatorSlots_, combinatorKeyCount_++, subjectKey).index = ruleIndex;
+  }
+
+  rule.styleIndex = static_cast<uint16_t>(styles_.size());
+  styles_.push_back(style);
+  styleKeys_.push_back(0);
+  combinatorRules_.push_back(rule);
+  return true;
+}
+
+bool CssParser::matchesAncestors(const CombinatorRule& rule, const AncestorStack& ancestors) const {
+  const auto& entries = ancestors.entries;
+  const auto matchesStep = [&ancestors](const SelectorStep& step, const AncestorStack::Entry& entry) {
+    if (step.tagId && step.tagId != entry.tagId) return false;
+    if (!step.classId) return true;
+    const uint16_t* classes = ancestors.classIds.data() + entry.firstClass;
+    return std::find(classes, classes + entry.classCount, step.classId) != classes + entry.classCount;
+  };
+
+  // Steps are split into runs: one step reached through a descendant combinator (or the subject's own combinator)
+  // followed by the child steps chained onto it. Taking the nearest ancestor where a whole run matches leaves the
+  // most room for the runs further left, so no backtracking across runs is needed.
+  int available = static_cast<int>(entries.size());  // Ancestors at indexes below this are still unused
+  const SelectorStep* steps = steps_.data() + rule.firstStep;
+  size_t first = 0;
+  while (first < rule.stepCount) {
+    size_t end = first + 1;
+    while (end < rule.stepCount && steps[end].child) ++end;
+    const int runLength = static_cast<int>(end - first);
+
+    bool matched = false;
+    for (int start = available - 1; start >= runLength - 1 && !matched; --start) {
+      matched = true;
+      for (int k = 0; k < runLength && matched; ++k) {
+        matched = matchesStep(steps[first + k], entries[start - k]);
+      }
+      if (matched) {
+        available = start - runLength + 1;
+      } else if (steps[first].child) {
+        break;  // A child combinator pins the run to the parent
+      }
+    }
+    if (!matched) return false;
+    first = end;
+  }
+  return true;
+}
+
+std::string CssParser::selectorForKey(const uint32_t key) const {
+  const uint16_t tagId = key >> 16;
+  const uint16_t classId = key & 0xFFFF;
+  std::string selector = tagId ? names_[tagId] : std::string();
+  if (classId) {
+    selector += '.';
+    selector += names_[classId];
+  }
+  return selector;
+}
+
+std::string CssParser::selectorForRule(const CombinatorRule& rule) const {
+  std::string selector;
+  for (size_t i = rule.stepCount; i-- > 0;) {
+    const SelectorStep& step = steps_[rule.firstStep + i];
+    selector += selectorForKey(ruleKey(step.tagId, step.classId));
+    selector += step.child ? " > " : " ";
+  }
+  return selector + selectorForKey(rule.subjectKey);
+}
+
+void CssParser::clear() {
+  names_.clear();
+  nameSlots_.clear();
+  ruleSlots_.clear();
+  styles_.clear();
+  styleKeys_.clear();
+  combinatorSlots_.clear();
+  combinatorRules_.clear();
+  steps_.clear();
+  ancestorNames_.clear();
+  combinatorKeyCount_ = 0;
+}
+
+void CssParser::AncestorStack::leave(const int depth) {
+  while (!entries.empty() && entries.back().depth >= depth) {
+    classIds.resize(entries.back().firstClass);
+    entries.pop_back();
+  }
+}
+
+void CssParser::AncestorStack::clear() {
+  entries.clear();
+  classIds.clear();
+}
+
 // Rule processing
 
 void CssParser::processRuleBlock(const std::string& selectorGroup, const std::string& declarations) {
@@ -431,17 +630,114 @@ void CssParser::processRuleBlock(const std::string& selectorGroup, const std::st
   const auto selectors = splitOnChar(selectorGroup, ',');
 
   for (const auto& sel : selectors) {
-    // Normalize the selector
-    std::string key = normalized(sel);
-    if (key.empty()) continue;
-
-    // Store or merge with existing
-    auto it = rulesBySelector_.find(key);
-    if (it != rulesBySelector_.end()) {
-      it->second.applyOver(style);
-    } else {
-      rulesBySelector_[key] = style;
+    // Selectors are already normalized by splitOnChar; store or merge with existing
+    addSelector(sel, style);
+  }
+}
+
+// Streaming tokenizer
+
+CssParser::StreamLoader::~StreamLoader() {
+  // A '/' held back at the very end was not a comment
+  if (pendingSlash && !inComment) {
+    pendingSlash = false;
+    consume('/');
+  }
+}
+
+size_t CssParser::StreamLoader::write(const uint8_t c) { return write(&c, 1); }
+
+size_t CssParser::StreamLoader::write(const uint8_t* buffer, const size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    const char c = static_cast<char>(buffer[i]);
+
+    // Strip comments first; the markers can be split across writes
+    if (inComment) {
+      if (commentStar && c == '/') {
+        inComment = false;
+      }
+      commentStar = c == '*';
+      continue;
+    }
+    if (pendingSlash) {
+      pendingSlash = false;
+      if (c == '*') {
+        inComment = true;
+        commentStar = false;
+        continue;
+      }
+      consume('/');
+    }
+    if (c == '/') {
+      pendingSlash = true;
+      continue;
     }
+    consume(c);
+  }
+  return size;
+}
+
+void CssParser::StreamLoader::append(std::string& token, const char c, const size_t limit) {
+  if (token.size() >= limit) {
+    overflow = true;
+    return;
+  }
+  token.push_back(c);
+}
+
+void CssParser::StreamLoader::consume(const char c) {
+  switch (state) {
+    case SELECTOR:
+      if (c == '@' && std::all_of(selector.begin(), selector.end(), isCssWhitespace)) {
+        // @import, @font-face, @media, ...: skipped entirely, including any nested rules
+        selector.clear();
+        state = AT_RULE;
+      } else if (c == '{') {
+        state = BODY;
+        depth = 1;
+      } else if (c == '}') {
+        // Stray closing brace, start over
+        selector.clear();
+        overflow = false;
+      } else {
+        append(selector, c, MAX_SELECTOR_LENGTH);
+      }
+      break;
+
+    case BODY:
+      if (c == '{') {
+        ++depth;
+      } else if (c == '}' && --depth == 0) {
+        if (!overflow) {
+          parser.processRuleBlock(selector, body);
+        } else {
+          LOG_DBG("CSS", "Dropping oversized rule");
+        }
+        selector.clear();
+        body.clear();
+        overflow = false;
+        state = SELECTOR;
+        break;
+      }
+      append(body, c, MAX_DECLARATIONS_LENGTH);
+      break;
+
+    case AT_RULE:
+      if (c == ';') {
+        state = SELECTOR;
+      } else if (c == '{') {
+        state = AT_BLOCK;
+        depth = 1;
+      }
+      break;
+
+    case AT_BLOCK:
+      if (c == '{') {
+        ++depth;
+      } else if (c == '}' && --depth == 0) {
+        state = SELECTOR;
+      }
+      break;
   }
 }
 
@@ -453,74 +749,162 @@ bool CssParser::loadFromStream(FsFile& source) {
     return false;
   }
 
-  // Read file content
-  const std::string content = readFileContent(source);
-  if (content.empty()) {
-    return true;  // Empty file is valid
-  }
-
-  // Remove comments
-  const std::string cleaned = stripComments(content);
-
-  // Parse rules
-  size_t pos = 0;
-  std::string selector, body;
-
-  while (extractNextRule(cleaned, pos, selector, body)) {
-    processRuleBlock(selector, body);
+  {
+    StreamLoader loader(*this);
+    uint8_t buffer[READ_BUFFER_SIZE];
+    while (source.available()) {
+      const int bytesRead = source.read(buffer, sizeof(buffer));
+      if (bytesRead <= 0) break;
+      loader.write(buffer, bytesRead);
+    }
   }
 
-  LOG_DBG("CSS", "Parsed %zu rules", rulesBySelector_.size());
+  LOG_DBG("CSS", "Parsed %zu rules", styles_.size());
   return true;
 }
 
 // Style resolution
 
 CssStyle CssParser::resolveStyle(const std::string& tagName, const std::string& classAttr) const {
+  return resolveStyle(tagName.c_str(), classAttr.c_str());
+}
+
+void CssParser::MatchedRules::add(const uint16_t specificity, const uint16_t styleIndex) {
+  // Past the cap later matches are dropped whatever their specificity, see MAX_MATCHED_RULES
+  if (count < MAX_MATCHED_RULES) {
+    matches[count++] = {(static_cast<uint32_t>(specificity) << 16) | styleIndex, styleIndex};
+  }
+}
+
+CssStyle CssParser::MatchedRules::resolve(const std::vector<CssStyle>& styles) {
+  // Few matches per element, insertion sort is cheapest
+  for (size_t i = 1; i < count; ++i) {
+    const Match m = matches[i];
+    size_t j = i;
+    for (; j > 0 && matches[j - 1].order > m.order; --j) matches[j] = matches[j - 1];
+    matches[j] = m;
+  }
+
   CssStyle result;
-  const std::string tag = normalized(tagName);
+  for (size_t i = 0; i < count; ++i) {
+    result.applyOver(styles[matches[i].styleIndex]);
+  }
+  return result;
+}
+
+CssStyle CssParser::resolveStyle(const char* tagName, const char* classAttr) const {
+  if (styles_.empty()) return {};
 
-  // 1. Apply element-level style (lowest priority)
-  const auto tagIt = rulesBySelector_.find(tag);
-  if (tagIt != rulesBySelector_.end()) {
-    result.applyOver(tagIt->second);
+  // Same cascade order as the combinator path: specificity, then source order (style index)
+  MatchedRules matched;
+  const auto considerKey = [&](const uint32_t key, const uint16_t specificity) {
+    if (const RuleSlot* slot = findSlot(ruleSlots_, key)) matched.add(specificity, slot->index);
+  };
+
+  const uint16_t tagId = findName(tagName, strlen(tagName));
+  if (tagId) considerKey(ruleKey(tagId, 0), 1);
+
+  // Walk the whitespace-separated class tokens in place
+  for (const char* p = classAttr ? classAttr : ""; *p;) {
+    while (*p && isCssWhitespace(*p)) ++p;
+    const char* start = p;
+    while (*p && !isCssWhitespace(*p)) ++p;
+    const uint16_t classId = p > start ? findName(start, p - start) : 0;
+    if (!classId) continue;
+
+    considerKey(ruleKey(0, classId), 0x100);
+    if (tagId) considerKey(ruleKey(tagId, classId), 0x101);
   }
 
-  // 2. Apply class styles (medium priority)
-  if (!classAttr.empty()) {
-    const auto classes = splitWhitespace(classAttr);
+  return matched.resolve(styles_);
+}
 
-    for (const auto& cls : classes) {
-      std::string classKey = "." + normalized(cls);
+CssStyle CssParser::resolveStyle(const char* tagName, const char* classAttr, AncestorStack& ancestors,
+                                 const int depth) const {
+  if (combinatorRules_.empty()) return resolveStyle(tagName, classAttr);
 
-      auto classIt = rulesBySelector_.find(classKey);
-      if (classIt != rulesBySelector_.end()) {
-        result.applyOver(classIt->second);
-      }
-    }
+  // Anything still open at this depth or deeper was left without a matching leave()
+  ancestors.leave(depth);
 
-    // 3. Apply element.class styles (higher priority)
-    for (const auto& cls : classes) {
-      std::string combinedKey = tag + "." + normalized(cls);
+  // Collect every matching rule, then apply in cascade order: specificity, then source order (style index)
+  MatchedRules matched;
 
-      auto combinedIt = rulesBySelector_.find(combinedKey);
-      if (combinedIt != rulesBySelector_.end()) {
-        result.applyOver(combinedIt->second);
-      }
+  AncestorStack::Entry entry;
+  entry.depth = depth;
+  if (!ancestors.entries.empty()) {
+    entry.bloom[0] = ancestors.entries.back().bloom[0];
+    entry.bloom[1] = ancestors.entries.back().bloom[1];
+  }
+  const uint64_t parentBloom[2] = {entry.bloom[0], entry.bloom[1]};
+
+  const auto considerKey = [&](const uint32_t key, const uint16_t specificity) {
+    if (const RuleSlot* slot = findSlot(ruleSlots_, key)) {
+      matched.add(specificity, slot->index);
+    }
+    const RuleSlot* slot = findSlot(combinatorSlots_, key);
+    for (uint16_t i = slot ? slot->index : UINT16_MAX; i != UINT16_MAX; i = combinatorRules_[i].next) {
+      const CombinatorRule& rule = combinatorRules_[i];
+      // Bloom check first: a rule naming an ancestor that is certainly absent needs no stack walk
+      if ((rule.bloom[0] & ~parentBloom[0]) || (rule.bloom[1] & ~parentBloom[1])) continue;
+      if (matchesAncestors(rule, ancestors)) matched.add(rule.specificity, rule.styleIndex);
+    }
+  };
+
+  const uint16_t tagId = findName(tagName, strlen(tagName));
+  if (tagId) {
+    considerKey(ruleKey(tagId, 0), 1);
+    if (isAncestorName(tagId)) {
+      entry.tagId = tagId;
+      addToBloom(entry.bloom, tagId, false);
     }
   }
 
-  return result;
+  entry.firstClass = static_cast<uint16_t>(ancestors.classIds.size());
+  for (const char* p = classAttr ? classAttr : ""; *p;) {
+    while (*p && isCssWhitespace(*p)) ++p;
+    const char* start = p;
+    while (*p && !isCssWhitespace(*p)) ++p;
+    const uint16_t classId = p > start ? findName(start, p - start) : 0;
+    if (!classId) continue;
+
+    considerKey(ruleKey(0, classId), 0x100);
+    if (tagId) considerKey(ruleKey(tagId, classId), 0x101);
+    if (isAncestorName(classId)) {
+      ancestors.classIds.push_back(classId);
+      addToBloom(entry.bloom, classId, true);
+    }
+  }
+  entry.classCount = static_cast<uint16_t>(ancestors.classIds.size() - entry.firstClass);
+  ancestors.entries.push_back(entry);
+
+  return matched.resolve(styles_);
 }
 
 // Inline style parsing (static - doesn't need rule database)
 
 CssStyle CssParser::parseInlineStyle(const std::string& styleValue) { return parseDeclarations(styleValue); }
 
+CssStyle CssParser::resolveInlineStyle(const char* styleValue) const {
+  const uint32_t hash = hashBytes(styleValue);
+  for (const auto& memo : inlineStyleMemo_) {
+    if (memo.hash == hash && memo.text == styleValue) {
+      return memo.style;
+    }
+  }
+
+  // Miss: parse and replace the oldest entry
+  InlineStyleMemo& memo = inlineStyleMemo_[inlineStyleMemoNext_];
+  inlineStyleMemoNext_ = (inlineStyleMemoNext_ + 1) % INLINE_STYLE_MEMO_SIZE;
+  memo.hash = hash;
+  memo.text = styleValue;
+  memo.style = parseDeclarations(memo.text);
+  return memo.style;
+}
+
 // Cache serialization
 
 // Cache format version - increment when format changes
-constexpr uint8_t CSS_CACHE_VERSION = 2;
+constexpr uint8_t CSS_CACHE_VERSION = 3;
 
 bool CssParser::saveToCache(FsFile& file) const {
   if (!file) {
@@ -531,18 +915,26 @@ bool CssParser::saveToCache(FsFile& file) const {
   file.write(CSS_CACHE_VERSION);
 
   // Write rule count
-  const auto ruleCount = static_cast<uint16_t>(rulesBySelector_.size());
+  const auto ruleCount = static_cast<uint16_t>(styles_.size());
   file.write(reinterpret_cast<const uint8_t*>(&ruleCount), sizeof(ruleCount));
 
-  // Write each rule: selector string + CssStyle fields
-  for (const auto& pair : rulesBySelector_) {
+  // Combinator rules have no rule key, find their selectors by style index
+  std::vector<uint16_t> ruleForStyle(styles_.size(), UINT16_MAX);
+  for (size_t i = 0; i < combinatorRules_.size(); ++i) {
+    ruleForStyle[combinatorRules_[i].styleIndex] = static_cast<uint16_t>(i);
+  }
+
+  // Write each rule in source order: selector string + CssStyle fields
+  for (size_t i = 0; i < styles_.size(); ++i) {
     // Write selector string (length-prefixed)
-    const auto selectorLen = static_cast<uint16_t>(pair.first.size());
+    const std::string selector = ruleForStyle[i] != UINT16_MAX ? selectorForRule(combinatorRules_[ruleForStyle[i]])
+                                                                : selectorForKey(styleKeys_[i]);
+    const auto selectorLen = static_cast<uint16_t>(selector.size());
     file.write(reinterpret_cast<const uint8_t*>(&selectorLen), sizeof(selectorLen));
-    file.write(reinterpret_cast<const uint8_t*>(pair.first.data()), selectorLen);
+    file.write(reinterpret_cast<const uint8_t*>(selector.data()), selectorLen);
 
     // Write CssStyle fields (all are POD types)
-    const CssStyle& style = pair.second;
+    const CssStyle& style = styles_[i];
     file.write(static_cast<uint8_t>(style.textAlign));
     file.write(static_cast<uint8_t>(style.fontStyle));
     file.write(static_cast<uint8_t>(style.fontWeight));
@@ -612,14 +1004,14 @@ bool CssParser::loadFromCache(FsFile& file) {
     // Read selector string
     uint16_t selectorLen = 0;
     if (file.read(&selectorLen, sizeof(selectorLen)) != sizeof(selectorLen)) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
 
     std::string selector;
     selector.resize(selectorLen);
     if (file.read(&selector[0], selectorLen) != selectorLen) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
 
@@ -628,25 +1020,25 @@ bool CssParser::loadFromCache(FsFile& file) {
     uint8_t enumVal;
 
     if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
     style.textAlign = static_cast<CssTextAlign>(enumVal);
 
     if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
     style.fontStyle = static_cast<CssFontStyle>(enumVal);
 
     if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
     style.fontWeight = static_cast<CssFontWeight>(enumVal);
 
     if (file.read(&enumVal, 1) != 1) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
     style.textDecoration = static_cast<CssTextDecoration>(enumVal);
@@ -667,14 +1059,14 @@ bool CssParser::loadFromCache(FsFile& file) {
     if (!readLength(style.textIndent) || !readLength(style.marginTop) || !readLength(style.marginBottom) ||
         !readLength(style.marginLeft) || !readLength(style.marginRight) || !readLength(style.paddingTop) ||
         !readLength(style.paddingBottom) || !readLength(style.paddingLeft) || !readLength(style.paddingRight)) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
 
     // Read defined flags
     uint16_t definedBits = 0;
     if (file.read(&definedBits, sizeof(definedBits)) != sizeof(definedBits)) {
-      rulesBySelector_.clear();
+      clear();
       return false;
     }
     style.defined.textAlign = (definedBits & 1 << 0) != 0;
@@ -691,7 +1083,7 @@ bool CssParser::loadFromCache(FsFile& file) {
     style.defined.paddingLeft = (definedBits & 1 << 11) != 0;
     style.defined.paddingRight = (definedBits & 1 << 12) != 0;
 
-    rulesBySelector_[selector] = style;
+    addSelector(selector, style);
   }
 
   LOG_DBG("CSS", "Loaded %u rules from cache", ruleCount);
@@ -1,9 +1,9 @@
 #pragma once
 
 #include <HalStorage.h>
+#include <Print.h>
 
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 #include "CssStyle.h"
@@ -12,23 +12,88 @@
  * Lightweight CSS parser for EPUB stylesheets
  *
  * Parses CSS files and extracts styling information relevant for e-ink display.
- * Uses a two-phase approach: first tokenizes the CSS content, then builds
- * a rule database that can be queried during HTML parsing.
+ * A streaming tokenizer (StreamLoader) splits the input into rules as the bytes
+ * arrive, and each rule is added to a database that can be queried during HTML
+ * parsing. Memory use is bounded by the longest rule, not the stylesheet size.
+ *
+ * Selector names are interned to small integer ids at parse time and rules live in an open-addressed
+ * (tag id, class id) table, so resolving an element's style is a few hash probes with no string building.
+ *
+ * Descendant and child selectors are indexed by their rightmost compound and matched right to left against an
+ * AncestorStack. Each ancestor entry carries a small bloom filter of the names above it, so most candidate rules
+ * are rejected without walking the stack; the cost per element stays proportional to the rules sharing its
+ * rightmost key.
  *
  * Supported selectors:
  *   - Element selectors: p, div, h1, etc.
  *   - Class selectors: .classname
  *   - Combined: element.classname
+ *   - Descendant and child combinators of the above: div.chapter p, blockquote > p
  *   - Grouped: selector1, selector2 { }
  *
  * Not supported (silently ignored):
- *   - Descendant/child selectors
+ *   - Sibling combinators, attribute, id and universal selectors
  *   - Pseudo-classes and pseudo-elements
  *   - Media queries (content is skipped)
  *   - @import, @font-face, etc.
  */
 class CssParser {
  public:
+  /**
+   * Print sink that tokenizes a stylesheet as it is written, e.g. straight from ZipFile while the entry is being
+   * inflated, with no temp file and no whole-file buffer. Comments are stripped, @-rules (including @media blocks)
+   * are skipped, and every complete rule is added to the parser as soon as its closing brace arrives. Rules longer
+   * than the token limits are dropped.
+   */
+  class StreamLoader final : public Print {
+    enum State : uint8_t { SELECTOR, BODY, AT_RULE, AT_BLOCK };
+
+    CssParser& parser;
+    std::string selector;
+    std::string body;
+    State state = SELECTOR;
+    int depth = 0;              // Brace depth inside a rule body or @-rule block
+    bool inComment = false;     // Inside /* ... */
+    bool pendingSlash = false;  // Saw '/' that may open a comment
+    bool commentStar = false;   // Saw '*' inside a comment that may close it
+    bool overflow = false;      // Current rule exceeded a token limit and will be dropped
+
+    void consume(char c);
+    void append(std::string& token, char c, size_t limit);
+
+   public:
+    explicit StreamLoader(CssParser& parser) : parser(parser) {}
+    ~StreamLoader() override;
+
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t* buffer, size_t size) override;
+  };
+
+  /**
+   * The open elements above the one being resolved, for descendant and child selectors. Keep one per document:
+   * resolveStyle() pushes every element it resolves, and the caller calls leave() as elements close. Storage is
+   * reused, so a whole chapter runs without heap allocations once the deepest nesting has been seen.
+   */
+  class AncestorStack {
+    friend class CssParser;
+
+    struct Entry {
+      int depth = 0;
+      uint16_t tagId = 0;       // 0 unless some selector names this tag as an ancestor
+      uint16_t firstClass = 0;  // Class ids named by ancestor selectors, in classIds
+      uint16_t classCount = 0;
+      uint64_t bloom[2] = {};  // Names of this element and everything above it
+    };
+
+    std::vector<Entry> entries;
+    std::vector<uint16_t> classIds;
+
+   public:
+    // Drop every element at or below the given depth
+    void leave(int depth);
+    void clear();
+  };
+
   CssParser() = default;
   ~CssParser() = default;
 
@@ -46,7 +111,8 @@ class CssParser {
 
   /**
    * Look up the style for an HTML element, considering tag name and class attributes.
-   * Applies CSS cascade: element style < class style < element.class style
+   * Applies CSS cascade: element style < class style < element.class style, rules of equal specificity in source
+   * order, the same as the combinator-aware overload below
    *
    * @param tagName The HTML element name (e.g., "p", "div")
    * @param classAttr The class attribute value (may contain multiple space-separated classes)
@@ -54,6 +120,25 @@ class CssParser {
    */
   [[nodiscard]] CssStyle resolveStyle(const std::string& tagName, const std::string& classAttr) const;
 
+  /**
+   * Same as above without any heap allocation: names are looked up in the interned name table straight from the
+   * attribute bytes. classAttr may be nullptr.
+   */
+  [[nodiscard]] CssStyle resolveStyle(const char* tagName, const char* classAttr) const;
+
+  /**
+   * Resolve an element at the given nesting depth, including descendant and child selectors matched against
+   * ancestors, then push the element onto ancestors. Rules are applied by specificity, then source order. Falls
+   * back to the plain lookup when the stylesheet has no combinator selectors.
+   */
+  [[nodiscard]] CssStyle resolveStyle(const char* tagName, const char* classAttr, AncestorStack& ancestors,
+                                      int depth) const;
+
+  /**
+   * True if any descendant or child selector was loaded
+   */
+  [[nodiscard]] bool hasCombinatorRules() const { return !combinatorRules_.empty(); }
+
   /**
    * Parse an inline style attribute string.
    * @param styleValue The value of a style="" attribute
@@ -61,20 +146,27 @@ class CssParser {
    */
   [[nodiscard]] static CssStyle parseInlineStyle(const std::string& styleValue);
 
+  /**
+   * Parse an inline style attribute, memoized. Conversion tools repeat the same few style="" values thousands of
+   * times per book, so recently seen values are answered from a small cache compared by hash first. Not thread
+   * safe; the parser is only used from the task that builds sections.
+   */
+  [[nodiscard]] CssStyle resolveInlineStyle(const char* styleValue) const;
+
   /**
    * Check if any rules have been loaded
    */
-  [[nodiscard]] bool empty() const { return rulesBySelector_.empty(); }
+  [[nodiscard]] bool empty() const { return styles_.empty(); }
 
   /**
    * Get count of loaded rule sets
    */
-  [[nodiscard]] size_t ruleCount() const { return rulesBySelector_.size(); }
+  [[nodiscard]] size_t ruleCount() const { return styles_.size(); }
 
   /**
    * Clear all loaded rules
    */
-  void clear() { rulesBySelector_.clear(); }
+  void clear();
 
   /**
    * Save parsed CSS rules to a cache file.
@@ -92,8 +184,91 @@ class CssParser {
   bool loadFromCache(FsFile& file);
 
  private:
-  // Storage: maps normalized selector -> style properties
-  std::unordered_map<std::string, CssStyle> rulesBySelector_;
+  // Number of style="" values remembered by resolveInlineStyle
+  static constexpr size_t INLINE_STYLE_MEMO_SIZE = 16;
+
+  // Limits that keep pathological stylesheets from blowing up parse time or per-element matching cost
+  static constexpr size_t MAX_SELECTOR_STEPS = 8;
+  static constexpr size_t MAX_COMBINATOR_RULES = 1024;
+  // Matching rules kept per element. Matches past the cap are dropped in discovery order (tag, then each class
+  // token), so a later, more specific match can be the one lost.
+  static constexpr size_t MAX_MATCHED_RULES = 32;
+
+  // Rules matching one element, applied by specificity, then source order
+  struct MatchedRules {
+    struct Match {
+      uint32_t order;  // specificity << 16 | style index
+      uint16_t styleIndex;
+    };
+    Match matches[MAX_MATCHED_RULES];
+    size_t count = 0;
+
+    void add(uint16_t specificity, uint16_t styleIndex);
+    CssStyle resolve(const std::vector<CssStyle>& styles);
+  };
+
+  struct RuleSlot {
+    uint32_t key = 0;    // ruleKey(tagId, classId), 0 marks an empty slot
+    uint16_t index = 0;  // Style index for simple rules, first combinator rule for combinator rules
+  };
+
+  // One ancestor compound of a combinator selector
+  struct SelectorStep {
+    uint16_t tagId = 0;
+    uint16_t classId = 0;
+    bool child = false;  // Must be the parent of the compound to its right, not just an ancestor
+  };
+
+  struct CombinatorRule {
+    uint32_t subjectKey = 0;  // ruleKey of the rightmost compound
+    uint16_t styleIndex = 0;
+    uint16_t firstStep = 0;  // Ancestor compounds in steps_, nearest first
+    uint16_t stepCount = 0;
+    uint16_t specificity = 0;
+    uint16_t next = UINT16_MAX;  // Next rule with the same subject key
+    uint64_t bloom[2] = {};      // Names every matching element must have among its ancestors
+  };
+
+  struct InlineStyleMemo {
+    uint32_t hash = 0;
+    std::string text;
+    CssStyle style;
+  };
+
+  // Interned lower-case tag and class names, indexed by name id. Id 0 is reserved for "no name".
+  std::vector<std::string> names_;
+  // Open-addressed hash set of name ids (0 = empty slot), size is zero or a power of two
+  std::vector<uint16_t> nameSlots_;
+  // Open-addressed (tagId, classId) -> style table. Tag id 0 matches any element, class id 0 means no class.
+  std::vector<RuleSlot> ruleSlots_;
+  std::vector<CssStyle> styles_;
+  std::vector<uint32_t> styleKeys_;  // Rule key of each entry in styles_ (0 for combinator rules), for the cache
+  // Descendant and child selectors, chained per subject key from combinatorSlots_
+  std::vector<RuleSlot> combinatorSlots_;
+  std::vector<CombinatorRule> combinatorRules_;
+  std::vector<SelectorStep> steps_;
+  std::vector<uint8_t> ancestorNames_;  // Non-zero for name ids used in an ancestor compound
+  size_t combinatorKeyCount_ = 0;       // Used slots in combinatorSlots_
+  mutable InlineStyleMemo inlineStyleMemo_[INLINE_STYLE_MEMO_SIZE];
+  mutable size_t inlineStyleMemoNext_ = 0;  // Round-robin replacement position
+
+  static uint32_t ruleKey(const uint16_t tagId, const uint16_t classId) {
+    return (static_cast<uint32_t>(tagId) << 16) | classId;
+  }
+  static uint32_t hashName(const char* s, size_t len);
+  static const RuleSlot* findSlot(const std::vector<RuleSlot>& slots, uint32_t key);
+  static RuleSlot& insertSlot(std::vector<RuleSlot>& slots, size_t used, uint32_t key);
+  static void addToBloom(uint64_t bloom[2], uint16_t nameId, bool isClass);
+  uint16_t findName(const char* s, size_t len) const;
+  uint16_t internName(const std::string& name);
+  bool isAncestorName(const uint16_t id) const { return id < ancestorNames_.size() && ancestorNames_[id]; }
+  const CssStyle* findRule(uint32_t key) const;
+  void addRule(uint32_t key, const CssStyle& style);
+  bool parseCompound(const std::string& compound, uint16_t& tagId, uint16_t& classId);
+  bool addSelector(const std::string& selector, const CssStyle& style);
+  bool matchesAncestors(const CombinatorRule& rule, const AncestorStack& ancestors) const;
+  std::string selectorForKey(uint32_t key) const;
+  std::string selectorForRule(const CombinatorRule& rule) const;
 
   // Internal parsing helpers
   void processRuleBlock(const std::string& selectorGroup, const std::string& declarations);
@@ -0,0 +1,944 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Auto-generated by generate_html_entities.py. Do not edit manually.
+// 2125 HTML named character references laid out as a minimal perfect hash (see the script for details).
+namespace html_entities {
+
+constexpr size_t ENTITY_COUNT = 2125;
+constexpr size_t BUCKET_COUNT = 532;
+constexpr size_t MAX_NAME_LENGTH = 31;
+constexpr size_t MAX_VALUE_LENGTH = 6;
+
+struct Entity {
+  uint16_t nameOffset;   // Into NAMES, no '&' or ';'
+  uint16_t valueOffset;  // Into VALUES, NUL-terminated UTF-8
+  uint8_t nameLength;
+};
+
+constexpr uint32_t hash(const char* name, const size_t len, const uint32_t seed) {
+  uint32_t h = 2166136261u ^ seed;
+  for (size_t i = 0; i < len; ++i) {
+    h ^= static_cast<uint8_t>(name[i]);
+    h *= 16777619u;
+  }
+  h ^= h >> 15;
+  h *= 0x2C1B3C6Du;
+  h ^= h >> 12;
+  return h;
+}
+
+constexpr char NAMES[] =
+    "tdotlsimeIntphivFscrintcalleftrightarrowsCedillatriePhinLlVDashOverBarHorizontalLinensupEScedilbetaF"
+    "illedVerySmallSquarenparallelxfrHcircImaginaryIveebarpluseboxhdmarkerOrzhcyhelliplnapncapcuveelceilB"
+    "arvSucceedsVerbarbsimintegersNotRightTrianglecommatyacuteLeftArrowRightArrowNotLeftTriangleDownLeftR"
+    "ightVectorcurarrssmilegensccueverbarplusboxVrzeetrfBarwedDownArrowoumlkfrGgCfrharrwboxvRvarrholvnEvA"
+    "rrrlmointurcropoSsuplarrwscrisinEElementracutedigammaamplessapproxColondalethNotGreaterSlantEqualorv"
+    "deltactdotcircledRnleftarrowLessSlantEquallparltNotCongruentrnmidnapDiacriticalAcutestarsccueitildeC"
+    "OPYnaturalexponentialelatesOverBracketbigstarequivnleftrightarrowufrstraightphiimofnLtvrtrietildehsl"
+    "ashKHcybcongUnderBracegeslAcysdoteUpArrowBarLleftarrowdoublebarwedgecirmidsparnivsmeparslcfrrational"
+    "srAarrPrecedesSlantEqualstrnssubEsqufminuscomplementdashvXirealpartsoftcyBernoullisccaronrataileqsim"
+    "compLeftCeilingvBarlshRcaronlotimesnvleIacuteNotGreaterEqualsubseteqqDiacriticalTildeswarrhardcyyopf"
+    "ntlgangmsdaarightthreetimeslharubnelEgxlArrlongrightarrowexistmucirceqcapdotupharpoonleftgtreqlesscu"
+    "larrpiexclLongrightarrowEsimchcyquestUnionPluslAarrucircxhArrAndrarrrightrightarrowsNotSupersetaumls"
+    "qsubseteqOslashLeftVectorBarDoubleVerticalBarRightUpVectorBarReverseEquilibriumiiotarightharpoonupJo"
+    "pfleqqlesseqqgtrplustwofrownodotvdashparltdotxcircpercntbigveevsubnEiocyhybullcsubUgravelozengeiopff"
+    "rac13NotPrecedesEqualVertsquareProductplussimUmacrDiamondfrac15LJcynexistsulcornbecauslarrsimLscrnvl"
+    "triehksearowboxboxltlarrnedotoacutevarsupsetneqofcirVscrqopfDoubleLeftArrowhoarrpertenkNotLessTilder"
+    "ppolintCongruentrAtailtrisbDownRightVectorBarffrXopfDownRightVectorsupDcyslarranddplanckhsqsubeeaste"
+    "rutdotleftleftarrowsMublk34boxuRInvisibleTimesprecnapproxtimesbscEsqcapsintlarhkRscrgesfrac56rArrbig"
+    "capBetabopfcapcapRfrlnEmDDotGreaterEqualxlarrCayleysscnapvartriangleleftasympRightTeeVectorRightDown"
+    "VectorBarnotinlarrfsfpartintinodotnsubhbarTstrokudarrLcedilnrArrNotLessEqualZopftriminussumnapidsimg"
+    "EmcyLeftDownVectorngEfrac58zwjdarrloarrincarecupcupltccntrianglelefteqsupExcupscapUbreveOmacrbepsieo"
+    "gonnisdpointintZscrascrLfrnvDashUdblacncedildrcropagravesdotlsimgUogonRshSigmarhovminusdForAllDownRi"
+    "ghtTeeVectornVdashlharulNotNestedLessLessDownTeeArrowlhblkroangjsercywedgeLeftTeeangstZeroWidthSpace"
+    "oltuhblkAEligvarphiegsdotdHarlarrVcyisinsvsuccnapproxdotplusKcedilohbarangmsdacycircEgravelcedilsucc"
+    "tscynearrowdienotinvaruluharphiNotTildeangnsimeqicircsuphsolawintblacksquarexharrnsqsubevarthetaEmpt"
+    "ySmallSquarepreccurlyeqHscrlrarrNotVerticalBarrbarrnpreceqDoubleDotxdtriGbreveddCconintaogonexpectat"
+    "ionofrSquareSubsetEqualsuccapproxSquareSupersetefDotdlcornrealinecuwednGtvsetmncapandsubsetrbracenda"
+    "shbullvproppraplozfEpsilonblacktriangledownYopfdscyLowerLeftArrowlcubyacyeDDotmaltimpedRoundImpliesC"
+    "opfdivonxominuslesdotormoustacheDotDotIJligfrac16ScyngeqqOacuteHopfrharusqsuplessgtroeligRopfRightTe"
+    "eArrowssetmneparslAcircxveeDoubleRightArrowMfrLeftFloorQUOTangsphepsivCircleDotlnapproxBumpeqGreater"
+    "TildesupsubNuHilbertSpaceAopfrsaquoFcygimelboxVLoplusccapslooparrowrightutildegljordfNotSucceedsSlan"
+    "tEqualmicroupsihaopfdowndownarrowsdiamvnsupNotEqualTildeiukcyerarrdrbkarowdcyvarkappaflatltriesqcupm"
+    "scrbecausenscodivNotSubsetEqualulcropbprimekopfboxDLLtemsp14dfrbrevecoloneqnumspFouriertrfiinfinlong"
+    "leftrightarroweopfregbacksimSumngsimconintEcircleqslantsscrsucccurlyeqangmsdaeNotLessLessNscryumldow"
+    "narrowshcyZHcyeqslantlessnotniUpEquilibriumvzigzagrHarQopffallingdotseqImplieswedbarbbrktbrkpropsbqu"
+    "oelsSucceedsTildeUnderBracketDoubleLongRightArrowvopfCapitalDifferentialDnsimrarrbfsShortRightArrowa"
+    "acutevrtrilozHfrNotLessngtpoundnhparVdashlJsercyloangproptoSquareDScyDoubleLongLeftRightArrowljcydiv"
+    "ideontimesmalteseNtildeShortUpArrowDJcyIotagesdotonotinvbboxVlHARDcypreequalsUringrbrkslubigtriangle"
+    "downnltrisimgNotGreaterTildefrac23primesvsupnEVopfmapstonhArrtprimeBcyNotHumpEqualsupsetneqqBscrscns"
+    "imtriangleleftsimdotfscrnvinfincurlyeqsuccdharrdArrnGtgbreveoastracebemptyvrceilCloseCurlyQuoteltrif"
+    "simbigwedgeColonediamsEdotpsivarsubsetneqenspcupornsubEuharlfrac35RuleDelayedtcediludharlowastlesbsi"
+    "meInvisibleCommasacutelowbarNopfblacktrianglerightRightTriangleEqualldrdharcurvearrowrightEquilibriu"
+    "mcapcupcudarrlUpperLeftArrowncaronUpsilonNotGreaterGreaterpreceqSOFTcyboxvlLessFullEquallambdanlEbar"
+    "veebernoutargetnsupsetLongleftrightarrowicRightArrowcdotDDotrahdvscrAumllbracencongdotudblacapeuscrb"
+    "cyhomthtcirENGboxhGreaterGreaterodashiotalesdotoreDoteercublarrlpnapEhArrocircawconintlmidotiquestNe"
+    "gativeVeryThinSpaceuparrowoslashshycupDDlharddemptyvnscehopffopfSubsetEqualNotLeftTriangleEqualgopfc"
+    "heckmarknrarrprodpermilswarrowacuteYcircprecNewLinexoplusnumplusacirnesimsupmultsubsupRrightarrowcap"
+    "sbigodotboxHuSacutelarrtlnsucceqLcaronRightTeeBecausebfrDoubleContourIntegraldcaronororepsilonldshxu"
+    "plusLeftUpTeeVectorboxVpscrSscrVfrNotDoubleVerticalBarboxHDtripluslopfrarrtlWedgelbarrsubeltleftrigh"
+    "tarrowrightleftarrowsbigcircrdshNotSucceedsEqualgammaxodotgElTSHcyangzarrnvgtmidmlcpmidastaeligtimes"
+    "ngeqScircordldquorangrtvbIopfomacrthicksimScCupshchcywopfnleqslantgvnEnopfCapbNotacylsaquoiprodecolo"
+    "ndaggertelrecDownArrowUpArrowSHcysubplusRightTriangleBartoeaIgraveNotEqualgdotquotlacutedharlanglele"
+    "ftharpoonupCoproductdlcropNotSucceedsTildethinspntrianglerightgtrlessNfrapproxeqLangeuronvsimYfrblk1"
+    "2RcedilnaturalslatailOverBracegtccjcircgelmapstodownbsoltridotxopfparallelReverseElementmdashethEopf"
+    "nrtrieCupCapcompfnlesdotocirvellipnlArrnvdashrectwedgeqscaronGreaterSlantEqualsupsetDiacriticalGrave"
+    "rarrapgggjcyswArrnlessnwarhksqsupsetbotGfrnVDashrealsCloseCurlyDoubleQuoteomidSupGreaterLessboxULham"
+    "iltOverParenthesisNotSupersetEqualfcyprecapproxeqcolonUnderBarProportionalolineboxVHprecneqqgggglrar"
+    "rbisinvsimnenuisinlrtriEacuteLowerRightArrowugravensupseteqqsimlElsquosimplusCirclePlusboxdLlrmEcyri"
+    "ghtarrowbrvbarnexistrBarrubrevethere4xrarrboxuliacuteandvwreathzwnjlHarorderspadesuitNotNestedGreate"
+    "rGreatersubdotntildeangmsdaftfrsmtebackcongSquareUnionotimesBackslashalephsupnEangmsdagDoubleLeftTee"
+    "horbarnotnivbNotPrecedesropfgtrarrThetacopysrYUcycircepsirarrfssfrowncurrensolbEtabottomnvHarrxsqcup"
+    "boxVRrcyseArrboxHUprurelcircledSthetasymtrianglerightseswarcudarrrDotEqualxutriUpperRightArrowcolone"
+    "ApplyFunctionrarrwRightarrowDoubleDownArrowOcydotminusBrevenbumpeisindotCHcyroparHumpDownHumputrirdc"
+    "anaposSquareSupersetEqualTcaronLshAscrFfrTScyCdotrsquorSuchThattopfNJcyscpolintdashQscrprnapgneqqLef"
+    "tArrowimagensuccvsupnetritimeDashvraemptyvDownBreveboxvLthksimdividecolonrightsquigarrowsuccsimratio"
+    "ecyisinseqslantgtrabreveIukcyrdquoImboxplusEqualTildeAogonZfrnharrNotRightTriangleEqualsupdsubrfrles"
+    "gessimlraquoKopfLstroklebulletjukcyscsimleftrightharpoonsYacuteyucyFilledSmallSquareneIOcylcaronRigh"
+    "tDownTeeVectorDiacriticalDotUnderParenthesiscaretellbumpeqmhoWscrlsqbcomplexesCircleTimesIEcyparabig"
+    "sqcupPlusMinusgtrdotlneqlbrkerthreesetminusNotTildeFullEqualleftharpoondownbackepsilonxiIfrgvertneqq"
+    "sqcupsExistsngeqslantandslopelrharvarsubsetneqqdscrnvapRightVectorBarJcircamalglarrpliumloopfOgravex"
+    "rArrOtildeCacutecupcapbsemiRightVectorRanggnEsharpccedilradiclmoustsstarfcirclearrowleftgsimeotimesa"
+    "sharrcirzcyapEgcircangrtlarrhkemacracEltquestUpdownarrowkjcyNcyLmidotLcyLongLeftRightArrowjcyChihfrb"
+    "oxurIcynpartnpolintCscrntglAmacrlsimsupsimUumlfiligfrac18smtlongmapstoorThickSpacenotnivcUpArrowDown"
+    "ArrownearrrharulPscrSucceedsEqualblacklozengeKcysquDstrokmumapodsoldrshrhosquarfDcaronneArrfrac14oti"
+    "ldetstrokjfrboxhuGammaCrossZcyLambdalAtailGammadplusbvarproptocireTHORNangrtvbdpuncspOumlSubsetSupse"
+    "tzigrarrsubnErsqbXscrblk14rarrhkngeQfrLongLeftArrowTildeNegativeMediumSpacensupangmsdabJscrbackprime"
+    "frac78barwedgeupharpoonrightcirclearrowrightrtrifgtdotMcyzdoteplusYcythereforeLongleftarrowLeftDownV"
+    "ectorBarPrecedesEqualsup1downharpoonrightiscrDownLeftVectorshortmidnvrArremptyvcsupeuringurcornerNot"
+    "GreaterFullEqualsqsupseteqocyhstrokLeftVectorhookrightarrowangmsdadloparemsp13boxHmcommaalefsymboxvr"
+    "napproxsmidDownarrowNcaronnwarrowuuarrIscrmiddotdwanglensubelbbrknearhkcylctylcyangmsdahEscrrparnGgn"
+    "ltluruharequivDDtrianglerighteqfemaledoteqdotsfrkscrsimedfishtogonhyphenapparslsmtesRightFloorzscrBf"
+    "rlaemptyvUcirclneqqlangNotcopynishcircnotinvcorigofijligBopfdollarlstrokUarrocirpartulcorneregbdquoY"
+    "AcybiguplusminusdusupseteqqurcornrmoustkgreennwarrdopfcrossrightarrowtailjmathRightCeilingmpcemptyve"
+    "frSupersetEqualZetaVerticalLinelooparrowleftDownTeeexclherconbnequivgeqqoparrotimestosaUcyflligqfras"
+    "tdownharpoonleftLeftUpVectorBartimesbarTildeEqualrsquograveheartsuitDoubleUpArrownotnivalessdotquate"
+    "rnionsAfralphacurlywedgelEbsolhsublesccRightUpDownVectorAbrevejscrNotSquareSupersetDotcirscirDiacrit"
+    "icalDoubleAcuteqprimeprimeNotSubsetnacutenlarrDellrhardpitchforkpmblockeumlnrtriMediumSpaceJcyacdiii"
+    "ntPsiwrPrimebethplusmnengdjcyLeftTeeArrowEogonPrrcedilPrecedesTildeNotCupCapCenterDotdiamondNegative"
+    "ThickSpaceangecurarrmxotimencuplrcornerRarrGopfTripleDotuharrnRightarrowimacrcentLeftRightVectorNotG"
+    "reaterLessscircLeftUpDownVectorthetavmodelskappavomegauwanglebumpeGJcydisinleftarrowuarrdotUnionltim"
+    "escopfyenNotPrecedesSlantEqualOmicronImacrScaronumacrzetahookleftarrowtintnotinEblacktriangleleftvsu"
+    "bnelbrksluplusduLeftTrianglesemisuccnsimnLeftarrowemptyleftarrowtailnsubseteqlsquorelDoubleUpDownArr"
+    "owrlharyicyEqualOmegascnEGdotNotHumpDownHumpranglensupseteqSmallCircleTildeFullEqualsigmaldquoAlphad"
+    "uharperiodShortLeftArrowrarrsimsearhkUarrGtedotvarnothingGreaterEqualLessRightDoubleBracketscycularr"
+    "RightUpVectorRightTriangleprofsurfProportionnprecboxvogtimaglinevDashDoubleLeftRightArrowKscrboxUrCc"
+    "aronKJcyNotSquareSupersetEqualOscrLeftArrowBarlbrksldUopfGcedilvarpiLeftrightarrowcueprsmashpnLeftri"
+    "ghtarrowOtimesDownLeftTeeVectorOdblacETHnlesrangeffiligsqsubsetUacuteUpsimapPiSopfncynldrnscrinfinti"
+    "ecenterdotforkplankvgcyupsigtquestContourIntegralzfrtwoheadleftarrowEumlheartsumlOfrcircledastDopfns"
+    "ubsetwfrcongdotGscrldcaboxdrllcornerbacksimeqlesgNotSquareSubsetEqualmfrnleqsceHumpEqualgneqgscrAMPe"
+    "gsgtrapproxnvlArrszligCircleMinusRarrtldtrinshortparallelanddzcylfrcwintnvgeUpDownArrowboxVheparomic"
+    "ronnotindotKappazopfTRADEnjcygeqslantWcircsolbararinggnsimLongRightArrowNoBreakRBarrsqcapIumlecircbu"
+    "mpZacuteyscrrscrJfrprecsimSupersetsigmavsup3zacutenequivblacktriangleboxDrIogonupdownarrowsubneelint"
+    "ersTopfIntersectioncommaAssignDZcyNotLessGreatervBarvcircleddashDarrolarrNegativeThinSpaceLarrdtdotp"
+    "rcuentriangleleftWfrroplusnesearVeryThinSpacevarepsilonweierpFopfecaronswarhkPrecedesVeegacuteqscrle"
+    "sssimDscrhkswarowmapstouprlarrNestedGreaterGreatersextcurlyeqprectcyCounterClockwiseContourIntegralL"
+    "essLessafrcupdotSquareSubsetboxDRsopfupuparrowsDeltaNotLessSlantEqualsigmafNotExistsncongiiiintNotGr"
+    "eaterSqrtShortDownArrowiecyllxwedgellarrrightleftharpoonsimathlbrackAtildecurlyveesupplusRhoswnwargE"
+    "GreaterFullEqualLeftAngleBracketnprcueNotSquareSubsetnvrtriesup2sunglmoustachensparspadesrbrksldnpar"
+    "prsimGTnLtdotsquarehscrlBarrOEligsmallsetminuszcaronupsilontradedoteqproflineVvdashlgEStarsubsetneqN"
+    "acuteltriOpenCurlyDoubleQuotebnotLessEqualGreateryfrNotTildeEqualnparslAgravegeslesCcircatildeUfrlns"
+    "imacircLeftDoubleBracketnrarrcrxcapbrcupkhcyExponentialEkcycacuteuHarorslopesqsupeLeftDownTeeVectoru"
+    "ogonLopfeqcircvarsigmaUbrcyescrlaquovltribigcuplegMscrblankgnapproxdrcornUpTeescVdashcircledcircques"
+    "teqeacutenrarrwshortparallelolcirrrarrsqsubveeequtrifPoincareplanequatintelsdotitprnEbbrkDoubleRight"
+    "TeeYscrurtripfrOpenCurlyQuoteNotTildeTildeesdotWopfcongtbrkRightAngleBracketstarfthkappiplusdolvertn"
+    "eqqDoubleLongLeftArrowNotSucceedsxscrvfrmldrboxtimesnsqsupercaronodblacwplatefrac45gammadloplusKfrla"
+    "rrbsdotbrbracknpreUpTeeArrowharrtriangledownleqapacirlscrGcircmnpluslagranPfrlltriTildeTildesimrarrM"
+    "ellintrfddotseqnlelArregravesupneetaprecnsimnsupegapfrac34boxdlRegesccrealveeNonBreakingSpaceprEtria"
+    "ngleqtrpeziumsectDfrngesparsimJukcygtrsimrightharpoondownforkvnmidprnsimllhardmopfboxvHcuescvarruopf"
+    "nfrpivthickapproxHstrokforallsubseteqvnsubrarrcnwArrerDotprtimesdrfishtrbrkeZdotbigtriangleupOopfthe"
+    "taVbarPcycaronlapigraveboxdRringLeftTriangleEqualLaplacetrfdtrifTaunaturlesseqgtrNotReverseElementCo"
+    "nintRightUpTeeVectorosolfflligTfrReverseUpEquilibriumsuccneqqDownLeftVectorBarNotRightTriangleBarrha"
+    "rdcsubeinfrac25nprccupssmSfrTcyxcapultriscedilgeqYIcytwoheadrightarrowSucceedsSlantEquallparintercal"
+    "supseteqUparrowMinusPlusboxvhOcircboxhDcrarrmstposorderofamacrorarrrtimeslarrbfsUscrLeftTriangleBart"
+    "auduarrlobrkNestedLessLesstrianglelefteqTabsearrowovbarnbsproarrlatSHCHcycheckdstroklongleftarrowicy"
+    "boxURaposgsimlclubsIdotlangleLeftTeeVectornlsimsupsupgtemspgesdotplancksmilesrarrThereforetopgtcirVe"
+    "rticalBarcupslfishtnltrienrightarrowTcedilboxuLubrcylnemeasuredangledblacboxHdAacuteboxhUboxUlgfriff"
+    "nshortmidLacutedsolphonegesdotoltopbotleftrightsquigarrowtwixtPartialDleftthreetimesVerticalSeparato"
+    "rSquareIntersectionniiiafuumlbowtiepluscirnablaclubsuitstraightepsilonrdldharAringbscrrarrplcwconint"
+    "fltnsfrac38ZcaronLeftRightArrowEmptyVerySmallSquareNotLeftTriangleBarrarrlpvcysupeUtildenvltltcirXfr"
+    "ThinSpacekcediliogonboxminusapidasympeqEmacrintprodcapHatsearrgsimmidcirolcrossmapstoleftfrac12Mopfo"
+    "gravedzigrarrbkarowltrParprofalarrisingdotseqYumlrobrkccupsTscreqvparslminusbcirfnintohmucyimagpartL"
+    "eftUpVectorthorndbkarowesimccircqintecirLessGreaterREGifrsubsetneqqinfinLessTildehalfnwnearglaldrush"
+    "arcirEgtreqqlessrbbrkbetweenhairsprtridivRightDownVectorClockwiseContourIntegralvarsupsetneqqsubappr"
+    "oxbigotimesPopfphmmatcedilcurvearrowleftrtriltrisucceqbumpEmaletshcypopfnotbigoplusfnofoscrsubedotsu"
+    "psetneqbarwedgneLTvangrtnleqqranglthreeUpArrowEcaroncscrycygnapGcyrfloorkappardquorffligsubsubNcedil"
+    "fraslpcyvartrianglerightnsimexmapIntegralchinsubseteqqsollangdHaceksupdotsubmultnbumpemptysetjopfRig"
+    "htArrowBarequestangmsdmultimapglEcupbrcapnumerorpargtlgDifferentialDbsolbperpRcycoproddeggtlParlfloo"
+    "rEfruArrnangMapDownArrowBarRacuteSubVerticalTildetcaronmacrsubsimwcircLlverttriangleIcircsubrarrddag"
+    "geracItildefjliguplusDaggertscrdiamondsuitsimeqboxDllurdsharsuphsubufishtngtrCcedilcsuptopforkintsup"
+    "edotntrianglerighteqandandordmNotElementrangdoperptopciruacuteddarrLeftarrowxnisnsmidRightArrowLeftA"
+    "rrow";
+
+constexpr uint8_t VALUES[] = {
+    0xC3, 0x86, 0x00, 0x26, 0x00, 0xC3, 0x81, 0x00, 0xC4, 0x82, 0x00, 0xC3, 0x82, 0x00, 0xD0, 0x90,
+    0x00, 0xF0, 0x9D, 0x94, 0x84, 0x00, 0xC3, 0x80, 0x00, 0xCE, 0x91, 0x00, 0xC4, 0x80, 0x00, 0xE2,
+    0xA9, 0x93, 0x00, 0xC4, 0x84, 0x00, 0xF0, 0x9D, 0x94, 0xB8, 0x00, 0xE2, 0x81, 0xA1, 0x00, 0xC3,
+    0x85, 0x00, 0xF0, 0x9D, 0x92, 0x9C, 0x00, 0xE2, 0x89, 0x94, 0x00, 0xC3, 0x83, 0x00, 0xC3, 0x84,
+    0x00, 0xE2, 0x88, 0x96, 0x00, 0xE2, 0xAB, 0xA7, 0x00, 0xE2, 0x8C, 0x86, 0x00, 0xD0, 0x91, 0x00,
+    0xE2, 0x88, 0xB5, 0x00, 0xE2, 0x84, 0xAC, 0x00, 0xCE, 0x92, 0x00, 0xF0, 0x9D, 0x94, 0x85, 0x00,
+    0xF0, 0x9D, 0x94, 0xB9, 0x00, 0xCB, 0x98, 0x00, 0xE2, 0x89, 0x8E, 0x00, 0xD0, 0xA7, 0x00, 0xC2,
+    0xA9, 0x00, 0xC4, 0x86, 0x00, 0xE2, 0x8B, 0x92, 0x00, 0xE2, 0x85, 0x85, 0x00, 0xE2, 0x84, 0xAD,
+    0x00, 0xC4, 0x8C, 0x00, 0xC3, 0x87, 0x00, 0xC4, 0x88, 0x00, 0xE2, 0x88, 0xB0, 0x00, 0xC4, 0x8A,
+    0x00, 0xC2, 0xB8, 0x00, 0xC2, 0xB7, 0x00, 0xCE, 0xA7, 0x00, 0xE2, 0x8A, 0x99, 0x00, 0xE2, 0x8A,
+    0x96, 0x00, 0xE2, 0x8A, 0x95, 0x00, 0xE2, 0x8A, 0x97, 0x00, 0xE2, 0x88, 0xB2, 0x00, 0xE2, 0x80,
+    0x9D, 0x00, 0xE2, 0x80, 0x99, 0x00, 0xE2, 0x88, 0xB7, 0x00, 0xE2, 0xA9, 0xB4, 0x00, 0xE2, 0x89,
+    0xA1, 0x00, 0xE2, 0x88, 0xAF, 0x00, 0xE2, 0x88, 0xAE, 0x00, 0xE2, 0x84, 0x82, 0x00, 0xE2, 0x88,
+    0x90, 0x00, 0xE2, 0x88, 0xB3, 0x00, 0xE2, 0xA8, 0xAF, 0x00, 0xF0, 0x9D, 0x92, 0x9E, 0x00, 0xE2,
+    0x8B, 0x93, 0x00, 0xE2, 0x89, 0x8D, 0x00, 0xE2, 0xA4, 0x91, 0x00, 0xD0, 0x82, 0x00, 0xD0, 0x85,
+    0x00, 0xD0, 0x8F, 0x00, 0xE2, 0x80, 0xA1, 0x00, 0xE2, 0x86, 0xA1, 0x00, 0xE2, 0xAB, 0xA4, 0x00,
+    0xC4, 0x8E, 0x00, 0xD0, 0x94, 0x00, 0xE2, 0x88, 0x87, 0x00, 0xCE, 0x94, 0x00, 0xF0, 0x9D, 0x94,
+    0x87, 0x00, 0xC2, 0xB4, 0x00, 0xCB, 0x99, 0x00, 0xCB, 0x9D, 0x00, 0x60, 0x00, 0xCB, 0x9C, 0x00,
+    0xE2, 0x8B, 0x84, 0x00, 0xE2, 0x85, 0x86, 0x00, 0xF0, 0x9D, 0x94, 0xBB, 0x00, 0xC2, 0xA8, 0x00,
+    0xE2, 0x83, 0x9C, 0x00, 0xE2, 0x89, 0x90, 0x00, 0xE2, 0x87, 0x93, 0x00, 0xE2, 0x87, 0x90, 0x00,
+    0xE2, 0x87, 0x94, 0x00, 0xE2, 0x9F, 0xB8, 0x00, 0xE2, 0x9F, 0xBA, 0x00, 0xE2, 0x9F, 0xB9, 0x00,
+    0xE2, 0x87, 0x92, 0x00, 0xE2, 0x8A, 0xA8, 0x00, 0xE2, 0x87, 0x91, 0x00, 0xE2, 0x87, 0x95, 0x00,
+    0xE2, 0x88, 0xA5, 0x00, 0xE2, 0x86, 0x93, 0x00, 0xE2, 0xA4, 0x93, 0x00, 0xE2, 0x87, 0xB5, 0x00,
+    0xCC, 0x91, 0x00, 0xE2, 0xA5, 0x90, 0x00, 0xE2, 0xA5, 0x9E, 0x00, 0xE2, 0x86, 0xBD, 0x00, 0xE2,
+    0xA5, 0x96, 0x00, 0xE2, 0xA5, 0x9F, 0x00, 0xE2, 0x87, 0x81, 0x00, 0xE2, 0xA5, 0x97, 0x00, 0xE2,
+    0x8A, 0xA4, 0x00, 0xE2, 0x86, 0xA7, 0x00, 0xF0, 0x9D, 0x92, 0x9F, 0x00, 0xC4, 0x90, 0x00, 0xC5,
+    0x8A, 0x00, 0xC3, 0x90, 0x00, 0xC3, 0x89, 0x00, 0xC4, 0x9A, 0x00, 0xC3, 0x8A, 0x00, 0xD0, 0xAD,
+    0x00, 0xC4, 0x96, 0x00, 0xF0, 0x9D, 0x94, 0x88, 0x00, 0xC3, 0x88, 0x00, 0xE2, 0x88, 0x88, 0x00,
+    0xC4, 0x92, 0x00, 0xE2, 0x97, 0xBB, 0x00, 0xE2, 0x96, 0xAB, 0x00, 0xC4, 0x98, 0x00, 0xF0, 0x9D,
+    0x94, 0xBC, 0x00, 0xCE, 0x95, 0x00, 0xE2, 0xA9, 0xB5, 0x00, 0xE2, 0x89, 0x82, 0x00, 0xE2, 0x87,
+    0x8C, 0x00, 0xE2, 0x84, 0xB0, 0x00, 0xE2, 0xA9, 0xB3, 0x00, 0xCE, 0x97, 0x00, 0xC3, 0x8B, 0x00,
+    0xE2, 0x88, 0x83, 0x00, 0xE2, 0x85, 0x87, 0x00, 0xD0, 0xA4, 0x00, 0xF0, 0x9D, 0x94, 0x89, 0x00,
+    0xE2, 0x97, 0xBC, 0x00, 0xE2, 0x96, 0xAA, 0x00, 0xF0, 0x9D, 0x94, 0xBD, 0x00, 0xE2, 0x88, 0x80,
+    0x00, 0xE2, 0x84, 0xB1, 0x00, 0xD0, 0x83, 0x00, 0x3E, 0x00, 0xCE, 0x93, 0x00, 0xCF, 0x9C, 0x00,
+    0xC4, 0x9E, 0x00, 0xC4, 0xA2, 0x00, 0xC4, 0x9C, 0x00, 0xD0, 0x93, 0x00, 0xC4, 0xA0, 0x00, 0xF0,
+    0x9D, 0x94, 0x8A, 0x00, 0xE2, 0x8B, 0x99, 0x00, 0xF0, 0x9D, 0x94, 0xBE, 0x00, 0xE2, 0x89, 0xA5,
+    0x00, 0xE2, 0x8B, 0x9B, 0x00, 0xE2, 0x89, 0xA7, 0x00, 0xE2, 0xAA, 0xA2, 0x00, 0xE2, 0x89, 0xB7,
+    0x00, 0xE2, 0xA9, 0xBE, 0x00, 0xE2, 0x89, 0xB3, 0x00, 0xF0, 0x9D, 0x92, 0xA2, 0x00, 0xE2, 0x89,
+    0xAB, 0x00, 0xD0, 0xAA, 0x00, 0xCB, 0x87, 0x00, 0x5E, 0x00, 0xC4, 0xA4, 0x00, 0xE2, 0x84, 0x8C,
+    0x00, 0xE2, 0x84, 0x8B, 0x00, 0xE2, 0x84, 0x8D, 0x00, 0xE2, 0x94, 0x80, 0x00, 0xC4, 0xA6, 0x00,
+    0xE2, 0x89, 0x8F, 0x00, 0xD0, 0x95, 0x00, 0xC4, 0xB2, 0x00, 0xD0, 0x81, 0x00, 0xC3, 0x8D, 0x00,
+    0xC3, 0x8E, 0x00, 0xD0, 0x98, 0x00, 0xC4, 0xB0, 0x00, 0xE2, 0x84, 0x91, 0x00, 0xC3, 0x8C, 0x00,
+    0xC4, 0xAA, 0x00, 0xE2, 0x85, 0x88, 0x00, 0xE2, 0x88, 0xAC, 0x00, 0xE2, 0x88, 0xAB, 0x00, 0xE2,
+    0x8B, 0x82, 0x00, 0xE2, 0x81, 0xA3, 0x00, 0xE2, 0x81, 0xA2, 0x00, 0xC4, 0xAE, 0x00, 0xF0, 0x9D,
+    0x95, 0x80, 0x00, 0xCE, 0x99, 0x00, 0xE2, 0x84, 0x90, 0x00, 0xC4, 0xA8, 0x00, 0xD0, 0x86, 0x00,
+    0xC3, 0x8F, 0x00, 0xC4, 0xB4, 0x00, 0xD0, 0x99, 0x00, 0xF0, 0x9D, 0x94, 0x8D, 0x00, 0xF0, 0x9D,
+    0x95, 0x81, 0x00, 0xF0, 0x9D, 0x92, 0xA5, 0x00, 0xD0, 0x88, 0x00, 0xD0, 0x84, 0x00, 0xD0, 0xA5,
+    0x00, 0xD0, 0x8C, 0x00, 0xCE, 0x9A, 0x00, 0xC4, 0xB6, 0x00, 0xD0, 0x9A, 0x00, 0xF0, 0x9D, 0x94,
+    0x8E, 0x00, 0xF0, 0x9D, 0x95, 0x82, 0x00, 0xF0, 0x9D, 0x92, 0xA6, 0x00, 0xD0, 0x89, 0x00, 0x3C,
+    0x00, 0xC4, 0xB9, 0x00, 0xCE, 0x9B, 0x00, 0xE2, 0x9F, 0xAA, 0x00, 0xE2, 0x84, 0x92, 0x00, 0xE2,
+    0x86, 0x9E, 0x00, 0xC4, 0xBD, 0x00, 0xC4, 0xBB, 0x00, 0xD0, 0x9B, 0x00, 0xE2, 0x9F, 0xA8, 0x00,
+    0xE2, 0x86, 0x90, 0x00, 0xE2, 0x87, 0xA4, 0x00, 0xE2, 0x87, 0x86, 0x00, 0xE2, 0x8C, 0x88, 0x00,
+    0xE2, 0x9F, 0xA6, 0x00, 0xE2, 0xA5, 0xA1, 0x00, 0xE2, 0x87, 0x83, 0x00, 0xE2, 0xA5, 0x99, 0x00,
+    0xE2, 0x8C, 0x8A, 0x00, 0xE2, 0x86, 0x94, 0x00, 0xE2, 0xA5, 0x8E, 0x00, 0xE2, 0x8A, 0xA3, 0x00,
+    0xE2, 0x86, 0xA4, 0x00, 0xE2, 0xA5, 0x9A, 0x00, 0xE2, 0x8A, 0xB2, 0x00, 0xE2, 0xA7, 0x8F, 0x00,
+    0xE2, 0x8A, 0xB4, 0x00, 0xE2, 0xA5, 0x91, 0x00, 0xE2, 0xA5, 0xA0, 0x00, 0xE2, 0x86, 0xBF, 0x00,
+    0xE2, 0xA5, 0x98, 0x00, 0xE2, 0x86, 0xBC, 0x00, 0xE2, 0xA5, 0x92, 0x00, 0xE2, 0x8B, 0x9A, 0x00,
+    0xE2, 0x89, 0xA6, 0x00, 0xE2, 0x89, 0xB6, 0x00, 0xE2, 0xAA, 0xA1, 0x00, 0xE2, 0xA9, 0xBD, 0x00,
+    0xE2, 0x89, 0xB2, 0x00, 0xF0, 0x9D, 0x94, 0x8F, 0x00, 0xE2, 0x8B, 0x98, 0x00, 0xE2, 0x87, 0x9A,
+    0x00, 0xC4, 0xBF, 0x00, 0xE2, 0x9F, 0xB5, 0x00, 0xE2, 0x9F, 0xB7, 0x00, 0xE2, 0x9F, 0xB6, 0x00,
+    0xF0, 0x9D, 0x95, 0x83, 0x00, 0xE2, 0x86, 0x99, 0x00, 0xE2, 0x86, 0x98, 0x00, 0xE2, 0x86, 0xB0,
+    0x00, 0xC5, 0x81, 0x00, 0xE2, 0x89, 0xAA, 0x00, 0xE2, 0xA4, 0x85, 0x00, 0xD0, 0x9C, 0x00, 0xE2,
+    0x81, 0x9F, 0x00, 0xE2, 0x84, 0xB3, 0x00, 0xF0, 0x9D, 0x94, 0x90, 0x00, 0xE2, 0x88, 0x93, 0x00,
+    0xF0, 0x9D, 0x95, 0x84, 0x00, 0xCE, 0x9C, 0x00, 0xD0, 0x8A, 0x00, 0xC5, 0x83, 0x00, 0xC5, 0x87,
+    0x00, 0xC5, 0x85, 0x00, 0xD0, 0x9D, 0x00, 0xE2, 0x80, 0x8B, 0x00, 0x0A, 0x00, 0xF0, 0x9D, 0x94,
+    0x91, 0x00, 0xE2, 0x81, 0xA0, 0x00, 0xC2, 0xA0, 0x00, 0xE2, 0x84, 0x95, 0x00, 0xE2, 0xAB, 0xAC,
+    0x00, 0xE2, 0x89, 0xA2, 0x00, 0xE2, 0x89, 0xAD, 0x00, 0xE2, 0x88, 0xA6, 0x00, 0xE2, 0x88, 0x89,
+    0x00, 0xE2, 0x89, 0xA0, 0x00, 0xE2, 0x89, 0x82, 0xCC, 0xB8, 0x00, 0xE2, 0x88, 0x84, 0x00, 0xE2,
+    0x89, 0xAF, 0x00, 0xE2, 0x89, 0xB1, 0x00, 0xE2, 0x89, 0xA7, 0xCC, 0xB8, 0x00, 0xE2, 0x89, 0xAB,
+    0xCC, 0xB8, 0x00, 0xE2, 0x89, 0xB9, 0x00, 0xE2, 0xA9, 0xBE, 0xCC, 0xB8, 0x00, 0xE2, 0x89, 0xB5,
+    0x00, 0xE2, 0x89, 0x8E, 0xCC, 0xB8, 0x00, 0xE2, 0x89, 0x8F, 0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xAA,
+    0x00, 0xE2, 0xA7, 0x8F, 0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xAC, 0x00, 0xE2, 0x89, 0xAE, 0x00, 0xE2,
+    0x89, 0xB0, 0x00, 0xE2, 0x89, 0xB8, 0x00, 0xE2, 0x89, 0xAA, 0xCC, 0xB8, 0x00, 0xE2, 0xA9, 0xBD,
+    0xCC, 0xB8, 0x00, 0xE2, 0x89, 0xB4, 0x00, 0xE2, 0xAA, 0xA2, 0xCC, 0xB8, 0x00, 0xE2, 0xAA, 0xA1,
+    0xCC, 0xB8, 0x00, 0xE2, 0x8A, 0x80, 0x00, 0xE2, 0xAA, 0xAF, 0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xA0,
+    0x00, 0xE2, 0x88, 0x8C, 0x00, 0xE2, 0x8B, 0xAB, 0x00, 0xE2, 0xA7, 0x90, 0xCC, 0xB8, 0x00, 0xE2,
+    0x8B, 0xAD, 0x00, 0xE2, 0x8A, 0x8F, 0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xA2, 0x00, 0xE2, 0x8A, 0x90,
+    0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xA3, 0x00, 0xE2, 0x8A, 0x82, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0x8A,
+    0x88, 0x00, 0xE2, 0x8A, 0x81, 0x00, 0xE2, 0xAA, 0xB0, 0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xA1, 0x00,
+    0xE2, 0x89, 0xBF, 0xCC, 0xB8, 0x00, 0xE2, 0x8A, 0x83, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0x8A, 0x89,
+    0x00, 0xE2, 0x89, 0x81, 0x00, 0xE2, 0x89, 0x84, 0x00, 0xE2, 0x89, 0x87, 0x00, 0xE2, 0x89, 0x89,
+    0x00, 0xE2, 0x88, 0xA4, 0x00, 0xF0, 0x9D, 0x92, 0xA9, 0x00, 0xC3, 0x91, 0x00, 0xCE, 0x9D, 0x00,
+    0xC5, 0x92, 0x00, 0xC3, 0x93, 0x00, 0xC3, 0x94, 0x00, 0xD0, 0x9E, 0x00, 0xC5, 0x90, 0x00, 0xF0,
+    0x9D, 0x94, 0x92, 0x00, 0xC3, 0x92, 0x00, 0xC5, 0x8C, 0x00, 0xCE, 0xA9, 0x00, 0xCE, 0x9F, 0x00,
+    0xF0, 0x9D, 0x95, 0x86, 0x00, 0xE2, 0x80, 0x9C, 0x00, 0xE2, 0x80, 0x98, 0x00, 0xE2, 0xA9, 0x94,
+    0x00, 0xF0, 0x9D, 0x92, 0xAA, 0x00, 0xC3, 0x98, 0x00, 0xC3, 0x95, 0x00, 0xE2, 0xA8, 0xB7, 0x00,
+    0xC3, 0x96, 0x00, 0xE2, 0x80, 0xBE, 0x00, 0xE2, 0x8F, 0x9E, 0x00, 0xE2, 0x8E, 0xB4, 0x00, 0xE2,
+    0x8F, 0x9C, 0x00, 0xE2, 0x88, 0x82, 0x00, 0xD0, 0x9F, 0x00, 0xF0, 0x9D, 0x94, 0x93, 0x00, 0xCE,
+    0xA6, 0x00, 0xCE, 0xA0, 0x00, 0xC2, 0xB1, 0x00, 0xE2, 0x84, 0x99, 0x00, 0xE2, 0xAA, 0xBB, 0x00,
+    0xE2, 0x89, 0xBA, 0x00, 0xE2, 0xAA, 0xAF, 0x00, 0xE2, 0x89, 0xBC, 0x00, 0xE2, 0x89, 0xBE, 0x00,
+    0xE2, 0x80, 0xB3, 0x00, 0xE2, 0x88, 0x8F, 0x00, 0xE2, 0x88, 0x9D, 0x00, 0xF0, 0x9D, 0x92, 0xAB,
+    0x00, 0xCE, 0xA8, 0x00, 0x22, 0x00, 0xF0, 0x9D, 0x94, 0x94, 0x00, 0xE2, 0x84, 0x9A, 0x00, 0xF0,
+    0x9D, 0x92, 0xAC, 0x00, 0xE2, 0xA4, 0x90, 0x00, 0xC2, 0xAE, 0x00, 0xC5, 0x94, 0x00, 0xE2, 0x9F,
+    0xAB, 0x00, 0xE2, 0x86, 0xA0, 0x00, 0xE2, 0xA4, 0x96, 0x00, 0xC5, 0x98, 0x00, 0xC5, 0x96, 0x00,
+    0xD0, 0xA0, 0x00, 0xE2, 0x84, 0x9C, 0x00, 0xE2, 0x88, 0x8B, 0x00, 0xE2, 0x87, 0x8B, 0x00, 0xE2,
+    0xA5, 0xAF, 0x00, 0xCE, 0xA1, 0x00, 0xE2, 0x9F, 0xA9, 0x00, 0xE2, 0x86, 0x92, 0x00, 0xE2, 0x87,
+    0xA5, 0x00, 0xE2, 0x87, 0x84, 0x00, 0xE2, 0x8C, 0x89, 0x00, 0xE2, 0x9F, 0xA7, 0x00, 0xE2, 0xA5,
+    0x9D, 0x00, 0xE2, 0x87, 0x82, 0x00, 0xE2, 0xA5, 0x95, 0x00, 0xE2, 0x8C, 0x8B, 0x00, 0xE2, 0x8A,
+    0xA2, 0x00, 0xE2, 0x86, 0xA6, 0x00, 0xE2, 0xA5, 0x9B, 0x00, 0xE2, 0x8A, 0xB3, 0x00, 0xE2, 0xA7,
+    0x90, 0x00, 0xE2, 0x8A, 0xB5, 0x00, 0xE2, 0xA5, 0x8F, 0x00, 0xE2, 0xA5, 0x9C, 0x00, 0xE2, 0x86,
+    0xBE, 0x00, 0xE2, 0xA5, 0x94, 0x00, 0xE2, 0x87, 0x80, 0x00, 0xE2, 0xA5, 0x93, 0x00, 0xE2, 0x84,
+    0x9D, 0x00, 0xE2, 0xA5, 0xB0, 0x00, 0xE2, 0x87, 0x9B, 0x00, 0xE2, 0x84, 0x9B, 0x00, 0xE2, 0x86,
+    0xB1, 0x00, 0xE2, 0xA7, 0xB4, 0x00, 0xD0, 0xA9, 0x00, 0xD0, 0xA8, 0x00, 0xD0, 0xAC, 0x00, 0xC5,
+    0x9A, 0x00, 0xE2, 0xAA, 0xBC, 0x00, 0xC5, 0xA0, 0x00, 0xC5, 0x9E, 0x00, 0xC5, 0x9C, 0x00, 0xD0,
+    0xA1, 0x00, 0xF0, 0x9D, 0x94, 0x96, 0x00, 0xE2, 0x86, 0x91, 0x00, 0xCE, 0xA3, 0x00, 0xE2, 0x88,
+    0x98, 0x00, 0xF0, 0x9D, 0x95, 0x8A, 0x00, 0xE2, 0x88, 0x9A, 0x00, 0xE2, 0x96, 0xA1, 0x00, 0xE2,
+    0x8A, 0x93, 0x00, 0xE2, 0x8A, 0x8F, 0x00, 0xE2, 0x8A, 0x91, 0x00, 0xE2, 0x8A, 0x90, 0x00, 0xE2,
+    0x8A, 0x92, 0x00, 0xE2, 0x8A, 0x94, 0x00, 0xF0, 0x9D, 0x92, 0xAE, 0x00, 0xE2, 0x8B, 0x86, 0x00,
+    0xE2, 0x8B, 0x90, 0x00, 0xE2, 0x8A, 0x86, 0x00, 0xE2, 0x89, 0xBB, 0x00, 0xE2, 0xAA, 0xB0, 0x00,
+    0xE2, 0x89, 0xBD, 0x00, 0xE2, 0x89, 0xBF, 0x00, 0xE2, 0x88, 0x91, 0x00, 0xE2, 0x8B, 0x91, 0x00,
+    0xE2, 0x8A, 0x83, 0x00, 0xE2, 0x8A, 0x87, 0x00, 0xC3, 0x9E, 0x00, 0xE2, 0x84, 0xA2, 0x00, 0xD0,
+    0x8B, 0x00, 0xD0, 0xA6, 0x00, 0x09, 0x00, 0xCE, 0xA4, 0x00, 0xC5, 0xA4, 0x00, 0xC5, 0xA2, 0x00,
+    0xD0, 0xA2, 0x00, 0xF0, 0x9D, 0x94, 0x97, 0x00, 0xE2, 0x88, 0xB4, 0x00, 0xCE, 0x98, 0x00, 0xE2,
+    0x81, 0x9F, 0xE2, 0x80, 0x8A, 0x00, 0xE2, 0x80, 0x89, 0x00, 0xE2, 0x88, 0xBC, 0x00, 0xE2, 0x89,
+    0x83, 0x00, 0xE2, 0x89, 0x85, 0x00, 0xE2, 0x89, 0x88, 0x00, 0xF0, 0x9D, 0x95, 0x8B, 0x00, 0xE2,
+    0x83, 0x9B, 0x00, 0xF0, 0x9D, 0x92, 0xAF, 0x00, 0xC5, 0xA6, 0x00, 0xC3, 0x9A, 0x00, 0xE2, 0x86,
+    0x9F, 0x00, 0xE2, 0xA5, 0x89, 0x00, 0xD0, 0x8E, 0x00, 0xC5, 0xAC, 0x00, 0xC3, 0x9B, 0x00, 0xD0,
+    0xA3, 0x00, 0xC5, 0xB0, 0x00, 0xF0, 0x9D, 0x94, 0x98, 0x00, 0xC3, 0x99, 0x00, 0xC5, 0xAA, 0x00,
+    0x5F, 0x00, 0xE2, 0x8F, 0x9F, 0x00, 0xE2, 0x8E, 0xB5, 0x00, 0xE2, 0x8F, 0x9D, 0x00, 0xE2, 0x8B,
+    0x83, 0x00, 0xE2, 0x8A, 0x8E, 0x00, 0xC5, 0xB2, 0x00, 0xF0, 0x9D, 0x95, 0x8C, 0x00, 0xE2, 0xA4,
+    0x92, 0x00, 0xE2, 0x87, 0x85, 0x00, 0xE2, 0x86, 0x95, 0x00, 0xE2, 0xA5, 0xAE, 0x00, 0xE2, 0x8A,
+    0xA5, 0x00, 0xE2, 0x86, 0xA5, 0x00, 0xE2, 0x86, 0x96, 0x00, 0xE2, 0x86, 0x97, 0x00, 0xCF, 0x92,
+    0x00, 0xCE, 0xA5, 0x00, 0xC5, 0xAE, 0x00, 0xF0, 0x9D, 0x92, 0xB0, 0x00, 0xC5, 0xA8, 0x00, 0xC3,
+    0x9C, 0x00, 0xE2, 0x8A, 0xAB, 0x00, 0xE2, 0xAB, 0xAB, 0x00, 0xD0, 0x92, 0x00, 0xE2, 0x8A, 0xA9,
+    0x00, 0xE2, 0xAB, 0xA6, 0x00, 0xE2, 0x8B, 0x81, 0x00, 0xE2, 0x80, 0x96, 0x00, 0xE2, 0x88, 0xA3,
+    0x00, 0x7C, 0x00, 0xE2, 0x9D, 0x98, 0x00, 0xE2, 0x89, 0x80, 0x00, 0xE2, 0x80, 0x8A, 0x00, 0xF0,
+    0x9D, 0x94, 0x99, 0x00, 0xF0, 0x9D, 0x95, 0x8D, 0x00, 0xF0, 0x9D, 0x92, 0xB1, 0x00, 0xE2, 0x8A,
+    0xAA, 0x00, 0xC5, 0xB4, 0x00, 0xE2, 0x8B, 0x80, 0x00, 0xF0, 0x9D, 0x94, 0x9A, 0x00, 0xF0, 0x9D,
+    0x95, 0x8E, 0x00, 0xF0, 0x9D, 0x92, 0xB2, 0x00, 0xF0, 0x9D, 0x94, 0x9B, 0x00, 0xCE, 0x9E, 0x00,
+    0xF0, 0x9D, 0x95, 0x8F, 0x00, 0xF0, 0x9D, 0x92, 0xB3, 0x00, 0xD0, 0xAF, 0x00, 0xD0, 0x87, 0x00,
+    0xD0, 0xAE, 0x00, 0xC3, 0x9D, 0x00, 0xC5, 0xB6, 0x00, 0xD0, 0xAB, 0x00, 0xF0, 0x9D, 0x94, 0x9C,
+    0x00, 0xF0, 0x9D, 0x95, 0x90, 0x00, 0xF0, 0x9D, 0x92, 0xB4, 0x00, 0xC5, 0xB8, 0x00, 0xD0, 0x96,
+    0x00, 0xC5, 0xB9, 0x00, 0xC5, 0xBD, 0x00, 0xD0, 0x97, 0x00, 0xC5, 0xBB, 0x00, 0xCE, 0x96, 0x00,
+    0xE2, 0x84, 0xA8, 0x00, 0xE2, 0x84, 0xA4, 0x00, 0xF0, 0x9D, 0x92, 0xB5, 0x00, 0xC3, 0xA1, 0x00,
+    0xC4, 0x83, 0x00, 0xE2, 0x88, 0xBE, 0x00, 0xE2, 0x88, 0xBE, 0xCC, 0xB3, 0x00, 0xE2, 0x88, 0xBF,
+    0x00, 0xC3, 0xA2, 0x00, 0xD0, 0xB0, 0x00, 0xC3, 0xA6, 0x00, 0xF0, 0x9D, 0x94, 0x9E, 0x00, 0xC3,
+    0xA0, 0x00, 0xE2, 0x84, 0xB5, 0x00, 0xCE, 0xB1, 0x00, 0xC4, 0x81, 0x00, 0xE2, 0xA8, 0xBF, 0x00,
+    0xE2, 0x88, 0xA7, 0x00, 0xE2, 0xA9, 0x95, 0x00, 0xE2, 0xA9, 0x9C, 0x00, 0xE2, 0xA9, 0x98, 0x00,
+    0xE2, 0xA9, 0x9A, 0x00, 0xE2, 0x88, 0xA0, 0x00, 0xE2, 0xA6, 0xA4, 0x00, 0xE2, 0x88, 0xA1, 0x00,
+    0xE2, 0xA6, 0xA8, 0x00, 0xE2, 0xA6, 0xA9, 0x00, 0xE2, 0xA6, 0xAA, 0x00, 0xE2, 0xA6, 0xAB, 0x00,
+    0xE2, 0xA6, 0xAC, 0x00, 0xE2, 0xA6, 0xAD, 0x00, 0xE2, 0xA6, 0xAE, 0x00, 0xE2, 0xA6, 0xAF, 0x00,
+    0xE2, 0x88, 0x9F, 0x00, 0xE2, 0x8A, 0xBE, 0x00, 0xE2, 0xA6, 0x9D, 0x00, 0xE2, 0x88, 0xA2, 0x00,
+    0xE2, 0x8D, 0xBC, 0x00, 0xC4, 0x85, 0x00, 0xF0, 0x9D, 0x95, 0x92, 0x00, 0xE2, 0xA9, 0xB0, 0x00,
+    0xE2, 0xA9, 0xAF, 0x00, 0xE2, 0x89, 0x8A, 0x00, 0xE2, 0x89, 0x8B, 0x00, 0x27, 0x00, 0xC3, 0xA5,
+    0x00, 0xF0, 0x9D, 0x92, 0xB6, 0x00, 0x2A, 0x00, 0xC3, 0xA3, 0x00, 0xC3, 0xA4, 0x00, 0xE2, 0xA8,
+    0x91, 0x00, 0xE2, 0xAB, 0xAD, 0x00, 0xE2, 0x89, 0x8C, 0x00, 0xCF, 0xB6, 0x00, 0xE2, 0x80, 0xB5,
+    0x00, 0xE2, 0x88, 0xBD, 0x00, 0xE2, 0x8B, 0x8D, 0x00, 0xE2, 0x8A, 0xBD, 0x00, 0xE2, 0x8C, 0x85,
+    0x00, 0xE2, 0x8E, 0xB6, 0x00, 0xD0, 0xB1, 0x00, 0xE2, 0x80, 0x9E, 0x00, 0xE2, 0xA6, 0xB0, 0x00,
+    0xCE, 0xB2, 0x00, 0xE2, 0x84, 0xB6, 0x00, 0xE2, 0x89, 0xAC, 0x00, 0xF0, 0x9D, 0x94, 0x9F, 0x00,
+    0xE2, 0x97, 0xAF, 0x00, 0xE2, 0xA8, 0x80, 0x00, 0xE2, 0xA8, 0x81, 0x00, 0xE2, 0xA8, 0x82, 0x00,
+    0xE2, 0xA8, 0x86, 0x00, 0xE2, 0x98, 0x85, 0x00, 0xE2, 0x96, 0xBD, 0x00, 0xE2, 0x96, 0xB3, 0x00,
+    0xE2, 0xA8, 0x84, 0x00, 0xE2, 0xA4, 0x8D, 0x00, 0xE2, 0xA7, 0xAB, 0x00, 0xE2, 0x96, 0xB4, 0x00,
+    0xE2, 0x96, 0xBE, 0x00, 0xE2, 0x97, 0x82, 0x00, 0xE2, 0x96, 0xB8, 0x00, 0xE2, 0x90, 0xA3, 0x00,
+    0xE2, 0x96, 0x92, 0x00, 0xE2, 0x96, 0x91, 0x00, 0xE2, 0x96, 0x93, 0x00, 0xE2, 0x96, 0x88, 0x00,
+    0x3D, 0xE2, 0x83, 0xA5, 0x00, 0xE2, 0x89, 0xA1, 0xE2, 0x83, 0xA5, 0x00, 0xE2, 0x8C, 0x90, 0x00,
+    0xF0, 0x9D, 0x95, 0x93, 0x00, 0xE2, 0x8B, 0x88, 0x00, 0xE2, 0x95, 0x97, 0x00, 0xE2, 0x95, 0x94,
+    0x00, 0xE2, 0x95, 0x96, 0x00, 0xE2, 0x95, 0x93, 0x00, 0xE2, 0x95, 0x90, 0x00, 0xE2, 0x95, 0xA6,
+    0x00, 0xE2, 0x95, 0xA9, 0x00, 0xE2, 0x95, 0xA4, 0x00, 0xE2, 0x95, 0xA7, 0x00, 0xE2, 0x95, 0x9D,
+    0x00, 0xE2, 0x95, 0x9A, 0x00, 0xE2, 0x95, 0x9C, 0x00, 0xE2, 0x95, 0x99, 0x00, 0xE2, 0x95, 0x91,
+    0x00, 0xE2, 0x95, 0xAC, 0x00, 0xE2, 0x95, 0xA3, 0x00, 0xE2, 0x95, 0xA0, 0x00, 0xE2, 0x95, 0xAB,
+    0x00, 0xE2, 0x95, 0xA2, 0x00, 0xE2, 0x95, 0x9F, 0x00, 0xE2, 0xA7, 0x89, 0x00, 0xE2, 0x95, 0x95,
+    0x00, 0xE2, 0x95, 0x92, 0x00, 0xE2, 0x94, 0x90, 0x00, 0xE2, 0x94, 0x8C, 0x00, 0xE2, 0x95, 0xA5,
+    0x00, 0xE2, 0x95, 0xA8, 0x00, 0xE2, 0x94, 0xAC, 0x00, 0xE2, 0x94, 0xB4, 0x00, 0xE2, 0x8A, 0x9F,
+    0x00, 0xE2, 0x8A, 0x9E, 0x00, 0xE2, 0x8A, 0xA0, 0x00, 0xE2, 0x95, 0x9B, 0x00, 0xE2, 0x95, 0x98,
+    0x00, 0xE2, 0x94, 0x98, 0x00, 0xE2, 0x94, 0x94, 0x00, 0xE2, 0x94, 0x82, 0x00, 0xE2, 0x95, 0xAA,
+    0x00, 0xE2, 0x95, 0xA1, 0x00, 0xE2, 0x95, 0x9E, 0x00, 0xE2, 0x94, 0xBC, 0x00, 0xE2, 0x94, 0xA4,
+    0x00, 0xE2, 0x94, 0x9C, 0x00, 0xC2, 0xA6, 0x00, 0xF0, 0x9D, 0x92, 0xB7, 0x00, 0xE2, 0x81, 0x8F,
+    0x00, 0x5C, 0x00, 0xE2, 0xA7, 0x85, 0x00, 0xE2, 0x9F, 0x88, 0x00, 0xE2, 0x80, 0xA2, 0x00, 0xE2,
+    0xAA, 0xAE, 0x00, 0xC4, 0x87, 0x00, 0xE2, 0x88, 0xA9, 0x00, 0xE2, 0xA9, 0x84, 0x00, 0xE2, 0xA9,
+    0x89, 0x00, 0xE2, 0xA9, 0x8B, 0x00, 0xE2, 0xA9, 0x87, 0x00, 0xE2, 0xA9, 0x80, 0x00, 0xE2, 0x88,
+    0xA9, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0x81, 0x81, 0x00, 0xE2, 0xA9, 0x8D, 0x00, 0xC4, 0x8D, 0x00,
+    0xC3, 0xA7, 0x00, 0xC4, 0x89, 0x00, 0xE2, 0xA9, 0x8C, 0x00, 0xE2, 0xA9, 0x90, 0x00, 0xC4, 0x8B,
+    0x00, 0xE2, 0xA6, 0xB2, 0x00, 0xC2, 0xA2, 0x00, 0xF0, 0x9D, 0x94, 0xA0, 0x00, 0xD1, 0x87, 0x00,
+    0xE2, 0x9C, 0x93, 0x00, 0xCF, 0x87, 0x00, 0xE2, 0x97, 0x8B, 0x00, 0xE2, 0xA7, 0x83, 0x00, 0xCB,
+    0x86, 0x00, 0xE2, 0x89, 0x97, 0x00, 0xE2, 0x86, 0xBA, 0x00, 0xE2, 0x86, 0xBB, 0x00, 0xE2, 0x93,
+    0x88, 0x00, 0xE2, 0x8A, 0x9B, 0x00, 0xE2, 0x8A, 0x9A, 0x00, 0xE2, 0x8A, 0x9D, 0x00, 0xE2, 0xA8,
+    0x90, 0x00, 0xE2, 0xAB, 0xAF, 0x00, 0xE2, 0xA7, 0x82, 0x00, 0xE2, 0x99, 0xA3, 0x00, 0x3A, 0x00,
+    0x2C, 0x00, 0x40, 0x00, 0xE2, 0x88, 0x81, 0x00, 0xE2, 0xA9, 0xAD, 0x00, 0xF0, 0x9D, 0x95, 0x94,
+    0x00, 0xE2, 0x84, 0x97, 0x00, 0xE2, 0x86, 0xB5, 0x00, 0xE2, 0x9C, 0x97, 0x00, 0xF0, 0x9D, 0x92,
+    0xB8, 0x00, 0xE2, 0xAB, 0x8F, 0x00, 0xE2, 0xAB, 0x91, 0x00, 0xE2, 0xAB, 0x90, 0x00, 0xE2, 0xAB,
+    0x92, 0x00, 0xE2, 0x8B, 0xAF, 0x00, 0xE2, 0xA4, 0xB8, 0x00, 0xE2, 0xA4, 0xB5, 0x00, 0xE2, 0x8B,
+    0x9E, 0x00, 0xE2, 0x8B, 0x9F, 0x00, 0xE2, 0x86, 0xB6, 0x00, 0xE2, 0xA4, 0xBD, 0x00, 0xE2, 0x88,
+    0xAA, 0x00, 0xE2, 0xA9, 0x88, 0x00, 0xE2, 0xA9, 0x86, 0x00, 0xE2, 0xA9, 0x8A, 0x00, 0xE2, 0x8A,
+    0x8D, 0x00, 0xE2, 0xA9, 0x85, 0x00, 0xE2, 0x88, 0xAA, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0x86, 0xB7,
+    0x00, 0xE2, 0xA4, 0xBC, 0x00, 0xE2, 0x8B, 0x8E, 0x00, 0xE2, 0x8B, 0x8F, 0x00, 0xC2, 0xA4, 0x00,
+    0xE2, 0x88, 0xB1, 0x00, 0xE2, 0x8C, 0xAD, 0x00, 0xE2, 0xA5, 0xA5, 0x00, 0xE2, 0x80, 0xA0, 0x00,
+    0xE2, 0x84, 0xB8, 0x00, 0xE2, 0x80, 0x90, 0x00, 0xE2, 0xA4, 0x8F, 0x00, 0xC4, 0x8F, 0x00, 0xD0,
+    0xB4, 0x00, 0xE2, 0x87, 0x8A, 0x00, 0xE2, 0xA9, 0xB7, 0x00, 0xC2, 0xB0, 0x00, 0xCE, 0xB4, 0x00,
+    0xE2, 0xA6, 0xB1, 0x00, 0xE2, 0xA5, 0xBF, 0x00, 0xF0, 0x9D, 0x94, 0xA1, 0x00, 0xE2, 0x99, 0xA6,
+    0x00, 0xCF, 0x9D, 0x00, 0xE2, 0x8B, 0xB2, 0x00, 0xC3, 0xB7, 0x00, 0xE2, 0x8B, 0x87, 0x00, 0xD1,
+    0x92, 0x00, 0xE2, 0x8C, 0x9E, 0x00, 0xE2, 0x8C, 0x8D, 0x00, 0x24, 0x00, 0xF0, 0x9D, 0x95, 0x95,
+    0x00, 0xE2, 0x89, 0x91, 0x00, 0xE2, 0x88, 0xB8, 0x00, 0xE2, 0x88, 0x94, 0x00, 0xE2, 0x8A, 0xA1,
+    0x00, 0xE2, 0x8C, 0x9F, 0x00, 0xE2, 0x8C, 0x8C, 0x00, 0xF0, 0x9D, 0x92, 0xB9, 0x00, 0xD1, 0x95,
+    0x00, 0xE2, 0xA7, 0xB6, 0x00, 0xC4, 0x91, 0x00, 0xE2, 0x8B, 0xB1, 0x00, 0xE2, 0x96, 0xBF, 0x00,
+    0xE2, 0xA6, 0xA6, 0x00, 0xD1, 0x9F, 0x00, 0xE2, 0x9F, 0xBF, 0x00, 0xC3, 0xA9, 0x00, 0xE2, 0xA9,
+    0xAE, 0x00, 0xC4, 0x9B, 0x00, 0xE2, 0x89, 0x96, 0x00, 0xC3, 0xAA, 0x00, 0xE2, 0x89, 0x95, 0x00,
+    0xD1, 0x8D, 0x00, 0xC4, 0x97, 0x00, 0xE2, 0x89, 0x92, 0x00, 0xF0, 0x9D, 0x94, 0xA2, 0x00, 0xE2,
+    0xAA, 0x9A, 0x00, 0xC3, 0xA8, 0x00, 0xE2, 0xAA, 0x96, 0x00, 0xE2, 0xAA, 0x98, 0x00, 0xE2, 0xAA,
+    0x99, 0x00, 0xE2, 0x8F, 0xA7, 0x00, 0xE2, 0x84, 0x93, 0x00, 0xE2, 0xAA, 0x95, 0x00, 0xE2, 0xAA,
+    0x97, 0x00, 0xC4, 0x93, 0x00, 0xE2, 0x88, 0x85, 0x00, 0xE2, 0x80, 0x83, 0x00, 0xE2, 0x80, 0x84,
+    0x00, 0xE2, 0x80, 0x85, 0x00, 0xC5, 0x8B, 0x00, 0xE2, 0x80, 0x82, 0x00, 0xC4, 0x99, 0x00, 0xF0,
+    0x9D, 0x95, 0x96, 0x00, 0xE2, 0x8B, 0x95, 0x00, 0xE2, 0xA7, 0xA3, 0x00, 0xE2, 0xA9, 0xB1, 0x00,
+    0xCE, 0xB5, 0x00, 0xCF, 0xB5, 0x00, 0x3D, 0x00, 0xE2, 0x89, 0x9F, 0x00, 0xE2, 0xA9, 0xB8, 0x00,
+    0xE2, 0xA7, 0xA5, 0x00, 0xE2, 0x89, 0x93, 0x00, 0xE2, 0xA5, 0xB1, 0x00, 0xE2, 0x84, 0xAF, 0x00,
+    0xCE, 0xB7, 0x00, 0xC3, 0xB0, 0x00, 0xC3, 0xAB, 0x00, 0xE2, 0x82, 0xAC, 0x00, 0x21, 0x00, 0xD1,
+    0x84, 0x00, 0xE2, 0x99, 0x80, 0x00, 0xEF, 0xAC, 0x83, 0x00, 0xEF, 0xAC, 0x80, 0x00, 0xEF, 0xAC,
+    0x84, 0x00, 0xF0, 0x9D, 0x94, 0xA3, 0x00, 0xEF, 0xAC, 0x81, 0x00, 0x66, 0x6A, 0x00, 0xE2, 0x99,
+    0xAD, 0x00, 0xEF, 0xAC, 0x82, 0x00, 0xE2, 0x96, 0xB1, 0x00, 0xC6, 0x92, 0x00, 0xF0, 0x9D, 0x95,
+    0x97, 0x00, 0xE2, 0x8B, 0x94, 0x00, 0xE2, 0xAB, 0x99, 0x00, 0xE2, 0xA8, 0x8D, 0x00, 0xC2, 0xBD,
+    0x00, 0xE2, 0x85, 0x93, 0x00, 0xC2, 0xBC, 0x00, 0xE2, 0x85, 0x95, 0x00, 0xE2, 0x85, 0x99, 0x00,
+    0xE2, 0x85, 0x9B, 0x00, 0xE2, 0x85, 0x94, 0x00, 0xE2, 0x85, 0x96, 0x00, 0xC2, 0xBE, 0x00, 0xE2,
+    0x85, 0x97, 0x00, 0xE2, 0x85, 0x9C, 0x00, 0xE2, 0x85, 0x98, 0x00, 0xE2, 0x85, 0x9A, 0x00, 0xE2,
+    0x85, 0x9D, 0x00, 0xE2, 0x85, 0x9E, 0x00, 0xE2, 0x81, 0x84, 0x00, 0xE2, 0x8C, 0xA2, 0x00, 0xF0,
+    0x9D, 0x92, 0xBB, 0x00, 0xE2, 0xAA, 0x8C, 0x00, 0xC7, 0xB5, 0x00, 0xCE, 0xB3, 0x00, 0xE2, 0xAA,
+    0x86, 0x00, 0xC4, 0x9F, 0x00, 0xC4, 0x9D, 0x00, 0xD0, 0xB3, 0x00, 0xC4, 0xA1, 0x00, 0xE2, 0xAA,
+    0xA9, 0x00, 0xE2, 0xAA, 0x80, 0x00, 0xE2, 0xAA, 0x82, 0x00, 0xE2, 0xAA, 0x84, 0x00, 0xE2, 0x8B,
+    0x9B, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0xAA, 0x94, 0x00, 0xF0, 0x9D, 0x94, 0xA4, 0x00, 0xE2, 0x84,
+    0xB7, 0x00, 0xD1, 0x93, 0x00, 0xE2, 0xAA, 0x92, 0x00, 0xE2, 0xAA, 0xA5, 0x00, 0xE2, 0xAA, 0xA4,
+    0x00, 0xE2, 0x89, 0xA9, 0x00, 0xE2, 0xAA, 0x8A, 0x00, 0xE2, 0xAA, 0x88, 0x00, 0xE2, 0x8B, 0xA7,
+    0x00, 0xF0, 0x9D, 0x95, 0x98, 0x00, 0xE2, 0x84, 0x8A, 0x00, 0xE2, 0xAA, 0x8E, 0x00, 0xE2, 0xAA,
+    0x90, 0x00, 0xE2, 0xAA, 0xA7, 0x00, 0xE2, 0xA9, 0xBA, 0x00, 0xE2, 0x8B, 0x97, 0x00, 0xE2, 0xA6,
+    0x95, 0x00, 0xE2, 0xA9, 0xBC, 0x00, 0xE2, 0xA5, 0xB8, 0x00, 0xE2, 0x89, 0xA9, 0xEF, 0xB8, 0x80,
+    0x00, 0xD1, 0x8A, 0x00, 0xE2, 0xA5, 0x88, 0x00, 0xE2, 0x86, 0xAD, 0x00, 0xE2, 0x84, 0x8F, 0x00,
+    0xC4, 0xA5, 0x00, 0xE2, 0x99, 0xA5, 0x00, 0xE2, 0x80, 0xA6, 0x00, 0xE2, 0x8A, 0xB9, 0x00, 0xF0,
+    0x9D, 0x94, 0xA5, 0x00, 0xE2, 0xA4, 0xA5, 0x00, 0xE2, 0xA4, 0xA6, 0x00, 0xE2, 0x87, 0xBF, 0x00,
+    0xE2, 0x88, 0xBB, 0x00, 0xE2, 0x86, 0xA9, 0x00, 0xE2, 0x86, 0xAA, 0x00, 0xF0, 0x9D, 0x95, 0x99,
+    0x00, 0xE2, 0x80, 0x95, 0x00, 0xF0, 0x9D, 0x92, 0xBD, 0x00, 0xC4, 0xA7, 0x00, 0xE2, 0x81, 0x83,
+    0x00, 0xC3, 0xAD, 0x00, 0xC3, 0xAE, 0x00, 0xD0, 0xB8, 0x00, 0xD0, 0xB5, 0x00, 0xC2, 0xA1, 0x00,
+    0xF0, 0x9D, 0x94, 0xA6, 0x00, 0xC3, 0xAC, 0x00, 0xE2, 0xA8, 0x8C, 0x00, 0xE2, 0x88, 0xAD, 0x00,
+    0xE2, 0xA7, 0x9C, 0x00, 0xE2, 0x84, 0xA9, 0x00, 0xC4, 0xB3, 0x00, 0xC4, 0xAB, 0x00, 0xC4, 0xB1,
+    0x00, 0xE2, 0x8A, 0xB7, 0x00, 0xC6, 0xB5, 0x00, 0xE2, 0x84, 0x85, 0x00, 0xE2, 0x88, 0x9E, 0x00,
+    0xE2, 0xA7, 0x9D, 0x00, 0xE2, 0x8A, 0xBA, 0x00, 0xE2, 0xA8, 0x97, 0x00, 0xE2, 0xA8, 0xBC, 0x00,
+    0xD1, 0x91, 0x00, 0xC4, 0xAF, 0x00, 0xF0, 0x9D, 0x95, 0x9A, 0x00, 0xCE, 0xB9, 0x00, 0xC2, 0xBF,
+    0x00, 0xF0, 0x9D, 0x92, 0xBE, 0x00, 0xE2, 0x8B, 0xB9, 0x00, 0xE2, 0x8B, 0xB5, 0x00, 0xE2, 0x8B,
+    0xB4, 0x00, 0xE2, 0x8B, 0xB3, 0x00, 0xC4, 0xA9, 0x00, 0xD1, 0x96, 0x00, 0xC3, 0xAF, 0x00, 0xC4,
+    0xB5, 0x00, 0xD0, 0xB9, 0x00, 0xF0, 0x9D, 0x94, 0xA7, 0x00, 0xC8, 0xB7, 0x00, 0xF0, 0x9D, 0x95,
+    0x9B, 0x00, 0xF0, 0x9D, 0x92, 0xBF, 0x00, 0xD1, 0x98, 0x00, 0xD1, 0x94, 0x00, 0xCE, 0xBA, 0x00,
+    0xCF, 0xB0, 0x00, 0xC4, 0xB7, 0x00, 0xD0, 0xBA, 0x00, 0xF0, 0x9D, 0x94, 0xA8, 0x00, 0xC4, 0xB8,
+    0x00, 0xD1, 0x85, 0x00, 0xD1, 0x9C, 0x00, 0xF0, 0x9D, 0x95, 0x9C, 0x00, 0xF0, 0x9D, 0x93, 0x80,
+    0x00, 0xE2, 0xA4, 0x9B, 0x00, 0xE2, 0xA4, 0x8E, 0x00, 0xE2, 0xAA, 0x8B, 0x00, 0xE2, 0xA5, 0xA2,
+    0x00, 0xC4, 0xBA, 0x00, 0xE2, 0xA6, 0xB4, 0x00, 0xCE, 0xBB, 0x00, 0xE2, 0xA6, 0x91, 0x00, 0xE2,
+    0xAA, 0x85, 0x00, 0xC2, 0xAB, 0x00, 0xE2, 0xA4, 0x9F, 0x00, 0xE2, 0xA4, 0x9D, 0x00, 0xE2, 0x86,
+    0xAB, 0x00, 0xE2, 0xA4, 0xB9, 0x00, 0xE2, 0xA5, 0xB3, 0x00, 0xE2, 0x86, 0xA2, 0x00, 0xE2, 0xAA,
+    0xAB, 0x00, 0xE2, 0xA4, 0x99, 0x00, 0xE2, 0xAA, 0xAD, 0x00, 0xE2, 0xAA, 0xAD, 0xEF, 0xB8, 0x80,
+    0x00, 0xE2, 0xA4, 0x8C, 0x00, 0xE2, 0x9D, 0xB2, 0x00, 0x7B, 0x00, 0x5B, 0x00, 0xE2, 0xA6, 0x8B,
+    0x00, 0xE2, 0xA6, 0x8F, 0x00, 0xE2, 0xA6, 0x8D, 0x00, 0xC4, 0xBE, 0x00, 0xC4, 0xBC, 0x00, 0xD0,
+    0xBB, 0x00, 0xE2, 0xA4, 0xB6, 0x00, 0xE2, 0xA5, 0xA7, 0x00, 0xE2, 0xA5, 0x8B, 0x00, 0xE2, 0x86,
+    0xB2, 0x00, 0xE2, 0x89, 0xA4, 0x00, 0xE2, 0x87, 0x87, 0x00, 0xE2, 0x8B, 0x8B, 0x00, 0xE2, 0xAA,
+    0xA8, 0x00, 0xE2, 0xA9, 0xBF, 0x00, 0xE2, 0xAA, 0x81, 0x00, 0xE2, 0xAA, 0x83, 0x00, 0xE2, 0x8B,
+    0x9A, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0xAA, 0x93, 0x00, 0xE2, 0x8B, 0x96, 0x00, 0xE2, 0xA5, 0xBC,
+    0x00, 0xF0, 0x9D, 0x94, 0xA9, 0x00, 0xE2, 0xAA, 0x91, 0x00, 0xE2, 0xA5, 0xAA, 0x00, 0xE2, 0x96,
+    0x84, 0x00, 0xD1, 0x99, 0x00, 0xE2, 0xA5, 0xAB, 0x00, 0xE2, 0x97, 0xBA, 0x00, 0xC5, 0x80, 0x00,
+    0xE2, 0x8E, 0xB0, 0x00, 0xE2, 0x89, 0xA8, 0x00, 0xE2, 0xAA, 0x89, 0x00, 0xE2, 0xAA, 0x87, 0x00,
+    0xE2, 0x8B, 0xA6, 0x00, 0xE2, 0x9F, 0xAC, 0x00, 0xE2, 0x87, 0xBD, 0x00, 0xE2, 0x9F, 0xBC, 0x00,
+    0xE2, 0x86, 0xAC, 0x00, 0xE2, 0xA6, 0x85, 0x00, 0xF0, 0x9D, 0x95, 0x9D, 0x00, 0xE2, 0xA8, 0xAD,
+    0x00, 0xE2, 0xA8, 0xB4, 0x00, 0xE2, 0x88, 0x97, 0x00, 0xE2, 0x97, 0x8A, 0x00, 0x28, 0x00, 0xE2,
+    0xA6, 0x93, 0x00, 0xE2, 0xA5, 0xAD, 0x00, 0xE2, 0x80, 0x8E, 0x00, 0xE2, 0x8A, 0xBF, 0x00, 0xE2,
+    0x80, 0xB9, 0x00, 0xF0, 0x9D, 0x93, 0x81, 0x00, 0xE2, 0xAA, 0x8D, 0x00, 0xE2, 0xAA, 0x8F, 0x00,
+    0xE2, 0x80, 0x9A, 0x00, 0xC5, 0x82, 0x00, 0xE2, 0xAA, 0xA6, 0x00, 0xE2, 0xA9, 0xB9, 0x00, 0xE2,
+    0x8B, 0x89, 0x00, 0xE2, 0xA5, 0xB6, 0x00, 0xE2, 0xA9, 0xBB, 0x00, 0xE2, 0xA6, 0x96, 0x00, 0xE2,
+    0x97, 0x83, 0x00, 0xE2, 0xA5, 0x8A, 0x00, 0xE2, 0xA5, 0xA6, 0x00, 0xE2, 0x89, 0xA8, 0xEF, 0xB8,
+    0x80, 0x00, 0xE2, 0x88, 0xBA, 0x00, 0xC2, 0xAF, 0x00, 0xE2, 0x99, 0x82, 0x00, 0xE2, 0x9C, 0xA0,
+    0x00, 0xE2, 0x96, 0xAE, 0x00, 0xE2, 0xA8, 0xA9, 0x00, 0xD0, 0xBC, 0x00, 0xE2, 0x80, 0x94, 0x00,
+    0xF0, 0x9D, 0x94, 0xAA, 0x00, 0xE2, 0x84, 0xA7, 0x00, 0xC2, 0xB5, 0x00, 0xE2, 0xAB, 0xB0, 0x00,
+    0xE2, 0x88, 0x92, 0x00, 0xE2, 0xA8, 0xAA, 0x00, 0xE2, 0xAB, 0x9B, 0x00, 0xE2, 0x8A, 0xA7, 0x00,
+    0xF0, 0x9D, 0x95, 0x9E, 0x00, 0xF0, 0x9D, 0x93, 0x82, 0x00, 0xCE, 0xBC, 0x00, 0xE2, 0x8A, 0xB8,
+    0x00, 0xE2, 0x8B, 0x99, 0xCC, 0xB8, 0x00, 0xE2, 0x89, 0xAB, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0x87,
+    0x8D, 0x00, 0xE2, 0x87, 0x8E, 0x00, 0xE2, 0x8B, 0x98, 0xCC, 0xB8, 0x00, 0xE2, 0x89, 0xAA, 0xE2,
+    0x83, 0x92, 0x00, 0xE2, 0x87, 0x8F, 0x00, 0xE2, 0x8A, 0xAF, 0x00, 0xE2, 0x8A, 0xAE, 0x00, 0xC5,
+    0x84, 0x00, 0xE2, 0x88, 0xA0, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0xA9, 0xB0, 0xCC, 0xB8, 0x00, 0xE2,
+    0x89, 0x8B, 0xCC, 0xB8, 0x00, 0xC5, 0x89, 0x00, 0xE2, 0x99, 0xAE, 0x00, 0xE2, 0xA9, 0x83, 0x00,
+    0xC5, 0x88, 0x00, 0xC5, 0x86, 0x00, 0xE2, 0xA9, 0xAD, 0xCC, 0xB8, 0x00, 0xE2, 0xA9, 0x82, 0x00,
+    0xD0, 0xBD, 0x00, 0xE2, 0x80, 0x93, 0x00, 0xE2, 0x87, 0x97, 0x00, 0xE2, 0xA4, 0xA4, 0x00, 0xE2,
+    0x89, 0x90, 0xCC, 0xB8, 0x00, 0xE2, 0xA4, 0xA8, 0x00, 0xF0, 0x9D, 0x94, 0xAB, 0x00, 0xE2, 0x86,
+    0xAE, 0x00, 0xE2, 0xAB, 0xB2, 0x00, 0xE2, 0x8B, 0xBC, 0x00, 0xE2, 0x8B, 0xBA, 0x00, 0xD1, 0x9A,
+    0x00, 0xE2, 0x89, 0xA6, 0xCC, 0xB8, 0x00, 0xE2, 0x86, 0x9A, 0x00, 0xE2, 0x80, 0xA5, 0x00, 0xF0,
+    0x9D, 0x95, 0x9F, 0x00, 0xC2, 0xAC, 0x00, 0xE2, 0x8B, 0xB9, 0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xB5,
+    0xCC, 0xB8, 0x00, 0xE2, 0x8B, 0xB7, 0x00, 0xE2, 0x8B, 0xB6, 0x00, 0xE2, 0x8B, 0xBE, 0x00, 0xE2,
+    0x8B, 0xBD, 0x00, 0xE2, 0xAB, 0xBD, 0xE2, 0x83, 0xA5, 0x00, 0xE2, 0x88, 0x82, 0xCC, 0xB8, 0x00,
+    0xE2, 0xA8, 0x94, 0x00, 0xE2, 0x86, 0x9B, 0x00, 0xE2, 0xA4, 0xB3, 0xCC, 0xB8, 0x00, 0xE2, 0x86,
+    0x9D, 0xCC, 0xB8, 0x00, 0xF0, 0x9D, 0x93, 0x83, 0x00, 0xE2, 0x8A, 0x84, 0x00, 0xE2, 0xAB, 0x85,
+    0xCC, 0xB8, 0x00, 0xE2, 0x8A, 0x85, 0x00, 0xE2, 0xAB, 0x86, 0xCC, 0xB8, 0x00, 0xC3, 0xB1, 0x00,
+    0xCE, 0xBD, 0x00, 0x23, 0x00, 0xE2, 0x84, 0x96, 0x00, 0xE2, 0x80, 0x87, 0x00, 0xE2, 0x8A, 0xAD,
+    0x00, 0xE2, 0xA4, 0x84, 0x00, 0xE2, 0x89, 0x8D, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0x8A, 0xAC, 0x00,
+    0xE2, 0x89, 0xA5, 0xE2, 0x83, 0x92, 0x00, 0x3E, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0xA7, 0x9E, 0x00,
+    0xE2, 0xA4, 0x82, 0x00, 0xE2, 0x89, 0xA4, 0xE2, 0x83, 0x92, 0x00, 0x3C, 0xE2, 0x83, 0x92, 0x00,
+    0xE2, 0x8A, 0xB4, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0xA4, 0x83, 0x00, 0xE2, 0x8A, 0xB5, 0xE2, 0x83,
+    0x92, 0x00, 0xE2, 0x88, 0xBC, 0xE2, 0x83, 0x92, 0x00, 0xE2, 0x87, 0x96, 0x00, 0xE2, 0xA4, 0xA3,
+    0x00, 0xE2, 0xA4, 0xA7, 0x00, 0xC3, 0xB3, 0x00, 0xC3, 0xB4, 0x00, 0xD0, 0xBE, 0x00, 0xC5, 0x91,
+    0x00, 0xE2, 0xA8, 0xB8, 0x00, 0xE2, 0xA6, 0xBC, 0x00, 0xC5, 0x93, 0x00, 0xE2, 0xA6, 0xBF, 0x00,
+    0xF0, 0x9D, 0x94, 0xAC, 0x00, 0xCB, 0x9B, 0x00, 0xC3, 0xB2, 0x00, 0xE2, 0xA7, 0x81, 0x00, 0xE2,
+    0xA6, 0xB5, 0x00, 0xE2, 0xA6, 0xBE, 0x00, 0xE2, 0xA6, 0xBB, 0x00, 0xE2, 0xA7, 0x80, 0x00, 0xC5,
+    0x8D, 0x00, 0xCF, 0x89, 0x00, 0xCE, 0xBF, 0x00, 0xE2, 0xA6, 0xB6, 0x00, 0xF0, 0x9D, 0x95, 0xA0,
+    0x00, 0xE2, 0xA6, 0xB7, 0x00, 0xE2, 0xA6, 0xB9, 0x00, 0xE2, 0x88, 0xA8, 0x00, 0xE2, 0xA9, 0x9D,
+    0x00, 0xE2, 0x84, 0xB4, 0x00, 0xC2, 0xAA, 0x00, 0xC2, 0xBA, 0x00, 0xE2, 0x8A, 0xB6, 0x00, 0xE2,
+    0xA9, 0x96, 0x00, 0xE2, 0xA9, 0x97, 0x00, 0xE2, 0xA9, 0x9B, 0x00, 0xC3, 0xB8, 0x00, 0xE2, 0x8A,
+    0x98, 0x00, 0xC3, 0xB5, 0x00, 0xE2, 0xA8, 0xB6, 0x00, 0xC3, 0xB6, 0x00, 0xE2, 0x8C, 0xBD, 0x00,
+    0xC2, 0xB6, 0x00, 0xE2, 0xAB, 0xB3, 0x00, 0xE2, 0xAB, 0xBD, 0x00, 0xD0, 0xBF, 0x00, 0x25, 0x00,
+    0x2E, 0x00, 0xE2, 0x80, 0xB0, 0x00, 0xE2, 0x80, 0xB1, 0x00, 0xF0, 0x9D, 0x94, 0xAD, 0x00, 0xCF,
+    0x86, 0x00, 0xCF, 0x95, 0x00, 0xE2, 0x98, 0x8E, 0x00, 0xCF, 0x80, 0x00, 0xCF, 0x96, 0x00, 0xE2,
+    0x84, 0x8E, 0x00, 0x2B, 0x00, 0xE2, 0xA8, 0xA3, 0x00, 0xE2, 0xA8, 0xA2, 0x00, 0xE2, 0xA8, 0xA5,
+    0x00, 0xE2, 0xA9, 0xB2, 0x00, 0xE2, 0xA8, 0xA6, 0x00, 0xE2, 0xA8, 0xA7, 0x00, 0xE2, 0xA8, 0x95,
+    0x00, 0xF0, 0x9D, 0x95, 0xA1, 0x00, 0xC2, 0xA3, 0x00, 0xE2, 0xAA, 0xB3, 0x00, 0xE2, 0xAA, 0xB7,
+    0x00, 0xE2, 0xAA, 0xB9, 0x00, 0xE2, 0xAA, 0xB5, 0x00, 0xE2, 0x8B, 0xA8, 0x00, 0xE2, 0x80, 0xB2,
+    0x00, 0xE2, 0x8C, 0xAE, 0x00, 0xE2, 0x8C, 0x92, 0x00, 0xE2, 0x8C, 0x93, 0x00, 0xE2, 0x8A, 0xB0,
+    0x00, 0xF0, 0x9D, 0x93, 0x85, 0x00, 0xCF, 0x88, 0x00, 0xE2, 0x80, 0x88, 0x00, 0xF0, 0x9D, 0x94,
+    0xAE, 0x00, 0xF0, 0x9D, 0x95, 0xA2, 0x00, 0xE2, 0x81, 0x97, 0x00, 0xF0, 0x9D, 0x93, 0x86, 0x00,
+    0xE2, 0xA8, 0x96, 0x00, 0x3F, 0x00, 0xE2, 0xA4, 0x9C, 0x00, 0xE2, 0xA5, 0xA4, 0x00, 0xE2, 0x88,
+    0xBD, 0xCC, 0xB1, 0x00, 0xC5, 0x95, 0x00, 0xE2, 0xA6, 0xB3, 0x00, 0xE2, 0xA6, 0x92, 0x00, 0xE2,
+    0xA6, 0xA5, 0x00, 0xC2, 0xBB, 0x00, 0xE2, 0xA5, 0xB5, 0x00, 0xE2, 0xA4, 0xA0, 0x00, 0xE2, 0xA4,
+    0xB3, 0x00, 0xE2, 0xA4, 0x9E, 0x00, 0xE2, 0xA5, 0x85, 0x00, 0xE2, 0xA5, 0xB4, 0x00, 0xE2, 0x86,
+    0xA3, 0x00, 0xE2, 0x86, 0x9D, 0x00, 0xE2, 0xA4, 0x9A, 0x00, 0xE2, 0x88, 0xB6, 0x00, 0xE2, 0x9D,
+    0xB3, 0x00, 0x7D, 0x00, 0x5D, 0x00, 0xE2, 0xA6, 0x8C, 0x00, 0xE2, 0xA6, 0x8E, 0x00, 0xE2, 0xA6,
+    0x90, 0x00, 0xC5, 0x99, 0x00, 0xC5, 0x97, 0x00, 0xD1, 0x80, 0x00, 0xE2, 0xA4, 0xB7, 0x00, 0xE2,
+    0xA5, 0xA9, 0x00, 0xE2, 0x86, 0xB3, 0x00, 0xE2, 0x96, 0xAD, 0x00, 0xE2, 0xA5, 0xBD, 0x00, 0xF0,
+    0x9D, 0x94, 0xAF, 0x00, 0xE2, 0xA5, 0xAC, 0x00, 0xCF, 0x81, 0x00, 0xCF, 0xB1, 0x00, 0xE2, 0x87,
+    0x89, 0x00, 0xE2, 0x8B, 0x8C, 0x00, 0xCB, 0x9A, 0x00, 0xE2, 0x80, 0x8F, 0x00, 0xE2, 0x8E, 0xB1,
+    0x00, 0xE2, 0xAB, 0xAE, 0x00, 0xE2, 0x9F, 0xAD, 0x00, 0xE2, 0x87, 0xBE, 0x00, 0xE2, 0xA6, 0x86,
+    0x00, 0xF0, 0x9D, 0x95, 0xA3, 0x00, 0xE2, 0xA8, 0xAE, 0x00, 0xE2, 0xA8, 0xB5, 0x00, 0x29, 0x00,
+    0xE2, 0xA6, 0x94, 0x00, 0xE2, 0xA8, 0x92, 0x00, 0xE2, 0x80, 0xBA, 0x00, 0xF0, 0x9D, 0x93, 0x87,
+    0x00, 0xE2, 0x8B, 0x8A, 0x00, 0xE2, 0x96, 0xB9, 0x00, 0xE2, 0xA7, 0x8E, 0x00, 0xE2, 0xA5, 0xA8,
+    0x00, 0xE2, 0x84, 0x9E, 0x00, 0xC5, 0x9B, 0x00, 0xE2, 0xAA, 0xB4, 0x00, 0xE2, 0xAA, 0xB8, 0x00,
+    0xC5, 0xA1, 0x00, 0xC5, 0x9F, 0x00, 0xC5, 0x9D, 0x00, 0xE2, 0xAA, 0xB6, 0x00, 0xE2, 0xAA, 0xBA,
+    0x00, 0xE2, 0x8B, 0xA9, 0x00, 0xE2, 0xA8, 0x93, 0x00, 0xD1, 0x81, 0x00, 0xE2, 0x8B, 0x85, 0x00,
+    0xE2, 0xA9, 0xA6, 0x00, 0xE2, 0x87, 0x98, 0x00, 0xC2, 0xA7, 0x00, 0x3B, 0x00, 0xE2, 0xA4, 0xA9,
+    0x00, 0xE2, 0x9C, 0xB6, 0x00, 0xF0, 0x9D, 0x94, 0xB0, 0x00, 0xE2, 0x99, 0xAF, 0x00, 0xD1, 0x89,
+    0x00, 0xD1, 0x88, 0x00, 0xC2, 0xAD, 0x00, 0xCF, 0x83, 0x00, 0xCF, 0x82, 0x00, 0xE2, 0xA9, 0xAA,
+    0x00, 0xE2, 0xAA, 0x9E, 0x00, 0xE2, 0xAA, 0xA0, 0x00, 0xE2, 0xAA, 0x9D, 0x00, 0xE2, 0xAA, 0x9F,
+    0x00, 0xE2, 0x89, 0x86, 0x00, 0xE2, 0xA8, 0xA4, 0x00, 0xE2, 0xA5, 0xB2, 0x00, 0xE2, 0xA8, 0xB3,
+    0x00, 0xE2, 0xA7, 0xA4, 0x00, 0xE2, 0x8C, 0xA3, 0x00, 0xE2, 0xAA, 0xAA, 0x00, 0xE2, 0xAA, 0xAC,
+    0x00, 0xE2, 0xAA, 0xAC, 0xEF, 0xB8, 0x80, 0x00, 0xD1, 0x8C, 0x00, 0x2F, 0x00, 0xE2, 0xA7, 0x84,
+    0x00, 0xE2, 0x8C, 0xBF, 0x00, 0xF0, 0x9D, 0x95, 0xA4, 0x00, 0xE2, 0x99, 0xA0, 0x00, 0xE2, 0x8A,
+    0x93, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0x8A, 0x94, 0xEF, 0xB8, 0x80, 0x00, 0xF0, 0x9D, 0x93, 0x88,
+    0x00, 0xE2, 0x98, 0x86, 0x00, 0xE2, 0x8A, 0x82, 0x00, 0xE2, 0xAB, 0x85, 0x00, 0xE2, 0xAA, 0xBD,
+    0x00, 0xE2, 0xAB, 0x83, 0x00, 0xE2, 0xAB, 0x81, 0x00, 0xE2, 0xAB, 0x8B, 0x00, 0xE2, 0x8A, 0x8A,
+    0x00, 0xE2, 0xAA, 0xBF, 0x00, 0xE2, 0xA5, 0xB9, 0x00, 0xE2, 0xAB, 0x87, 0x00, 0xE2, 0xAB, 0x95,
+    0x00, 0xE2, 0xAB, 0x93, 0x00, 0xE2, 0x99, 0xAA, 0x00, 0xC2, 0xB9, 0x00, 0xC2, 0xB2, 0x00, 0xC2,
+    0xB3, 0x00, 0xE2, 0xAB, 0x86, 0x00, 0xE2, 0xAA, 0xBE, 0x00, 0xE2, 0xAB, 0x98, 0x00, 0xE2, 0xAB,
+    0x84, 0x00, 0xE2, 0x9F, 0x89, 0x00, 0xE2, 0xAB, 0x97, 0x00, 0xE2, 0xA5, 0xBB, 0x00, 0xE2, 0xAB,
+    0x82, 0x00, 0xE2, 0xAB, 0x8C, 0x00, 0xE2, 0x8A, 0x8B, 0x00, 0xE2, 0xAB, 0x80, 0x00, 0xE2, 0xAB,
+    0x88, 0x00, 0xE2, 0xAB, 0x94, 0x00, 0xE2, 0xAB, 0x96, 0x00, 0xE2, 0x87, 0x99, 0x00, 0xE2, 0xA4,
+    0xAA, 0x00, 0xC3, 0x9F, 0x00, 0xE2, 0x8C, 0x96, 0x00, 0xCF, 0x84, 0x00, 0xC5, 0xA5, 0x00, 0xC5,
+    0xA3, 0x00, 0xD1, 0x82, 0x00, 0xE2, 0x8C, 0x95, 0x00, 0xF0, 0x9D, 0x94, 0xB1, 0x00, 0xCE, 0xB8,
+    0x00, 0xCF, 0x91, 0x00, 0xC3, 0xBE, 0x00, 0xC3, 0x97, 0x00, 0xE2, 0xA8, 0xB1, 0x00, 0xE2, 0xA8,
+    0xB0, 0x00, 0xE2, 0x8C, 0xB6, 0x00, 0xE2, 0xAB, 0xB1, 0x00, 0xF0, 0x9D, 0x95, 0xA5, 0x00, 0xE2,
+    0xAB, 0x9A, 0x00, 0xE2, 0x80, 0xB4, 0x00, 0xE2, 0x96, 0xB5, 0x00, 0xE2, 0x89, 0x9C, 0x00, 0xE2,
+    0x97, 0xAC, 0x00, 0xE2, 0xA8, 0xBA, 0x00, 0xE2, 0xA8, 0xB9, 0x00, 0xE2, 0xA7, 0x8D, 0x00, 0xE2,
+    0xA8, 0xBB, 0x00, 0xE2, 0x8F, 0xA2, 0x00, 0xF0, 0x9D, 0x93, 0x89, 0x00, 0xD1, 0x86, 0x00, 0xD1,
+    0x9B, 0x00, 0xC5, 0xA7, 0x00, 0xE2, 0xA5, 0xA3, 0x00, 0xC3, 0xBA, 0x00, 0xD1, 0x9E, 0x00, 0xC5,
+    0xAD, 0x00, 0xC3, 0xBB, 0x00, 0xD1, 0x83, 0x00, 0xC5, 0xB1, 0x00, 0xE2, 0xA5, 0xBE, 0x00, 0xF0,
+    0x9D, 0x94, 0xB2, 0x00, 0xC3, 0xB9, 0x00, 0xE2, 0x96, 0x80, 0x00, 0xE2, 0x8C, 0x9C, 0x00, 0xE2,
+    0x8C, 0x8F, 0x00, 0xE2, 0x97, 0xB8, 0x00, 0xC5, 0xAB, 0x00, 0xC5, 0xB3, 0x00, 0xF0, 0x9D, 0x95,
+    0xA6, 0x00, 0xCF, 0x85, 0x00, 0xE2, 0x87, 0x88, 0x00, 0xE2, 0x8C, 0x9D, 0x00, 0xE2, 0x8C, 0x8E,
+    0x00, 0xC5, 0xAF, 0x00, 0xE2, 0x97, 0xB9, 0x00, 0xF0, 0x9D, 0x93, 0x8A, 0x00, 0xE2, 0x8B, 0xB0,
+    0x00, 0xC5, 0xA9, 0x00, 0xC3, 0xBC, 0x00, 0xE2, 0xA6, 0xA7, 0x00, 0xE2, 0xAB, 0xA8, 0x00, 0xE2,
+    0xAB, 0xA9, 0x00, 0xE2, 0xA6, 0x9C, 0x00, 0xE2, 0x8A, 0x8A, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0xAB,
+    0x8B, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0x8A, 0x8B, 0xEF, 0xB8, 0x80, 0x00, 0xE2, 0xAB, 0x8C, 0xEF,
+    0xB8, 0x80, 0x00, 0xD0, 0xB2, 0x00, 0xE2, 0x8A, 0xBB, 0x00, 0xE2, 0x89, 0x9A, 0x00, 0xE2, 0x8B,
+    0xAE, 0x00, 0xF0, 0x9D, 0x94, 0xB3, 0x00, 0xF0, 0x9D, 0x95, 0xA7, 0x00, 0xF0, 0x9D, 0x93, 0x8B,
+    0x00, 0xE2, 0xA6, 0x9A, 0x00, 0xC5, 0xB5, 0x00, 0xE2, 0xA9, 0x9F, 0x00, 0xE2, 0x89, 0x99, 0x00,
+    0xE2, 0x84, 0x98, 0x00, 0xF0, 0x9D, 0x94, 0xB4, 0x00, 0xF0, 0x9D, 0x95, 0xA8, 0x00, 0xF0, 0x9D,
+    0x93, 0x8C, 0x00, 0xF0, 0x9D, 0x94, 0xB5, 0x00, 0xCE, 0xBE, 0x00, 0xE2, 0x8B, 0xBB, 0x00, 0xF0,
+    0x9D, 0x95, 0xA9, 0x00, 0xF0, 0x9D, 0x93, 0x8D, 0x00, 0xC3, 0xBD, 0x00, 0xD1, 0x8F, 0x00, 0xC5,
+    0xB7, 0x00, 0xD1, 0x8B, 0x00, 0xC2, 0xA5, 0x00, 0xF0, 0x9D, 0x94, 0xB6, 0x00, 0xD1, 0x97, 0x00,
+    0xF0, 0x9D, 0x95, 0xAA, 0x00, 0xF0, 0x9D, 0x93, 0x8E, 0x00, 0xD1, 0x8E, 0x00, 0xC3, 0xBF, 0x00,
+    0xC5, 0xBA, 0x00, 0xC5, 0xBE, 0x00, 0xD0, 0xB7, 0x00, 0xC5, 0xBC, 0x00, 0xCE, 0xB6, 0x00, 0xF0,
+    0x9D, 0x94, 0xB7, 0x00, 0xD0, 0xB6, 0x00, 0xE2, 0x87, 0x9D, 0x00, 0xF0, 0x9D, 0x95, 0xAB, 0x00,
+    0xF0, 0x9D, 0x93, 0x8F, 0x00, 0xE2, 0x80, 0x8D, 0x00, 0xE2, 0x80, 0x8C, 0x00,
+};
+
+// Indexed by slot
+constexpr Entity ENTITIES[] = {
+    {0, 1839, 4}, {4, 4120, 5}, {9, 679, 3}, {12, 4786, 4}, {16, 529, 4}, {20, 3700, 6},
+    {26, 824, 15}, {41, 145, 7}, {48, 5531, 4}, {52, 1407, 3}, {55, 4278, 3}, {58, 1970, 5},
+    {63, 1379, 7}, {70, 633, 14}, {84, 4503, 5}, {89, 1657, 6}, {95, 2368, 4}, {99, 516, 21},
+    {120, 1065, 9}, {129, 5779, 3}, {132, 618, 5}, {137, 675, 10}, {147, 5718, 6}, {153, 4817, 5},
+    {158, 2597, 5}, {163, 4193, 6}, {169, 1357, 2}, {171, 5860, 4}, {175, 3575, 6}, {181, 4040, 4},
+    {185, 4332, 4}, {189, 2949, 5}, {194, 828, 5}, {199, 69, 4}, {203, 1736, 8}, {211, 1993, 6},
+    {217, 2337, 4}, {221, 2132, 8}, {229, 1205, 16}, {245, 2834, 6}, {251, 5801, 6}, {257, 824, 19},
+    {276, 1133, 15}, {291, 371, 19}, {310, 2941, 6}, {316, 5269, 6}, {322, 573, 2}, {324, 1260, 6},
+    {330, 2001, 6}, {336, 4803, 4}, {340, 2565, 5}, {345, 2128, 6}, {351, 73, 6}, {357, 356, 9},
+    {366, 4745, 4}, {370, 3801, 3}, {373, 564, 2}, {375, 125, 3}, {378, 3560, 5}, {383, 2645, 5},
+    {388, 5051, 6}, {394, 4171, 4}, {398, 348, 4}, {402, 5065, 3}, {405, 198, 4}, {409, 5645, 6},
+    {415, 2798, 2}, {417, 5418, 7}, {424, 5774, 4}, {428, 3734, 5}, {433, 444, 7}, {440, 4932, 6},
+    {446, 3025, 7}, {453, 3, 3}, {456, 3855, 10}, {466, 182, 5}, {471, 2976, 6}, {477, 1111, 20},
+    {497, 4727, 3}, {500, 3005, 5}, {505, 2882, 5}, {510, 1480, 8}, {518, 4407, 10}, {528, 924, 14},
+    {542, 4095, 6}, {548, 1057, 12}, {560, 5073, 5}, {565, 1293, 3}, {568, 274, 16}, {584, 5329, 4},
+    {588, 1744, 5}, {593, 3750, 6}, {599, 111, 4}, {603, 4328, 7}, {610, 500, 12}, {622, 3898, 5},
+    {627, 1387, 11}, {638, 2404, 7}, {645, 190, 5}, {650, 4382, 15}, {665, 5599, 3}, {668, 4786, 11},
+    {679, 3681, 4}, {683, 1159, 4}, {687, 1586, 5}, {692, 285, 5}, {697, 3564, 6}, {703, 750, 4},
+    {707, 2326, 5}, {712, 1890, 10}, {722, 3454, 4}, {726, 14, 3}, {729, 5184, 5}, {734, 1918, 10},
+    {744, 941, 10}, {754, 73, 14}, {768, 2818, 6}, {774, 352, 4}, {778, 1511, 3}, {781, 5265, 8},
+    {789, 2760, 3}, {792, 1467, 9}, {801, 1622, 5}, {806, 1432, 18}, {824, 4182, 5}, {829, 5337, 4},
+    {833, 516, 4}, {837, 4224, 5}, {842, 2836, 10}, {852, 860, 5}, {857, 2061, 2}, {859, 1507, 8},
+    {867, 5288, 6}, {873, 84, 10}, {883, 2733, 6}, {889, 4982, 6}, {895, 474, 5}, {900, 2836, 4},
+    {904, 828, 11}, {915, 5675, 4}, {919, 973, 3}, {922, 1498, 6}, {928, 4081, 7}, {935, 4564, 4},
+    {939, 653, 6}, {945, 1091, 15}, {960, 5337, 9}, {969, 285, 16}, {985, 965, 5}, {990, 3553, 6},
+    {996, 5824, 4}, {1000, 1155, 4}, {1004, 2224, 8}, {1012, 5058, 15}, {1027, 900, 5}, {1032, 2464, 3},
+    {1035, 3833, 3}, {1038, 324, 5}, {1043, 956, 14}, {1057, 496, 5}, {1062, 4250, 2}, {1064, 2786, 6},
+    {1070, 2714, 6}, {1076, 892, 13}, {1089, 577, 9}, {1098, 2906, 7}, {1105, 3645, 5}, {1110, 332, 14},
+    {1124, 486, 4}, {1128, 2765, 4}, {1132, 4916, 5}, {1137, 1906, 9}, {1146, 941, 5}, {1151, 5586, 5},
+    {1156, 328, 5}, {1161, 31, 3}, {1164, 1530, 4}, {1168, 5054, 16}, {1184, 1270, 11}, {1195, 2315, 4},
+    {1199, 1703, 10}, {1209, 1366, 6}, {1215, 904, 13}, {1228, 352, 17}, {1245, 1602, 16}, {1261, 1515, 18},
+    {1279, 3668, 5}, {1284, 1606, 14}, {1298, 734, 4}, {1302, 912, 4}, {1306, 3833, 10}, {1316, 4825, 7},
+    {1323, 3403, 5}, {1328, 154, 4}, {1332, 1566, 5}, {1337, 352, 3}, {1340, 3993, 5}, {1345, 2384, 5},
+    {1350, 4766, 6}, {1356, 1989, 6}, {1362, 5694, 6}, {1368, 3712, 4}, {1372, 3629, 6}, {1378, 2866, 4},
+    {1382, 1882, 6}, {1388, 4089, 7}, {1395, 3718, 4}, {1399, 3345, 6}, {1405, 1191, 16}, {1421, 1993, 4},
+    {1425, 1691, 6}, {1431, 1444, 7}, {1438, 4821, 7}, {1445, 1885, 5}, {1450, 288, 7}, {1457, 3352, 6},
+    {1463, 780, 4}, {1467, 1083, 7}, {1474, 5611, 6}, {1480, 80, 6}, {1486, 3878, 7}, {1493, 795, 4},
+    {1497, 4576, 7}, {1504, 3588, 8}, {1512, 2569, 6}, {1518, 4147, 6}, {1524, 4367, 5}, {1529, 4613, 6},
+    {1535, 5701, 12}, {1547, 4636, 5}, {1552, 2025, 4}, {1556, 4898, 4}, {1560, 316, 15}, {1575, 3596, 5},
+    {1580, 4774, 7}, {1587, 1171, 12}, {1599, 5108, 8}, {1607, 190, 9}, {1616, 4918, 6}, {1622, 5547, 5},
+    {1627, 395, 18}, {1645, 3298, 3}, {1648, 2064, 4}, {1652, 391, 15}, {1667, 1760, 3}, {1670, 259, 3},
+    {1673, 816, 5}, {1678, 2200, 4}, {1682, 4799, 7}, {1689, 1703, 6}, {1695, 3118, 6}, {1701, 5661, 5},
+    {1706, 3958, 14}, {1720, 1013, 2}, {1722, 2456, 5}, {1727, 2621, 5}, {1732, 695, 14}, {1746, 4849, 11},
+    {1757, 2613, 6}, {1763, 5144, 3}, {1766, 5310, 6}, {1772, 3704, 8}, {1780, 1626, 4}, {1784, 593, 3},
+    {1787, 3387, 6}, {1793, 336, 4}, {1797, 687, 6}, {1803, 88, 4}, {1807, 2480, 4}, {1811, 2706, 6},
+    {1817, 1507, 3}, {1820, 4036, 3}, {1823, 4178, 5}, {1828, 573, 12}, {1840, 948, 5}, {1845, 125, 7},
+    {1852, 5165, 5}, {1857, 872, 15}, {1872, 1830, 5}, {1877, 1574, 14}, {1891, 1558, 18}, {1909, 1069, 5},
+    {1914, 3866, 6}, {1920, 3338, 8}, {1928, 3678, 6}, {1934, 4489, 4}, {1938, 3564, 4}, {1942, 1848, 6},
+    {1948, 1922, 5}, {1953, 806, 6}, {1959, 4291, 5}, {1964, 1151, 12}, {1976, 2132, 4}, {1980, 5539, 8},
+    {1988, 1752, 3}, {1991, 4319, 5}, {1996, 5237, 5}, {2001, 4201, 3}, {2004, 840, 14}, {2018, 1095, 3},
+    {2021, 3391, 6}, {2027, 5877, 3}, {2030, 356, 4}, {2034, 4056, 5}, {2039, 3688, 6}, {2045, 2922, 6},
+    {2051, 4135, 4}, {2055, 1143, 15}, {2070, 5394, 4}, {2074, 1902, 4}, {2078, 5148, 4}, {2082, 1865, 6},
+    {2088, 1335, 5}, {2093, 2330, 5}, {2098, 3212, 5}, {2103, 4394, 4}, {2107, 4829, 8}, {2115, 2136, 4},
+    {2119, 2305, 4}, {2123, 932, 3}, {2126, 4525, 6}, {2132, 1874, 6}, {2138, 4339, 6}, {2144, 3077, 6},
+    {2150, 2175, 6}, {2156, 5180, 4}, {2160, 4124, 5}, {2165, 1910, 5}, {2170, 1630, 3}, {2173, 1675, 5},
+    {2178, 5051, 4}, {2182, 3061, 6}, {2188, 525, 6}, {2194, 387, 18}, {2212, 4299, 6}, {2218, 4010, 6},
+    {2224, 1181, 17}, {2241, 403, 12}, {2253, 4014, 5}, {2258, 5077, 5}, {2263, 3783, 6}, {2269, 2192, 5},
+    {2274, 860, 7}, {2281, 47, 5}, {2286, 1031, 14}, {2300, 4667, 3}, {2303, 5607, 5}, {2308, 0, 5},
+    {2313, 4786, 6}, {2319, 3162, 6}, {2325, 2968, 4}, {2329, 816, 4}, {2333, 1978, 3}, {2336, 3746, 6},
+    {2342, 5165, 11}, {2353, 3065, 7}, {2360, 759, 6}, {2366, 4655, 5}, {2371, 2232, 8}, {2379, 5807, 5},
+    {2384, 441, 6}, {2390, 3932, 6}, {2396, 1736, 4}, {2400, 5564, 4}, {2404, 1946, 7}, {2411, 301, 3},
+    {2414, 1069, 7}, {2421, 5133, 7}, {2428, 4783, 3}, {2431, 1281, 8}, {2439, 2212, 3}, {2442, 1285, 6},
+    {2448, 3636, 5}, {2453, 5410, 7}, {2460, 2318, 5}, {2465, 516, 11}, {2476, 952, 5}, {2481, 1225, 7},
+    {2488, 5489, 8}, {2496, 451, 16}, {2512, 1432, 11}, {2523, 625, 4}, {2527, 824, 5}, {2532, 1297, 14},
+    {2546, 2420, 5}, {2551, 1191, 7}, {2558, 301, 9}, {2567, 2408, 5}, {2572, 544, 6}, {2578, 292, 2},
+    {2580, 138, 7}, {2587, 2276, 5}, {2592, 482, 11}, {2603, 4640, 3}, {2606, 1703, 17}, {2623, 5148, 10},
+    {2633, 1707, 14}, {2647, 3142, 5}, {2652, 3042, 6}, {2658, 1626, 7}, {2665, 2953, 5}, {2670, 1101, 4},
+    {2674, 65, 5}, {2679, 2698, 6}, {2685, 5333, 6}, {2691, 4994, 6}, {2697, 4355, 5}, {2702, 2683, 4},
+    {2706, 1448, 5}, {2711, 4845, 4}, {2715, 2424, 4}, {2719, 467, 7}, {2726, 2432, 17}, {2743, 2097, 4},
+    {2747, 3086, 4}, {2751, 965, 14}, {2765, 3913, 4}, {2769, 5804, 4}, {2773, 2998, 5}, {2778, 4189, 4},
+    {2782, 3685, 5}, {2787, 1618, 12}, {2799, 202, 4}, {2803, 3035, 6}, {2809, 158, 6}, {2815, 3974, 7},
+    {2822, 5069, 10}, {2832, 304, 6}, {2838, 647, 5}, {2843, 3356, 6}, {2849, 1663, 3}, {2852, 1095, 5},
+    {2857, 1315, 6}, {2863, 629, 4}, {2867, 1606, 5}, {2872, 1707, 5}, {2877, 916, 7}, {2884, 4633, 5},
+    {2889, 1614, 4}, {2893, 1570, 13}, {2906, 65, 6}, {2912, 3224, 6}, {2918, 11, 5}, {2923, 1989, 4},
+    {2927, 336, 16}, {2943, 999, 3}, {2946, 848, 9}, {2955, 1460, 4}, {2959, 2268, 6}, {2965, 3235, 5},
+    {2970, 154, 9}, {2979, 4040, 8}, {2987, 104, 6}, {2993, 597, 12}, {3005, 5442, 6}, {3011, 1309, 2},
+    {3013, 625, 12}, {3025, 38, 4}, {3029, 5112, 6}, {3035, 504, 3}, {3038, 3470, 5}, {3043, 2549, 5},
+    {3048, 162, 5}, {3053, 2729, 5}, {3058, 4064, 14}, {3072, 5665, 6}, {3078, 3485, 3}, {3081, 4709, 4},
+    {3085, 1260, 21}, {3106, 4217, 5}, {3111, 1950, 5}, {3116, 2279, 4}, {3120, 2994, 14}, {3134, 288, 4},
+    {3138, 1270, 5}, {3143, 1077, 13}, {3156, 3753, 5}, {3161, 3256, 5}, {3166, 1476, 8}, {3174, 2991, 3},
+    {3177, 3792, 8}, {3185, 3310, 4}, {3189, 880, 5}, {3194, 1715, 5}, {3199, 4245, 4}, {3203, 80, 7},
+    {3210, 1250, 3}, {3213, 4625, 4}, {3217, 1246, 14}, {3231, 5615, 6}, {3237, 2333, 6}, {3243, 3815, 4},
+    {3247, 2489, 5}, {3252, 980, 2}, {3254, 3201, 6}, {3260, 3016, 3}, {3263, 101, 5}, {3268, 55, 7},
+    {3275, 4521, 5}, {3280, 529, 10}, {3290, 3664, 6}, {3296, 952, 18}, {3314, 3215, 4}, {3318, 1480, 3},
+    {3321, 2337, 7}, {3328, 1752, 3}, {3331, 1117, 5}, {3336, 198, 6}, {3342, 427, 5}, {3347, 924, 8},
+    {3355, 5324, 4}, {3359, 1744, 11}, {3370, 2240, 8}, {3378, 1159, 11}, {3389, 1301, 4}, {3393, 5837, 4},
+    {3397, 356, 9}, {3406, 5217, 4}, {3410, 2110, 4}, {3414, 3178, 11}, {3425, 1201, 5}, {3430, 1930, 13},
+    {3443, 5745, 7}, {3450, 4922, 4}, {3454, 1467, 4}, {3458, 3142, 13}, {3471, 336, 7}, {3478, 5752, 6},
+    {3484, 2353, 8}, {3492, 1448, 4}, {3496, 4128, 5}, {3501, 3178, 3}, {3504, 1748, 13}, {3517, 1894, 12},
+    {3529, 332, 20}, {3549, 5735, 4}, {3553, 121, 20}, {3573, 1281, 4}, {3577, 4954, 7}, {3584, 1530, 15},
+    {3599, 2141, 6}, {3605, 1578, 5}, {3610, 4089, 3}, {3613, 621, 3}, {3616, 1147, 7}, {3623, 1087, 3},
+    {3626, 4838, 5}, {3631, 4386, 5}, {3636, 1985, 6}, {3642, 744, 6}, {3648, 4052, 5}, {3653, 1448, 6},
+    {3659, 1691, 6}, {3665, 238, 4}, {3669, 328, 24}, {3693, 4018, 4}, {3697, 3035, 13}, {3710, 4189, 7},
+    {3717, 1306, 6}, {3723, 1671, 12}, {3735, 235, 4}, {3739, 707, 4}, {3743, 3446, 7}, {3750, 4435, 7},
+    {3757, 2561, 5}, {3762, 610, 6}, {3768, 1428, 3}, {3771, 3238, 6}, {3777, 1956, 5}, {3782, 5006, 7},
+    {3789, 2408, 15}, {3804, 1133, 5}, {3809, 5233, 4}, {3813, 1117, 15}, {3828, 3364, 6}, {3834, 1416, 6},
+    {3840, 5708, 6}, {3846, 2020, 4}, {3850, 1570, 6}, {3856, 4274, 5}, {3861, 5523, 6}, {3867, 77, 3},
+    {3870, 1127, 12}, {3882, 5426, 10}, {3892, 84, 4}, {3896, 5169, 6}, {3902, 4159, 12}, {3914, 5229, 6},
+    {3920, 3407, 4}, {3924, 4556, 7}, {3931, 2898, 11}, {3942, 1554, 5}, {3947, 312, 4}, {3951, 4263, 3},
+    {3954, 3426, 6}, {3960, 2802, 4}, {3964, 4926, 4}, {3968, 2364, 7}, {3975, 1542, 5}, {3980, 178, 15},
+    {3995, 2436, 5}, {4000, 1818, 3}, {4003, 2037, 8}, {4011, 186, 6}, {4017, 3021, 5}, {4022, 433, 4},
+    {4026, 4886, 3}, {4029, 5687, 12}, {4041, 3208, 4}, {4045, 2930, 5}, {4050, 4493, 5}, {4055, 892, 5},
+    {4060, 3375, 6}, {4066, 1634, 11}, {4077, 5471, 6}, {4083, 1930, 5}, {4088, 4085, 6}, {4094, 924, 3},
+    {4097, 2341, 5}, {4102, 691, 14}, {4116, 5141, 6}, {4122, 1888, 6}, {4128, 1049, 4}, {4132, 2440, 18},
+    {4150, 1586, 18}, {4168, 3942, 7}, {4175, 2941, 15}, {4190, 478, 11}, {4201, 2710, 6}, {4207, 2886, 7},
+    {4214, 1942, 14}, {4228, 4336, 6}, {4234, 1953, 7}, {4241, 1101, 17}, {4258, 1428, 6}, {4264, 1644, 6},
+    {4270, 2653, 5}, {4275, 912, 13}, {4288, 3848, 6}, {4294, 4401, 3}, {4297, 2345, 6}, {4303, 84, 6},
+    {4309, 5461, 6}, {4315, 1270, 7}, {4322, 328, 18}, {4340, 691, 2}, {4342, 1530, 10}, {4352, 2750, 4},
+    {4356, 231, 8}, {4364, 5740, 4}, {4368, 62, 4}, {4372, 3913, 6}, {4378, 4342, 8}, {4386, 5592, 6},
+    {4392, 2292, 3}, {4395, 5656, 4}, {4399, 2357, 3}, {4402, 3600, 6}, {4408, 2775, 3}, {4411, 415, 3},
+    {4414, 633, 4}, {4418, 585, 14}, {4432, 2810, 5}, {4437, 3723, 4}, {4441, 3978, 8}, {4449, 3057, 4},
+    {4453, 500, 2}, {4455, 4994, 4}, {4459, 3870, 6}, {4465, 4313, 4}, {4469, 320, 4}, {4473, 4616, 5},
+    {4478, 210, 8}, {4486, 4029, 6}, {4492, 3726, 6}, {4498, 1031, 21}, {4519, 1671, 7}, {4526, 4731, 6},
+    {4532, 5220, 3}, {4535, 2910, 3}, {4538, 121, 2}, {4540, 379, 5}, {4545, 3008, 7}, {4552, 1254, 4},
+    {4556, 3612, 4}, {4560, 3325, 4}, {4564, 1732, 11}, {4575, 1143, 20}, {4595, 3505, 4}, {4599, 2768, 9},
+    {4608, 4468, 5}, {4613, 1444, 4}, {4617, 4770, 6}, {4623, 965, 7}, {4630, 274, 5}, {4635, 2086, 5},
+    {4640, 1424, 4}, {4644, 1035, 7}, {4651, 2392, 6}, {4657, 4515, 3}, {4660, 4805, 8}, {4668, 1077, 5},
+    {4673, 5422, 7}, {4680, 5377, 6}, {4686, 1622, 11}, {4697, 2718, 4}, {4701, 2388, 7}, {4708, 2521, 5},
+    {4713, 1647, 6}, {4719, 3882, 6}, {4725, 1254, 7}, {4732, 803, 6}, {4738, 1566, 8}, {4746, 80, 7},
+    {4753, 2379, 3}, {4756, 194, 21}, {4777, 2988, 6}, {4783, 4719, 4}, {4787, 3232, 7}, {4794, 3950, 4},
+    {4798, 2416, 6}, {4804, 888, 15}, {4819, 2541, 4}, {4823, 4881, 4}, {4827, 1719, 4}, {4831, 2015, 3},
+    {4834, 1065, 20}, {4854, 2509, 5}, {4859, 5543, 7}, {4866, 4072, 4}, {4870, 4974, 6}, {4876, 2037, 5},
+    {4881, 3905, 5}, {4886, 1732, 4}, {4890, 783, 2}, {4892, 852, 14}, {4906, 1538, 15}, {4921, 2384, 7},
+    {4928, 5027, 4}, {4932, 1254, 16}, {4948, 3419, 5}, {4953, 2388, 5}, {4958, 3412, 3}, {4961, 1775, 5},
+    {4966, 2272, 7}, {4973, 4551, 4}, {4977, 1997, 3}, {4980, 4232, 4}, {4984, 2310, 6}, {4990, 2167, 5},
+    {4995, 5495, 5}, {5000, 1091, 4}, {5004, 1660, 5}, {5009, 4701, 3}, {5012, 2360, 6}, {5018, 2260, 7},
+    {5025, 702, 4}, {5029, 4671, 5}, {5034, 1818, 8}, {5042, 1650, 2}, {5044, 223, 3}, {5047, 5214, 6},
+    {5053, 5769, 4}, {5057, 1165, 9}, {5066, 3546, 4}, {5070, 4415, 4}, {5074, 117, 3}, {5077, 2322, 4},
+    {5081, 2164, 3}, {5084, 4111, 6}, {5090, 3708, 5}, {5095, 3132, 6}, {5101, 2972, 6}, {5107, 5477, 6},
+    {5113, 364, 16}, {5129, 1641, 4}, {5133, 5361, 7}, {5140, 1582, 16}, {5156, 4373, 4}, {5160, 669, 6},
+    {5166, 1073, 8}, {5174, 3435, 4}, {5178, 1460, 4}, {5182, 3841, 6}, {5188, 840, 5}, {5193, 2212, 5},
+    {5198, 900, 13}, {5211, 206, 9}, {5220, 3046, 6}, {5226, 1264, 16}, {5242, 1814, 6}, {5248, 1205, 14},
+    {5262, 589, 7}, {5269, 1037, 3}, {5272, 2292, 8}, {5280, 791, 4}, {5284, 3273, 4}, {5288, 4594, 5},
+    {5293, 2092, 3}, {5296, 2448, 5}, {5301, 1501, 6}, {5307, 1049, 8}, {5315, 3890, 6}, {5321, 1383, 9},
+    {5330, 3522, 4}, {5334, 3759, 5}, {5339, 577, 3}, {5342, 403, 10}, {5352, 2673, 4}, {5356, 5535, 6},
+    {5362, 5791, 4}, {5366, 352, 8}, {5374, 1511, 14}, {5388, 4204, 5}, {5393, 3267, 3}, {5396, 462, 4},
+    {5400, 1215, 6}, {5406, 227, 6}, {5412, 1678, 6}, {5418, 3970, 6}, {5424, 2806, 4}, {5428, 5726, 6},
+    {5434, 4270, 5}, {5439, 4540, 6}, {5445, 5031, 4}, {5449, 5756, 6}, {5455, 5152, 6}, {5461, 593, 17},
+    {5478, 1760, 6}, {5484, 283, 16}, {5500, 4950, 6}, {5506, 606, 2}, {5508, 3474, 4}, {5512, 5450, 5},
+    {5517, 1147, 5}, {5522, 4605, 6}, {5528, 1707, 8}, {5536, 1934, 3}, {5539, 559, 3}, {5542, 4295, 6},
+    {5548, 1614, 5}, {5553, 174, 21}, {5574, 4680, 4}, {5578, 1756, 3}, {5581, 589, 11}, {5592, 2525, 5},
+    {5597, 625, 6}, {5603, 1391, 15}, {5618, 1277, 16}, {5634, 3279, 3}, {5637, 4845, 10}, {5647, 3132, 7},
+    {5654, 1888, 8}, {5662, 1448, 12}, {5674, 1379, 5}, {5679, 2545, 5}, {5684, 4853, 8}, {5692, 564, 3},
+    {5695, 589, 2}, {5697, 1534, 5}, {5702, 444, 5}, {5707, 5249, 5}, {5712, 4512, 2}, {5714, 444, 4},
+    {5718, 4107, 5}, {5723, 421, 6}, {5729, 969, 15}, {5744, 5604, 6}, {5750, 4503, 10}, {5760, 5245, 5},
+    {5765, 1353, 5}, {5770, 5253, 7}, {5777, 162, 10}, {5787, 2573, 5}, {5792, 4103, 3}, {5795, 430, 3},
+    {5798, 1530, 10}, {5808, 2661, 6}, {5814, 1083, 6}, {5820, 2984, 5}, {5825, 5583, 6}, {5831, 1800, 6},
+    {5837, 956, 5}, {5842, 2625, 5}, {5847, 3633, 6}, {5853, 2208, 4}, {5857, 2007, 6}, {5863, 5881, 4},
+    {5867, 3837, 4}, {5871, 4705, 5}, {5876, 5306, 9}, {5885, 1175, 23}, {5908, 5341, 6}, {5914, 4509, 6},
+    {5920, 2244, 8}, {5928, 5481, 3}, {5931, 5277, 4}, {5935, 2326, 8}, {5943, 1715, 11}, {5954, 166, 6},
+    {5960, 65, 9}, {5969, 2178, 5}, {5974, 5426, 5}, {5979, 2248, 8}, {5987, 252, 13}, {6000, 3617, 6},
+    {6006, 4443, 7}, {6013, 1187, 11}, {6024, 5089, 4}, {6028, 3542, 6}, {6034, 1804, 5}, {6039, 2849, 6},
+    {6045, 2080, 4}, {6049, 2783, 4}, {6053, 3232, 4}, {6057, 4962, 6}, {6063, 3403, 6}, {6069, 2957, 6},
+    {6075, 5293, 4}, {6079, 490, 3}, {6082, 1934, 6}, {6088, 4529, 6}, {6094, 2400, 6}, {6100, 2553, 5},
+    {6105, 5016, 3}, {6108, 5188, 5}, {6113, 2513, 5}, {6118, 4877, 6}, {6124, 2798, 8}, {6132, 5489, 8},
+    {6140, 5125, 13}, {6153, 5197, 6}, {6159, 2890, 7}, {6166, 308, 8}, {6174, 2412, 5}, {6179, 1946, 15},
+    {6194, 55, 6}, {6200, 43, 13}, {6213, 4978, 5}, {6218, 336, 10}, {6228, 312, 15}, {6243, 1321, 3},
+    {6246, 3061, 8}, {6254, 101, 5}, {6259, 1127, 6}, {6265, 3738, 7}, {6272, 108, 4}, {6276, 5085, 5},
+    {6281, 104, 12}, {6293, 5527, 4}, {6297, 5019, 4}, {6301, 4325, 5}, {6306, 1711, 19}, {6325, 1786, 6},
+    {6331, 973, 3}, {6334, 50, 4}, {6338, 507, 3}, {6341, 1778, 4}, {6345, 142, 4}, {6349, 178, 6},
+    {6355, 1511, 8}, {6363, 5514, 4}, {6367, 1016, 4}, {6371, 5173, 8}, {6379, 2980, 4}, {6383, 1471, 4},
+    {6387, 4849, 5}, {6392, 3489, 5}, {6397, 816, 9}, {6406, 665, 5}, {6411, 1250, 5}, {6416, 5701, 6},
+    {6422, 5551, 7}, {6429, 252, 5}, {6434, 4935, 8}, {6442, 368, 9}, {6451, 2641, 5}, {6456, 1818, 6},
+    {6462, 3032, 6}, {6468, 2830, 5}, {6473, 4978, 15}, {6488, 1748, 7}, {6495, 4986, 5}, {6500, 3136, 3},
+    {6503, 3742, 5}, {6508, 3158, 10}, {6518, 2144, 6}, {6524, 717, 5}, {6529, 174, 5}, {6534, 665, 2},
+    {6536, 2609, 7}, {6543, 474, 10}, {6553, 35, 5}, {6558, 2128, 3}, {6561, 4382, 5}, {6566, 1215, 21},
+    {6587, 5402, 7}, {6594, 5039, 3}, {6597, 3989, 6}, {6603, 5241, 4}, {6607, 4947, 5}, {6612, 770, 4},
+    {6616, 977, 6}, {6622, 3954, 2}, {6624, 2683, 6}, {6630, 3786, 5}, {6635, 1748, 5}, {6640, 1515, 17},
+    {6657, 2083, 6}, {6663, 5834, 4}, {6667, 512, 17}, {6684, 1073, 2}, {6686, 650, 4}, {6690, 3929, 6},
+    {6696, 1550, 18}, {6714, 277, 14}, {6728, 1898, 16}, {6744, 2725, 5}, {6749, 3174, 3}, {6752, 640, 6},
+    {6758, 4213, 3}, {6761, 2051, 4}, {6765, 3915, 4}, {6769, 202, 9}, {6778, 166, 11}, {6789, 644, 4},
+    {6793, 4752, 4}, {6797, 2400, 8}, {6805, 1413, 9}, {6814, 3530, 6}, {6820, 4044, 4}, {6824, 3917, 5},
+    {6829, 5058, 6}, {6835, 65, 8}, {6843, 1289, 17}, {6860, 379, 15}, {6875, 2330, 11}, {6886, 5784, 2},
+    {6888, 665, 3}, {6891, 3546, 9}, {6900, 5317, 6}, {6906, 496, 6}, {6912, 1111, 9}, {6921, 2204, 8},
+    {6929, 1515, 5}, {6934, 5694, 13}, {6947, 3081, 4}, {6951, 4533, 4}, {6955, 1610, 14}, {6969, 723, 5},
+    {6974, 2188, 5}, {6979, 3874, 6}, {6985, 3756, 4}, {6989, 4684, 4}, {6993, 1332, 6}, {6999, 332, 5},
+    {7004, 1369, 6}, {7010, 114, 6}, {7016, 2918, 6}, {7022, 2669, 5}, {7027, 1606, 11}, {7038, 1486, 4},
+    {7042, 3489, 3}, {7045, 5210, 5}, {7050, 2736, 6}, {7056, 1687, 5}, {7061, 4032, 6}, {7067, 1724, 6},
+    {7073, 2790, 15}, {7088, 3514, 5}, {7093, 4741, 8}, {7101, 3556, 7}, {7108, 5846, 3}, {7111, 2284, 3},
+    {7114, 3429, 5}, {7119, 2256, 5}, {7124, 3604, 6}, {7130, 3186, 5}, {7135, 2151, 3}, {7138, 4151, 7},
+    {7145, 348, 11}, {7156, 3812, 4}, {7160, 1028, 3}, {7163, 945, 6}, {7169, 809, 3}, {7172, 952, 18},
+    {7190, 3762, 3}, {7193, 151, 3}, {7196, 3583, 3}, {7199, 2629, 5}, {7204, 659, 3}, {7207, 4458, 5},
+    {7212, 4464, 7}, {7219, 218, 4}, {7223, 1107, 4}, {7227, 28, 5}, {7232, 928, 4}, {7236, 5438, 6},
+    {7242, 1967, 4}, {7246, 3303, 5}, {7251, 3360, 6}, {7257, 5273, 3}, {7260, 4060, 10}, {7270, 4697, 2},
+    {7272, 1807, 10}, {7282, 4447, 7}, {7289, 1922, 16}, {7305, 1946, 5}, {7310, 5044, 6}, {7316, 1452, 4},
+    {7320, 1740, 13}, {7333, 2424, 12}, {7345, 762, 3}, {7348, 1691, 3}, {7351, 412, 6}, {7357, 4253, 5},
+    {7362, 4629, 6}, {7368, 1630, 3}, {7371, 5048, 3}, {7374, 516, 6}, {7380, 256, 6}, {7386, 4359, 5},
+    {7391, 3349, 6}, {7397, 4738, 6}, {7403, 5570, 6}, {7409, 3765, 3}, {7412, 2601, 5}, {7417, 538, 5},
+    {7422, 214, 5}, {7427, 2119, 3}, {7430, 788, 6}, {7436, 3825, 6}, {7442, 541, 6}, {7448, 2609, 5},
+    {7453, 1448, 9}, {7462, 2786, 4}, {7466, 1768, 5}, {7471, 2264, 8}, {7479, 4889, 6}, {7485, 1376, 4},
+    {7489, 1728, 6}, {7495, 1756, 6}, {7501, 5863, 7}, {7508, 5353, 5}, {7513, 4996, 4}, {7517, 2069, 4},
+    {7521, 2452, 5}, {7526, 3608, 6}, {7532, 1091, 3}, {7535, 1462, 3}, {7538, 948, 13}, {7551, 1818, 5},
+    {7556, 1031, 19}, {7575, 4499, 4}, {7579, 2228, 8}, {7587, 739, 4}, {7591, 2333, 9}, {7600, 3395, 6},
+    {7606, 2349, 8}, {7614, 1598, 14}, {7628, 2794, 16}, {7644, 2440, 5}, {7649, 3530, 5}, {7654, 988, 3},
+    {7657, 5849, 4}, {7661, 3228, 5}, {7666, 2089, 3}, {7669, 1800, 9}, {7678, 324, 13}, {7691, 844, 17},
+    {7708, 1428, 13}, {7721, 5385, 4}, {7725, 1554, 16}, {7741, 3729, 4}, {7745, 379, 14}, {7759, 1997, 8},
+    {7767, 4583, 6}, {7773, 3189, 6}, {7779, 2878, 5}, {7784, 5649, 5}, {7789, 5641, 8}, {7797, 1095, 19},
+    {7816, 1711, 10}, {7826, 4619, 3}, {7829, 3626, 6}, {7835, 900, 10}, {7845, 3608, 14}, {7859, 2236, 8},
+    {7867, 4068, 5}, {7872, 3197, 6}, {7878, 2505, 4}, {7882, 4197, 6}, {7888, 2178, 7}, {7895, 2657, 5},
+    {7900, 1293, 7}, {7907, 1997, 4}, {7911, 312, 9}, {7920, 1022, 6}, {7926, 1942, 7}, {7933, 5637, 5},
+    {7938, 710, 4}, {7942, 148, 6}, {7948, 3104, 7}, {7955, 1246, 5}, {7960, 3909, 5}, {7965, 4363, 6},
+    {7971, 2964, 6}, {7977, 3935, 3}, {7980, 2252, 8}, {7988, 482, 4}, {7992, 5102, 4}, {7996, 4257, 3},
+    {7999, 1147, 3}, {8002, 4167, 7}, {8009, 3244, 7}, {8016, 1586, 15}, {8031, 3282, 6}, {8037, 3057, 8},
+    {8045, 5205, 3}, {8048, 3820, 4}, {8052, 1822, 4}, {8056, 3012, 6}, {8062, 4645, 4}, {8066, 2980, 6},
+    {8072, 1830, 2}, {8074, 4759, 5}, {8079, 5281, 5}, {8084, 1562, 10}, {8094, 5872, 4}, {8098, 91, 3},
+    {8101, 3844, 8}, {8109, 1868, 5}, {8114, 4036, 5}, {8119, 812, 4}, {8123, 1053, 3}, {8126, 111, 4},
+    {8130, 4390, 3}, {8133, 3568, 5}, {8138, 4439, 7}, {8145, 4715, 6}, {8151, 3672, 5}, {8156, 96, 4},
+    {8160, 3050, 6}, {8166, 4132, 6}, {8172, 1858, 8}, {8180, 1395, 4}, {8184, 5611, 8}, {8192, 3151, 2},
+    {8194, 2360, 5}, {8199, 2074, 4}, {8203, 2416, 8}, {8211, 4228, 7}, {8218, 5394, 9}, {8227, 5641, 6},
+    {8233, 5069, 6}, {8239, 3806, 6}, {8245, 1942, 5}, {8250, 3052, 4}, {8254, 2857, 5}, {8259, 4974, 14},
+    {8273, 3770, 5}, {8278, 1542, 12}, {8290, 1004, 2}, {8292, 2753, 7}, {8299, 3146, 3}, {8302, 1764, 13},
+    {8315, 2125, 4}, {8319, 2001, 12}, {8331, 3870, 13}, {8344, 399, 7}, {8351, 3277, 4}, {8355, 3579, 6},
+    {8361, 2469, 7}, {8368, 581, 4}, {8372, 4689, 4}, {8376, 5098, 7}, {8383, 5197, 4}, {8387, 1871, 3},
+    {8390, 3314, 5}, {8395, 4893, 3}, {8398, 2310, 3}, {8401, 840, 15}, {8416, 896, 15}, {8431, 5498, 8},
+    {8439, 1822, 10}, {8449, 178, 5}, {8454, 283, 5}, {8459, 3571, 9}, {8468, 344, 13}, {8481, 1201, 7},
+    {8488, 3993, 7}, {8495, 629, 11}, {8506, 17, 3}, {8509, 2182, 5}, {8514, 2953, 10}, {8524, 912, 2},
+    {8526, 2679, 8}, {8534, 3966, 5}, {8539, 1590, 17}, {8556, 8, 6}, {8562, 3778, 4}, {8566, 1229, 17},
+    {8583, 301, 3}, {8586, 2822, 7}, {8593, 280, 22}, {8615, 4903, 6}, {8621, 4861, 5}, {8626, 1239, 9},
+    {8635, 4303, 6}, {8641, 4407, 5}, {8646, 262, 3}, {8649, 4099, 6}, {8655, 3330, 9}, {8664, 1413, 2},
+    {8666, 2460, 5}, {8671, 3270, 4}, {8675, 1205, 5}, {8680, 991, 11}, {8691, 726, 3}, {8694, 2157, 3},
+    {8697, 3660, 5}, {8702, 1457, 3}, {8705, 2007, 2}, {8707, 1440, 5}, {8712, 2371, 4}, {8716, 1413, 6},
+    {8722, 3205, 3}, {8725, 3039, 4}, {8729, 864, 12}, {8741, 459, 5}, {8746, 1420, 2}, {8748, 5013, 6},
+    {8754, 1436, 13}, {8767, 1061, 9}, {8776, 148, 9}, {8785, 288, 7}, {8792, 1031, 18}, {8810, 2216, 4},
+    {8814, 2945, 7}, {8821, 2396, 6}, {8827, 4348, 4}, {8831, 3073, 8}, {8839, 1490, 4}, {8843, 568, 4},
+    {8847, 1839, 9}, {8856, 1598, 5}, {8861, 4291, 11}, {8872, 3675, 5}, {8877, 2757, 4}, {8881, 856, 15},
+    {8896, 1107, 14}, {8910, 5158, 5}, {8915, 884, 16}, {8931, 5489, 6}, {8937, 4236, 6}, {8943, 3792, 6},
+    {8949, 4674, 5}, {8954, 5671, 7}, {8961, 640, 5}, {8966, 533, 4}, {8970, 3028, 5}, {8975, 816, 9},
+    {8984, 1671, 4}, {8988, 277, 3}, {8991, 1902, 5}, {8996, 4143, 6}, {9002, 2844, 4}, {9006, 5813, 3},
+    {9009, 1197, 21}, {9030, 1341, 7}, {9037, 672, 5}, {9042, 1654, 6}, {9048, 5623, 5}, {9053, 5852, 4},
+    {9057, 3604, 13}, {9070, 3660, 4}, {9074, 4423, 6}, {9080, 2436, 17}, {9097, 5687, 6}, {9103, 3925, 7},
+    {9110, 4813, 6}, {9116, 872, 12}, {9128, 5195, 4}, {9132, 5169, 8}, {9140, 4270, 10}, {9150, 3189, 5},
+    {9155, 3882, 13}, {9168, 1246, 9}, {9177, 4128, 6}, {9183, 3166, 2}, {9185, 348, 17}, {9202, 478, 5},
+    {9207, 5821, 4}, {9211, 470, 5}, {9216, 1338, 5}, {9221, 5161, 4}, {9225, 556, 4}, {9229, 1121, 15},
+    {9244, 1526, 6}, {9250, 1277, 9}, {9259, 1678, 11}, {9270, 1826, 14}, {9284, 5223, 5}, {9289, 1349, 5},
+    {9294, 25, 5}, {9299, 1519, 5}, {9304, 4768, 6}, {9310, 816, 14}, {9324, 4970, 7}, {9331, 3588, 6},
+    {9337, 1854, 4}, {9341, 606, 2}, {9343, 3139, 4}, {9347, 3189, 10}, {9357, 577, 16}, {9373, 1546, 18},
+    {9391, 5177, 3}, {9394, 2902, 6}, {9400, 1598, 13}, {9413, 1578, 13}, {9426, 4873, 8}, {9434, 182, 10},
+    {9444, 1187, 5}, {9449, 2633, 4}, {9453, 4651, 3}, {9456, 710, 8}, {9464, 340, 5}, {9469, 320, 20},
+    {9489, 775, 4}, {9493, 2537, 5}, {9498, 129, 6}, {9504, 753, 4}, {9508, 1235, 22}, {9530, 1361, 4},
+    {9534, 820, 12}, {9546, 3921, 7}, {9553, 1913, 4}, {9557, 547, 6}, {9563, 4796, 5}, {9568, 320, 14},
+    {9582, 2894, 5}, {9587, 5261, 6}, {9593, 4274, 15}, {9608, 1372, 6}, {9614, 375, 17}, {9631, 1324, 6},
+    {9637, 418, 3}, {9640, 1165, 4}, {9644, 4943, 5}, {9649, 3286, 6}, {9655, 1699, 8}, {9663, 1851, 6},
+    {9669, 1950, 4}, {9673, 1570, 3}, {9676, 1410, 2}, {9678, 1682, 4}, {9682, 4352, 3}, {9685, 4411, 4},
+    {9689, 4484, 4}, {9693, 3696, 8}, {9701, 148, 9}, {9710, 3330, 4}, {9714, 3564, 6}, {9720, 3432, 3},
+    {9723, 5634, 4}, {9727, 3538, 7}, {9734, 198, 15}, {9749, 5855, 3}, {9752, 799, 16}, {9768, 493, 4},
+    {9772, 3571, 6}, {9778, 301, 3}, {9781, 1327, 3}, {9784, 2802, 10}, {9794, 296, 4}, {9798, 1239, 7},
+    {9805, 5764, 3}, {9808, 2840, 7}, {9815, 601, 4}, {9819, 3938, 4}, {9823, 2585, 5}, {9828, 3042, 8},
+    {9836, 2341, 9}, {9845, 3982, 4}, {9849, 1225, 20}, {9869, 4208, 3}, {9872, 1151, 4}, {9876, 1740, 3},
+    {9879, 640, 9}, {9888, 3497, 4}, {9892, 3510, 4}, {9896, 3, 3}, {9899, 3158, 3}, {9902, 3422, 9},
+    {9911, 4560, 6}, {9917, 5458, 5}, {9922, 158, 11}, {9933, 1494, 6}, {9939, 3100, 4}, {9943, 1065, 14},
+    {9957, 2192, 3}, {9960, 3108, 4}, {9964, 4001, 3}, {9967, 2960, 5}, {9972, 4544, 4}, {9976, 1926, 11},
+    {9987, 2557, 5}, {9992, 3220, 4}, {9996, 4677, 7}, {10003, 4429, 8}, {10011, 756, 5}, {10016, 5867, 4},
+    {10020, 1771, 5}, {10025, 4398, 4}, {10029, 593, 8}, {10037, 2034, 5}, {10042, 5297, 6}, {10048, 2302, 5},
+    {10053, 3501, 5}, {10058, 956, 14}, {10072, 1042, 7}, {10079, 1476, 5}, {10084, 1695, 5}, {10089, 720, 4},
+    {10093, 3129, 5}, {10098, 104, 4}, {10102, 2113, 6}, {10108, 5829, 4}, {10112, 5116, 4}, {10116, 729, 3},
+    {10119, 1436, 7}, {10126, 1760, 8}, {10134, 5226, 6}, {10140, 5391, 4}, {10144, 5840, 6}, {10150, 1057, 6},
+    {10156, 2428, 13}, {10169, 2501, 5}, {10174, 699, 5}, {10179, 1926, 11}, {10190, 5357, 5}, {10195, 3170, 8},
+    {10203, 1834, 4}, {10207, 687, 12}, {10219, 2832, 5}, {10224, 55, 6}, {10230, 241, 4}, {10234, 1155, 14},
+    {10248, 5679, 5}, {10253, 2810, 11}, {10264, 248, 4}, {10268, 2790, 5}, {10273, 1031, 17}, {10290, 799, 4},
+    {10294, 3096, 5}, {10299, 1432, 5}, {10304, 1133, 13}, {10317, 2041, 3}, {10320, 5094, 6}, {10326, 4373, 6},
+    {10332, 2011, 13}, {10345, 3235, 10}, {10355, 5760, 6}, {10361, 520, 4}, {10365, 3122, 6}, {10371, 3592, 6},
+    {10377, 1424, 8}, {10385, 1989, 3}, {10388, 3416, 6}, {10394, 4907, 4}, {10398, 928, 7}, {10405, 407, 4},
+    {10409, 3592, 8}, {10417, 1938, 8}, {10425, 1538, 5}, {10430, 606, 20}, {10450, 5201, 4}, {10454, 2894, 11},
+    {10465, 5474, 3}, {10468, 210, 31}, {10499, 920, 8}, {10507, 2170, 3}, {10510, 2926, 6}, {10516, 1699, 12},
+    {10528, 2493, 5}, {10533, 5301, 4}, {10537, 5637, 10}, {10547, 266, 5}, {10552, 1165, 17}, {10569, 5226, 6},
+    {10575, 1083, 9}, {10584, 1289, 5}, {10589, 3656, 6}, {10595, 1087, 10}, {10605, 1687, 4}, {10609, 356, 14},
+    {10623, 3642, 4}, {10627, 980, 2}, {10629, 2037, 6}, {10635, 3958, 5}, {10640, 478, 17}, {10657, 3678, 5},
+    {10662, 3915, 6}, {10668, 59, 6}, {10674, 2949, 8}, {10682, 5434, 7}, {10689, 1523, 3}, {10692, 5454, 6},
+    {10698, 581, 2}, {10700, 581, 16}, {10716, 812, 16}, {10732, 1197, 6}, {10738, 1219, 15}, {10753, 4587, 7},
+    {10760, 5388, 4}, {10764, 5381, 4}, {10768, 4032, 10}, {10778, 1065, 5}, {10783, 5306, 6}, {10789, 5002, 7},
+    {10796, 1065, 4}, {10800, 1436, 5}, {10805, 536, 2}, {10807, 4284, 3}, {10810, 3069, 9}, {10819, 3621, 4},
+    {10823, 3829, 5}, {10828, 1312, 5}, {10833, 65, 13}, {10846, 5843, 6}, {10852, 5634, 7}, {10859, 1771, 5},
+    {10864, 308, 5}, {10869, 4869, 8}, {10877, 2030, 6}, {10883, 4006, 3}, {10886, 1724, 4}, {10890, 5357, 9},
+    {10899, 1019, 6}, {10905, 4159, 4}, {10909, 1349, 20}, {10929, 2476, 4}, {10933, 908, 16}, {10949, 5816, 3},
+    {10952, 1285, 13}, {10965, 4451, 6}, {10971, 22, 6}, {10977, 3461, 6}, {10983, 135, 5}, {10988, 2312, 6},
+    {10994, 1877, 3}, {10997, 4048, 5}, {11002, 2161, 5}, {11007, 832, 17}, {11024, 4472, 6}, {11030, 5137, 2},
+    {11032, 2702, 8}, {11040, 3809, 4}, {11044, 500, 12}, {11056, 3798, 3}, {11059, 2691, 6}, {11065, 5573, 4},
+    {11069, 4723, 7}, {11076, 1711, 6}, {11082, 836, 17}, {11099, 5626, 5}, {11104, 960, 4}, {11108, 3125, 6},
+    {11114, 5226, 8}, {11122, 1862, 5}, {11127, 3260, 4}, {11131, 3859, 5}, {11136, 872, 5}, {11141, 1902, 6},
+    {11147, 908, 3}, {11150, 995, 4}, {11154, 2444, 5}, {11159, 3493, 8}, {11167, 3073, 6}, {11173, 1934, 5},
+    {11178, 1736, 2}, {11180, 1981, 5}, {11185, 2806, 11}, {11196, 3240, 7}, {11203, 3115, 6}, {11209, 4478, 6},
+    {11215, 352, 13}, {11228, 4659, 5}, {11233, 5054, 5}, {11238, 1699, 5}, {11243, 5722, 5}, {11248, 2428, 5},
+    {11253, 621, 13}, {11266, 4912, 7}, {11273, 3182, 6}, {11279, 695, 2}, {11281, 4853, 4}, {11285, 1894, 4},
+    {11289, 340, 14}, {11303, 2102, 4}, {11307, 5652, 5}, {11312, 4778, 3}, {11315, 1353, 14}, {11329, 1293, 13},
+    {11342, 308, 5}, {11347, 2046, 4}, {11351, 1826, 4}, {11355, 1387, 4}, {11359, 1526, 17}, {11376, 2404, 5},
+    {11381, 1830, 5}, {11386, 4793, 2}, {11388, 3065, 6}, {11394, 4171, 9}, {11403, 324, 19}, {11422, 1250, 11},
+    {11433, 5796, 4}, {11437, 5730, 3}, {11440, 3575, 4}, {11444, 2613, 8}, {11452, 1235, 7}, {11459, 5010, 6},
+    {11465, 4622, 6}, {11471, 5760, 2}, {11473, 3894, 4}, {11477, 3383, 6}, {11483, 3025, 6}, {11489, 4077, 6},
+    {11495, 765, 3}, {11498, 820, 5}, {11503, 3069, 5}, {11508, 4996, 6}, {11514, 1191, 4}, {11518, 1938, 10},
+    {11528, 852, 4}, {11532, 3100, 12}, {11544, 3954, 3}, {11547, 2288, 6}, {11553, 4115, 4}, {11557, 550, 5},
+    {11562, 1004, 6}, {11568, 795, 6}, {11574, 1402, 3}, {11577, 4025, 5}, {11582, 1830, 10}, {11592, 5257, 7},
+    {11599, 995, 9}, {11608, 2998, 7}, {11615, 1151, 3}, {11618, 316, 4}, {11622, 3155, 6}, {11628, 5430, 5},
+    {11633, 3264, 3}, {11636, 4857, 8}, {11644, 1277, 5}, {11649, 3422, 3}, {11652, 3372, 6}, {11658, 2581, 5},
+    {11663, 1507, 2}, {11665, 3438, 5}, {11670, 1507, 4}, {11674, 4697, 3}, {11677, 1046, 16}, {11693, 4841, 3},
+    {11696, 5531, 9}, {11705, 5555, 8}, {11713, 5192, 4}, {11717, 269, 3}, {11720, 1111, 4}, {11724, 4755, 6},
+    {11730, 747, 5}, {11735, 597, 6}, {11741, 391, 16}, {11757, 3334, 5}, {11762, 1297, 4}, {11766, 4857, 6},
+    {11772, 4021, 6}, {11778, 4240, 4}, {11782, 2637, 5}, {11787, 2898, 5}, {11792, 1926, 4}, {11796, 5629, 4},
+    {11800, 4377, 3}, {11803, 4796, 3}, {11806, 1830, 11}, {11817, 637, 6}, {11823, 525, 6}, {11829, 1732, 8},
+    {11837, 1239, 5}, {11842, 4958, 5}, {11847, 4601, 5}, {11852, 3252, 5}, {11857, 1424, 2}, {11859, 5502, 6},
+    {11865, 5035, 6}, {11871, 4998, 5}, {11876, 2122, 4}, {11880, 2412, 13}, {11893, 1344, 4}, {11897, 5486, 5},
+    {11902, 1974, 4}, {11906, 1399, 3}, {11909, 613, 5}, {11914, 3855, 3}, {11917, 3653, 6}, {11923, 2577, 5},
+    {11928, 5062, 4}, {11932, 880, 17}, {11949, 795, 10}, {11959, 2432, 5}, {11964, 1783, 3}, {11967, 4328, 5},
+    {11972, 908, 9}, {11981, 1201, 17}, {11998, 194, 6}, {12004, 1594, 16}, {12020, 4734, 4}, {12024, 3294, 6},
+    {12030, 1795, 3}, {12033, 1519, 20}, {12053, 5161, 8}, {12061, 383, 17}, {12078, 1209, 19}, {12097, 391, 5},
+    {12102, 2870, 5}, {12107, 444, 2}, {12109, 3368, 6}, {12115, 1187, 3}, {12118, 2746, 7}, {12125, 1666, 3},
+    {12128, 1792, 3}, {12131, 687, 4}, {12135, 5619, 5}, {12140, 5155, 6}, {12146, 573, 3}, {12149, 2077, 4},
+    {12153, 1490, 17}, {12170, 1744, 18}, {12188, 4093, 4}, {12192, 3700, 8}, {12200, 1764, 8}, {12208, 344, 7},
+    {12215, 1004, 9}, {12224, 2649, 5}, {12229, 1318, 5}, {12234, 2589, 5}, {12239, 2853, 5}, {12244, 2147, 6},
+    {12250, 4705, 7}, {12257, 2185, 5}, {12262, 2794, 5}, {12267, 5121, 6}, {12273, 3862, 7}, {12280, 1959, 4},
+    {12284, 876, 15}, {12299, 5465, 3}, {12302, 364, 5}, {12307, 832, 5}, {12312, 980, 14}, {12326, 880, 14},
+    {12340, 1781, 3}, {12343, 969, 7}, {12350, 4748, 5}, {12355, 1046, 4}, {12359, 5081, 5}, {12364, 3886, 3},
+    {12367, 1638, 6}, {12373, 2768, 5}, {12378, 3093, 6}, {12384, 948, 13}, {12397, 3639, 3}, {12400, 2529, 5},
+    {12405, 2300, 4}, {12409, 3518, 5}, {12414, 2826, 5}, {12419, 662, 4}, {12423, 812, 6}, {12429, 868, 13},
+    {12442, 1171, 5}, {12447, 5446, 6}, {12453, 536, 2}, {12455, 3193, 4}, {12459, 3442, 6}, {12465, 3564, 6},
+    {12471, 5269, 5}, {12476, 1530, 5}, {12481, 1800, 9}, {12490, 399, 3}, {12493, 3526, 5}, {12498, 1997, 11},
+    {12509, 2934, 4}, {12513, 3997, 6}, {12519, 1143, 6}, {12525, 4468, 11}, {12536, 1789, 6}, {12542, 2617, 5},
+    {12547, 5580, 5}, {12552, 4044, 3}, {12555, 2220, 13}, {12568, 280, 5}, {12573, 2517, 5}, {12578, 5, 6},
+    {12584, 2593, 5}, {12589, 2533, 5}, {12594, 3465, 3}, {12597, 320, 3}, {12600, 1297, 9}, {12609, 785, 6},
+    {12615, 3089, 4}, {12619, 4789, 5}, {12624, 3450, 8}, {12632, 5506, 6}, {12638, 3560, 19}, {12657, 2375, 5},
+    {12662, 1395, 8}, {12670, 3962, 14}, {12684, 2003, 17}, {12701, 1695, 18}, {12719, 1511, 2}, {12721, 675, 2},
+    {12723, 43, 2}, {12725, 5668, 4}, {12729, 2485, 6}, {12735, 4809, 7}, {12742, 262, 5}, {12747, 2826, 8},
+    {12755, 3235, 15}, {12770, 5023, 7}, {12777, 47, 5}, {12782, 2664, 4}, {12786, 4966, 6}, {12792, 170, 8},
+    {12800, 3318, 5}, {12805, 3379, 6}, {12811, 2116, 6}, {12817, 852, 14}, {12831, 455, 20}, {12851, 1137, 18},
+    {12869, 4064, 6}, {12875, 5715, 3}, {12878, 1764, 4}, {12882, 1964, 6}, {12888, 4571, 4}, {12892, 4139, 5},
+    {12897, 2056, 3}, {12900, 1814, 9}, {12909, 3795, 6}, {12915, 3715, 5}, {12920, 2605, 8}, {12928, 2296, 4},
+    {12932, 227, 7}, {12939, 448, 5}, {12944, 3708, 7}, {12951, 2694, 3}, {12954, 616, 3}, {12957, 969, 5},
+    {12962, 597, 4}, {12966, 4220, 6}, {12972, 4663, 7}, {12979, 864, 10}, {12989, 3342, 6}, {12995, 1008, 4},
+    {12999, 4648, 6}, {13005, 3111, 8}, {13013, 2420, 6}, {13019, 4155, 6}, {13025, 4865, 8}, {13033, 3252, 12},
+    {13045, 2107, 4}, {13049, 1546, 5}, {13054, 2742, 5}, {13059, 1843, 4}, {13063, 3248, 8}, {13071, 2605, 6},
+    {13077, 2814, 8}, {13085, 1338, 3}, {13088, 5589, 3}, {13091, 665, 8}, {13099, 892, 12}, {13111, 5492, 5},
+    {13116, 2984, 7}, {13123, 474, 4}, {13127, 2739, 5}, {13132, 3656, 4}, {13136, 3125, 4}, {13140, 916, 11},
+    {13151, 1480, 3}, {13154, 3648, 3}, {13157, 5353, 10}, {13167, 3692, 5}, {13172, 928, 9}, {13181, 3342, 4},
+    {13185, 4609, 6}, {13191, 3481, 3}, {13194, 3946, 8}, {13202, 2779, 4}, {13206, 3412, 10}, {13216, 4990, 5},
+    {13221, 2375, 7}, {13228, 2011, 6}, {13234, 5125, 4}, {13238, 3032, 3}, {13241, 1554, 15}, {13256, 170, 24},
+    {13280, 5708, 13}, {13293, 5333, 3}, {13296, 1830, 6}, {13302, 2396, 9}, {13311, 1416, 4}, {13315, 995, 6},
+    {13321, 145, 5}, {13326, 2902, 14}, {13340, 5129, 8}, {13348, 1740, 6}, {13354, 2687, 5}, {13359, 4185, 4},
+    {13363, 5567, 5}, {13368, 4833, 4}, {13372, 4420, 3}, {13375, 2392, 8}, {13383, 3322, 4}, {13387, 4705, 4},
+    {13391, 5345, 7}, {13398, 5430, 9}, {13407, 2349, 6}, {13413, 3497, 3}, {13416, 783, 2}, {13418, 5683, 6},
+    {13424, 4401, 5}, {13429, 1526, 4}, {13433, 3962, 6}, {13439, 1671, 7}, {13446, 424, 6}, {13452, 2861, 4},
+    {13456, 5810, 3}, {13459, 3493, 4}, {13463, 553, 3}, {13466, 1562, 6}, {13472, 3789, 5}, {13477, 174, 6},
+    {13483, 3290, 5}, {13488, 5373, 6}, {13494, 1025, 6}, {13500, 3399, 5}, {13505, 4763, 3}, {13508, 1578, 16},
+    {13524, 1285, 5}, {13529, 4060, 4}, {13533, 683, 8}, {13541, 2772, 3}, {13544, 4493, 10}, {13554, 5291, 3},
+    {13557, 3851, 5}, {13562, 613, 5}, {13567, 5398, 6}, {13573, 5349, 7}, {13580, 1121, 5}, {13585, 3189, 8},
+    {13593, 3773, 4}, {13597, 1534, 13}, {13610, 3240, 6}, {13616, 2220, 6}, {13622, 4253, 8}, {13630, 3477, 3},
+    {13633, 2914, 8}, {13641, 4517, 6}, {13647, 5104, 6}, {13653, 916, 2}, {13655, 292, 13}, {13668, 2675, 5},
+    {13673, 1934, 4}, {13677, 1504, 3}, {13680, 206, 6}, {13686, 3002, 3}, {13689, 3534, 6}, {13695, 848, 6},
+    {13701, 436, 3}, {13704, 344, 4}, {13708, 4306, 4}, {13712, 984, 3}, {13715, 360, 12}, {13727, 1483, 6},
+    {13733, 1728, 3}, {13736, 2007, 13}, {13749, 5468, 6}, {13755, 4182, 4}, {13759, 5369, 6}, {13765, 5749, 5},
+    {13770, 937, 2}, {13772, 2001, 4}, {13776, 5527, 8}, {13784, 656, 5}, {13789, 5365, 7}, {13796, 244, 7},
+    {13803, 2147, 2}, {13805, 714, 6}, {13811, 3307, 5}, {13816, 1906, 5}, {13821, 244, 6}, {13827, 5559, 4},
+    {13831, 3021, 11}, {13842, 1822, 5}, {13847, 2497, 5}, {13852, 4163, 8}, {13860, 5414, 7}, {13867, 5595, 6},
+    {13873, 1087, 4}, {13877, 132, 6}, {13883, 2874, 4}, {13887, 5519, 7}, {13894, 683, 3}, {13897, 5406, 7},
+    {13904, 1215, 16}, {13920, 2196, 6}, {13926, 4712, 4}, {13930, 1069, 10}, {13940, 4939, 5}, {13945, 4693, 5},
+    {13950, 5510, 6}, {13956, 5577, 6}, {13962, 2994, 5}, {13967, 316, 9}, {13976, 5787, 4}, {13980, 1297, 5},
+    {13985, 1538, 19},
+};
+
+// Second-hash seed per first-hash bucket
+constexpr uint16_t DISPLACEMENTS[] = {
+    256, 8, 20, 4, 8, 7, 58, 1, 3, 90, 21, 18, 1, 17, 2, 102,
+    2, 22, 74, 1, 45, 6, 18, 4, 2, 29, 26, 218, 6, 2, 44, 1,
+    28, 15, 1, 35, 134, 27, 7, 72, 37, 101, 26, 23, 5, 13, 0, 56,
+    130, 28, 82, 147, 8, 130, 100, 82, 19, 22, 12, 27, 11, 4, 5, 111,
+    16, 1, 258, 87, 87, 63, 327, 16, 101, 150, 122, 0, 3, 1, 23, 225,
+    2, 13, 2, 82, 91, 7, 54, 88, 5, 16, 27, 32, 16, 387, 3, 126,
+    2, 66, 56, 2, 2, 4, 21, 20, 154, 5, 381, 9, 26, 1, 119, 23,
+    27, 4, 10, 218, 48, 2, 62, 389, 13, 63, 84, 163, 46, 104, 9, 0,
+    9, 542, 37, 312, 2, 3, 6, 302, 297, 6, 26, 29, 15, 138, 5, 58,
+    11, 117, 107, 28, 5, 7, 0, 65, 55, 5, 324, 1, 10, 3, 140, 0,
+    1, 88, 669, 42, 185, 6, 6, 67, 47, 2, 2, 10, 174, 128, 135, 2,
+    36, 5, 101, 577, 1, 0, 2, 4, 23, 383, 8, 7, 314, 45, 363, 19,
+    5, 70, 47, 20, 1, 2, 59, 1, 17, 129, 215, 3, 36, 42, 11, 5,
+    16, 82, 132, 170, 104, 217, 28, 66, 0, 12, 17, 11, 6, 35, 0, 1,
+    157, 248, 303, 20, 15, 16, 32, 14, 70, 17, 67, 275, 4, 4, 6, 294,
+    53, 84, 83, 194, 76, 31, 27, 7, 130, 24, 325, 5, 110, 12, 425, 120,
+    1, 1, 19, 0, 1, 129, 29, 57, 37, 6, 1, 394, 35, 97, 2, 1,
+    26, 49, 2, 845, 13, 6, 303, 64, 8, 20, 313, 58, 3, 30, 1, 3,
+    55, 546, 0, 851, 373, 41, 172, 7, 254, 305, 245, 18, 305, 260, 77, 431,
+    60, 103, 271, 70, 3, 505, 120, 44, 7, 253, 253, 286, 0, 23, 72, 43,
+    72, 533, 126, 49, 5, 43, 4, 0, 287, 307, 11, 546, 254, 364, 4, 2,
+    4, 122, 110, 29, 8, 75, 268, 453, 92, 37, 31, 165, 215, 423, 2, 16,
+    3, 7, 369, 781, 4, 41, 89, 529, 2, 1772, 2, 118, 242, 31, 78, 498,
+    2, 68, 80, 771, 371, 1208, 155, 32, 514, 215, 384, 15, 175, 124, 153, 891,
+    606, 760, 0, 978, 622, 1568, 5, 311, 55, 431, 316, 5, 1941, 5, 1654, 199,
+    922, 96, 15, 881, 2, 695, 1, 106, 33, 13, 1236, 319, 136, 19, 613, 109,
+    5, 820, 391, 8, 1339, 987, 20, 2764, 24, 8, 22, 886, 490, 125, 190, 158,
+    23, 5, 6, 525, 50, 305, 113, 197, 24, 31, 7, 38, 178, 134, 2, 64,
+    17, 1710, 12, 375, 65, 38, 596, 1691, 3, 42, 1367, 139, 61, 29, 3, 221,
+    2984, 2, 346, 29, 1, 576, 19, 5, 84, 1, 1, 653, 0, 183, 4, 0,
+    378, 1918, 183, 1293, 12, 890, 164, 862, 3092, 376, 3216, 3, 176, 1159, 6, 10150,
+    83, 113, 163, 7, 59, 4, 3418, 751, 38, 6, 5, 2671, 2762, 975, 164, 29,
+    555, 99, 47, 16105, 87, 171, 4, 29, 1057, 6944, 8, 1, 770, 1468, 149, 5,
+    3, 84, 1156, 25,
+};
+
+}  // namespace html_entities
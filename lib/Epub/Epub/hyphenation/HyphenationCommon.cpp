@@ -2,6 +2,8 @@
 
 #include <Utf8.h>
 
+#include <cstring>
+
 namespace {
 
 // Convert Latin uppercase letters (ASCII plus Latin-1 supplement) to lowercase
@@ -135,47 +137,59 @@ bool isExplicitHyphen(const uint32_t cp) {
 
 bool isSoftHyphen(const uint32_t cp) { return cp == 0x00AD; }
 
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps) {
+void trimSurroundingPunctuationAndFootnote(WordCodepoints& cps) {
   if (cps.empty()) {
     return;
   }
 
+  size_t end = cps.count;
   // Remove trailing footnote references like [12], even if punctuation trails after the closing bracket.
-  if (cps.size() >= 3) {
-    int end = static_cast<int>(cps.size()) - 1;
-    while (end >= 0 && isPunctuation(cps[end].value)) {
-      --end;
+  if (end >= 3) {
+    int last = static_cast<int>(end) - 1;
+    while (last >= 0 && isPunctuation(cps[last].value)) {
+      --last;
     }
-    int pos = end;
+    int pos = last;
     if (pos >= 0 && isAsciiDigit(cps[pos].value)) {
       while (pos >= 0 && isAsciiDigit(cps[pos].value)) {
         --pos;
       }
-      if (pos >= 0 && cps[pos].value == '[' && end - pos > 1) {
-        cps.erase(cps.begin() + pos, cps.end());
+      if (pos >= 0 && cps[pos].value == '[' && last - pos > 1) {
+        end = static_cast<size_t>(pos);
       }
     }
   }
 
-  while (!cps.empty() && isPunctuation(cps.front().value)) {
-    cps.erase(cps.begin());
+  size_t start = 0;
+  while (start < end && isPunctuation(cps[start].value)) {
+    ++start;
+  }
+  while (end > start && isPunctuation(cps[end - 1].value)) {
+    --end;
   }
-  while (!cps.empty() && isPunctuation(cps.back().value)) {
-    cps.pop_back();
+
+  // Shift the survivors down once rather than erasing from the front one codepoint at a time
+  if (start > 0) {
+    memmove(cps.items, cps.items + start, (end - start) * sizeof(CodepointInfo));
   }
+  cps.count = end - start;
 }
 
-std::vector<CodepointInfo> collectCodepoints(const std::string& word) {
-  std::vector<CodepointInfo> cps;
-  cps.reserve(word.size());
+bool collectCodepoints(const std::string& word, WordCodepoints& out) {
+  out.count = 0;
+  if (word.size() > MAX_HYPHENATION_WORD_BYTES) {
+    return false;
+  }
 
   const unsigned char* base = reinterpret_cast<const unsigned char*>(word.c_str());
   const unsigned char* ptr = base;
-  while (*ptr != 0) {
+  // Bounded by the size as well: a truncated sequence at the end would otherwise step over the terminator
+  const unsigned char* end = base + word.size();
+  while (ptr < end && *ptr != 0) {
     const unsigned char* current = ptr;
     const uint32_t cp = utf8NextCodepoint(&ptr);
-    cps.push_back({cp, static_cast<size_t>(current - base)});
+    out.items[out.count++] = {cp, static_cast<uint32_t>(current - base)};
   }
 
-  return cps;
+  return true;
 }
@@ -3,11 +3,27 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
-#include <vector>
 
+// Longest word the hyphenator accepts, in UTF-8 bytes. ChapterHtmlSlimParser never emits longer words
+// (MAX_WORD_SIZE), so every hyphenation buffer can have a fixed size.
+constexpr size_t MAX_HYPHENATION_WORD_BYTES = 200;
+
+// Packed to four bytes so a whole word's worth fits comfortably on the stack
 struct CodepointInfo {
-  uint32_t value;
-  size_t byteOffset;
+  uint32_t value : 21;
+  uint32_t byteOffset : 11;
+};
+
+// Codepoints of a single word
+struct WordCodepoints {
+  CodepointInfo items[MAX_HYPHENATION_WORD_BYTES];
+  size_t count = 0;
+
+  size_t size() const { return count; }
+  bool empty() const { return count == 0; }
+  const CodepointInfo& operator[](const size_t i) const { return items[i]; }
+  const CodepointInfo* begin() const { return items; }
+  const CodepointInfo* end() const { return items + count; }
 };
 
 uint32_t toLowerLatin(uint32_t cp);
@@ -21,5 +37,6 @@ bool isPunctuation(uint32_t cp);
 bool isAsciiDigit(uint32_t cp);
 bool isExplicitHyphen(uint32_t cp);
 bool isSoftHyphen(uint32_t cp);
-void trimSurroundingPunctuationAndFootnote(std::vector<CodepointInfo>& cps);
-std::vector<CodepointInfo> collectCodepoints(const std::string& word);
+void trimSurroundingPunctuationAndFootnote(WordCodepoints& cps);
+// Decodes `word` into `out`. Returns false (leaving `out` empty) if the word exceeds MAX_HYPHENATION_WORD_BYTES.
+bool collectCodepoints(const std::string& word, WordCodepoints& out);
@@ -0,0 +1,106 @@
+#include "HyphenationTrieFile.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace {
+constexpr char MAGIC[4] = {'H', 'Y', 'P', 'H'};
+constexpr uint8_t DICTIONARY_VERSION = 1;
+// magic + version + script + min prefix + min suffix + trie size
+constexpr size_t HEADER_SIZE = sizeof(MAGIC) + 4 * sizeof(uint8_t) + sizeof(uint32_t);
+}  // namespace
+
+bool HyphenationTrieFile::open(const std::string& path) {
+  close();
+  if (!Storage.openFileForRead("HYP", path, file)) {
+    return false;
+  }
+
+  uint8_t header[HEADER_SIZE];
+  if (file.read(header, HEADER_SIZE) != static_cast<int>(HEADER_SIZE) || memcmp(header, MAGIC, sizeof(MAGIC)) != 0 ||
+      header[4] != DICTIONARY_VERSION || header[5] > static_cast<uint8_t>(Script::CYRILLIC)) {
+    LOG_ERR("HYP", "Not a hyphenation dictionary: %s", path.c_str());
+    file.close();
+    return false;
+  }
+  script_ = static_cast<Script>(header[5]);
+  minPrefix_ = header[6];
+  minSuffix_ = header[7];
+  size = static_cast<size_t>(header[8]) | (static_cast<size_t>(header[9]) << 8) |
+         (static_cast<size_t>(header[10]) << 16) | (static_cast<size_t>(header[11]) << 24);
+  if (size < 4 || file.size() != HEADER_SIZE + size) {
+    LOG_ERR("HYP", "Truncated hyphenation dictionary: %s", path.c_str());
+    file.close();
+    size = 0;
+    return false;
+  }
+
+  clock = 0;
+  loads = 0;
+  if (size <= WHOLE_TRIE_LIMIT) {
+    whole.reset(new (std::nothrow) uint8_t[size]);
+    if (whole && file.read(whole.get(), size) == static_cast<int>(size)) {
+      ++loads;
+      file.close();
+      return true;
+    }
+    // Fall back to the page cache, which needs less contiguous memory
+    whole.reset();
+  }
+
+  pages.reset(new (std::nothrow) Page[PAGE_COUNT]);
+  if (!pages) {
+    LOG_ERR("HYP", "Not enough memory for the dictionary page cache");
+    file.close();
+    size = 0;
+    return false;
+  }
+  return true;
+}
+
+void HyphenationTrieFile::close() {
+  if (file) {
+    file.close();
+  }
+  pages.reset();
+  whole.reset();
+  size = 0;
+}
+
+const uint8_t* HyphenationTrieFile::window(const size_t offset, const size_t len) {
+  if ((!pages && !whole) || len == 0 || len > MAX_WINDOW || offset >= size || len > size - offset) {
+    return nullptr;
+  }
+  if (whole) {
+    return whole.get() + offset;
+  }
+
+  Page* victim = &pages[0];
+  for (size_t i = 0; i < PAGE_COUNT; ++i) {
+    Page& page = pages[i];
+    if (page.length > 0 && offset >= page.start && offset + len <= page.start + page.length) {
+      page.lastUse = ++clock;
+      return page.bytes + (offset - page.start);
+    }
+    if (page.lastUse < victim->lastUse) {
+      victim = &page;
+    }
+  }
+
+  // Miss: replace the least recently used page with the aligned stretch around the window
+  const size_t start = offset - offset % PAGE_ALIGN;
+  const size_t length = std::min(PAGE_SIZE, size - start);
+  victim->length = 0;
+  if (!file.seek(HEADER_SIZE + start) || file.read(victim->bytes, length) != static_cast<int>(length)) {
+    LOG_ERR("HYP", "Failed to read dictionary page at %u", static_cast<unsigned>(start));
+    return nullptr;
+  }
+  victim->start = start;
+  victim->length = length;
+  victim->lastUse = ++clock;
+  ++loads;
+  return victim->bytes + (offset - start);
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <HalStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+/**
+ * A hyphenation dictionary on the SD card, read through a page cache instead of being loaded whole.
+ *
+ * The file is a short header (see docs/hyphenation-trie-format.md) followed by an unmodified hypher trie. A Liang
+ * walk keeps returning to the nodes near the root and touches one stretch of deeper nodes per start position, so
+ * the cache is sized to keep the whole path of a word resident: with fewer pages a long word evicted its own root
+ * pages and the German dictionary averaged about 20 page loads per word. Dictionaries up to WHOLE_TRIE_LIMIT bytes
+ * are read whole when opened instead, which covers every shipped language except German. Either way RAM use is
+ * bounded whatever the size of the dictionary and only held while a section is being laid out.
+ */
+class HyphenationTrieFile {
+ public:
+  enum class Script : uint8_t { LATIN = 0, CYRILLIC = 1 };
+
+  static constexpr size_t PAGE_SIZE = 512;
+  static constexpr size_t PAGE_COUNT = 32;
+  // Tries up to this size are kept in RAM whole, the page cache would not be much smaller
+  static constexpr size_t WHOLE_TRIE_LIMIT = 32 * 1024;
+  // Pages are loaded from this alignment below the requested offset, so any window up to MAX_WINDOW bytes fits
+  // in a single page
+  static constexpr size_t PAGE_ALIGN = 64;
+  static constexpr size_t MAX_WINDOW = PAGE_SIZE - PAGE_ALIGN;
+
+  ~HyphenationTrieFile() { close(); }
+
+  // Opens the dictionary, validates its header and reads it whole or allocates the page cache
+  bool open(const std::string& path);
+  void close();
+
+  // Pointer to `len` bytes of the trie at `offset`, or nullptr if the range is out of bounds or cannot be read.
+  // Pages are replaced least recently used first, so a pointer stays valid across one further call.
+  // A trie read whole never moves.
+  const uint8_t* window(size_t offset, size_t len);
+
+  size_t trieSize() const { return size; }
+  Script script() const { return script_; }
+  uint8_t minPrefix() const { return minPrefix_; }
+  uint8_t minSuffix() const { return minSuffix_; }
+  uint32_t pageLoads() const { return loads; }
+
+ private:
+  struct Page {
+    size_t start = 0;
+    size_t length = 0;  // 0 for an empty page
+    uint32_t lastUse = 0;
+    uint8_t bytes[PAGE_SIZE];
+  };
+
+  FsFile file;
+  std::unique_ptr<Page[]> pages;
+  std::unique_ptr<uint8_t[]> whole;
+  size_t size = 0;
+  Script script_ = Script::LATIN;
+  uint8_t minPrefix_ = 0;
+  uint8_t minSuffix_ = 0;
+  uint32_t clock = 0;
+  uint32_t loads = 0;
+};
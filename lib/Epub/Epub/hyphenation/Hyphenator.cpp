@@ -1,6 +1,6 @@
 #include "Hyphenator.h"
 
-#include <vector>
+#include <cstring>
 
 #include "HyphenationCommon.h"
 #include "LanguageRegistry.h"
@@ -26,15 +26,88 @@ const LanguageHyphenator* hyphenatorForLanguage(const std::string& langTag) {
   return getLanguageHyphenatorForPrimaryTag(primary);
 }
 
-// Maps a codepoint index back to its byte offset inside the source word.
-size_t byteOffsetForIndex(const std::vector<CodepointInfo>& cps, const size_t index) {
-  return (index < cps.size()) ? cps[index].byteOffset : (cps.empty() ? 0 : cps.back().byteOffset);
+// Recently hyphenated words. ParsedText asks for a word again when it lays out the retained tail of a long
+// paragraph or retries it as the first word of the next line, and frequent words recur; a small LRU keyed on the
+// word answers those without rerunning the Liang evaluator. Words or break lists that do not fit an entry are not
+// cached.
+constexpr size_t WORD_CACHE_ENTRIES = 16;
+constexpr size_t CACHED_WORD_BYTES = 24;
+constexpr size_t CACHED_BREAKS = 12;
+
+struct CachedWord {
+  uint32_t lastUse = 0;  // 0 for an empty entry
+  uint8_t wordLength = 0;
+  uint8_t breakCount = 0;
+  bool includeFallback = false;
+  uint16_t insertedHyphens = 0;  // Bit i set if offsets[i] needs an inserted hyphen
+  char word[CACHED_WORD_BYTES];
+  uint8_t offsets[CACHED_BREAKS];
+};
+static_assert(CACHED_BREAKS <= 16, "insertedHyphens holds one bit per cached break");
+
+CachedWord wordCache[WORD_CACHE_ENTRIES];
+uint32_t wordCacheClock = 0;
+
+void clearWordCache() {
+  for (auto& entry : wordCache) {
+    entry.lastUse = 0;
+  }
+  wordCacheClock = 0;
+}
+
+bool findCachedWord(const std::string& word, const bool includeFallback, Hyphenator::Breaks& out) {
+  for (auto& entry : wordCache) {
+    if (entry.lastUse == 0 || entry.wordLength != word.size() || entry.includeFallback != includeFallback ||
+        memcmp(entry.word, word.data(), word.size()) != 0) {
+      continue;
+    }
+    entry.lastUse = ++wordCacheClock;
+    for (size_t i = 0; i < entry.breakCount; ++i) {
+      out.items[i] = {entry.offsets[i], ((entry.insertedHyphens >> i) & 1u) != 0};
+    }
+    out.count = entry.breakCount;
+    return true;
+  }
+  return false;
+}
+
+void cacheWord(const std::string& word, const bool includeFallback, const Hyphenator::Breaks& breaks) {
+  if (word.size() > CACHED_WORD_BYTES || breaks.size() > CACHED_BREAKS) {
+    return;
+  }
+  if (wordCacheClock == UINT32_MAX) {
+    clearWordCache();  // Keep 0 meaning "empty" once the clock wraps
+  }
+
+  CachedWord* victim = &wordCache[0];
+  for (auto& entry : wordCache) {
+    if (entry.lastUse < victim->lastUse) {
+      victim = &entry;
+    }
+  }
+
+  victim->lastUse = ++wordCacheClock;
+  victim->wordLength = static_cast<uint8_t>(word.size());
+  victim->breakCount = static_cast<uint8_t>(breaks.size());
+  victim->includeFallback = includeFallback;
+  victim->insertedHyphens = 0;
+  memcpy(victim->word, word.data(), word.size());
+  for (size_t i = 0; i < breaks.size(); ++i) {
+    victim->offsets[i] = breaks.items[i].byteOffset;
+    if (breaks.items[i].requiresInsertedHyphen) {
+      victim->insertedHyphens |= static_cast<uint16_t>(1u << i);
+    }
+  }
 }
 
-// Builds a vector of break information from explicit hyphen markers in the given codepoints.
-std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<CodepointInfo>& cps) {
-  std::vector<Hyphenator::BreakInfo> breaks;
+// Maps a codepoint index back to its byte offset inside the source word.
+uint8_t byteOffsetForIndex(const WordCodepoints& cps, const size_t index) {
+  return static_cast<uint8_t>((index < cps.size()) ? cps[index].byteOffset
+                                                   : (cps.empty() ? 0 : cps[cps.size() - 1].byteOffset));
+}
 
+// Collects break information from explicit hyphen markers in the given codepoints.
+void buildExplicitBreakInfos(const WordCodepoints& cps, Hyphenator::Breaks& breaks) {
   // Scan every codepoint looking for explicit/soft hyphen markers that are surrounded by letters.
   for (size_t i = 1; i + 1 < cps.size(); ++i) {
     const uint32_t cp = cps[i].value;
@@ -42,56 +115,64 @@ std::vector<Hyphenator::BreakInfo> buildExplicitBreakInfos(const std::vector<Cod
       continue;
     }
     // Offset points to the next codepoint so rendering starts after the hyphen marker.
-    breaks.push_back({cps[i + 1].byteOffset, isSoftHyphen(cp)});
+    breaks.items[breaks.count++] = {static_cast<uint8_t>(cps[i + 1].byteOffset), isSoftHyphen(cp)};
   }
-
-  return breaks;
 }
 
-}  // namespace
-
-std::vector<Hyphenator::BreakInfo> Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
-  if (word.empty()) {
-    return {};
+void computeBreakOffsets(const std::string& word, const bool includeFallback, const LanguageHyphenator* hyphenator,
+                         Hyphenator::Breaks& breaks) {
+  // Convert to codepoints and normalize word boundaries. The parser never emits words that don't fit.
+  WordCodepoints cps;
+  if (!collectCodepoints(word, cps)) {
+    return;
   }
-
-  // Convert to codepoints and normalize word boundaries.
-  auto cps = collectCodepoints(word);
   trimSurroundingPunctuationAndFootnote(cps);
-  const auto* hyphenator = cachedHyphenator_;
 
   // Explicit hyphen markers (soft or hard) take precedence over language breaks.
-  auto explicitBreakInfos = buildExplicitBreakInfos(cps);
-  if (!explicitBreakInfos.empty()) {
-    return explicitBreakInfos;
+  buildExplicitBreakInfos(cps, breaks);
+  if (!breaks.empty()) {
+    return;
   }
 
   // Ask language hyphenator for legal break points.
-  std::vector<size_t> indexes;
-  if (hyphenator) {
-    indexes = hyphenator->breakIndexes(cps);
-  }
+  uint8_t indexes[MAX_HYPHENATION_WORD_BYTES];
+  size_t indexCount = hyphenator ? hyphenator->breakIndexes(cps, indexes) : 0;
 
   // Only add fallback breaks if needed
-  if (includeFallback && indexes.empty()) {
+  if (includeFallback && indexCount == 0) {
     const size_t minPrefix = hyphenator ? hyphenator->minPrefix() : LiangWordConfig::kDefaultMinPrefix;
     const size_t minSuffix = hyphenator ? hyphenator->minSuffix() : LiangWordConfig::kDefaultMinSuffix;
     for (size_t idx = minPrefix; idx + minSuffix <= cps.size(); ++idx) {
-      indexes.push_back(idx);
+      indexes[indexCount++] = static_cast<uint8_t>(idx);
     }
   }
 
-  if (indexes.empty()) {
-    return {};
+  for (size_t i = 0; i < indexCount; ++i) {
+    breaks.items[breaks.count++] = {byteOffsetForIndex(cps, indexes[i]), true};
   }
+}
+
+}  // namespace
 
-  std::vector<Hyphenator::BreakInfo> breaks;
-  breaks.reserve(indexes.size());
-  for (const size_t idx : indexes) {
-    breaks.push_back({byteOffsetForIndex(cps, idx), true});
+Hyphenator::Breaks Hyphenator::breakOffsets(const std::string& word, const bool includeFallback) {
+  Breaks breaks;
+  if (word.empty() || findCachedWord(word, includeFallback, breaks)) {
+    return breaks;
   }
 
+  computeBreakOffsets(word, includeFallback, cachedHyphenator_, breaks);
+  cacheWord(word, includeFallback, breaks);
   return breaks;
 }
 
-void Hyphenator::setPreferredLanguage(const std::string& lang) { cachedHyphenator_ = hyphenatorForLanguage(lang); }
+void Hyphenator::setPreferredLanguage(const std::string& lang) {
+  // Always start over: an SD language reloaded after releaseLanguage() can come back at the same address
+  clearWordCache();
+  cachedHyphenator_ = hyphenatorForLanguage(lang);
+}
+
+void Hyphenator::releaseLanguage() {
+  clearWordCache();
+  cachedHyphenator_ = nullptr;
+  releaseSdHyphenationDictionary();
+}
@@ -1,24 +1,42 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
-#include <vector>
+
+#include "HyphenationCommon.h"
 
 class LanguageHyphenator;
 
 class Hyphenator {
  public:
   struct BreakInfo {
-    size_t byteOffset;
+    uint8_t byteOffset;
     bool requiresInsertedHyphen;
   };
+  // Break positions of a single word, in ascending order
+  struct Breaks {
+    BreakInfo items[MAX_HYPHENATION_WORD_BYTES];
+    size_t count = 0;
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    const BreakInfo* begin() const { return items; }
+    const BreakInfo* end() const { return items + count; }
+  };
   // Returns byte offsets where the word may be hyphenated. When includeFallback is true, all positions obeying the
-  // minimum prefix/suffix constraints are returned even if no language-specific rule matches.
-  static std::vector<BreakInfo> breakOffsets(const std::string& word, bool includeFallback);
+  // minimum prefix/suffix constraints are returned even if no language-specific rule matches. Results for recent
+  // words are kept in a small LRU, so asking again for the same word is a table lookup.
+  static Breaks breakOffsets(const std::string& word, bool includeFallback);
 
   // Provide a publication-level language hint (e.g. "en", "en-US", "ru") used to select hyphenation rules.
+  // Languages other than English are read from the SD card (/hyphenation/<tag>.bin) and stay open until
+  // releaseLanguage(). Drops the cached results.
   static void setPreferredLanguage(const std::string& lang);
 
+  // Forget the preferred language and close its SD dictionary, freeing the page cache. Call once layout is done.
+  static void releaseLanguage();
+
  private:
   static const LanguageHyphenator* cachedHyphenator_;
-};
\ No newline at end of file
+};
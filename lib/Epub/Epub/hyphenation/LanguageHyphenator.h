@@ -2,22 +2,28 @@
 
 #include "LiangHyphenation.h"
 
-// Generic Liang-backed hyphenator that stores pattern metadata plus language-specific helpers.
+// Generic Liang-backed hyphenator that stores pattern metadata plus language-specific helpers. `dense` is optional
+// (nullptr for dictionaries read from the SD card).
 class LanguageHyphenator {
  public:
-  LanguageHyphenator(const SerializedHyphenationPatterns& patterns, bool (*isLetterFn)(uint32_t),
-                     uint32_t (*toLowerFn)(uint32_t), size_t minPrefix = LiangWordConfig::kDefaultMinPrefix,
+  LanguageHyphenator(const SerializedHyphenationPatterns& patterns, const DenseHyphenationLevels* dense,
+                     bool (*isLetterFn)(uint32_t), uint32_t (*toLowerFn)(uint32_t),
+                     size_t minPrefix = LiangWordConfig::kDefaultMinPrefix,
                      size_t minSuffix = LiangWordConfig::kDefaultMinSuffix)
-      : patterns_(patterns), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
+      : patterns_(patterns), dense_(dense), config_(isLetterFn, toLowerFn, minPrefix, minSuffix) {}
 
-  std::vector<size_t> breakIndexes(const std::vector<CodepointInfo>& cps) const {
-    return liangBreakIndexes(cps, patterns_, config_);
+  size_t breakIndexes(const WordCodepoints& cps, uint8_t (&indexes)[MAX_HYPHENATION_WORD_BYTES]) const {
+    return liangBreakIndexes(cps, patterns_, dense_, config_, indexes);
   }
 
   size_t minPrefix() const { return config_.minPrefix; }
   size_t minSuffix() const { return config_.minSuffix; }
 
+  const SerializedHyphenationPatterns& patterns() const { return patterns_; }
+  const LiangWordConfig& config() const { return config_; }
+
  protected:
   const SerializedHyphenationPatterns& patterns_;
+  const DenseHyphenationLevels* dense_;
   LiangWordConfig config_;
 };
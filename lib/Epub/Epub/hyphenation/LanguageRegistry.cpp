@@ -1,47 +1,95 @@
 #include "LanguageRegistry.h"
 
+#include <Logging.h>
+
 #include <algorithm>
 #include <array>
+#include <memory>
+#include <new>
+#include <utility>
 
 #include "HyphenationCommon.h"
-#include "generated/hyph-de.trie.h"
+#include "HyphenationTrieFile.h"
+#include "generated/hyph-en.dense.h"
 #include "generated/hyph-en.trie.h"
-#include "generated/hyph-es.trie.h"
-#include "generated/hyph-fr.trie.h"
-#include "generated/hyph-it.trie.h"
-#include "generated/hyph-ru.trie.h"
 
 namespace {
 
 // English hyphenation patterns (3/3 minimum prefix/suffix length)
-LanguageHyphenator englishHyphenator(en_us_patterns, isLatinLetter, toLowerLatin, 3, 3);
-LanguageHyphenator frenchHyphenator(fr_patterns, isLatinLetter, toLowerLatin);
-LanguageHyphenator germanHyphenator(de_patterns, isLatinLetter, toLowerLatin);
-LanguageHyphenator russianHyphenator(ru_ru_patterns, isCyrillicLetter, toLowerCyrillic);
-LanguageHyphenator spanishHyphenator(es_patterns, isLatinLetter, toLowerLatin);
-LanguageHyphenator italianHyphenator(it_patterns, isLatinLetter, toLowerLatin);
+LanguageHyphenator englishHyphenator(en_us_patterns, &en_us_dense, isLatinLetter, toLowerLatin, 3, 3);
 
-using EntryArray = std::array<LanguageEntry, 6>;
+using EntryArray = std::array<LanguageEntry, 1>;
 
 const EntryArray& entries() {
-  static const EntryArray kEntries = {{{"english", "en", &englishHyphenator},
-                                       {"french", "fr", &frenchHyphenator},
-                                       {"german", "de", &germanHyphenator},
-                                       {"russian", "ru", &russianHyphenator},
-                                       {"spanish", "es", &spanishHyphenator},
-                                       {"italian", "it", &italianHyphenator}}};
+  static const EntryArray kEntries = {{{"english", "en", &englishHyphenator}}};
   return kEntries;
 }
 
+constexpr char SD_DICTIONARY_DIR[] = "/hyphenation/";
+constexpr size_t MAX_SD_TAG_LENGTH = 16;
+
+// The tag comes from the book's metadata and becomes part of a path, so only lowercase letters and '-' get through
+bool isDictionaryTag(const std::string& tag) {
+  return !tag.empty() && tag.size() <= MAX_SD_TAG_LENGTH &&
+         std::all_of(tag.begin(), tag.end(), [](const char c) { return (c >= 'a' && c <= 'z') || c == '-'; });
+}
+
+// The one SD dictionary that can be open at a time. Members are initialized in order: the file is opened first
+// because its header picks the letter predicates and the prefix/suffix minima of the hyphenator.
+struct SdLanguage {
+  std::string tag;
+  HyphenationTrieFile trie;
+  bool opened;
+  SerializedHyphenationPatterns patterns{nullptr, 0, &trie};
+  LanguageHyphenator hyphenator;
+
+  SdLanguage(std::string languageTag, const std::string& path)
+      : tag(std::move(languageTag)),
+        opened(trie.open(path)),
+        hyphenator(patterns, nullptr, isCyrillic() ? isCyrillicLetter : isLatinLetter,
+                   isCyrillic() ? toLowerCyrillic : toLowerLatin, trie.minPrefix(), trie.minSuffix()) {}
+
+  bool isCyrillic() const { return trie.script() == HyphenationTrieFile::Script::CYRILLIC; }
+};
+
+std::unique_ptr<SdLanguage> sdLanguage;
+
+const LanguageHyphenator* loadSdLanguage(const std::string& primaryTag) {
+  if (sdLanguage && sdLanguage->tag == primaryTag) {
+    return &sdLanguage->hyphenator;
+  }
+  releaseSdHyphenationDictionary();
+  if (!isDictionaryTag(primaryTag)) {
+    LOG_DBG("HYP", "Ignoring language tag that is not a dictionary name");
+    return nullptr;
+  }
+
+  const std::string path = SD_DICTIONARY_DIR + primaryTag + ".bin";
+  if (!Storage.exists(path.c_str())) {
+    return nullptr;
+  }
+
+  sdLanguage.reset(new (std::nothrow) SdLanguage(primaryTag, path));
+  if (!sdLanguage || !sdLanguage->opened) {
+    sdLanguage.reset();
+    return nullptr;
+  }
+  LOG_DBG("HYP", "Loaded hyphenation dictionary %s (%u bytes)", path.c_str(),
+          static_cast<unsigned>(sdLanguage->trie.trieSize()));
+  return &sdLanguage->hyphenator;
+}
+
 }  // namespace
 
 const LanguageHyphenator* getLanguageHyphenatorForPrimaryTag(const std::string& primaryTag) {
   const auto& allEntries = entries();
   const auto it = std::find_if(allEntries.begin(), allEntries.end(),
                                [&primaryTag](const LanguageEntry& entry) { return primaryTag == entry.primaryTag; });
-  return (it != allEntries.end()) ? it->hyphenator : nullptr;
+  return (it != allEntries.end()) ? it->hyphenator : loadSdLanguage(primaryTag);
 }
 
+void releaseSdHyphenationDictionary() { sdLanguage.reset(); }
+
 LanguageEntryView getLanguageEntries() {
   const auto& allEntries = entries();
   return LanguageEntryView{allEntries.data(), allEntries.size()};
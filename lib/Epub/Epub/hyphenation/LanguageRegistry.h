@@ -19,8 +19,13 @@ struct LanguageEntryView {
   const LanguageEntry* end() const { return data + size; }
 };
 
-// Returns the Liang-backed hyphenator for a given primary language tag (e.g., "en", "fr").
+// Returns the Liang-backed hyphenator for a given primary language tag (e.g., "en", "fr"). Built-in languages are
+// always available; any other tag is looked up as /hyphenation/<tag>.bin on the SD card. An SD hyphenator stays
+// valid until the next call asking for a different SD language or releaseSdHyphenationDictionary().
 const LanguageHyphenator* getLanguageHyphenatorForPrimaryTag(const std::string& primaryTag);
 
-// Exposes the list of supported languages primarily for tooling/tests.
+// Closes the loaded SD dictionary, if any, and frees its page cache.
+void releaseSdHyphenationDictionary();
+
+// Exposes the list of built-in languages primarily for tooling/tests.
 LanguageEntryView getLanguageEntries();
@@ -1,16 +1,18 @@
 #include "LiangHyphenation.h"
 
 #include <algorithm>
-#include <vector>
+#include <cstring>
+
+#include "HyphenationTrieFile.h"
 
 /*
  * Liang hyphenation pipeline overview (Typst-style binary trie variant)
  * --------------------------------------------------------------------
  * 1.  Input normalization (buildAugmentedWord)
- *     - Accepts a vector of CodepointInfo structs emitted by the EPUB text
- *       parser. Each codepoint is validated with LiangWordConfig::isLetter so
- *       we abort early on digits, punctuation, etc. If the word is valid we
- *       build an "augmented" byte sequence: leading '.', lowercase UTF-8 bytes
+ *     - Accepts the WordCodepoints emitted by the EPUB text parser. Each
+ *       codepoint is validated with LiangWordConfig::isLetter so we abort
+ *       early on digits, punctuation, etc. If the word is valid we build an
+ *       "augmented" byte sequence: leading '.', lowercase UTF-8 bytes
  *       for every letter, then a trailing '.'. While doing this we capture the
  *       UTF-8 byte offset for each character and a reverse lookup table that
  *       maps UTF-8 byte indexes back to codepoint indexes. This lets the rest
@@ -24,8 +26,18 @@
  *       nodes, and an optional pointer into a shared "levels" list. We parse
  *       that layout lazily via decodeState/transition, keeping everything in
  *       flash memory; no heap allocations besides the stack-local AutomatonState
- *       structs. getAutomaton caches parseAutomaton results per blob pointer so
- *       multiple words hitting the same language only pay the cost once.
+ *       structs.
+ *
+ *     - Languages that are not built in read the same blob from the SD card
+ *       through HyphenationTrieFile's page cache. bytesAt hides the difference,
+ *       so decodeState asks for each node's header, body and levels
+ *       separately and never assumes the rest of the blob is addressable.
+ *
+ *     - The top levels of the trie, where every walk starts and nodes have
+ *       the most children, are also available as DenseHyphenationLevels:
+ *       direct-indexed tables emitted next to the blob by the generator. The
+ *       walk uses them first and only falls back to decodeState/transition
+ *       for deeper nodes.
  *
  * 3.  Pattern application
  *     - We walk the augmented bytes left-to-right. For each starting byte we
@@ -47,80 +59,79 @@
  * Keeping the entire algorithm small and deterministic is critical on the
  * ESP32-C3: we avoid recursion, dynamic allocations per node, or copying the
  * trie. All lookups stay within the generated blob, which lives in flash, and
- * the working buffers (augmented bytes/scores) scale with the word length rather
- * than the pattern corpus.
+ * the working buffers (augmented bytes/scores) are fixed-size stack arrays
+ * bounded by MAX_HYPHENATION_WORD_BYTES, so a word never touches the heap.
  */
 
 namespace {
 
-struct AugmentedWord {
-  std::vector<uint8_t> bytes;
-  std::vector<size_t> charByteOffsets;
-  std::vector<int32_t> byteToCharIndex;
+// The augmented word adds a leading and trailing '.' around the letters
+constexpr size_t MAX_AUGMENTED_BYTES = MAX_HYPHENATION_WORD_BYTES + 2;
+// byteToCharIndex marker for bytes that do not start a codepoint
+constexpr uint8_t NOT_A_BOUNDARY = 0xFF;
+static_assert(MAX_AUGMENTED_BYTES < NOT_A_BOUNDARY, "augmented offsets must fit in a byte");
 
-  bool empty() const { return bytes.empty(); }
-  size_t charCount() const { return charByteOffsets.size(); }
+struct AugmentedWord {
+  uint8_t bytes[MAX_AUGMENTED_BYTES];
+  uint8_t charByteOffsets[MAX_AUGMENTED_BYTES];
+  uint8_t byteToCharIndex[MAX_AUGMENTED_BYTES];
+  size_t byteCount = 0;
+  size_t charCount = 0;
 };
 
-// Encode a single Unicode codepoint into UTF-8 and append to the provided buffer.
-size_t encodeUtf8(uint32_t cp, std::vector<uint8_t>& out) {
+// Encode a single Unicode codepoint into UTF-8 at `out`, returning the number of bytes written.
+size_t encodeUtf8(const uint32_t cp, uint8_t* out) {
   if (cp <= 0x7Fu) {
-    out.push_back(static_cast<uint8_t>(cp));
+    out[0] = static_cast<uint8_t>(cp);
     return 1;
   }
   if (cp <= 0x7FFu) {
-    out.push_back(static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    out[0] = static_cast<uint8_t>(0xC0u | ((cp >> 6) & 0x1Fu));
+    out[1] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 2;
   }
   if (cp <= 0xFFFFu) {
-    out.push_back(static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-    out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+    out[0] = static_cast<uint8_t>(0xE0u | ((cp >> 12) & 0x0Fu));
+    out[1] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+    out[2] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
     return 3;
   }
-  out.push_back(static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu)));
-  out.push_back(static_cast<uint8_t>(0x80u | (cp & 0x3Fu)));
+  out[0] = static_cast<uint8_t>(0xF0u | ((cp >> 18) & 0x07u));
+  out[1] = static_cast<uint8_t>(0x80u | ((cp >> 12) & 0x3Fu));
+  out[2] = static_cast<uint8_t>(0x80u | ((cp >> 6) & 0x3Fu));
+  out[3] = static_cast<uint8_t>(0x80u | (cp & 0x3Fu));
   return 4;
 }
 
-// Build the dotted, lowercase UTF-8 representation plus lookup tables.
-AugmentedWord buildAugmentedWord(const std::vector<CodepointInfo>& cps, const LiangWordConfig& config) {
-  AugmentedWord word;
+// Build the dotted, lowercase UTF-8 representation plus lookup tables. Returns false for words that contain
+// non-letters or whose lowercase form does not fit the buffers.
+bool buildAugmentedWord(const WordCodepoints& cps, const LiangWordConfig& config, AugmentedWord& word) {
   if (cps.empty()) {
-    return word;
+    return false;
   }
 
-  word.bytes.reserve(cps.size() * 2 + 2);
-  word.charByteOffsets.reserve(cps.size() + 2);
-
-  word.charByteOffsets.push_back(0);
-  word.bytes.push_back('.');
+  word.charByteOffsets[0] = 0;
+  word.bytes[0] = '.';
+  word.byteCount = 1;
+  word.charCount = 1;
 
   for (const auto& info : cps) {
-    if (!config.isLetter(info.value)) {
-      word.bytes.clear();
-      word.charByteOffsets.clear();
-      word.byteToCharIndex.clear();
-      return word;
+    // Leave room for the widest encoding plus the trailing '.'
+    if (!config.isLetter(info.value) || word.byteCount + 4 + 1 > MAX_AUGMENTED_BYTES) {
+      return false;
     }
-    word.charByteOffsets.push_back(word.bytes.size());
-    encodeUtf8(config.toLower(info.value), word.bytes);
+    word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+    word.byteCount += encodeUtf8(config.toLower(info.value), word.bytes + word.byteCount);
   }
 
-  word.charByteOffsets.push_back(word.bytes.size());
-  word.bytes.push_back('.');
+  word.charByteOffsets[word.charCount++] = static_cast<uint8_t>(word.byteCount);
+  word.bytes[word.byteCount++] = '.';
 
-  word.byteToCharIndex.assign(word.bytes.size(), -1);
-  for (size_t i = 0; i < word.charByteOffsets.size(); ++i) {
-    const size_t offset = word.charByteOffsets[i];
-    if (offset < word.byteToCharIndex.size()) {
-      word.byteToCharIndex[offset] = static_cast<int32_t>(i);
-    }
+  memset(word.byteToCharIndex, NOT_A_BOUNDARY, word.byteCount);
+  for (size_t i = 0; i < word.charCount; ++i) {
+    word.byteToCharIndex[word.charByteOffsets[i]] = static_cast<uint8_t>(i);
   }
-  return word;
+  return true;
 }
 
 // Decoded view of a single trie node pulled straight out of the serialized blob.
@@ -145,51 +156,47 @@ struct AutomatonState {
 // The blob format is:
 //   [0..3]  - big-endian root offset
 //   [4....] - node heap containing variable-sized headers + transition data
+// Exactly one of `data` (flash) and `file` (SD card) is set.
 struct EmbeddedAutomaton {
   const uint8_t* data = nullptr;
+  HyphenationTrieFile* file = nullptr;
   size_t size = 0;
   uint32_t rootOffset = 0;
 
-  bool valid() const { return data != nullptr && size >= 4 && rootOffset < size; }
+  bool valid() const { return (data != nullptr || file != nullptr) && size >= 4 && rootOffset < size; }
 };
 
+// Pointer to `len` bytes of the blob at `addr`, or nullptr if they are out of range or cannot be read. For a file
+// the pointer stays valid across one further call.
+const uint8_t* bytesAt(const EmbeddedAutomaton& automaton, const size_t addr, const size_t len) {
+  if (automaton.file) {
+    return automaton.file->window(addr, len);
+  }
+  if (!automaton.data || addr >= automaton.size || len > automaton.size - addr) {
+    return nullptr;
+  }
+  return automaton.data + addr;
+}
+
 // Decode the serialized automaton header and root offset.
 EmbeddedAutomaton parseAutomaton(const SerializedHyphenationPatterns& patterns) {
   EmbeddedAutomaton automaton;
-  if (!patterns.data || patterns.size < 4) {
-    return automaton;
-  }
+  automaton.data = patterns.file ? nullptr : patterns.data;
+  automaton.file = patterns.file;
+  automaton.size = patterns.file ? patterns.file->trieSize() : patterns.size;
 
-  automaton.data = patterns.data;
-  automaton.size = patterns.size;
-  automaton.rootOffset = (static_cast<uint32_t>(patterns.data[0]) << 24) |
-                         (static_cast<uint32_t>(patterns.data[1]) << 16) |
-                         (static_cast<uint32_t>(patterns.data[2]) << 8) | static_cast<uint32_t>(patterns.data[3]);
+  const uint8_t* root = automaton.size >= 4 ? bytesAt(automaton, 0, 4) : nullptr;
+  if (!root) {
+    return EmbeddedAutomaton{};
+  }
+  automaton.rootOffset = (static_cast<uint32_t>(root[0]) << 24) | (static_cast<uint32_t>(root[1]) << 16) |
+                         (static_cast<uint32_t>(root[2]) << 8) | static_cast<uint32_t>(root[3]);
   if (automaton.rootOffset >= automaton.size) {
-    automaton.data = nullptr;
-    automaton.size = 0;
+    return EmbeddedAutomaton{};
   }
   return automaton;
 }
 
-// Cache parsed automata per blob pointer to avoid reparsing.
-const EmbeddedAutomaton& getAutomaton(const SerializedHyphenationPatterns& patterns) {
-  struct CacheEntry {
-    const SerializedHyphenationPatterns* key;
-    EmbeddedAutomaton automaton;
-  };
-  static std::vector<CacheEntry> cache;
-
-  for (const auto& entry : cache) {
-    if (entry.key == &patterns) {
-      return entry.automaton;
-    }
-  }
-
-  cache.push_back({&patterns, parseAutomaton(patterns)});
-  return cache.back().automaton;
-}
-
 // Interpret the node located at `addr`, returning transition metadata.
 AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
   AutomatonState state;
@@ -197,8 +204,12 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     return state;
   }
 
-  const uint8_t* base = automaton.data + addr;
   size_t remaining = automaton.size - addr;
+  // The header decides how long the node is; fetch it first so a paged trie only reads what the node needs
+  const uint8_t* base = bytesAt(automaton, addr, std::min<size_t>(2, remaining));
+  if (!base) {
+    return state;
+  }
   size_t pos = 0;
 
   const uint8_t header = base[pos++];
@@ -219,12 +230,18 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     childCount = base[pos++];
   }
 
+  const size_t nodeBytes = pos + (hasLevels ? 2 : 0) + childCount * (1 + stride);
+  if (nodeBytes > remaining) {
+    return AutomatonState{};
+  }
+  base = bytesAt(automaton, addr, nodeBytes);
+  if (!base) {
+    return AutomatonState{};
+  }
+
   const uint8_t* levelsPtr = nullptr;
   size_t levelsLen = 0;
   if (hasLevels) {
-    if (pos + 1 >= remaining) {
-      return AutomatonState{};
-    }
     const uint8_t offsetHi = base[pos++];
     const uint8_t offsetLoLen = base[pos++];
     // The 12-bit offset (hi<<4 | top nibble) points into the blob-level levels list.
@@ -234,22 +251,20 @@ AutomatonState decodeState(const EmbeddedAutomaton& automaton, size_t addr) {
     if (offset + levelsLen > automaton.size) {
       return AutomatonState{};
     }
-    levelsPtr = automaton.data + offset;
+    // Fetched last: the node body stays valid across this one further read
+    if (levelsLen > 0) {
+      levelsPtr = bytesAt(automaton, offset, levelsLen);
+      if (!levelsPtr) {
+        return AutomatonState{};
+      }
+    }
   }
 
-  if (pos + childCount > remaining) {
-    return AutomatonState{};
-  }
   const uint8_t* transitions = base + pos;
   pos += childCount;
-
-  const size_t targetsBytes = childCount * stride;
-  if (pos + targetsBytes > remaining) {
-    return AutomatonState{};
-  }
   const uint8_t* targets = base + pos;
 
-  state.data = automaton.data;
+  state.data = base;
   state.size = automaton.size;
   state.addr = addr;
   state.stride = stride;
@@ -300,15 +315,45 @@ bool transition(const EmbeddedAutomaton& automaton, const AutomatonState& state,
   return false;
 }
 
+// Raise scores with the packed levels of a matched node. Each packed byte stores the byte-distance delta from the
+// walk's starting byte and the Liang level digit.
+void applyLevels(const uint8_t* levels, const size_t levelsLen, const size_t byteStart, const AugmentedWord& augmented,
+                 uint8_t* scores) {
+  if (!levels) {
+    return;
+  }
+  size_t offset = 0;
+  for (size_t i = 0; i < levelsLen; ++i) {
+    const uint8_t packed = levels[i];
+    const size_t dist = static_cast<size_t>(packed / 10);
+    const uint8_t level = static_cast<uint8_t>(packed % 10);
+
+    offset += dist;
+    const size_t splitByte = byteStart + offset;
+    if (splitByte >= augmented.byteCount) {
+      continue;
+    }
+
+    const uint8_t boundary = augmented.byteToCharIndex[splitByte];
+    if (boundary == NOT_A_BOUNDARY) {
+      continue;  // Mid-codepoint byte, wait for the next one.
+    }
+    if (boundary < 2 || boundary + 2u > augmented.charCount) {
+      continue;  // Skip splits that land in the leading/trailing sentinels.
+    }
+
+    scores[boundary] = std::max(scores[boundary], level);
+  }
+}
+
 // Converts odd score positions back into codepoint indexes, honoring min prefix/suffix constraints.
 // Each break corresponds to scores[breakIndex + 1] because of the leading '.' sentinel.
-// Convert odd score entries into hyphen positions while honoring prefix/suffix limits.
-std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, const std::vector<uint8_t>& scores,
-                                        const size_t minPrefix, const size_t minSuffix) {
-  std::vector<size_t> indexes;
-  const size_t cpCount = cps.size();
+size_t collectBreakIndexes(const size_t cpCount, const uint8_t* scores, const size_t scoreCount,
+                           const size_t minPrefix, const size_t minSuffix,
+                           uint8_t (&indexes)[MAX_HYPHENATION_WORD_BYTES]) {
+  size_t count = 0;
   if (cpCount < 2) {
-    return indexes;
+    return count;
   }
 
   for (size_t breakIndex = 1; breakIndex < cpCount; ++breakIndex) {
@@ -322,84 +367,87 @@ std::vector<size_t> collectBreakIndexes(const std::vector<CodepointInfo>& cps, c
     }
 
     const size_t scoreIdx = breakIndex + 1;
-    if (scoreIdx >= scores.size()) {
+    if (scoreIdx >= scoreCount) {
       break;
     }
     if ((scores[scoreIdx] & 1u) == 0) {
       continue;
     }
-    indexes.push_back(breakIndex);
+    indexes[count++] = static_cast<uint8_t>(breakIndex);
   }
 
-  return indexes;
+  return count;
 }
 
 }  // namespace
 
 // Entry point that runs the full Liang pipeline for a single word.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config) {
-  const auto augmented = buildAugmentedWord(cps, config);
-  if (augmented.empty()) {
-    return {};
+size_t liangBreakIndexes(const WordCodepoints& cps, const SerializedHyphenationPatterns& patterns,
+                         const DenseHyphenationLevels* dense, const LiangWordConfig& config,
+                         uint8_t (&indexes)[MAX_HYPHENATION_WORD_BYTES]) {
+  AugmentedWord augmented;
+  if (!buildAugmentedWord(cps, config, augmented)) {
+    return 0;
   }
 
-  const EmbeddedAutomaton& automaton = getAutomaton(patterns);
+  const EmbeddedAutomaton automaton = parseAutomaton(patterns);
   if (!automaton.valid()) {
-    return {};
+    return 0;
   }
 
   const AutomatonState root = decodeState(automaton, automaton.rootOffset);
   if (!root.valid()) {
-    return {};
+    return 0;
   }
 
   // Liang scores: one entry per augmented char (leading/trailing dots included).
-  std::vector<uint8_t> scores(augmented.charCount(), 0);
+  uint8_t scores[MAX_AUGMENTED_BYTES] = {};
 
   // Walk every starting character position and stream bytes through the trie.
-  for (size_t charStart = 0; charStart < augmented.charByteOffsets.size(); ++charStart) {
+  for (size_t charStart = 0; charStart < augmented.charCount; ++charStart) {
     const size_t byteStart = augmented.charByteOffsets[charStart];
-    AutomatonState state = root;
+    size_t cursor = byteStart;
+    // A paged root may have been evicted by the previous walk
+    AutomatonState state = automaton.file ? decodeState(automaton, automaton.rootOffset) : root;
+
+    // The top levels are direct lookups; the walk continues in the compact encoding once it leaves them.
+    if (dense) {
+      uint32_t row = 0;
+      bool matched = false;
+      for (; cursor < augmented.byteCount; ++cursor) {
+        const uint8_t column = dense->columns[augmented.bytes[cursor]];
+        const uint32_t next = column ? dense->next[row * dense->columnCount + column - 1] : 0;
+        if (next == 0) {
+          break;  // No more matches for this prefix.
+        }
+        if (next & DenseHyphenationLevels::ROW_FLAG) {
+          row = next & ~DenseHyphenationLevels::ROW_FLAG;
+          const DenseHyphenationRow& levels = dense->rows[row];
+          applyLevels(automaton.data + levels.levelsOffset, levels.levelsCount, byteStart, augmented, scores);
+          continue;
+        }
+        state = decodeState(automaton, next);
+        if (state.valid()) {
+          applyLevels(state.levels, state.levelsLen, byteStart, augmented, scores);
+          matched = true;
+          ++cursor;
+        }
+        break;
+      }
+      if (!matched) {
+        continue;
+      }
+    }
 
-    for (size_t cursor = byteStart; cursor < augmented.bytes.size(); ++cursor) {
+    for (; cursor < augmented.byteCount; ++cursor) {
       AutomatonState next;
       if (!transition(automaton, state, augmented.bytes[cursor], next)) {
         break;  // No more matches for this prefix.
       }
       state = next;
-
-      if (state.levels && state.levelsLen > 0) {
-        size_t offset = 0;
-        // Each packed byte stores the byte-distance delta and the Liang level digit.
-        for (size_t i = 0; i < state.levelsLen; ++i) {
-          const uint8_t packed = state.levels[i];
-          const size_t dist = static_cast<size_t>(packed / 10);
-          const uint8_t level = static_cast<uint8_t>(packed % 10);
-
-          offset += dist;
-          const size_t splitByte = byteStart + offset;
-          if (splitByte >= augmented.byteToCharIndex.size()) {
-            continue;
-          }
-
-          const int32_t boundary = augmented.byteToCharIndex[splitByte];
-          if (boundary < 0) {
-            continue;  // Mid-codepoint byte, wait for the next one.
-          }
-          if (boundary < 2 || boundary + 2 > static_cast<int32_t>(augmented.charCount())) {
-            continue;  // Skip splits that land in the leading/trailing sentinels.
-          }
-
-          const size_t idx = static_cast<size_t>(boundary);
-          if (idx >= scores.size()) {
-            continue;
-          }
-          scores[idx] = std::max(scores[idx], level);
-        }
-      }
+      applyLevels(state.levels, state.levelsLen, byteStart, augmented, scores);
     }
   }
 
-  return collectBreakIndexes(cps, scores, config.minPrefix, config.minSuffix);
+  return collectBreakIndexes(cps.size(), scores, augmented.charCount, config.minPrefix, config.minSuffix, indexes);
 }
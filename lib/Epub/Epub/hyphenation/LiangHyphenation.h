@@ -2,7 +2,6 @@
 
 #include <cstddef>
 #include <cstdint>
-#include <vector>
 
 #include "HyphenationCommon.h"
 #include "SerializedHyphenationTrie.h"
@@ -33,6 +32,9 @@ struct LiangWordConfig {
       : isLetter(letterFn), toLower(lowerFn), minPrefix(prefix), minSuffix(suffix) {}
 };
 
-// Shared Liang pattern evaluator used by every language-specific hyphenator.
-std::vector<size_t> liangBreakIndexes(const std::vector<CodepointInfo>& cps,
-                                      const SerializedHyphenationPatterns& patterns, const LiangWordConfig& config);
+// Shared Liang pattern evaluator used by every language-specific hyphenator. Writes the codepoint indexes where the
+// word may be broken to `indexes` in ascending order and returns how many there are. `dense` holds the top levels
+// of the same trie as lookup tables; without it the whole walk decodes the compact blob.
+size_t liangBreakIndexes(const WordCodepoints& cps, const SerializedHyphenationPatterns& patterns,
+                         const DenseHyphenationLevels* dense, const LiangWordConfig& config,
+                         uint8_t (&indexes)[MAX_HYPHENATION_WORD_BYTES]);
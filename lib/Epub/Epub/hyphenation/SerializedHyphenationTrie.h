@@ -3,8 +3,32 @@
 #include <cstddef>
 #include <cstdint>
 
-// Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash.
+class HyphenationTrieFile;
+
+// Lightweight descriptor that points at a serialized Liang hyphenation trie stored in flash, or at one read from
+// the SD card through `file` (data and size are then unused).
 struct SerializedHyphenationPatterns {
   const std::uint8_t* data;
   size_t size;
+  HyphenationTrieFile* file = nullptr;
+};
+
+// Levels attached to one dense row, in the same form as the compact node header
+struct DenseHyphenationRow {
+  uint16_t levelsOffset;
+  uint8_t levelsCount;
+};
+
+// The top levels of a serialized trie as direct-indexed transition tables, also in flash. Row 0 is the root. A
+// byte's column is columns[byte] - 1 (0: no node in these levels has a transition on it). next[row * columnCount +
+// column] is 0 for no transition, ROW_FLAG | row for a child that has its own dense row, or else the child's
+// offset in the compact blob.
+struct DenseHyphenationLevels {
+  static constexpr uint32_t ROW_FLAG = 0x80000000u;
+
+  const std::uint8_t* columns;
+  const std::uint32_t* next;
+  const DenseHyphenationRow* rows;
+  size_t columnCount;
+  size_t rowCount;
 };
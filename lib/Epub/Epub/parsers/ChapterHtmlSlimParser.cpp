@@ -1,53 +1,27 @@
 #include "ChapterHtmlSlimParser.h"
 
+#include <Arduino.h>
 #include <GfxRenderer.h>
 #include <HalStorage.h>
 #include <Logging.h>
+#include <Utf8.h>
 #include <expat.h>
 
 #include "../Page.h"
 #include "../htmlEntities.h"
-
-const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
-constexpr int NUM_HEADER_TAGS = sizeof(HEADER_TAGS) / sizeof(HEADER_TAGS[0]);
+#include "../hyphenation/HyphenationCommon.h"
+#include "HtmlTags.h"
 
 // Minimum file size (in bytes) to show indexing popup - smaller chapters don't benefit from it
 constexpr size_t MIN_SIZE_FOR_POPUP = 10 * 1024;  // 10KB
 
-const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
-constexpr int NUM_BLOCK_TAGS = sizeof(BLOCK_TAGS) / sizeof(BLOCK_TAGS[0]);
-
-const char* BOLD_TAGS[] = {"b", "strong"};
-constexpr int NUM_BOLD_TAGS = sizeof(BOLD_TAGS) / sizeof(BOLD_TAGS[0]);
-
-const char* ITALIC_TAGS[] = {"i", "em"};
-constexpr int NUM_ITALIC_TAGS = sizeof(ITALIC_TAGS) / sizeof(ITALIC_TAGS[0]);
-
-const char* UNDERLINE_TAGS[] = {"u", "ins"};
-constexpr int NUM_UNDERLINE_TAGS = sizeof(UNDERLINE_TAGS) / sizeof(UNDERLINE_TAGS[0]);
-
-const char* IMAGE_TAGS[] = {"img"};
-constexpr int NUM_IMAGE_TAGS = sizeof(IMAGE_TAGS) / sizeof(IMAGE_TAGS[0]);
+// Words added to a paragraph between two looks at the free heap
+constexpr size_t HEAP_CHECK_INTERVAL_WORDS = 64;
 
-const char* SKIP_TAGS[] = {"head"};
-constexpr int NUM_SKIP_TAGS = sizeof(SKIP_TAGS) / sizeof(SKIP_TAGS[0]);
+static_assert(MAX_WORD_SIZE <= MAX_HYPHENATION_WORD_BYTES, "the hyphenator's buffers must hold any emitted word");
 
 bool isWhitespace(const char c) { return c == ' ' || c == '\r' || c == '\n' || c == '\t'; }
 
-// given the start and end of a tag, check to see if it matches a known tag
-bool matches(const char* tag_name, const char* possible_tags[], const int possible_tag_count) {
-  for (int i = 0; i < possible_tag_count; i++) {
-    if (strcmp(tag_name, possible_tags[i]) == 0) {
-      return true;
-    }
-  }
-  return false;
-}
-
-bool isHeaderOrBlock(const char* name) {
-  return matches(name, HEADER_TAGS, NUM_HEADER_TAGS) || matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS);
-}
-
 // Update effective bold/italic/underline based on block style and inline style stack
 void ChapterHtmlSlimParser::updateEffectiveInlineStyle() {
   // Start with block-level styles
@@ -91,14 +65,46 @@ void ChapterHtmlSlimParser::flushPartWordBuffer() {
 
   // flush the buffer
   partWordBuffer[partWordBufferIndex] = '\0';
-  currentTextBlock->addWord(partWordBuffer, fontStyle, false, nextWordContinues);
+  currentTextBlock->addWord(partWordBuffer, fontStyle, false, nextWordContinues, nextWordAbuts,
+                            partWordSourceOffset);
   partWordBufferIndex = 0;
   nextWordContinues = false;
+  nextWordAbuts = false;
+}
+
+uint32_t ChapterHtmlSlimParser::currentSourceOffset() const {
+  // Start of the event being handled: the tag in element callbacks, the text run in characterData
+  const XML_Index index = xmlParser ? XML_GetCurrentByteIndex(xmlParser) : 0;
+  return index > 0 ? static_cast<uint32_t>(index) : 0;
+}
+
+void ChapterHtmlSlimParser::recordAnchor(const char* id) {
+  // The element's content starts with the next word added to the current block, after any buffered part word
+  size_t wordIndex = wordsPlacedFromBlock + (partWordBufferIndex > 0 ? 1 : 0);
+  if (currentTextBlock) {
+    wordIndex += currentTextBlock->size();
+  }
+  pendingAnchors.push_back({hashAnchor(id), wordIndex});
+}
+
+void ChapterHtmlSlimParser::placePendingAnchors(const size_t placedWords, const uint16_t page) {
+  // Words split by hyphenation after an id was recorded shift it a word earlier each, never onto another block
+  auto it = pendingAnchors.begin();
+  while (it != pendingAnchors.end()) {
+    if (it->wordIndex < placedWords) {
+      anchors.push_back({it->idHash, page});
+      it = pendingAnchors.erase(it);
+    } else {
+      ++it;
+    }
+  }
 }
 
 // start a new text block if needed
 void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
   nextWordContinues = false;  // New block = new paragraph, no continuation
+  nextWordAbuts = false;
+  lineBreaker.reset();
   if (currentTextBlock) {
     // already have a text block running and it is empty - just reuse it
     if (currentTextBlock->isEmpty()) {
@@ -117,21 +123,28 @@ void ChapterHtmlSlimParser::startNewTextBlock(const BlockStyle& blockStyle) {
 void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char* name, const XML_Char** atts) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
+  // Classify once; endElement picks the categories back up from the stack
+  const uint16_t tag = HtmlTags::classify(name);
+  self->tagStack.push_back(tag);
+
   // Middle of skip
   if (self->skipUntilDepth < self->depth) {
     self->depth += 1;
     return;
   }
 
-  // Extract class and style attributes for CSS processing
-  std::string classAttr;
-  std::string styleAttr;
+  // Extract class and style attributes for CSS processing (pointers into expat's attribute array)
+  const char* classAttr = "";
+  const char* styleAttr = "";
   if (atts != nullptr) {
     for (int i = 0; atts[i]; i += 2) {
       if (strcmp(atts[i], "class") == 0) {
         classAttr = atts[i + 1];
       } else if (strcmp(atts[i], "style") == 0) {
         styleAttr = atts[i + 1];
+      } else if (strcmp(atts[i], "id") == 0 && *atts[i + 1]) {
+        // Recorded before the skip checks so ids on page-break markers and tables still resolve
+        self->recordAnchor(atts[i + 1]);
       }
     }
   }
@@ -141,7 +154,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   centeredBlockStyle.alignment = CssTextAlign::Center;
 
   // Special handling for tables - show placeholder text instead of dropping silently
-  if (strcmp(name, "table") == 0) {
+  if (tag & HtmlTags::TABLE) {
     // Add placeholder text
     self->startNewTextBlock(centeredBlockStyle);
 
@@ -155,7 +168,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
-  if (matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS)) {
+  if (tag & HtmlTags::IMAGE) {
     // TODO: Start processing image tags
     std::string alt = "[Image]";
     if (atts != nullptr) {
@@ -182,7 +195,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     return;
   }
 
-  if (matches(name, SKIP_TAGS, NUM_SKIP_TAGS)) {
+  if (tag & HtmlTags::SKIP) {
     // start skip
     self->skipUntilDepth = self->depth;
     self->depth += 1;
@@ -204,12 +217,11 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   // Compute CSS style for this element
   CssStyle cssStyle;
   if (self->cssParser) {
-    // Get combined tag + class styles
-    cssStyle = self->cssParser->resolveStyle(name, classAttr);
+    // Get combined tag + class styles, including selectors that depend on the open ancestors
+    cssStyle = self->cssParser->resolveStyle(name, classAttr, self->cssAncestors, self->depth);
     // Merge inline style (highest priority)
-    if (!styleAttr.empty()) {
-      CssStyle inlineStyle = CssParser::parseInlineStyle(styleAttr);
-      cssStyle.applyOver(inlineStyle);
+    if (*styleAttr) {
+      cssStyle.applyOver(self->cssParser->resolveInlineStyle(styleAttr));
     }
   }
 
@@ -219,7 +231,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
   const auto userAlignmentBlockStyle = BlockStyle::fromCssStyle(
       cssStyle, emSize, static_cast<CssTextAlign>(self->paragraphAlignment), self->viewportWidth);
 
-  if (matches(name, HEADER_TAGS, NUM_HEADER_TAGS)) {
+  if (tag & HtmlTags::HEADER) {
     self->currentCssStyle = cssStyle;
     auto headerBlockStyle = BlockStyle::fromCssStyle(cssStyle, emSize, CssTextAlign::Center, self->viewportWidth);
     headerBlockStyle.textAlignDefined = true;
@@ -229,8 +241,8 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     self->startNewTextBlock(headerBlockStyle);
     self->boldUntilDepth = std::min(self->boldUntilDepth, self->depth);
     self->updateEffectiveInlineStyle();
-  } else if (matches(name, BLOCK_TAGS, NUM_BLOCK_TAGS)) {
-    if (strcmp(name, "br") == 0) {
+  } else if (tag & HtmlTags::BLOCK) {
+    if (tag & HtmlTags::LINE_BREAK) {
       if (self->partWordBufferIndex > 0) {
         // flush word preceding <br/> to currentTextBlock before calling startNewTextBlock
         self->flushPartWordBuffer();
@@ -241,11 +253,12 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
       self->startNewTextBlock(userAlignmentBlockStyle);
       self->updateEffectiveInlineStyle();
 
-      if (strcmp(name, "li") == 0) {
-        self->currentTextBlock->addWord("\xe2\x80\xa2", EpdFontFamily::REGULAR);
+      if (tag & HtmlTags::LIST_ITEM) {
+        self->currentTextBlock->addWord("\xe2\x80\xa2", EpdFontFamily::REGULAR, false, false, false,
+                                        self->currentSourceOffset());
       }
     }
-  } else if (matches(name, UNDERLINE_TAGS, NUM_UNDERLINE_TAGS)) {
+  } else if (tag & HtmlTags::UNDERLINE) {
     // Flush buffer before style change so preceding text gets current style
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
@@ -267,7 +280,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
     self->inlineStyleStack.push_back(entry);
     self->updateEffectiveInlineStyle();
-  } else if (matches(name, BOLD_TAGS, NUM_BOLD_TAGS)) {
+  } else if (tag & HtmlTags::BOLD) {
     // Flush buffer before style change so preceding text gets current style
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
@@ -289,7 +302,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
     self->inlineStyleStack.push_back(entry);
     self->updateEffectiveInlineStyle();
-  } else if (matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS)) {
+  } else if (tag & HtmlTags::ITALIC) {
     // Flush buffer before style change so preceding text gets current style
     if (self->partWordBufferIndex > 0) {
       self->flushPartWordBuffer();
@@ -311,7 +324,7 @@ void XMLCALL ChapterHtmlSlimParser::startElement(void* userData, const XML_Char*
     }
     self->inlineStyleStack.push_back(entry);
     self->updateEffectiveInlineStyle();
-  } else if (strcmp(name, "span") == 0 || !isHeaderOrBlock(name)) {
+  } else if ((tag & HtmlTags::SPAN) || !(tag & (HtmlTags::HEADER | HtmlTags::BLOCK))) {
     // Handle span and other inline elements for CSS styling
     if (cssStyle.hasFontWeight() || cssStyle.hasFontStyle() || cssStyle.hasTextDecoration()) {
       // Flush buffer before style change so preceding text gets current style
@@ -350,7 +363,8 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
     return;
   }
 
-  for (int i = 0; i < len; i++) {
+  const uint32_t dataSourceOffset = self->currentSourceOffset();
+  for (int i = 0; i < len;) {
     if (isWhitespace(s[i])) {
       // Currently looking at whitespace, if there's anything in the partWordBuffer, flush it
       if (self->partWordBufferIndex > 0) {
@@ -358,13 +372,26 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
       }
       // Whitespace is a real word boundary — reset continuation state
       self->nextWordContinues = false;
+      self->lineBreaker.reset();
       // Skip the whitespace char
+      i++;
       continue;
     }
 
-    // Detect U+00A0 (non-breaking space): UTF-8 encoding is 0xC2 0xA0
-    // Render a visible space without allowing a line break around it.
-    if (static_cast<uint8_t>(s[i]) == 0xC2 && i + 1 < len && static_cast<uint8_t>(s[i + 1]) == 0xA0) {
+    // Work a whole codepoint at a time; a sequence cut short by the end of the data is taken byte by byte
+    const auto* bytes = reinterpret_cast<const unsigned char*>(s + i);
+    int sequenceLen = utf8CodepointLen(bytes[0]);
+    uint32_t cp = bytes[0];
+    if (sequenceLen > len - i) {
+      sequenceLen = 1;
+    } else if (sequenceLen > 1) {
+      const unsigned char* cursor = bytes;
+      cp = utf8NextCodepoint(&cursor);
+    }
+    const bool breakBefore = self->lineBreaker.breakBefore(cp);
+
+    // U+00A0 (non-breaking space): render a visible space without allowing a line break around it.
+    if (cp == 0xA0) {
       // Flush any pending text so style is applied correctly.
       if (self->partWordBufferIndex > 0) {
         self->flushPartWordBuffer();
@@ -374,47 +401,63 @@ void XMLCALL ChapterHtmlSlimParser::characterData(void* userData, const XML_Char
       self->partWordBuffer[0] = ' ';
       self->partWordBuffer[1] = '\0';
       self->partWordBufferIndex = 1;
+      self->partWordSourceOffset = dataSourceOffset + i;
       self->nextWordContinues = true;  // Attach space to previous word (no break).
       self->flushPartWordBuffer();
 
       // Ensure the next real word attaches to this space (no break).
       self->nextWordContinues = true;
 
-      i++;  // Skip the second byte (0xA0)
+      i += sequenceLen;
       continue;
     }
 
-    // Skip Zero Width No-Break Space / BOM (U+FEFF) = 0xEF 0xBB 0xBF
-    const XML_Char FEFF_BYTE_1 = static_cast<XML_Char>(0xEF);
-    const XML_Char FEFF_BYTE_2 = static_cast<XML_Char>(0xBB);
-    const XML_Char FEFF_BYTE_3 = static_cast<XML_Char>(0xBF);
-
-    if (s[i] == FEFF_BYTE_1) {
-      // Check if the next two bytes complete the 3-byte sequence
-      if ((i + 2 < len) && (s[i + 1] == FEFF_BYTE_2) && (s[i + 2] == FEFF_BYTE_3)) {
-        // Sequence 0xEF 0xBB 0xBF found!
-        i += 2;    // Skip the next two bytes
-        continue;  // Move to the next iteration
-      }
+    // Zero width space, word joiner and zero width no-break space / BOM only steer line breaking, nothing is drawn
+    if (cp == 0x200B || cp == 0x2060 || cp == 0xFEFF) {
+      i += sequenceLen;
+      continue;
     }
 
-    // If we're about to run out of space, then cut the word off and start a new one
-    if (self->partWordBufferIndex >= MAX_WORD_SIZE) {
+    if (breakBefore) {
+      // A line may break here although there is no space (between ideographs, after a zero width space)
+      if (self->partWordBufferIndex > 0) {
+        self->flushPartWordBuffer();
+      }
+      self->nextWordContinues = false;
+      self->nextWordAbuts = true;
+    } else if (self->partWordBufferIndex + sequenceLen > MAX_WORD_SIZE) {
+      // About to run out of space: cut the word off between codepoints and start a new one right after it
       self->flushPartWordBuffer();
+      self->nextWordAbuts = true;
     }
 
-    self->partWordBuffer[self->partWordBufferIndex++] = s[i];
-  }
-
-  // If we have > 750 words buffered up, perform the layout and consume out all but the last line
-  // There should be enough here to build out 1-2 full pages and doing this will free up a lot of
-  // memory.
-  // Spotted when reading Intermezzo, there are some really long text blocks in there.
-  if (self->currentTextBlock->size() > 750) {
-    LOG_DBG("EHP", "Text block too long, splitting into multiple pages");
-    self->currentTextBlock->layoutAndExtractLines(
-        self->renderer, self->fontId, self->viewportWidth,
-        [self](const std::shared_ptr<TextBlock>& textBlock) { self->addLineToPage(textBlock); }, false);
+    if (self->partWordBufferIndex == 0) {
+      // Entities arrive as their own event, so the offset is exact for plain text and points at the entity otherwise
+      self->partWordSourceOffset = dataSourceOffset + i;
+    }
+    memcpy(self->partWordBuffer + self->partWordBufferIndex, s + i, sequenceLen);
+    self->partWordBufferIndex += sequenceLen;
+    i += sequenceLen;
+  }
+
+  // Long paragraphs are laid out in windows: lay out and emit the leading lines once the window is full, holding back
+  // enough lines that their breaks still take the following text into account. Under memory pressure, emit all but
+  // the last line early instead of running out of heap on a giant paragraph.
+  const size_t bufferedWords = self->currentTextBlock->size();
+  if (bufferedWords >= self->processingProfile.layoutWindowWords) {
+    LOG_DBG("EHP", "Text block too long, laying out its leading lines");
+    self->layoutTextBlock(self->processingProfile.layoutLookaheadLines);
+    self->wordsAtHeapCheck = 0;
+  } else if (self->processingProfile.lowHeapThreshold > 0 && EpubProcessingProfile::heapHooks.freeHeap &&
+             bufferedWords >= self->wordsAtHeapCheck + HEAP_CHECK_INTERVAL_WORDS) {
+    self->wordsAtHeapCheck = bufferedWords;
+    const size_t freeHeap = EpubProcessingProfile::heapHooks.freeHeap();
+    if (freeHeap < self->processingProfile.lowHeapThreshold) {
+      LOG_DBG("EHP", "Low heap (%u bytes) with %u words buffered, laying out early", static_cast<unsigned>(freeHeap),
+              static_cast<unsigned>(bufferedWords));
+      self->layoutTextBlock(1);
+      self->wordsAtHeapCheck = 0;
+    }
   }
 }
 
@@ -434,9 +477,16 @@ void XMLCALL ChapterHtmlSlimParser::defaultHandlerExpand(void* userData, const X
   // Not an entity we recognize - skip it
 }
 
-void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* name) {
+void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* /*name*/) {
   auto* self = static_cast<ChapterHtmlSlimParser*>(userData);
 
+  // Categories computed when the element opened
+  uint16_t tag = 0;
+  if (!self->tagStack.empty()) {
+    tag = self->tagStack.back();
+    self->tagStack.pop_back();
+  }
+
   // Check if any style state will change after we decrement depth
   // If so, we MUST flush the partWordBuffer with the CURRENT style first
   // Note: depth hasn't been decremented yet, so we check against (depth - 1)
@@ -447,17 +497,15 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   const bool willClearUnderline = self->underlineUntilDepth == self->depth - 1;
 
   const bool styleWillChange = willPopStyleStack || willClearBold || willClearItalic || willClearUnderline;
-  const bool headerOrBlockTag = isHeaderOrBlock(name);
+  const bool headerOrBlockTag = tag & (HtmlTags::HEADER | HtmlTags::BLOCK);
 
   // Flush buffer with current style BEFORE any style changes
   if (self->partWordBufferIndex > 0) {
     // Flush if style will change OR if we're closing a block/structural element
-    const bool isInlineTag = !headerOrBlockTag && strcmp(name, "table") != 0 &&
-                             !matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS) && self->depth != 1;
-    const bool shouldFlush = styleWillChange || headerOrBlockTag || matches(name, BOLD_TAGS, NUM_BOLD_TAGS) ||
-                             matches(name, ITALIC_TAGS, NUM_ITALIC_TAGS) ||
-                             matches(name, UNDERLINE_TAGS, NUM_UNDERLINE_TAGS) || strcmp(name, "table") == 0 ||
-                             matches(name, IMAGE_TAGS, NUM_IMAGE_TAGS) || self->depth == 1;
+    const bool isInlineTag = !headerOrBlockTag && !(tag & (HtmlTags::TABLE | HtmlTags::IMAGE)) && self->depth != 1;
+    const bool shouldFlush = styleWillChange || self->depth == 1 ||
+                             (tag & (HtmlTags::HEADER | HtmlTags::BLOCK | HtmlTags::BOLD | HtmlTags::ITALIC |
+                                     HtmlTags::UNDERLINE | HtmlTags::TABLE | HtmlTags::IMAGE));
 
     if (shouldFlush) {
       self->flushPartWordBuffer();
@@ -469,6 +517,7 @@ void XMLCALL ChapterHtmlSlimParser::endElement(void* userData, const XML_Char* n
   }
 
   self->depth -= 1;
+  self->cssAncestors.leave(self->depth);
 
   // Leaving skip
   if (self->skipUntilDepth == self->depth) {
@@ -543,6 +592,7 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
   }
 
   XML_SetUserData(parser, this);
+  xmlParser = parser;
   XML_SetElementHandler(parser, startElement, endElement);
   XML_SetCharacterDataHandler(parser, characterData);
   const size_t parseChunkSize = processingProfile.parseChunkSizeOrDefault();
@@ -583,12 +633,26 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
       file.close();
       return false;
     }
+
+    // A chapter takes seconds to lay out; whoever asked for it may no longer be able to wait
+    if (!done && shouldStop && shouldStop()) {
+      LOG_DBG("EHP", "Stopped at byte %lu", static_cast<unsigned long>(file.position()));
+      stopped = true;
+      XML_StopParser(parser, XML_FALSE);
+      XML_SetElementHandler(parser, nullptr, nullptr);
+      XML_SetCharacterDataHandler(parser, nullptr);
+      XML_ParserFree(parser);
+      xmlParser = nullptr;
+      file.close();
+      return false;
+    }
   } while (!done);
 
   XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
   XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
   XML_SetCharacterDataHandler(parser, nullptr);
   XML_ParserFree(parser);
+  xmlParser = nullptr;
   file.close();
 
   // Process last page if there is still text
@@ -597,12 +661,19 @@ bool ChapterHtmlSlimParser::parseAndBuildPages() {
     completePageFn(std::move(currentPage));
     currentPage.reset();
     currentTextBlock.reset();
+    completedPages++;
   }
 
+  // Ids after the last word belong to the last page
+  if (!pendingAnchors.empty() && completedPages > 0) {
+    placePendingAnchors(SIZE_MAX, completedPages - 1);
+  }
+  pendingAnchors.clear();
+
   return true;
 }
 
-void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
+void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line, const uint32_t sourceOffset) {
   const int lineHeight = processingProfile.cacheLineMetrics
                              ? lineHeightPx
                              : static_cast<int>(renderer.getLineHeight(fontId) * lineCompression);
@@ -611,32 +682,40 @@ void ChapterHtmlSlimParser::addLineToPage(std::shared_ptr<TextBlock> line) {
     completePageFn(std::move(currentPage));
     currentPage.reset(new Page());
     currentPageNextY = 0;
+    completedPages++;
+  }
+
+  if (currentPage->elements.empty()) {
+    currentPage->sourceOffset = sourceOffset;
   }
 
   // Apply horizontal left inset (margin + padding) as x position offset
   const int16_t xOffset = line->getBlockStyle().leftInset();
   currentPage->elements.push_back(std::make_shared<PageLine>(line, xOffset, currentPageNextY));
   currentPageNextY += lineHeight;
-}
 
-void ChapterHtmlSlimParser::makePages() {
-  if (!currentTextBlock) {
-    LOG_ERR("EHP", "!! No text block to make pages for !!");
-    return;
+  wordsPlacedFromBlock += line->wordCount();
+  if (!pendingAnchors.empty()) {
+    placePendingAnchors(wordsPlacedFromBlock, completedPages);
   }
+}
 
+void ChapterHtmlSlimParser::layoutTextBlock(const uint16_t heldBackLines) {
   if (!currentPage) {
     currentPage.reset(new Page());
     currentPageNextY = 0;
   }
 
-  // Apply top spacing before the paragraph (stored in pixels)
+  // Apply top spacing before the paragraph (stored in pixels), once even if it is laid out in several windows
   const BlockStyle& blockStyle = currentTextBlock->getBlockStyle();
-  if (blockStyle.marginTop > 0) {
-    currentPageNextY += blockStyle.marginTop;
-  }
-  if (blockStyle.paddingTop > 0) {
-    currentPageNextY += blockStyle.paddingTop;
+  if (!textBlockStarted) {
+    if (blockStyle.marginTop > 0) {
+      currentPageNextY += blockStyle.marginTop;
+    }
+    if (blockStyle.paddingTop > 0) {
+      currentPageNextY += blockStyle.paddingTop;
+    }
+    textBlockStarted = true;
   }
 
   // Calculate effective width accounting for horizontal margins/padding
@@ -646,7 +725,29 @@ void ChapterHtmlSlimParser::makePages() {
 
   currentTextBlock->layoutAndExtractLines(
       renderer, fontId, effectiveWidth,
-      [this](const std::shared_ptr<TextBlock>& textBlock) { addLineToPage(textBlock); });
+      [this](const std::shared_ptr<TextBlock>& textBlock) {
+        addLineToPage(textBlock, currentTextBlock->lastLineSourceOffset());
+      },
+      heldBackLines);
+}
+
+void ChapterHtmlSlimParser::makePages() {
+  if (!currentTextBlock) {
+    LOG_ERR("EHP", "!! No text block to make pages for !!");
+    return;
+  }
+
+  layoutTextBlock(0);
+  textBlockStarted = false;
+  wordsAtHeapCheck = 0;
+
+  // Ids still pending point past this block, at the first word of the next one
+  for (auto& anchor : pendingAnchors) {
+    anchor.wordIndex = 0;
+  }
+  wordsPlacedFromBlock = 0;
+
+  const BlockStyle& blockStyle = currentTextBlock->getBlockStyle();
 
   // Apply bottom spacing after the paragraph (stored in pixels)
   if (blockStyle.marginBottom > 0) {
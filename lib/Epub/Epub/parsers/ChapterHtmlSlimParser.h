@@ -3,14 +3,17 @@
 #include <expat.h>
 
 #include <climits>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "../EpubProcessingProfile.h"
 #include "../ParsedText.h"
 #include "../blocks/TextBlock.h"
 #include "../css/CssParser.h"
 #include "../css/CssStyle.h"
+#include "LineBreak.h"
 
 class Page;
 class GfxRenderer;
@@ -18,11 +21,33 @@ class GfxRenderer;
 #define MAX_WORD_SIZE 200
 
 class ChapterHtmlSlimParser {
+ public:
+  // An element id and the page its content starts on
+  struct Anchor {
+    uint32_t idHash;
+    uint16_t page;
+  };
+
+  // FNV-1a of an element id, as stored in the section file's anchor table
+  static uint32_t hashAnchor(const char* id) {
+    uint32_t hash = 2166136261u;
+    for (; *id; ++id) {
+      hash ^= static_cast<uint8_t>(*id);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+
+ private:
   const std::string& filepath;
   GfxRenderer& renderer;
+  XML_Parser xmlParser = nullptr;  // Set while parseAndBuildPages runs, for source offsets
   std::function<void(std::unique_ptr<Page>)> completePageFn;
   std::function<void()> popupFn;  // Popup callback
+  std::function<bool()> shouldStop;  // Checked between chunks, true to give up the chapter
+  bool stopped = false;
   int depth = 0;
+  std::vector<uint16_t> tagStack;  // HtmlTags categories of each open element
   int skipUntilDepth = INT_MAX;
   int boldUntilDepth = INT_MAX;
   int italicUntilDepth = INT_MAX;
@@ -31,10 +56,24 @@ class ChapterHtmlSlimParser {
   // leave one char at end for null pointer
   char partWordBuffer[MAX_WORD_SIZE + 1] = {};
   int partWordBufferIndex = 0;
+  uint32_t partWordSourceOffset = 0;  // Where the buffered part word starts in the source document
   bool nextWordContinues = false;  // true when next flushed word attaches to previous (inline element boundary)
+  bool nextWordAbuts = false;      // true when next flushed word follows previous with no space but may break (CJK)
+  LineBreak::Breaker lineBreaker;  // Break opportunities inside the current run of non-space text
   std::unique_ptr<ParsedText> currentTextBlock = nullptr;
+  bool textBlockStarted = false;  // Top spacing of currentTextBlock is on the page, its leading lines may be too
+  size_t wordsAtHeapCheck = 0;    // currentTextBlock size when the free heap was last looked at
   std::unique_ptr<Page> currentPage = nullptr;
   int16_t currentPageNextY = 0;
+  uint16_t completedPages = 0;
+  // Ids whose content has not reached a page yet, with the index of their first word in currentTextBlock
+  struct PendingAnchor {
+    uint32_t idHash;
+    size_t wordIndex;
+  };
+  std::vector<PendingAnchor> pendingAnchors;
+  std::vector<Anchor> anchors;
+  size_t wordsPlacedFromBlock = 0;  // Words of currentTextBlock already on a page
   int fontId;
   float lineCompression;
   bool extraParagraphSpacing;
@@ -46,6 +85,7 @@ class ChapterHtmlSlimParser {
   EpubProcessingProfile processingProfile;
   bool hyphenationEnabled;
   const CssParser* cssParser;
+  CssParser::AncestorStack cssAncestors;  // Open elements, for descendant and child selectors
   bool embeddedStyle;
 
   // Style tracking (replaces depth-based approach)
@@ -64,6 +104,10 @@ class ChapterHtmlSlimParser {
   void updateEffectiveInlineStyle();
   void startNewTextBlock(const BlockStyle& blockStyle);
   void flushPartWordBuffer();
+  uint32_t currentSourceOffset() const;
+  void recordAnchor(const char* id);
+  void placePendingAnchors(size_t placedWords, uint16_t page);
+  void layoutTextBlock(uint16_t heldBackLines);
   void makePages();
   // XML callbacks
   static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
@@ -79,7 +123,8 @@ class ChapterHtmlSlimParser {
                                  const std::function<void(std::unique_ptr<Page>)>& completePageFn,
                                  const bool embeddedStyle, const std::function<void()>& popupFn = nullptr,
                                  const CssParser* cssParser = nullptr,
-                                 const EpubProcessingProfile& processingProfile = EpubProcessingProfile::optimized())
+                                 const EpubProcessingProfile& processingProfile = EpubProcessingProfile::optimized(),
+                                 const std::function<bool()>& shouldStop = nullptr)
 
       : filepath(filepath),
         renderer(renderer),
@@ -93,10 +138,16 @@ class ChapterHtmlSlimParser {
         hyphenationEnabled(hyphenationEnabled),
         completePageFn(completePageFn),
         popupFn(popupFn),
+        shouldStop(shouldStop),
         cssParser(cssParser),
         embeddedStyle(embeddedStyle) {}
 
   ~ChapterHtmlSlimParser() = default;
   bool parseAndBuildPages();
-  void addLineToPage(std::shared_ptr<TextBlock> line);
+  // True if parseAndBuildPages returned false because shouldStop asked it to
+  bool wasStopped() const { return stopped; }
+  // sourceOffset: where the line's first word starts in the source document
+  void addLineToPage(std::shared_ptr<TextBlock> line, uint32_t sourceOffset);
+  // Every id seen by parseAndBuildPages in document order, with the page it landed on
+  const std::vector<Anchor>& getAnchors() const { return anchors; }
 };
@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Classification of the HTML tags ChapterHtmlSlimParser treats specially.
+ *
+ * A perfect hash over the known tag names is found at compile time, so classify() costs one hash of at most three
+ * characters plus the length, one table load and a single strcmp to reject unknown tags, whatever the tag. The
+ * result is a bitmask of categories; tags the parser does not know classify as 0.
+ */
+namespace HtmlTags {
+
+enum Category : uint16_t {
+  HEADER = 1 << 0,
+  BLOCK = 1 << 1,
+  BOLD = 1 << 2,
+  ITALIC = 1 << 3,
+  UNDERLINE = 1 << 4,
+  IMAGE = 1 << 5,
+  SKIP = 1 << 6,
+  TABLE = 1 << 7,
+  LINE_BREAK = 1 << 8,
+  LIST_ITEM = 1 << 9,
+  SPAN = 1 << 10,
+};
+
+struct Tag {
+  const char* name;
+  uint16_t categories;
+};
+
+constexpr Tag TAGS[] = {
+    {"h1", HEADER},
+    {"h2", HEADER},
+    {"h3", HEADER},
+    {"h4", HEADER},
+    {"h5", HEADER},
+    {"h6", HEADER},
+    {"p", BLOCK},
+    {"li", BLOCK | LIST_ITEM},
+    {"div", BLOCK},
+    {"br", BLOCK | LINE_BREAK},
+    {"blockquote", BLOCK},
+    {"b", BOLD},
+    {"strong", BOLD},
+    {"i", ITALIC},
+    {"em", ITALIC},
+    {"u", UNDERLINE},
+    {"ins", UNDERLINE},
+    {"img", IMAGE},
+    {"head", SKIP},
+    {"table", TABLE},
+    {"span", SPAN},
+};
+constexpr size_t TAG_COUNT = sizeof(TAGS) / sizeof(TAGS[0]);
+
+// Hash table size (power of two) and the longest known name; longer names cannot be known tags
+constexpr size_t TABLE_BITS = 6;
+constexpr size_t TABLE_SIZE = size_t{1} << TABLE_BITS;
+constexpr size_t MAX_NAME_LENGTH = 10;
+
+constexpr size_t nameLength(const char* name) {
+  size_t len = 0;
+  while (name[len] && len <= MAX_NAME_LENGTH) ++len;
+  return len;
+}
+
+constexpr size_t hashSlot(const char* name, const size_t len, const uint32_t seed) {
+  uint32_t h = seed ^ static_cast<uint32_t>(len);
+  h = h * 31 + static_cast<uint8_t>(name[0]);
+  h = h * 31 + static_cast<uint8_t>(len > 1 ? name[1] : 0);
+  h = h * 31 + static_cast<uint8_t>(name[len - 1]);
+  return (h * 2654435761u) >> (32 - TABLE_BITS);
+}
+
+constexpr bool isPerfectSeed(const uint32_t seed) {
+  bool used[TABLE_SIZE] = {};
+  for (const Tag& tag : TAGS) {
+    const size_t slot = hashSlot(tag.name, nameLength(tag.name), seed);
+    if (used[slot]) return false;
+    used[slot] = true;
+  }
+  return true;
+}
+
+constexpr uint32_t findSeed() {
+  uint32_t seed = 0;
+  while (!isPerfectSeed(seed)) ++seed;
+  return seed;
+}
+
+constexpr uint32_t SEED = findSeed();
+
+// Slot -> index into TAGS plus one, 0 for an empty slot
+struct HashTable {
+  uint8_t slots[TABLE_SIZE] = {};
+};
+
+constexpr HashTable buildTable() {
+  HashTable table;
+  for (size_t i = 0; i < TAG_COUNT; ++i) {
+    table.slots[hashSlot(TAGS[i].name, nameLength(TAGS[i].name), SEED)] = static_cast<uint8_t>(i + 1);
+  }
+  return table;
+}
+
+constexpr HashTable HASH_TABLE = buildTable();
+
+constexpr bool namesEqual(const char* a, const char* b) {
+  while (*a && *a == *b) {
+    ++a;
+    ++b;
+  }
+  return *a == *b;
+}
+
+// Category bitmask for a tag name, 0 for tags without special handling
+constexpr uint16_t classify(const char* name) {
+  const size_t len = nameLength(name);
+  if (len == 0 || len > MAX_NAME_LENGTH) return 0;
+  const uint8_t entry = HASH_TABLE.slots[hashSlot(name, len, SEED)];
+  return entry && namesEqual(TAGS[entry - 1].name, name) ? TAGS[entry - 1].categories : 0;
+}
+
+static_assert(classify("p") == BLOCK && classify("blockquote") == BLOCK && classify("h6") == HEADER,
+              "known tags must classify");
+static_assert(classify("span") == SPAN && classify("br") == (BLOCK | LINE_BREAK), "known tags must classify");
+static_assert(classify("section") == 0 && classify("a") == 0 && classify("") == 0, "unknown tags classify as 0");
+
+}  // namespace HtmlTags
@@ -0,0 +1,104 @@
+#include "LineBreak.h"
+
+#include <algorithm>
+
+namespace LineBreak {
+
+namespace {
+
+struct Range {
+  uint32_t first : 24;  // Range runs up to the next entry's first codepoint
+  uint32_t lineBreakClass : 8;
+};
+
+// Line break class by range, sorted, covering every codepoint from 0. Hand-maintained subset of LineBreak.txt:
+// CJ (small kana) is resolved to NS as UAX #14 does by default, Hangul syllables are ID.
+constexpr Range RANGES[] = {
+    {0x0, AL}, {0x21, EX}, {0x22, QU}, {0x23, AL}, {0x24, PR}, {0x25, PO}, {0x26, AL}, {0x27, QU}, {0x28, OP},
+    {0x29, CP}, {0x2A, AL}, {0x2B, PR}, {0x2C, IS}, {0x2D, HY}, {0x2E, IS}, {0x2F, SY}, {0x30, NU}, {0x3A, IS},
+    {0x3C, AL}, {0x3F, EX}, {0x40, AL}, {0x5B, OP}, {0x5C, PR}, {0x5D, CP}, {0x5E, AL}, {0x7B, OP}, {0x7C, BA},
+    {0x7D, CL}, {0x7E, AL}, {0xA0, GL}, {0xA1, OP}, {0xA2, PO}, {0xA3, PR}, {0xA6, AL}, {0xAB, QU}, {0xAC, AL},
+    {0xAD, BA}, {0xAE, AL}, {0xB0, PO}, {0xB1, PR}, {0xB2, AL}, {0xB4, BB}, {0xB5, AL}, {0xBB, QU}, {0xBC, AL},
+    {0xBF, OP}, {0xC0, AL}, {0x300, CM}, {0x370, AL}, {0x483, CM}, {0x48A, AL}, {0x591, CM}, {0x5BE, AL}, {0x610, CM},
+    {0x61B, AL}, {0x64B, CM}, {0x660, AL}, {0x1100, ID}, {0x1160, AL}, {0x1AB0, CM}, {0x1B00, AL}, {0x1DC0, CM},
+    {0x1E00, AL}, {0x2000, BA}, {0x2007, GL}, {0x2008, BA}, {0x200B, ZW}, {0x200C, CM}, {0x2010, BA}, {0x2011, GL},
+    {0x2012, BA}, {0x2014, B2}, {0x2015, AL}, {0x2018, QU}, {0x201A, OP}, {0x201B, QU}, {0x201E, OP}, {0x201F, QU},
+    {0x2020, AL}, {0x2024, IN}, {0x2027, AL}, {0x202F, GL}, {0x2030, PO}, {0x2038, AL}, {0x2039, QU}, {0x203B, AL},
+    {0x203C, NS}, {0x203E, AL}, {0x2044, IS}, {0x2045, AL}, {0x2047, NS}, {0x204A, AL}, {0x2060, WJ}, {0x2061, AL},
+    {0x20A0, PR}, {0x20D0, CM}, {0x2100, AL}, {0x2E80, ID}, {0x3000, BA}, {0x3001, CL}, {0x3003, ID}, {0x3005, NS},
+    {0x3006, ID}, {0x3008, OP}, {0x3009, CL}, {0x300A, OP}, {0x300B, CL}, {0x300C, OP}, {0x300D, CL}, {0x300E, OP},
+    {0x300F, CL}, {0x3010, OP}, {0x3011, CL}, {0x3012, ID}, {0x3014, OP}, {0x3015, CL}, {0x3016, OP}, {0x3017, CL},
+    {0x3018, OP}, {0x3019, CL}, {0x301A, OP}, {0x301B, CL}, {0x301C, NS}, {0x301D, OP}, {0x301E, CL}, {0x3020, ID},
+    {0x302A, CM}, {0x3030, ID}, {0x303B, NS}, {0x303C, ID}, {0x3040, AL}, {0x3041, NS}, {0x3042, ID}, {0x3043, NS},
+    {0x3044, ID}, {0x3045, NS}, {0x3046, ID}, {0x3047, NS}, {0x3048, ID}, {0x3049, NS}, {0x304A, ID}, {0x3063, NS},
+    {0x3064, ID}, {0x3083, NS}, {0x3084, ID}, {0x3085, NS}, {0x3086, ID}, {0x3087, NS}, {0x3088, ID}, {0x308E, NS},
+    {0x308F, ID}, {0x3095, NS}, {0x3097, AL}, {0x3099, CM}, {0x309B, NS}, {0x309F, ID}, {0x30A0, NS}, {0x30A2, ID},
+    {0x30A3, NS}, {0x30A4, ID}, {0x30A5, NS}, {0x30A6, ID}, {0x30A7, NS}, {0x30A8, ID}, {0x30A9, NS}, {0x30AA, ID},
+    {0x30C3, NS}, {0x30C4, ID}, {0x30E3, NS}, {0x30E4, ID}, {0x30E5, NS}, {0x30E6, ID}, {0x30E7, NS}, {0x30E8, ID},
+    {0x30EE, NS}, {0x30EF, ID}, {0x30F5, NS}, {0x30F7, ID}, {0x30FB, NS}, {0x30FF, ID}, {0x31F0, NS}, {0x3200, ID},
+    {0x4DC0, AL}, {0x4E00, ID}, {0xA015, NS}, {0xA016, ID}, {0xA4D0, AL}, {0xAC00, ID}, {0xD7A4, AL}, {0xF900, ID},
+    {0xFB00, AL}, {0xFE10, IS}, {0xFE11, CL}, {0xFE13, IS}, {0xFE15, EX}, {0xFE17, OP}, {0xFE18, CL}, {0xFE19, IN},
+    {0xFE1A, AL}, {0xFE20, CM}, {0xFE30, ID}, {0xFE50, AL}, {0xFEFF, WJ}, {0xFF00, AL}, {0xFF01, EX}, {0xFF02, ID},
+    {0xFF04, PR}, {0xFF05, PO}, {0xFF06, ID}, {0xFF08, OP}, {0xFF09, CL}, {0xFF0A, ID}, {0xFF0C, CL}, {0xFF0D, ID},
+    {0xFF0E, CL}, {0xFF0F, ID}, {0xFF1A, NS}, {0xFF1C, ID}, {0xFF1F, EX}, {0xFF20, ID}, {0xFF3B, OP}, {0xFF3C, ID},
+    {0xFF3D, CL}, {0xFF3E, ID}, {0xFF5B, OP}, {0xFF5C, ID}, {0xFF5D, CL}, {0xFF5E, ID}, {0xFF5F, OP}, {0xFF60, CL},
+    {0xFF62, OP}, {0xFF63, CL}, {0xFF65, NS}, {0xFF66, AL}, {0xFF67, NS}, {0xFF71, AL}, {0xFF9E, NS}, {0xFFA0, AL},
+    {0xFFE0, PO}, {0xFFE1, PR}, {0xFFE2, ID}, {0xFFE5, PR}, {0xFFE7, AL}, {0x1F000, ID}, {0x1FB00, AL}, {0x20000, ID},
+    {0x2FFFE, AL}, {0x30000, ID}, {0x3FFFE, AL},
+};
+constexpr size_t RANGE_COUNT = sizeof(RANGES) / sizeof(RANGES[0]);
+
+struct AsciiTable {
+  uint8_t classes[128] = {};
+};
+
+constexpr AsciiTable buildAsciiTable() {
+  AsciiTable table;
+  size_t range = 0;
+  for (uint32_t cp = 0; cp < 128; ++cp) {
+    while (range + 1 < RANGE_COUNT && RANGES[range + 1].first <= cp) ++range;
+    table.classes[cp] = RANGES[range].lineBreakClass;
+  }
+  return table;
+}
+
+// Most text in a mixed book is ASCII; skip the search for it
+constexpr AsciiTable ASCII_CLASSES = buildAsciiTable();
+
+}  // namespace
+
+Class classify(const uint32_t cp) {
+  if (cp < 128) {
+    return static_cast<Class>(ASCII_CLASSES.classes[cp]);
+  }
+  const Range* next = std::upper_bound(RANGES, RANGES + RANGE_COUNT, cp,
+                                       [](const uint32_t value, const Range& range) { return value < range.first; });
+  return static_cast<Class>((next - 1)->lineBreakClass);
+}
+
+bool isWide(const uint32_t cp) {
+  return (cp >= 0x1100 && cp <= 0x115F) || (cp >= 0x2E80 && cp <= 0x303E) || (cp >= 0x3041 && cp <= 0x33FF) ||
+         (cp >= 0x3400 && cp <= 0x4DBF) || (cp >= 0x4E00 && cp <= 0x9FFF) || (cp >= 0xA000 && cp <= 0xA4CF) ||
+         (cp >= 0xAC00 && cp <= 0xD7A3) || (cp >= 0xF900 && cp <= 0xFAFF) || (cp >= 0xFE10 && cp <= 0xFE19) ||
+         (cp >= 0xFE30 && cp <= 0xFE6F) || (cp >= 0xFF00 && cp <= 0xFF60) || (cp >= 0xFFE0 && cp <= 0xFFE6) ||
+         (cp >= 0x1F300 && cp <= 0x1FAFF) || (cp >= 0x20000 && cp <= 0x3FFFD);
+}
+
+bool Breaker::breakBefore(const uint32_t cp) {
+  const Class current = classify(cp);
+  if (current == CM) {
+    // A mark belongs to the character before it (LB9), or stands in for a letter at the start of a run (LB10)
+    if (previous == SP) {
+      previous = AL;
+    }
+    return false;
+  }
+
+  const bool wide = isWide(cp);
+  const bool opportunity = breakAllowed(previous, current) && (wide || previousWide || previous == ZW);
+  previous = current;
+  previousWide = wide;
+  return opportunity;
+}
+
+}  // namespace LineBreak
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Line break opportunities between adjacent characters, after Unicode UAX #14.
+ *
+ * ChapterHtmlSlimParser already breaks at whitespace; this decides where a line may break inside a run without
+ * spaces, which is every boundary between two ideographs but never before a closing bracket or small kana nor after
+ * an opening bracket. Characters are classified with a range table (a subset of LineBreak.txt: the classes that
+ * matter for CJK text and common punctuation, everything else is AL) and pairs are resolved with a table built at
+ * compile time from the UAX #14 rules for characters that are not separated by spaces.
+ *
+ * Breaks are only taken where one side is an East Asian wide character, so text in alphabetic scripts keeps the
+ * parser's word segmentation (and hyphenation) exactly as before.
+ */
+namespace LineBreak {
+
+enum Class : uint8_t {
+  AL,  // Alphabetic and anything not listed
+  ID,  // Ideographic: CJK ideographs, kana, Hangul syllables
+  OP,  // Opening punctuation
+  CL,  // Closing punctuation
+  CP,  // Closing parenthesis
+  QU,  // Quotation
+  GL,  // Non-breaking glue
+  NS,  // Nonstarter: small kana, prolonged sound mark, iteration marks
+  EX,  // Exclamation/interrogation
+  SY,  // Symbols allowing a break after (solidus)
+  IS,  // Infix numeric separator
+  PR,  // Prefix numeric
+  PO,  // Postfix numeric
+  NU,  // Numeric
+  HY,  // Hyphen-minus
+  BA,  // Break after
+  BB,  // Break before
+  B2,  // Break on either side, but not between two (em dash)
+  IN,  // Inseparable (ellipsis)
+  CM,  // Combining mark
+  ZW,  // Zero width space
+  WJ,  // Word joiner
+  SP,  // Space, also the state at the start of a run
+  CLASS_COUNT
+};
+static_assert(CLASS_COUNT <= 32, "pair table rows are 32-bit masks");
+
+// UAX #14 rules LB7-LB30 for two characters with no space between them; true if a line may break between them
+constexpr bool pairAllowsBreak(const Class before, const Class after) {
+  const auto in = [](const Class c, const uint32_t mask) { return ((mask >> c) & 1u) != 0; };
+  const auto bit = [](const Class c) { return 1u << c; };
+
+  if (before == SP) return false;  // Nothing before, or the parser already broke at the space
+  if (after == ZW || after == CM) return false;
+  if (before == ZW) return true;
+  if (before == WJ || after == WJ || before == GL) return false;
+  if (after == GL && !in(before, bit(BA) | bit(HY))) return false;
+  if (in(after, bit(CL) | bit(CP) | bit(EX) | bit(IS) | bit(SY))) return false;
+  if (before == OP) return false;
+  if (before == QU && after == OP) return false;
+  if (in(before, bit(CL) | bit(CP)) && after == NS) return false;
+  if (before == B2 && after == B2) return false;
+  if (before == QU || after == QU) return false;
+  if (in(after, bit(BA) | bit(HY) | bit(NS) | bit(IN)) || before == BB) return false;
+  if ((before == AL && after == NU) || (before == NU && after == AL)) return false;
+  if ((before == PR && after == ID) || (before == ID && after == PO)) return false;
+  if ((in(before, bit(PR) | bit(PO)) && after == AL) || (before == AL && in(after, bit(PR) | bit(PO)))) return false;
+  if (in(before, bit(CL) | bit(CP) | bit(NU)) && in(after, bit(PO) | bit(PR))) return false;
+  if (in(before, bit(PO) | bit(PR)) && in(after, bit(OP) | bit(NU))) return false;
+  if (in(before, bit(HY) | bit(IS) | bit(NU) | bit(SY)) && after == NU) return false;
+  if (before == AL && after == AL) return false;
+  if (before == IS && after == AL) return false;
+  if ((in(before, bit(AL) | bit(NU)) && after == OP) || (before == CP && in(after, bit(AL) | bit(NU)))) return false;
+  return true;
+}
+
+// Row per preceding class: bit set where the following class prohibits a break
+struct PairTable {
+  uint32_t noBreak[CLASS_COUNT] = {};
+};
+
+constexpr PairTable buildPairTable() {
+  PairTable table;
+  for (uint8_t before = 0; before < CLASS_COUNT; ++before) {
+    for (uint8_t after = 0; after < CLASS_COUNT; ++after) {
+      if (!pairAllowsBreak(static_cast<Class>(before), static_cast<Class>(after))) {
+        table.noBreak[before] |= 1u << after;
+      }
+    }
+  }
+  return table;
+}
+
+constexpr PairTable PAIR_TABLE = buildPairTable();
+
+constexpr bool breakAllowed(const Class before, const Class after) {
+  return ((PAIR_TABLE.noBreak[before] >> after) & 1u) == 0;
+}
+
+static_assert(breakAllowed(ID, ID) && breakAllowed(CL, ID) && breakAllowed(ID, OP), "ideographs break freely");
+static_assert(!breakAllowed(ID, CL) && !breakAllowed(ID, NS) && !breakAllowed(OP, ID), "kinsoku pairs must hold");
+static_assert(!breakAllowed(AL, AL) && !breakAllowed(IN, IN) && !breakAllowed(B2, B2), "runs must stay together");
+
+Class classify(uint32_t cp);
+
+// East Asian Wide or Fullwidth (UAX #11), approximated by block
+bool isWide(uint32_t cp);
+
+// Streaming break finder for one run of text: feed every codepoint in order, reset() at whitespace.
+class Breaker {
+  Class previous = SP;
+  bool previousWide = false;
+
+ public:
+  void reset() {
+    previous = SP;
+    previousWide = false;
+  }
+
+  // True if a line may break between the previous codepoint and `cp`
+  bool breakBefore(uint32_t cp);
+};
+
+}  // namespace LineBreak
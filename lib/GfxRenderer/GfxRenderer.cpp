@@ -3,6 +3,11 @@
 #include <Logging.h>
 #include <Utf8.h>
 
+namespace {
+// The copy of the last frame for ghosting estimates is only taken while this much heap is left besides it
+constexpr uint32_t GHOSTING_TRACKER_MIN_FREE_HEAP = 96 * 1024;
+}  // namespace
+
 void GfxRenderer::begin() {
   frameBuffer = display.getFrameBuffer();
   if (!frameBuffer) {
@@ -62,6 +67,11 @@ void GfxRenderer::drawPixel(const int x, const int y, const bool state) const {
     return;
   }
 
+  // Every draw ends up here, so a frame an asynchronous refresh is still sending is not written to
+  if (frameBufferSent) {
+    waitForDisplay();
+  }
+
   // Calculate byte position and bit position
   const uint16_t byteIndex = phyY * HalDisplay::DISPLAY_WIDTH_BYTES + (phyX / 8);
   const uint8_t bitPosition = 7 - (phyX % 8);  // MSB first
@@ -382,6 +392,10 @@ void GfxRenderer::fillRoundedRect(const int x, const int y, const int width, con
 }
 
 void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
+  if (screenFrameBuffer) {
+    offscreenMissed = true;
+    return;
+  }
   int rotatedX = 0;
   int rotatedY = 0;
   rotateCoordinates(orientation, x, y, &rotatedX, &rotatedY);
@@ -405,6 +419,10 @@ void GfxRenderer::drawImage(const uint8_t bitmap[], const int x, const int y, co
 }
 
 void GfxRenderer::drawIcon(const uint8_t bitmap[], const int x, const int y, const int width, const int height) const {
+  if (screenFrameBuffer) {
+    offscreenMissed = true;
+    return;
+  }
   display.drawImage(bitmap, y, getScreenWidth() - width - x, height, width);
 }
 
@@ -572,6 +590,28 @@ void GfxRenderer::drawBitmap1Bit(const Bitmap& bitmap, const int x, const int y,
   free(rowBytes);
 }
 
+void GfxRenderer::drawPackedBitmap(const uint8_t* data, const int x, const int y, const int width,
+                                   const int height) const {
+  const int rowBytes = (width + 7) / 8;
+  const int screenWidth = getScreenWidth();
+  const int screenHeight = getScreenHeight();
+
+  for (int row = 0; row < height; row++) {
+    const int screenY = y + row;
+    if (screenY < 0 || screenY >= screenHeight) {
+      continue;
+    }
+    const uint8_t* src = data + row * rowBytes;
+    for (int col = 0; col < width; col++) {
+      const int screenX = x + col;
+      if (screenX < 0 || screenX >= screenWidth) {
+        continue;
+      }
+      drawPixel(screenX, screenY, !(src[col / 8] & (0x80 >> (col % 8))));
+    }
+  }
+}
+
 void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state) const {
   if (numPoints < 3) return;
 
@@ -644,29 +684,105 @@ void GfxRenderer::fillPolygon(const int* xPoints, const int* yPoints, int numPoi
 static unsigned long start_ms = 0;
 
 void GfxRenderer::clearScreen(const uint8_t color) const {
+  waitForDisplay();
   start_ms = millis();
+  if (screenFrameBuffer) {
+    memset(frameBuffer, color, HalDisplay::BUFFER_SIZE);
+    return;
+  }
   display.clearScreen(color);
 }
 
 void GfxRenderer::invertScreen() const {
+  waitForDisplay();
   for (int i = 0; i < HalDisplay::BUFFER_SIZE; i++) {
     frameBuffer[i] = ~frameBuffer[i];
   }
 }
 
-void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
+void GfxRenderer::frameShown(const HalDisplay::RefreshMode refreshMode) const {
   auto elapsed = millis() - start_ms;
   LOG_DBG("GFX", "Time = %lu ms from clearScreen to displayBuffer", elapsed);
+  if (trackGhosting) {
+    ghosting.frameShown(frameBuffer, refreshMode != HalDisplay::FAST_REFRESH,
+                        ESP.getFreeHeap() >= HalDisplay::BUFFER_SIZE + GHOSTING_TRACKER_MIN_FREE_HEAP);
+  }
+}
+
+void GfxRenderer::displayBuffer(const HalDisplay::RefreshMode refreshMode) const {
+  waitForDisplay();
+  frameShown(refreshMode);
   display.displayBuffer(refreshMode, fadingFix);
   // In dual-buffer display mode, the driver may swap backing framebuffers during displayBuffer().
   // Keep renderer's cached pointer in sync so subsequent draws target the active draw buffer.
   frameBuffer = display.getFrameBuffer();
 }
 
+void GfxRenderer::displayBufferAsync(const HalDisplay::RefreshMode refreshMode, std::function<void()> onDone) const {
+  waitForDisplay();
+  frameShown(refreshMode);
+  frameBufferSent = true;
+  display.displayBufferAsync(refreshMode, fadingFix, std::move(onDone));
+}
+
+void GfxRenderer::waitForDisplay() const {
+  if (!frameBufferSent) {
+    return;
+  }
+  // As after displayBuffer(), the driver may have swapped frame buffers
+  frameBuffer = display.getFrameBuffer();
+  frameBufferSent = false;
+}
+
+void GfxRenderer::beginOffscreen(uint8_t* buffer) const {
+  if (screenFrameBuffer) {
+    LOG_ERR("GFX", "!! Already drawing offscreen");
+    return;
+  }
+  screenFrameBuffer = frameBuffer;
+  screenFrameBufferSent = frameBufferSent;
+  frameBuffer = buffer;
+  frameBufferSent = false;
+  offscreenMissed = false;
+}
+
+bool GfxRenderer::endOffscreen() const {
+  if (!screenFrameBuffer) {
+    return false;
+  }
+  frameBuffer = screenFrameBuffer;
+  frameBufferSent = screenFrameBufferSent;
+  screenFrameBuffer = nullptr;
+  return !offscreenMissed;
+}
+
+void GfxRenderer::copyToFrameBuffer(const uint8_t* buffer) const {
+  waitForDisplay();
+  memcpy(frameBuffer, buffer, HalDisplay::BUFFER_SIZE);
+}
+
+HalDisplay::RefreshMode GfxRenderer::pickRefreshMode(const int pagesPerCleanRefresh) {
+  if (!trackGhosting) {
+    trackGhosting = true;
+    return HalDisplay::HALF_REFRESH;
+  }
+  if (ghosting.needsCleanRefresh(frameBuffer, pagesPerCleanRefresh)) {
+    LOG_DBG("GFX", "Half refresh, ghosting at %lu%%", static_cast<unsigned long>(ghosting.getWorstRegionPercent()));
+    return HalDisplay::HALF_REFRESH;
+  }
+  return HalDisplay::FAST_REFRESH;
+}
+
+void GfxRenderer::stopGhostingTracking() {
+  trackGhosting = false;
+  ghosting.release();
+}
+
 void GfxRenderer::displayWindow(const int x, const int y, const int width, const int height) const {
   if (width <= 0 || height <= 0) {
     return;
   }
+  waitForDisplay();
 
   int p1x = 0, p1y = 0;
   int p2x = 0, p2y = 0;
@@ -697,6 +813,9 @@ void GfxRenderer::displayWindow(const int x, const int y, const int width, const
   const uint16_t alignedEnd = static_cast<uint16_t>((endExclusive + 7) & ~0x7);
   const uint16_t alignedWidth = alignedEnd - alignedX;
 
+  if (trackGhosting) {
+    ghosting.frameShown(frameBuffer, false, false);
+  }
   display.displayWindow(alignedX, static_cast<uint16_t>(minY), alignedWidth,
                         static_cast<uint16_t>(maxY - minY + 1), fadingFix);
 }
@@ -881,18 +1000,30 @@ void GfxRenderer::drawTextRotated90CW(const int fontId, const int x, const int y
   }
 }
 
-uint8_t* GfxRenderer::getFrameBuffer() const { return frameBuffer; }
+uint8_t* GfxRenderer::getFrameBuffer() const {
+  waitForDisplay();
+  return frameBuffer;
+}
 
 size_t GfxRenderer::getBufferSize() { return HalDisplay::BUFFER_SIZE; }
 
 // unused
 // void GfxRenderer::grayscaleRevert() const { display.grayscaleRevert(); }
 
-void GfxRenderer::copyGrayscaleLsbBuffers() const { display.copyGrayscaleLsbBuffers(frameBuffer); }
+void GfxRenderer::copyGrayscaleLsbBuffers() const {
+  waitForDisplay();
+  display.copyGrayscaleLsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::copyGrayscaleMsbBuffers() const { display.copyGrayscaleMsbBuffers(frameBuffer); }
+void GfxRenderer::copyGrayscaleMsbBuffers() const {
+  waitForDisplay();
+  display.copyGrayscaleMsbBuffers(frameBuffer);
+}
 
-void GfxRenderer::displayGrayBuffer() const { display.displayGrayBuffer(fadingFix); }
+void GfxRenderer::displayGrayBuffer() const {
+  waitForDisplay();
+  display.displayGrayBuffer(fadingFix);
+}
 
 void GfxRenderer::freeBwBufferChunks() {
   for (auto& bwBufferChunk : bwBufferChunks) {
@@ -910,6 +1041,7 @@ void GfxRenderer::freeBwBufferChunks() {
  * Returns true if buffer was stored successfully, false if allocation failed.
  */
 bool GfxRenderer::storeBwBuffer() {
+  waitForDisplay();
   // Allocate and copy each chunk
   for (size_t i = 0; i < BW_BUFFER_NUM_CHUNKS; i++) {
     // Check if any chunks are already allocated
@@ -942,6 +1074,7 @@ bool GfxRenderer::storeBwBuffer() {
  * Uses chunked restoration to match chunked storage.
  */
 void GfxRenderer::restoreBwBuffer() {
+  waitForDisplay();
   // Check if any all chunks are allocated
   bool missingChunks = false;
   for (const auto& bwBufferChunk : bwBufferChunks) {
@@ -979,6 +1112,7 @@ void GfxRenderer::restoreBwBuffer() {
  * Use this when BW buffer was re-rendered instead of stored/restored.
  */
 void GfxRenderer::cleanupGrayscaleWithFrameBuffer() const {
+  waitForDisplay();
   if (frameBuffer) {
     display.cleanupGrayscaleBuffers(frameBuffer);
   }
@@ -3,9 +3,11 @@
 #include <EpdFontFamily.h>
 #include <HalDisplay.h>
 
+#include <functional>
 #include <map>
 
 #include "Bitmap.h"
+#include "GhostingTracker.h"
 
 // Color representation: uint8_t mapped to 4x4 Bayer matrix dithering levels
 // 0 = transparent, 1-16 = gray levels (white to black)
@@ -35,10 +37,20 @@ class GfxRenderer {
   bool fadingFix;
   mutable uint8_t* frameBuffer = nullptr;
   uint8_t* bwBufferChunks[BW_BUFFER_NUM_CHUNKS] = {nullptr};
+  // Follows what is on the panel once a reader asks for a refresh mode, until it is released
+  mutable GhostingTracker ghosting{HalDisplay::BUFFER_SIZE, BW_BUFFER_CHUNK_SIZE};
+  bool trackGhosting = false;
+  // Set while an asynchronous refresh may still be sending the frame buffer; cleared by waitForDisplay()
+  mutable bool frameBufferSent = false;
+  // The display's frame buffer while drawing goes to another one (see beginOffscreen), and its frameBufferSent
+  mutable uint8_t* screenFrameBuffer = nullptr;
+  mutable bool screenFrameBufferSent = false;
+  mutable bool offscreenMissed = false;
   std::map<int, EpdFontFamily> fontMap;
   void renderChar(const EpdFontFamily& fontFamily, uint32_t cp, int* x, const int* y, bool pixelState,
                   EpdFontFamily::Style style) const;
   void freeBwBufferChunks();
+  void frameShown(HalDisplay::RefreshMode refreshMode) const;
   template <Color color>
   void drawPixelDither(int x, int y) const;
   template <Color color>
@@ -69,6 +81,30 @@ class GfxRenderer {
   int getScreenWidth() const;
   int getScreenHeight() const;
   void displayBuffer(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH) const;
+  // Starts the refresh and returns while the panel updates; onDone runs on the display's refresh task when it is done.
+  // Drawing and other frame buffer calls wait for the refresh, so only work away from the frame buffer overlaps it.
+  void displayBufferAsync(HalDisplay::RefreshMode refreshMode = HalDisplay::FAST_REFRESH,
+                          std::function<void()> onDone = nullptr) const;
+  bool isDisplayBusy() const { return display.isRefreshing(); }
+  // Blocks until an asynchronous refresh is done, from any task; unlike waitForDisplay() it leaves the frame buffer be
+  void waitForRefresh() const { display.waitForRefresh(); }
+  // Waits for an asynchronous refresh, after which the frame buffer may be written again
+  void waitForDisplay() const;
+  // Draws into buffer (getBufferSize() bytes) instead of the frame buffer until endOffscreen(), e.g. to draw a page
+  // ahead while the panel updates, which needs no waiting for the refresh. drawImage() and drawIcon() go through the
+  // display and are skipped offscreen; endOffscreen() returns false if one was.
+  void beginOffscreen(uint8_t* buffer) const;
+  bool endOffscreen() const;
+  // Puts a frame drawn offscreen into the frame buffer
+  void copyToFrameBuffer(const uint8_t* buffer) const;
+  // Refresh for the page in the frame buffer: a half refresh once the residue fast refreshes left since the last clean
+  // one reaches GhostingTracker's threshold, scaled for pagesPerCleanRefresh, a fast one otherwise. Starts following
+  // what is shown, and asks for a half refresh first as what is on the panel is not known until then.
+  HalDisplay::RefreshMode pickRefreshMode(int pagesPerCleanRefresh);
+  // Frees the copy of the last frame, e.g. before laying out a chapter; taken again with the next frame if heap allows
+  void freeGhostingFrame() { ghosting.release(); }
+  // Stops following what is shown, when leaving the reader
+  void stopGhostingTracking();
   // EXPERIMENTAL: Windowed update - display only a logical rectangular region
   void displayWindow(int x, int y, int width, int height) const;
   void invertScreen() const;
@@ -95,6 +131,8 @@ class GfxRenderer {
   void drawBitmap(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight, float cropX = 0,
                   float cropY = 0) const;
   void drawBitmap1Bit(const Bitmap& bitmap, int x, int y, int maxWidth, int maxHeight) const;
+  // Draw raw 1-bit rows (MSB first, set bit = white) in logical coordinates, e.g. pre-packed thumbnails
+  void drawPackedBitmap(const uint8_t* data, int x, int y, int width, int height) const;
   void fillPolygon(const int* xPoints, const int* yPoints, int numPoints, bool state = true) const;
 
   // Text
@@ -0,0 +1,124 @@
+#include "GhostingTracker.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+// Residue of one 32-bit word of whitened pixels: each byte's count, times 4 where it has at least half its pixels.
+// Bit counting by halves; the ESP32-C3 has no popcount instruction, and __builtin_popcount becomes a library call.
+inline uint32_t residue32(uint32_t x) {
+  x = x - ((x >> 1) & 0x55555555u);
+  x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+  x = (x + (x >> 4)) & 0x0F0F0F0Fu;
+  // Counts are at most 8, so adding 4 sets bit 3 of a byte exactly when its count is 4 or more
+  const uint32_t solid = x & ((((x + 0x04040404u) >> 3) & 0x01010101u) * 0xFFu);
+  return ((x + 3 * solid) * 0x01010101u) >> 24;
+}
+}  // namespace
+
+GhostingTracker::GhostingTracker(const size_t frameBytes, const size_t chunkBytes)
+    : frameBytes(frameBytes),
+      chunkBytes(chunkBytes),
+      chunkCount(std::min<size_t>(frameBytes / chunkBytes, MAX_CHUNKS)),
+      regionBytes(frameBytes / REGION_COUNT) {}
+
+uint32_t GhostingTracker::countResidue(const uint8_t* previous, const uint8_t* next, const size_t bytes) {
+  // Set bits are white: a pixel is whitened where it is clear in the previous frame and set in the next
+  const auto* a = reinterpret_cast<const uint32_t*>(previous);
+  const auto* b = reinterpret_cast<const uint32_t*>(next);
+  const size_t words = bytes / 4;
+  uint32_t residue = 0;
+  size_t i = 0;
+  for (; i + 4 <= words; i += 4) {
+    residue += residue32(~a[i] & b[i]) + residue32(~a[i + 1] & b[i + 1]) + residue32(~a[i + 2] & b[i + 2]) +
+               residue32(~a[i + 3] & b[i + 3]);
+  }
+  for (; i < words; i++) {
+    residue += residue32(~a[i] & b[i]);
+  }
+  return residue;
+}
+
+bool GhostingTracker::allocate() {
+  for (size_t i = 0; i < chunkCount; i++) {
+    if (!chunks[i]) {
+      chunks[i] = static_cast<uint8_t*>(malloc(chunkBytes));
+      if (!chunks[i]) {
+        release();
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+void GhostingTracker::release() {
+  for (auto& chunk : chunks) {
+    free(chunk);
+    chunk = nullptr;
+  }
+  hasPrevious = false;
+}
+
+void GhostingTracker::countRegionResidue(const uint8_t* frame, uint32_t* residue) const {
+  if (!hasPrevious) {
+    std::fill(residue, residue + REGION_COUNT, residueThreshold() / DEFAULT_PAGES_PER_CLEAN_REFRESH);
+    return;
+  }
+  // Bands and chunks need not line up, so each band is counted in spans that stay within one chunk
+  for (int region = 0; region < REGION_COUNT; region++) {
+    residue[region] = 0;
+    size_t offset = region * regionBytes;
+    const size_t end = offset + regionBytes;
+    while (offset < end) {
+      const size_t chunk = offset / chunkBytes;
+      const size_t inChunk = offset % chunkBytes;
+      const size_t span = std::min(end - offset, chunkBytes - inChunk);
+      residue[region] += countResidue(chunks[chunk] + inChunk, frame + offset, span);
+      offset += span;
+    }
+  }
+}
+
+bool GhostingTracker::needsCleanRefresh(const uint8_t* frame, const int pagesPerCleanRefresh) const {
+  if (pagesPerCleanRefresh <= 1) {
+    return true;
+  }
+  uint32_t residue[REGION_COUNT];
+  countRegionResidue(frame, residue);
+  const uint32_t budget = residueThreshold() / DEFAULT_PAGES_PER_CLEAN_REFRESH * pagesPerCleanRefresh;
+  const uint32_t heavy = static_cast<uint32_t>(regionBytes * 8 * 4 * HEAVY_RESIDUE_PERCENT / 100);
+  for (int region = 0; region < REGION_COUNT; region++) {
+    // At the budget rather than past it, so untracked frames go back to every pagesPerCleanRefresh pages
+    if (residue[region] >= heavy || accumulated[region] + residue[region] >= budget) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void GhostingTracker::frameShown(const uint8_t* frame, const bool cleanRefresh, const bool canAllocate) {
+  if (cleanRefresh) {
+    std::fill(accumulated, accumulated + REGION_COUNT, 0);
+  } else {
+    uint32_t residue[REGION_COUNT];
+    countRegionResidue(frame, residue);
+    for (int region = 0; region < REGION_COUNT; region++) {
+      accumulated[region] += residue[region];
+    }
+  }
+
+  if (!hasPrevious && (!canAllocate || !allocate())) {
+    return;
+  }
+  for (size_t i = 0; i < chunkCount; i++) {
+    memcpy(chunks[i], frame + i * chunkBytes, chunkBytes);
+  }
+  hasPrevious = true;
+}
+
+uint32_t GhostingTracker::getWorstRegionPercent() const {
+  const uint32_t worst = *std::max_element(accumulated, accumulated + REGION_COUNT);
+  return static_cast<uint32_t>(static_cast<uint64_t>(worst) * 100 / (regionBytes * 8 * 4));
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Estimates the ghosting fast refreshes leave on the panel from the pixels they flip, so a clean (half) refresh is
+ * paid for when enough has built up rather than every so many pages.
+ *
+ * Every frame sent to the panel is compared with the one before it, a 32-bit word at a time, per band of display
+ * rows. What a fast refresh leaves behind is the faint image of ink it took away: pixels it turns black reach full
+ * black, pixels it turns white stay a little gray. So a band adds up the pixels whitened since its clean refresh as
+ * its residue, at full weight where they lie in solid runs (at least half of a byte's 8 pixels, as when a picture or
+ * an inverted area goes) and at a quarter where they are scattered glyph strokes, which the eye does not pick out as
+ * a shape. A band is due for a clean refresh once its residue reaches RESIDUE_THRESHOLD_PERCENT of its pixels; the
+ * refresh frequency setting scales that threshold, with its default of DEFAULT_PAGES_PER_CLEAN_REFRESH pages at 1x.
+ * A frame that leaves HEAVY_RESIDUE_PERCENT in a band by itself gets its clean refresh right away, so a picture is
+ * shown with a fast refresh and cleaned off with a half one.
+ *
+ * The last frame is kept in chunks, like the renderer's stored BW buffer. Without it (the heap was short, or release()
+ * gave it back) each frame adds 1/DEFAULT_PAGES_PER_CLEAN_REFRESH of the default threshold, which is the old fixed
+ * page counter.
+ */
+class GhostingTracker {
+ public:
+  static constexpr int REGION_COUNT = 8;
+  static constexpr int MAX_CHUNKS = 8;
+  // Residue a band can carry before it shows, in percent of its pixels, at the default refresh frequency
+  static constexpr uint32_t RESIDUE_THRESHOLD_PERCENT = 100;
+  static constexpr int DEFAULT_PAGES_PER_CLEAN_REFRESH = 15;
+  // A frame that leaves this much residue in a band (an image or inverted area going) gets a clean refresh itself
+  static constexpr uint32_t HEAVY_RESIDUE_PERCENT = 25;
+
+  GhostingTracker(size_t frameBytes, size_t chunkBytes);
+  ~GhostingTracker() { release(); }
+  GhostingTracker(const GhostingTracker&) = delete;
+  GhostingTracker& operator=(const GhostingTracker&) = delete;
+
+  // Residue a fast refresh from previous to next leaves, in quarter pixels: whitened pixels in solid runs count 4,
+  // scattered ones 1. Goes a 32-bit word at a time; bytes must be a multiple of 4 and both buffers 4-byte aligned.
+  static uint32_t countResidue(const uint8_t* previous, const uint8_t* next, size_t bytes);
+
+  // True if showing the frame with another fast refresh would take some band to its residue threshold, scaled for
+  // pagesPerCleanRefresh
+  bool needsCleanRefresh(const uint8_t* frame, int pagesPerCleanRefresh) const;
+  // Records a frame sent to the panel. Keeps a copy for the next comparison, allocating it if allowed.
+  void frameShown(const uint8_t* frame, bool cleanRefresh, bool canAllocate);
+  // Gives the copy of the last frame back; ghosting recorded so far is kept
+  void release();
+  bool isTracking() const { return hasPrevious; }
+  // Residue recorded since the last clean refresh in the worst band, in percent of its pixels
+  uint32_t getWorstRegionPercent() const;
+
+ private:
+  size_t frameBytes;
+  size_t chunkBytes;
+  size_t chunkCount;
+  size_t regionBytes;
+  uint8_t* chunks[MAX_CHUNKS] = {nullptr};
+  bool hasPrevious = false;
+  // Residue per band since the last clean refresh, in quarter pixels
+  uint32_t accumulated[REGION_COUNT] = {};
+
+  bool allocate();
+  // Residue per band against the kept frame, or one default page's share of the threshold each without it
+  void countRegionResidue(const uint8_t* frame, uint32_t* residue) const;
+  // A band's residue threshold at the default frequency, in quarter pixels
+  uint32_t residueThreshold() const {
+    return static_cast<uint32_t>(regionBytes * 8 * 4 * RESIDUE_THRESHOLD_PERCENT / 100);
+  }
+};
@@ -0,0 +1,136 @@
+#include "JobScheduler.h"
+
+#include <Logging.h>
+
+#include <algorithm>
+
+JobScheduler JobScheduler::instance{JobScheduler::Hooks{}};
+
+bool JobScheduler::Context::shouldYield() const { return isInterrupted() || scheduler.sliceUsedUp(); }
+
+bool JobScheduler::Context::isInterrupted() const {
+  return cancelled || (scheduler.hooks.shouldPause && scheduler.hooks.shouldPause());
+}
+
+JobScheduler::JobId JobScheduler::submit(JobSpec spec) {
+  if (!spec.step) {
+    return NO_JOB;
+  }
+  const JobId id = nextId++;
+  LOG_DBG("JOB", "Submitted %s (#%u)", spec.name.c_str(), static_cast<unsigned>(id));
+  std::unique_ptr<Job> job(new Job{id, std::move(spec)});
+  jobs.push_back(std::move(job));
+  return id;
+}
+
+bool JobScheduler::cancel(const JobId id) {
+  for (const auto& job : jobs) {
+    if (job->id == id && !job->cancelled) {
+      job->cancelled = true;
+      // Outside a slice nothing can be running it, so it goes right away
+      if (!inSlice) {
+        finish(job.get(), false);
+      }
+      return true;
+    }
+  }
+  return false;
+}
+
+bool JobScheduler::isPending(const JobId id) const {
+  return std::any_of(jobs.begin(), jobs.end(), [id](const auto& job) { return job->id == id && !job->cancelled; });
+}
+
+bool JobScheduler::canRun(const Job& job) const { return !job.spec.isRunnable || job.spec.isRunnable(); }
+
+bool JobScheduler::hasRunnableJob() const {
+  return std::any_of(jobs.begin(), jobs.end(), [this](const auto& job) { return job->cancelled || canRun(*job); });
+}
+
+bool JobScheduler::sliceUsedUp() const { return inSlice && hooks.millis() - sliceStart >= sliceBudgetMs; }
+
+JobScheduler::Job* JobScheduler::pickJob() {
+  Job* best = nullptr;
+  for (const auto& job : jobs) {
+    if (job->cancelled) {
+      // Cancelled jobs are cleared out first
+      return job.get();
+    }
+    if ((best && job->spec.priority <= best->spec.priority) || !canRun(*job)) {
+      continue;
+    }
+    if (hooks.freeHeap && job->spec.heapBudget > 0 && hooks.freeHeap() < job->spec.heapBudget) {
+      stats.heapDeferrals++;
+      continue;
+    }
+    best = job.get();
+  }
+  return best;
+}
+
+void JobScheduler::finish(const Job* job, const bool completed) {
+  const auto it = std::find_if(jobs.begin(), jobs.end(), [job](const auto& entry) { return entry.get() == job; });
+  if (it == jobs.end()) {
+    return;
+  }
+  // Out of the list before onDone runs, which may well submit the next job
+  std::unique_ptr<Job> done = std::move(*it);
+  jobs.erase(it);
+  LOG_DBG("JOB", "%s %s (#%u)", completed ? "Finished" : "Cancelled", done->spec.name.c_str(),
+          static_cast<unsigned>(done->id));
+  if (done->spec.onDone) {
+    done->spec.onDone(completed);
+  }
+}
+
+size_t JobScheduler::runSlice() {
+  if (!hooks.millis || jobs.empty()) {
+    return 0;
+  }
+
+  stats.slices++;
+  inSlice = true;
+  sliceStart = hooks.millis();
+  size_t steps = 0;
+
+  while (true) {
+    if (hooks.shouldPause && hooks.shouldPause()) {
+      stats.pauses++;
+      break;
+    }
+    Job* job = pickJob();
+    if (!job) {
+      break;
+    }
+    if (job->cancelled) {
+      finish(job, false);
+      continue;
+    }
+    // Checked after picking so a slice always does at least one step of work
+    if (steps > 0 && sliceUsedUp()) {
+      break;
+    }
+
+    Context context(*this, job->cancelled, job->spec.heapBudget);
+    const uint32_t stepStart = hooks.millis();
+    const bool more = job->spec.step(context);
+    stats.longestStepMs = std::max(stats.longestStepMs, hooks.millis() - stepStart);
+    stats.steps++;
+    steps++;
+
+    if (!more) {
+      finish(job, !job->cancelled);
+    }
+  }
+
+  inSlice = false;
+  // Jobs cancelled by the last step go now rather than waiting for the next slice
+  for (size_t i = 0; i < jobs.size();) {
+    if (jobs[i]->cancelled) {
+      finish(jobs[i].get(), false);
+    } else {
+      i++;
+    }
+  }
+  return steps;
+}
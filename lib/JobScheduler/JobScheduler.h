@@ -0,0 +1,120 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Cooperative scheduler for background work (indexing, thumbnails, cache upkeep) that runs on the main loop between
+ * input polls instead of in tasks of its own.
+ *
+ * A job is a step function that does a small piece of work and returns whether there is more; the state it needs to
+ * carry on lives in the job, and on the SD card if it has to survive a restart. runSlice() runs steps of the most
+ * urgent job that can run until the slice's time budget is used up or the pause check reports that input is waiting,
+ * so a button press waits for at most the slice budget plus one step. A step that cannot be cut to a few tens of
+ * milliseconds (laying out a chapter) polls isInterrupted() as it goes and throws its partial work away when it
+ * fires, which bounds the wait by the gap between its polls instead.
+ *
+ * Everything here runs on the thread that calls runSlice(); the clock, the pause check and the free heap come in
+ * through Hooks so the scheduler can be driven by a simulated clock on the host.
+ */
+class JobScheduler {
+ public:
+  enum class Priority : uint8_t { BACKGROUND = 0, NORMAL = 1, URGENT = 2 };
+  using JobId = uint32_t;
+  static constexpr JobId NO_JOB = 0;
+  static constexpr uint32_t DEFAULT_SLICE_MS = 20;
+
+  struct Hooks {
+    std::function<uint32_t()> millis;
+    // Input waiting or the display needing the bus; checked before every step and from inside long ones, so it
+    // has to see presses made since the loop last polled the buttons
+    std::function<bool()> shouldPause;
+    // Free heap in bytes, nullptr to ignore heap budgets
+    std::function<size_t()> freeHeap;
+  };
+
+  // Handed to a step, so a step that loops over several items can stop early
+  class Context {
+    friend class JobScheduler;
+    const JobScheduler& scheduler;
+    const bool& cancelled;  // The job's flag, so a cancel from inside the step is seen straight away
+    size_t heapBudget;
+
+    Context(const JobScheduler& scheduler, const bool& cancelled, const size_t heapBudget)
+        : scheduler(scheduler), cancelled(cancelled), heapBudget(heapBudget) {}
+
+   public:
+    bool isCancelled() const { return cancelled; }
+    // Cancelled, input waiting or the slice used up: the step should save its place and return
+    bool shouldYield() const;
+    // Cancelled or input waiting, the slice running out aside: a step that would lose its work by stopping checks this
+    bool isInterrupted() const;
+    size_t getHeapBudget() const { return heapBudget; }
+  };
+
+  struct JobSpec {
+    std::string name;
+    Priority priority = Priority::NORMAL;
+    // Free heap a step needs; the job waits while there is less
+    size_t heapBudget = 0;
+    // Optional gate, e.g. only while on USB power; a job that is not runnable keeps its place
+    std::function<bool()> isRunnable;
+    // Does a piece of work, true while more remains
+    std::function<bool(Context&)> step;
+    // Called once the job is done (true) or cancelled (false)
+    std::function<void(bool completed)> onDone;
+  };
+
+  struct Stats {
+    uint32_t slices = 0;
+    uint32_t steps = 0;
+    uint32_t pauses = 0;         // Slices cut short by the pause check
+    uint32_t heapDeferrals = 0;  // Times a job was passed over for lack of heap
+    uint32_t longestStepMs = 0;
+  };
+
+  explicit JobScheduler(Hooks hooks, const uint32_t sliceBudgetMs = DEFAULT_SLICE_MS)
+      : hooks(std::move(hooks)), sliceBudgetMs(sliceBudgetMs) {}
+
+  static JobScheduler& getInstance() { return instance; }
+  void setHooks(Hooks newHooks) { hooks = std::move(newHooks); }
+
+  JobId submit(JobSpec spec);
+  // The job stops before its next step and its onDone gets false; false if there is no such job
+  bool cancel(JobId id);
+  bool isPending(JobId id) const;
+  bool hasRunnableJob() const;
+  // Runs steps until the slice budget is spent, the pause check fires or nothing can run; returns the steps run
+  size_t runSlice();
+  const Stats& getStats() const { return stats; }
+
+ private:
+  struct Job {
+    JobId id;
+    JobSpec spec;
+    bool cancelled = false;
+  };
+
+  static JobScheduler instance;
+
+  Hooks hooks;
+  uint32_t sliceBudgetMs;
+  // In submission order, the first runnable job of the highest priority goes next. Held by pointer so a step can
+  // submit more jobs while it runs.
+  std::vector<std::unique_ptr<Job>> jobs;
+  JobId nextId = 1;
+  uint32_t sliceStart = 0;
+  bool inSlice = false;
+  Stats stats;
+
+  bool sliceUsedUp() const;
+  bool canRun(const Job& job) const;
+  Job* pickJob();
+  void finish(const Job* job, bool completed);
+};
+
+// Helper macro to access the firmware's scheduler
+#define JOB_SCHEDULER JobScheduler::getInstance()
@@ -198,17 +198,243 @@ unsigned char JpegToBmpConverter::jpegReadCallback(unsigned char* pBuf, const un
   return 0;  // Success
 }
 
-// Internal implementation with configurable target size and bit depth
-bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bmpOut, int targetWidth, int targetHeight,
-                                                     bool oneBit, bool crop) {
-  LOG_DBG("JPG", "Converting JPEG to %s BMP (target: %dx%d)", oneBit ? "1-bit" : "2-bit", targetWidth, targetHeight);
+namespace {
+// Scaler, ditherer and row buffers for one output BMP. Every variant of a conversion gets its own, so a single
+// decode can feed outputs of different sizes and bit depths.
+struct VariantWriter {
+  Print* out = nullptr;
+  bool oneBit = false;
+  int outWidth = 0;
+  int outHeight = 0;
+  bool needsScaling = false;
+  // Fixed-point (16.16) scale factors for sub-pixel accuracy: decoded pixels per output pixel
+  uint32_t scaleX_fp = 0;
+  uint32_t scaleY_fp = 0;
+  int bytesPerRow = 0;
+  uint8_t* rowBuffer = nullptr;
+  uint8_t* grayRow = nullptr;  // Averaged output row (scaled variants only)
+  // For scaling: accumulate source rows into scaled output rows
+  // Using fixed-point: srcY_fp = outY * scaleY_fp (gives source Y in 16.16 format)
+  uint32_t* rowAccum = nullptr;    // Accumulator for each output X (32-bit for larger sums)
+  uint16_t* rowCount = nullptr;    // Count of source pixels accumulated per output X
+  int currentOutY = 0;             // Current output row being accumulated
+  uint32_t nextOutY_srcStart = 0;  // Source Y where next output row starts (16.16 fixed point)
+  AtkinsonDitherer* atkinsonDitherer = nullptr;
+  FloydSteinbergDitherer* fsDitherer = nullptr;
+  Atkinson1BitDitherer* atkinson1BitDitherer = nullptr;
+
+  ~VariantWriter() {
+    delete[] rowAccum;
+    delete[] rowCount;
+    delete atkinsonDitherer;
+    delete fsDitherer;
+    delete atkinson1BitDitherer;
+    free(grayRow);
+    free(rowBuffer);
+  }
+
+  // Calculate output dimensions (pre-scale to fit display exactly)
+  void computeSize(const int width, const int height, const JpegToBmpConverter::BmpVariant& variant) {
+    out = variant.out;
+    oneBit = variant.oneBit;
+    outWidth = width;
+    outHeight = height;
+    needsScaling = false;
+
+    const int targetWidth = variant.targetWidth;
+    const int targetHeight = variant.targetHeight;
+    if (targetWidth > 0 && targetHeight > 0 && (width > targetWidth || height > targetHeight)) {
+      // Calculate scale to fit within target dimensions while maintaining aspect ratio
+      const float scaleToFitWidth = static_cast<float>(targetWidth) / width;
+      const float scaleToFitHeight = static_cast<float>(targetHeight) / height;
+      // We scale to the smaller dimension, so we can potentially crop later.
+      float scale = 1.0;
+      if (variant.crop) {  // if we will crop, scale to the smaller dimension
+        scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+      } else {  // else, scale to the larger dimension to fit
+        scale = (scaleToFitWidth < scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+      }
+
+      outWidth = static_cast<int>(width * scale);
+      outHeight = static_cast<int>(height * scale);
+
+      // Ensure at least 1 pixel
+      if (outWidth < 1) outWidth = 1;
+      if (outHeight < 1) outHeight = 1;
+
+      needsScaling = true;
+
+      LOG_DBG("JPG", "Pre-scaling %dx%d -> %dx%d (fit to %dx%d)", width, height, outWidth, outHeight, targetWidth,
+              targetHeight);
+    }
+  }
+
+  // Allocate buffers and write the BMP header once the decoded size is known
+  bool begin(const int srcWidth, const int srcHeight) {
+    scaleX_fp = (static_cast<uint32_t>(srcWidth) << 16) / outWidth;
+    scaleY_fp = (static_cast<uint32_t>(srcHeight) << 16) / outHeight;
+
+    // Write BMP header with output dimensions
+    if (USE_8BIT_OUTPUT && !oneBit) {
+      writeBmpHeader8bit(*out, outWidth, outHeight);
+      bytesPerRow = (outWidth + 3) / 4 * 4;
+    } else if (oneBit) {
+      writeBmpHeader1bit(*out, outWidth, outHeight);
+      bytesPerRow = (outWidth + 31) / 32 * 4;  // 1 bit per pixel
+    } else {
+      writeBmpHeader2bit(*out, outWidth, outHeight);
+      bytesPerRow = (outWidth * 2 + 31) / 32 * 4;
+    }
+
+    rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
+    if (!rowBuffer) {
+      LOG_ERR("JPG", "Failed to allocate row buffer");
+      return false;
+    }
+
+    // Create ditherer if enabled
+    // Use OUTPUT dimensions for dithering (after prescaling)
+    if (oneBit) {
+      // For 1-bit output, use Atkinson dithering for better quality
+      atkinson1BitDitherer = new Atkinson1BitDitherer(outWidth);
+    } else if (!USE_8BIT_OUTPUT) {
+      if (USE_ATKINSON) {
+        atkinsonDitherer = new AtkinsonDitherer(outWidth);
+      } else if (USE_FLOYD_STEINBERG) {
+        fsDitherer = new FloydSteinbergDitherer(outWidth);
+      }
+    }
+
+    if (needsScaling) {
+      grayRow = static_cast<uint8_t*>(malloc(outWidth));
+      if (!grayRow) {
+        LOG_ERR("JPG", "Failed to allocate scaled row buffer");
+        return false;
+      }
+      rowAccum = new uint32_t[outWidth]();
+      rowCount = new uint16_t[outWidth]();
+      nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
+    }
+    return true;
+  }
+
+  // Quantize, dither, pack and write one row of output pixels
+  void writeRow(const uint8_t* gray, const int y) {
+    memset(rowBuffer, 0, bytesPerRow);
+
+    if (USE_8BIT_OUTPUT && !oneBit) {
+      for (int x = 0; x < outWidth; x++) {
+        rowBuffer[x] = adjustPixel(gray[x]);
+      }
+    } else if (oneBit) {
+      // 1-bit output with Atkinson dithering for better quality
+      for (int x = 0; x < outWidth; x++) {
+        const uint8_t bit =
+            atkinson1BitDitherer ? atkinson1BitDitherer->processPixel(gray[x], x) : quantize1bit(gray[x], x, y);
+        // Pack 1-bit value: MSB first, 8 pixels per byte
+        const int byteIndex = x / 8;
+        const int bitOffset = 7 - (x % 8);
+        rowBuffer[byteIndex] |= (bit << bitOffset);
+      }
+      if (atkinson1BitDitherer) atkinson1BitDitherer->nextRow();
+    } else {
+      // 2-bit output
+      for (int x = 0; x < outWidth; x++) {
+        const uint8_t adjusted = adjustPixel(gray[x]);
+        uint8_t twoBit;
+        if (atkinsonDitherer) {
+          twoBit = atkinsonDitherer->processPixel(adjusted, x);
+        } else if (fsDitherer) {
+          twoBit = fsDitherer->processPixel(adjusted, x);
+        } else {
+          twoBit = quantize(adjusted, x, y);
+        }
+        const int byteIndex = (x * 2) / 8;
+        const int bitOffset = 6 - ((x * 2) % 8);
+        rowBuffer[byteIndex] |= (twoBit << bitOffset);
+      }
+      if (atkinsonDitherer)
+        atkinsonDitherer->nextRow();
+      else if (fsDitherer)
+        fsDitherer->nextRow();
+    }
+    out->write(rowBuffer, bytesPerRow);
+  }
+
+  // Feed one decoded source row, emitting an output row whenever a scaled row is complete
+  void addSourceRow(const uint8_t* srcRow, const int srcWidth, const int y) {
+    if (!needsScaling) {
+      // No scaling - direct output (1:1 mapping)
+      writeRow(srcRow, y);
+      return;
+    }
+
+    // Fixed-point area averaging for exact fit scaling
+    // For each output pixel X, accumulate source pixels that map to it
+    // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
+    for (int outX = 0; outX < outWidth; outX++) {
+      // Calculate source X range for this output pixel
+      const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp) >> 16;
+      const int srcXEnd = (static_cast<uint32_t>(outX + 1) * scaleX_fp) >> 16;
+
+      // Accumulate all source pixels in this range
+      int sum = 0;
+      int count = 0;
+      for (int srcX = srcXStart; srcX < srcXEnd && srcX < srcWidth; srcX++) {
+        sum += srcRow[srcX];
+        count++;
+      }
+
+      // Handle edge case: if no pixels in range, use nearest
+      if (count == 0 && srcXStart < srcWidth) {
+        sum = srcRow[srcXStart];
+        count = 1;
+      }
+
+      rowAccum[outX] += sum;
+      rowCount[outX] += count;
+    }
+
+    // Check if we've crossed into the next output row
+    // Current source Y in fixed point: y << 16
+    const uint32_t srcY_fp = static_cast<uint32_t>(y + 1) << 16;
+
+    // Output row when source Y crosses the boundary
+    if (srcY_fp >= nextOutY_srcStart && currentOutY < outHeight) {
+      for (int x = 0; x < outWidth; x++) {
+        grayRow[x] = (rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0;
+      }
+      writeRow(grayRow, currentOutY);
+      currentOutY++;
+
+      // Reset accumulators for next output row
+      memset(rowAccum, 0, outWidth * sizeof(uint32_t));
+      memset(rowCount, 0, outWidth * sizeof(uint16_t));
+
+      // Update boundary for next output row
+      nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
+    }
+  }
+};
+}  // namespace
+
+bool JpegToBmpConverter::jpegFileToBmpStreams(FsFile& jpegFile, const BmpVariant* variants, const int count,
+                                              const std::function<bool()>& shouldStop) {
+  if (count <= 0) {
+    return false;
+  }
+  for (int i = 0; i < count; i++) {
+    LOG_DBG("JPG", "Converting JPEG to %s BMP (target: %dx%d)", variants[i].oneBit ? "1-bit" : "2-bit",
+            variants[i].targetWidth, variants[i].targetHeight);
+  }
 
   // Setup context for picojpeg callback
+  const uint32_t jpegStart = jpegFile.position();
   JpegReadContext context = {.file = jpegFile, .bufferPos = 0, .bufferFilled = 0};
 
   // Initialize picojpeg decoder
   pjpeg_image_info_t imageInfo;
-  const unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, 0);
+  unsigned char status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, PJPG_REDUCE_NONE);
   if (status != 0) {
     LOG_ERR("JPG", "JPEG decode init failed with error code: %d", status);
     return false;
@@ -228,117 +454,94 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
     return false;
   }
 
-  // Calculate output dimensions (pre-scale to fit display exactly)
-  int outWidth = imageInfo.m_width;
-  int outHeight = imageInfo.m_height;
-  // Use fixed-point scaling (16.16) for sub-pixel accuracy
-  uint32_t scaleX_fp = 65536;  // 1.0 in 16.16 fixed point
-  uint32_t scaleY_fp = 65536;
-  bool needsScaling = false;
+  auto* writers = new VariantWriter[count];
+  for (int i = 0; i < count; i++) {
+    writers[i].computeSize(imageInfo.m_width, imageInfo.m_height, variants[i]);
+  }
 
-  if (targetWidth > 0 && targetHeight > 0 && (imageInfo.m_width > targetWidth || imageInfo.m_height > targetHeight)) {
-    // Calculate scale to fit within target dimensions while maintaining aspect ratio
-    const float scaleToFitWidth = static_cast<float>(targetWidth) / imageInfo.m_width;
-    const float scaleToFitHeight = static_cast<float>(targetHeight) / imageInfo.m_height;
-    // We scale to the smaller dimension, so we can potentially crop later.
-    float scale = 1.0;
-    if (crop) {  // if we will crop, scale to the smaller dimension
-      scale = (scaleToFitWidth > scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
-    } else {  // else, scale to the larger dimension to fit
-      scale = (scaleToFitWidth < scaleToFitHeight) ? scaleToFitWidth : scaleToFitHeight;
+  // Decode at the smallest DCT scale (1/8, 1/4 or 1/2) that still covers every output size, so most of the IDCT
+  // work for heavily downscaled covers is never done. The area averaging takes care of the remaining factor.
+  int decodeShift = 3;
+  for (int i = 0; i < count && decodeShift > 0; i++) {
+    if (!writers[i].needsScaling) {
+      decodeShift = 0;
+      break;
     }
+    while (decodeShift > 0) {
+      const int factor = 1 << decodeShift;
+      if ((imageInfo.m_width + factor - 1) / factor >= writers[i].outWidth &&
+          (imageInfo.m_height + factor - 1) / factor >= writers[i].outHeight) {
+        break;
+      }
+      decodeShift--;
+    }
+  }
 
-    outWidth = static_cast<int>(imageInfo.m_width * scale);
-    outHeight = static_cast<int>(imageInfo.m_height * scale);
-
-    // Ensure at least 1 pixel
-    if (outWidth < 1) outWidth = 1;
-    if (outHeight < 1) outHeight = 1;
-
-    // Calculate fixed-point scale factors (source pixels per output pixel)
-    // scaleX_fp = (srcWidth << 16) / outWidth
-    scaleX_fp = (static_cast<uint32_t>(imageInfo.m_width) << 16) / outWidth;
-    scaleY_fp = (static_cast<uint32_t>(imageInfo.m_height) << 16) / outHeight;
-    needsScaling = true;
-
-    LOG_DBG("JPG", "Pre-scaling %dx%d -> %dx%d (fit to %dx%d)", imageInfo.m_width, imageInfo.m_height, outWidth,
-            outHeight, targetWidth, targetHeight);
+  if (decodeShift > 0) {
+    constexpr unsigned char REDUCE_MODES[] = {PJPG_REDUCE_NONE, PJPG_REDUCE_1_2, PJPG_REDUCE_1_4, PJPG_REDUCE_1_8};
+    // The mode is fixed at init time, so restart the decoder on the same stream
+    if (!jpegFile.seek(jpegStart)) {
+      LOG_ERR("JPG", "Failed to rewind JPEG for scaled decode");
+      delete[] writers;
+      return false;
+    }
+    context.bufferPos = 0;
+    context.bufferFilled = 0;
+    status = pjpeg_decode_init(&imageInfo, jpegReadCallback, &context, REDUCE_MODES[decodeShift]);
+    if (status != 0) {
+      LOG_ERR("JPG", "JPEG scaled decode init failed with error code: %d", status);
+      delete[] writers;
+      return false;
+    }
   }
 
-  // Write BMP header with output dimensions
-  int bytesPerRow;
-  if (USE_8BIT_OUTPUT && !oneBit) {
-    writeBmpHeader8bit(bmpOut, outWidth, outHeight);
-    bytesPerRow = (outWidth + 3) / 4 * 4;
-  } else if (oneBit) {
-    writeBmpHeader1bit(bmpOut, outWidth, outHeight);
-    bytesPerRow = (outWidth + 31) / 32 * 4;  // 1 bit per pixel
-  } else {
-    writeBmpHeader2bit(bmpOut, outWidth, outHeight);
-    bytesPerRow = (outWidth * 2 + 31) / 32 * 4;
+  // Dimensions of the image as it comes out of the decoder
+  const int factor = 1 << decodeShift;
+  const int srcWidth = (imageInfo.m_width + factor - 1) / factor;
+  const int srcHeight = (imageInfo.m_height + factor - 1) / factor;
+  if (decodeShift > 0) {
+    LOG_DBG("JPG", "Decoding at 1/%d scale (%dx%d)", factor, srcWidth, srcHeight);
   }
 
-  // Allocate row buffer
-  auto* rowBuffer = static_cast<uint8_t*>(malloc(bytesPerRow));
-  if (!rowBuffer) {
-    LOG_ERR("JPG", "Failed to allocate row buffer");
-    return false;
+  for (int i = 0; i < count; i++) {
+    if (!writers[i].begin(srcWidth, srcHeight)) {
+      delete[] writers;
+      return false;
+    }
   }
 
   // Allocate a buffer for one MCU row worth of grayscale pixels
   // This is the minimal memory needed for streaming conversion
-  const int mcuPixelHeight = imageInfo.m_MCUHeight;
-  const int mcuRowPixels = imageInfo.m_width * mcuPixelHeight;
+  const int mcuPixelHeight = imageInfo.m_MCUHeight >> decodeShift;
+  const int mcuRowPixels = srcWidth * mcuPixelHeight;
 
   // Validate MCU row buffer size before allocation
   if (mcuRowPixels > MAX_MCU_ROW_BYTES) {
     LOG_DBG("JPG", "MCU row buffer too large (%d bytes), max: %d", mcuRowPixels, MAX_MCU_ROW_BYTES);
-    free(rowBuffer);
+    delete[] writers;
     return false;
   }
 
   auto* mcuRowBuffer = static_cast<uint8_t*>(malloc(mcuRowPixels));
   if (!mcuRowBuffer) {
     LOG_ERR("JPG", "Failed to allocate MCU row buffer (%d bytes)", mcuRowPixels);
-    free(rowBuffer);
+    delete[] writers;
     return false;
   }
 
-  // Create ditherer if enabled
-  // Use OUTPUT dimensions for dithering (after prescaling)
-  AtkinsonDitherer* atkinsonDitherer = nullptr;
-  FloydSteinbergDitherer* fsDitherer = nullptr;
-  Atkinson1BitDitherer* atkinson1BitDitherer = nullptr;
-
-  if (oneBit) {
-    // For 1-bit output, use Atkinson dithering for better quality
-    atkinson1BitDitherer = new Atkinson1BitDitherer(outWidth);
-  } else if (!USE_8BIT_OUTPUT) {
-    if (USE_ATKINSON) {
-      atkinsonDitherer = new AtkinsonDitherer(outWidth);
-    } else if (USE_FLOYD_STEINBERG) {
-      fsDitherer = new FloydSteinbergDitherer(outWidth);
-    }
-  }
-
-  // For scaling: accumulate source rows into scaled output rows
-  // We need to track which source Y maps to which output Y
-  // Using fixed-point: srcY_fp = outY * scaleY_fp (gives source Y in 16.16 format)
-  uint32_t* rowAccum = nullptr;    // Accumulator for each output X (32-bit for larger sums)
-  uint16_t* rowCount = nullptr;    // Count of source pixels accumulated per output X
-  int currentOutY = 0;             // Current output row being accumulated
-  uint32_t nextOutY_srcStart = 0;  // Source Y where next output row starts (16.16 fixed point)
-
-  if (needsScaling) {
-    rowAccum = new uint32_t[outWidth]();
-    rowCount = new uint16_t[outWidth]();
-    nextOutY_srcStart = scaleY_fp;  // First boundary is at scaleY_fp (source Y for outY=1)
-  }
-
   // Process MCUs row-by-row and write to BMP as we go (top-down)
-  const int mcuPixelWidth = imageInfo.m_MCUWidth;
+  const int mcuPixelWidth = imageInfo.m_MCUWidth >> decodeShift;
+  // Pixels per 8x8 block after the decoder's reduction
+  const int blockSize = 8 >> decodeShift;
 
   for (int mcuY = 0; mcuY < imageInfo.m_MCUSPerCol; mcuY++) {
+    if (mcuY > 0 && shouldStop && shouldStop()) {
+      LOG_DBG("JPG", "Stopped at MCU row %d of %d", mcuY, imageInfo.m_MCUSPerCol);
+      free(mcuRowBuffer);
+      delete[] writers;
+      return false;
+    }
+
     // Clear the MCU row buffer
     memset(mcuRowBuffer, 0, mcuRowPixels);
 
@@ -352,25 +555,23 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
           LOG_ERR("JPG", "JPEG decode MCU failed at (%d, %d) with error code: %d", mcuX, mcuY, mcuStatus);
         }
         free(mcuRowBuffer);
-        free(rowBuffer);
+        delete[] writers;
         return false;
       }
 
-      // picojpeg stores MCU data in 8x8 blocks
+      // picojpeg stores MCU data in 8x8 blocks, reduced decodes fill the top-left blockSize x blockSize of each
       // Block layout: H2V2(16x16)=0,64,128,192 H2V1(16x8)=0,64 H1V2(8x16)=0,128
       for (int blockY = 0; blockY < mcuPixelHeight; blockY++) {
         for (int blockX = 0; blockX < mcuPixelWidth; blockX++) {
           const int pixelX = mcuX * mcuPixelWidth + blockX;
-          if (pixelX >= imageInfo.m_width) continue;
+          if (pixelX >= srcWidth) continue;
 
           // Calculate proper block offset for picojpeg buffer
-          const int blockCol = blockX / 8;
-          const int blockRow = blockY / 8;
-          const int localX = blockX % 8;
-          const int localY = blockY % 8;
-          const int blocksPerRow = mcuPixelWidth / 8;
-          const int blockIndex = blockRow * blocksPerRow + blockCol;
-          const int pixelOffset = blockIndex * 64 + localY * 8 + localX;
+          const int blockCol = blockX / blockSize;
+          const int blockRow = blockY / blockSize;
+          const int localX = blockX % blockSize;
+          const int localY = blockY % blockSize;
+          const int pixelOffset = blockRow * 128 + blockCol * 64 + localY * 8 + localX;
 
           uint8_t gray;
           if (imageInfo.m_comps == 1) {
@@ -382,187 +583,51 @@ bool JpegToBmpConverter::jpegFileToBmpStreamInternal(FsFile& jpegFile, Print& bm
             gray = (r * 25 + g * 50 + b * 25) / 100;
           }
 
-          mcuRowBuffer[blockY * imageInfo.m_width + pixelX] = gray;
+          mcuRowBuffer[blockY * srcWidth + pixelX] = gray;
         }
       }
     }
 
-    // Process source rows from this MCU row
+    // Fan the source rows from this MCU row out to every variant
     const int startRow = mcuY * mcuPixelHeight;
     const int endRow = (mcuY + 1) * mcuPixelHeight;
 
-    for (int y = startRow; y < endRow && y < imageInfo.m_height; y++) {
-      const int bufferY = y - startRow;
-
-      if (!needsScaling) {
-        // No scaling - direct output (1:1 mapping)
-        memset(rowBuffer, 0, bytesPerRow);
-
-        if (USE_8BIT_OUTPUT && !oneBit) {
-          for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
-            rowBuffer[x] = adjustPixel(gray);
-          }
-        } else if (oneBit) {
-          // 1-bit output with Atkinson dithering for better quality
-          for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = mcuRowBuffer[bufferY * imageInfo.m_width + x];
-            const uint8_t bit =
-                atkinson1BitDitherer ? atkinson1BitDitherer->processPixel(gray, x) : quantize1bit(gray, x, y);
-            // Pack 1-bit value: MSB first, 8 pixels per byte
-            const int byteIndex = x / 8;
-            const int bitOffset = 7 - (x % 8);
-            rowBuffer[byteIndex] |= (bit << bitOffset);
-          }
-          if (atkinson1BitDitherer) atkinson1BitDitherer->nextRow();
-        } else {
-          // 2-bit output
-          for (int x = 0; x < outWidth; x++) {
-            const uint8_t gray = adjustPixel(mcuRowBuffer[bufferY * imageInfo.m_width + x]);
-            uint8_t twoBit;
-            if (atkinsonDitherer) {
-              twoBit = atkinsonDitherer->processPixel(gray, x);
-            } else if (fsDitherer) {
-              twoBit = fsDitherer->processPixel(gray, x);
-            } else {
-              twoBit = quantize(gray, x, y);
-            }
-            const int byteIndex = (x * 2) / 8;
-            const int bitOffset = 6 - ((x * 2) % 8);
-            rowBuffer[byteIndex] |= (twoBit << bitOffset);
-          }
-          if (atkinsonDitherer)
-            atkinsonDitherer->nextRow();
-          else if (fsDitherer)
-            fsDitherer->nextRow();
-        }
-        bmpOut.write(rowBuffer, bytesPerRow);
-      } else {
-        // Fixed-point area averaging for exact fit scaling
-        // For each output pixel X, accumulate source pixels that map to it
-        // srcX range for outX: [outX * scaleX_fp >> 16, (outX+1) * scaleX_fp >> 16)
-        const uint8_t* srcRow = mcuRowBuffer + bufferY * imageInfo.m_width;
-
-        for (int outX = 0; outX < outWidth; outX++) {
-          // Calculate source X range for this output pixel
-          const int srcXStart = (static_cast<uint32_t>(outX) * scaleX_fp) >> 16;
-          const int srcXEnd = (static_cast<uint32_t>(outX + 1) * scaleX_fp) >> 16;
-
-          // Accumulate all source pixels in this range
-          int sum = 0;
-          int count = 0;
-          for (int srcX = srcXStart; srcX < srcXEnd && srcX < imageInfo.m_width; srcX++) {
-            sum += srcRow[srcX];
-            count++;
-          }
-
-          // Handle edge case: if no pixels in range, use nearest
-          if (count == 0 && srcXStart < imageInfo.m_width) {
-            sum = srcRow[srcXStart];
-            count = 1;
-          }
-
-          rowAccum[outX] += sum;
-          rowCount[outX] += count;
-        }
-
-        // Check if we've crossed into the next output row
-        // Current source Y in fixed point: y << 16
-        const uint32_t srcY_fp = static_cast<uint32_t>(y + 1) << 16;
-
-        // Output row when source Y crosses the boundary
-        if (srcY_fp >= nextOutY_srcStart && currentOutY < outHeight) {
-          memset(rowBuffer, 0, bytesPerRow);
-
-          if (USE_8BIT_OUTPUT && !oneBit) {
-            for (int x = 0; x < outWidth; x++) {
-              const uint8_t gray = (rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0;
-              rowBuffer[x] = adjustPixel(gray);
-            }
-          } else if (oneBit) {
-            // 1-bit output with Atkinson dithering for better quality
-            for (int x = 0; x < outWidth; x++) {
-              const uint8_t gray = (rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0;
-              const uint8_t bit = atkinson1BitDitherer ? atkinson1BitDitherer->processPixel(gray, x)
-                                                       : quantize1bit(gray, x, currentOutY);
-              // Pack 1-bit value: MSB first, 8 pixels per byte
-              const int byteIndex = x / 8;
-              const int bitOffset = 7 - (x % 8);
-              rowBuffer[byteIndex] |= (bit << bitOffset);
-            }
-            if (atkinson1BitDitherer) atkinson1BitDitherer->nextRow();
-          } else {
-            // 2-bit output
-            for (int x = 0; x < outWidth; x++) {
-              const uint8_t gray = adjustPixel((rowCount[x] > 0) ? (rowAccum[x] / rowCount[x]) : 0);
-              uint8_t twoBit;
-              if (atkinsonDitherer) {
-                twoBit = atkinsonDitherer->processPixel(gray, x);
-              } else if (fsDitherer) {
-                twoBit = fsDitherer->processPixel(gray, x);
-              } else {
-                twoBit = quantize(gray, x, currentOutY);
-              }
-              const int byteIndex = (x * 2) / 8;
-              const int bitOffset = 6 - ((x * 2) % 8);
-              rowBuffer[byteIndex] |= (twoBit << bitOffset);
-            }
-            if (atkinsonDitherer)
-              atkinsonDitherer->nextRow();
-            else if (fsDitherer)
-              fsDitherer->nextRow();
-          }
-
-          bmpOut.write(rowBuffer, bytesPerRow);
-          currentOutY++;
-
-          // Reset accumulators for next output row
-          memset(rowAccum, 0, outWidth * sizeof(uint32_t));
-          memset(rowCount, 0, outWidth * sizeof(uint16_t));
-
-          // Update boundary for next output row
-          nextOutY_srcStart = static_cast<uint32_t>(currentOutY + 1) * scaleY_fp;
-        }
+    for (int y = startRow; y < endRow && y < srcHeight; y++) {
+      const uint8_t* srcRow = mcuRowBuffer + (y - startRow) * srcWidth;
+      for (int i = 0; i < count; i++) {
+        writers[i].addSourceRow(srcRow, srcWidth, y);
       }
     }
   }
 
   // Clean up
-  if (rowAccum) {
-    delete[] rowAccum;
-  }
-  if (rowCount) {
-    delete[] rowCount;
-  }
-  if (atkinsonDitherer) {
-    delete atkinsonDitherer;
-  }
-  if (fsDitherer) {
-    delete fsDitherer;
-  }
-  if (atkinson1BitDitherer) {
-    delete atkinson1BitDitherer;
-  }
   free(mcuRowBuffer);
-  free(rowBuffer);
+  delete[] writers;
 
-  LOG_DBG("JPG", "Successfully converted JPEG to BMP");
+  LOG_DBG("JPG", "Successfully converted JPEG to %d BMP%s", count, count == 1 ? "" : "s");
   return true;
 }
 
 // Core function: Convert JPEG file to 2-bit BMP (uses default target size)
 bool JpegToBmpConverter::jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut, bool crop) {
-  return jpegFileToBmpStreamInternal(jpegFile, bmpOut, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT, false, crop);
+  const BmpVariant variant = {&bmpOut, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT, false, crop};
+  return jpegFileToBmpStreams(jpegFile, &variant, 1);
 }
 
 // Convert with custom target size (for thumbnails, 2-bit)
 bool JpegToBmpConverter::jpegFileToBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth,
                                                      int targetMaxHeight) {
-  return jpegFileToBmpStreamInternal(jpegFile, bmpOut, targetMaxWidth, targetMaxHeight, false);
+  const BmpVariant variant = {&bmpOut, targetMaxWidth, targetMaxHeight, false, true};
+  return jpegFileToBmpStreams(jpegFile, &variant, 1);
 }
 
 // Convert to 1-bit BMP (black and white only, no grays) for fast home screen rendering
 bool JpegToBmpConverter::jpegFileTo1BitBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth,
                                                          int targetMaxHeight) {
-  return jpegFileToBmpStreamInternal(jpegFile, bmpOut, targetMaxWidth, targetMaxHeight, true, true);
+  const BmpVariant variant = {&bmpOut, targetMaxWidth, targetMaxHeight, true, true};
+  return jpegFileToBmpStreams(jpegFile, &variant, 1);
+}
+
+JpegToBmpConverter::BmpVariant JpegToBmpConverter::coverVariant(Print& bmpOut, const bool crop) {
+  return {&bmpOut, TARGET_MAX_WIDTH, TARGET_MAX_HEIGHT, false, crop};
 }
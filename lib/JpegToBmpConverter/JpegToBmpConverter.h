@@ -1,4 +1,5 @@
 #pragma once
+#include <functional>
 
 class FsFile;
 class Print;
@@ -7,13 +8,26 @@ class ZipFile;
 class JpegToBmpConverter {
   static unsigned char jpegReadCallback(unsigned char* pBuf, unsigned char buf_size,
                                         unsigned char* pBytes_actually_read, void* pCallback_data);
-  static bool jpegFileToBmpStreamInternal(class FsFile& jpegFile, Print& bmpOut, int targetWidth, int targetHeight,
-                                          bool oneBit, bool crop = true);
 
  public:
+  // One output of a multi-variant conversion
+  struct BmpVariant {
+    Print* out;
+    int targetWidth;
+    int targetHeight;
+    bool oneBit;
+    bool crop;
+  };
+
   static bool jpegFileToBmpStream(FsFile& jpegFile, Print& bmpOut, bool crop = true);
   // Convert with custom target size (for thumbnails)
   static bool jpegFileToBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
   // Convert to 1-bit BMP (black and white only, no grays) for fast home screen rendering
   static bool jpegFileTo1BitBmpStreamWithSize(FsFile& jpegFile, Print& bmpOut, int targetMaxWidth, int targetMaxHeight);
+  // Decode the JPEG once and write every variant from the same scanlines, each with its own scaler and ditherer.
+  // shouldStop is polled between MCU rows; a stopped conversion fails like a broken JPEG
+  static bool jpegFileToBmpStreams(FsFile& jpegFile, const BmpVariant* variants, int count,
+                                   const std::function<bool()>& shouldStop = nullptr);
+  // Full-screen 2-bit cover variant, as written by jpegFileToBmpStream
+  static BmpVariant coverVariant(Print& bmpOut, bool crop);
 };
@@ -0,0 +1,295 @@
+#include "ChapterXPath.h"
+
+#include <Logging.h>
+
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr size_t STREAM_CHUNK_SIZE = 1024;
+
+bool isXmlWhitespace(const char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+bool isCodepointStart(const char c) { return (static_cast<unsigned char>(c) & 0xC0) != 0x80; }
+
+uint32_t countCodepoints(const char* s, const int len) {
+  uint32_t count = 0;
+  for (int i = 0; i < len; i++) {
+    if (isCodepointStart(s[i])) count++;
+  }
+  return count;
+}
+
+// Parses "[n]" at s, leaving s after it; 1 when there is no index
+int parseIndex(const char*& s) {
+  if (*s != '[') return 1;
+  char* end;
+  const long index = strtol(s + 1, &end, 10);
+  if (*end != ']' || index < 1) return 0;
+  s = end + 1;
+  return static_cast<int>(index);
+}
+}  // namespace
+
+std::string ChapterXPath::fromSourceOffset(const std::shared_ptr<Epub>& epub, const int spineIndex,
+                                           const uint32_t sourceOffset) {
+  ChapterXPath walker(FIND_PATH);
+  walker.targetOffset = sourceOffset;
+  if (!walker.run(epub, spineIndex) || walker.foundPath.empty()) {
+    LOG_DBG("CXP", "No XPointer for offset %u of spine item %d", sourceOffset, spineIndex);
+    return "";
+  }
+  return "/body/DocFragment[" + std::to_string(spineIndex + 1) + "]" + walker.foundPath;
+}
+
+bool ChapterXPath::toSourceOffset(const std::shared_ptr<Epub>& epub, const int spineIndex, const std::string& xpath,
+                                  uint32_t* sourceOffset) {
+  ChapterXPath walker(FIND_OFFSET);
+  if (!walker.parseXPath(xpath)) {
+    LOG_DBG("CXP", "Unsupported XPointer: %s", xpath.c_str());
+    return false;
+  }
+  if (!walker.run(epub, spineIndex) || !walker.bodyMatched) {
+    return false;
+  }
+  if (walker.matchedSteps < walker.steps.size()) {
+    LOG_DBG("CXP", "Matched %u of %u steps of %s", static_cast<unsigned>(walker.matchedSteps),
+            static_cast<unsigned>(walker.steps.size()), xpath.c_str());
+  }
+  *sourceOffset = walker.foundOffset;
+  return true;
+}
+
+ChapterXPath::~ChapterXPath() {
+  if (parser) {
+    XML_StopParser(parser, XML_FALSE);                // Stop any pending processing
+    XML_SetElementHandler(parser, nullptr, nullptr);  // Clear callbacks
+    XML_SetCharacterDataHandler(parser, nullptr);
+    XML_ParserFree(parser);
+    parser = nullptr;
+  }
+}
+
+bool ChapterXPath::parseXPath(const std::string& xpath) {
+  // "/body/DocFragment[n]/body" then element steps, optionally ending in "text()[k].offset"
+  const size_t fragment = xpath.find("DocFragment[");
+  if (fragment == std::string::npos) return false;
+  const char* s = strchr(xpath.c_str() + fragment, ']');
+  if (!s || strncmp(s + 1, "/body", 5) != 0) return false;
+  s += 6;
+
+  while (*s == '/') {
+    s++;
+    const char* nameEnd = s;
+    while (*nameEnd && *nameEnd != '/' && *nameEnd != '[' && *nameEnd != '.') nameEnd++;
+    if (nameEnd == s) return false;
+    std::string name(s, nameEnd);
+    s = nameEnd;
+    const int index = parseIndex(s);
+    if (index == 0) return false;
+
+    if (name == "text()") {
+      textIndex = index;
+      if (*s == '.') {
+        textOffset = static_cast<uint32_t>(strtoul(s + 1, nullptr, 10));
+      }
+      return true;
+    }
+    steps.push_back({std::move(name), index});
+    if (*s == '.') {
+      // An offset into an element rather than a text node; the element itself is close enough
+      return true;
+    }
+  }
+  return *s == '\0';
+}
+
+bool ChapterXPath::run(const std::shared_ptr<Epub>& epub, const int spineIndex) {
+  if (spineIndex < 0 || spineIndex >= epub->getSpineItemsCount()) {
+    return false;
+  }
+
+  parser = XML_ParserCreate(nullptr);
+  if (!parser) {
+    LOG_ERR("CXP", "Couldn't allocate memory for parser");
+    return false;
+  }
+  XML_SetUserData(parser, this);
+  XML_SetElementHandler(parser, startElement, endElement);
+  XML_SetCharacterDataHandler(parser, characterData);
+  // HTML entities the XML parser does not know arrive here, like they do in ChapterHtmlSlimParser
+  XML_SetDefaultHandlerExpand(parser, defaultHandler);
+
+  if (!epub->readItemContentsToStream(epub->getSpineItem(spineIndex).href, *this, STREAM_CHUNK_SIZE)) {
+    LOG_ERR("CXP", "Could not read spine item %d", spineIndex);
+    return false;
+  }
+  if (!done && XML_Parse(parser, nullptr, 0, XML_TRUE) == XML_STATUS_ERROR) {
+    LOG_DBG("CXP", "Parse error at end: %s", XML_ErrorString(XML_GetErrorCode(parser)));
+  }
+  return true;
+}
+
+size_t ChapterXPath::write(const uint8_t data) { return write(&data, 1); }
+
+size_t ChapterXPath::write(const uint8_t* buffer, const size_t size) {
+  // Once the answer is known the rest of the chapter is drained unparsed, a short write would abort with an error
+  if (done || !parser) return size;
+
+  if (XML_Parse(parser, reinterpret_cast<const char*>(buffer), static_cast<int>(size), XML_FALSE) ==
+      XML_STATUS_ERROR) {
+    LOG_ERR("CXP", "Parse error at line %lu: %s", XML_GetCurrentLineNumber(parser),
+            XML_ErrorString(XML_GetErrorCode(parser)));
+    done = true;
+  }
+  return size;
+}
+
+uint32_t ChapterXPath::currentByteIndex() const {
+  const XML_Index index = XML_GetCurrentByteIndex(parser);
+  return index > 0 ? static_cast<uint32_t>(index) : 0;
+}
+
+std::string ChapterXPath::currentPath() const {
+  // levels[0] is <html> (the DocFragment), levels[1] the chapter's <body>
+  std::string path = "/body";
+  for (size_t i = 2; i < levels.size(); i++) {
+    path += "/" + levels[i].name + "[" + std::to_string(levels[i].index) + "]";
+  }
+  return path;
+}
+
+void ChapterXPath::endTextNode() {
+  textNodeCounted = false;
+  textNodeChars = 0;
+}
+
+void XMLCALL ChapterXPath::startElement(void* userData, const XML_Char* name, const XML_Char** /*atts*/) {
+  auto* self = static_cast<ChapterXPath*>(userData);
+  if (self->done) return;
+  self->endTextNode();
+
+  Level level;
+  level.name = name;
+  if (!self->levels.empty()) {
+    auto& counts = self->levels.back().childCounts;
+    auto it = counts.begin();
+    while (it != counts.end() && it->first != level.name) ++it;
+    if (it == counts.end()) {
+      counts.emplace_back(level.name, 1);
+      level.index = 1;
+    } else {
+      level.index = ++it->second;
+    }
+  }
+  self->levels.push_back(std::move(level));
+
+  const size_t depth = self->levels.size();
+  const bool isBody = depth == 2 && self->levels[1].name == "body";
+  if (depth < 2 || self->levels[1].name != "body") return;
+
+  if (self->mode == FIND_PATH) {
+    if (self->currentByteIndex() >= self->targetOffset) {
+      self->foundPath = self->currentPath();
+      self->done = true;
+    }
+    return;
+  }
+
+  if (isBody) {
+    self->bodyMatched = true;
+    self->foundOffset = self->currentByteIndex();
+  } else if (depth - 3 == self->matchedSteps && self->matchedSteps < self->steps.size()) {
+    const Step& step = self->steps[self->matchedSteps];
+    const Level& current = self->levels.back();
+    if (current.name == step.name && current.index == step.index) {
+      self->matchedSteps++;
+      self->foundOffset = self->currentByteIndex();
+    }
+  }
+  if (self->bodyMatched && self->matchedSteps == self->steps.size() && self->textIndex == 0) {
+    self->done = true;
+  }
+}
+
+void XMLCALL ChapterXPath::endElement(void* userData, const XML_Char* /*name*/) {
+  auto* self = static_cast<ChapterXPath*>(userData);
+  if (self->done) return;
+  self->endTextNode();
+
+  // Closing the deepest matched element (or the body) means the rest of the path is not in this chapter
+  if (self->mode == FIND_OFFSET && self->bodyMatched && self->levels.size() == self->matchedSteps + 2) {
+    self->done = true;
+  }
+  self->levels.pop_back();
+}
+
+void XMLCALL ChapterXPath::characterData(void* userData, const XML_Char* s, const int len) {
+  static_cast<ChapterXPath*>(userData)->text(s, len, true);
+}
+
+void XMLCALL ChapterXPath::defaultHandler(void* userData, const XML_Char* s, const int len) {
+  // An entity reference is one character of text; anything else (comments, doctype) is not text
+  if (len >= 3 && s[0] == '&' && s[len - 1] == ';') {
+    static_cast<ChapterXPath*>(userData)->text(s, len, false);
+  }
+}
+
+void ChapterXPath::text(const char* s, const int len, const bool decoded) {
+  if (done || levels.size() < 2 || levels[1].name != "body") return;
+
+  if (!textNodeCounted) {
+    bool hasContent = !decoded;
+    for (int i = 0; i < len && !hasContent; i++) {
+      hasContent = !isXmlWhitespace(s[i]);
+    }
+    if (hasContent) {
+      // Whitespace-only text nodes are dropped by crengine, so only the others are numbered
+      textNodeCounted = true;
+      levels.back().textNodes++;
+    }
+  }
+  const uint32_t chars = decoded ? countCodepoints(s, len) : 1;
+  const uint32_t eventStart = currentByteIndex();
+
+  if (mode == FIND_PATH) {
+    if (textNodeCounted && eventStart + len > targetOffset) {
+      const int bytesBefore = targetOffset > eventStart ? static_cast<int>(targetOffset - eventStart) : 0;
+      const uint32_t charsBefore = decoded ? countCodepoints(s, bytesBefore) : (bytesBefore > 0 ? 1 : 0);
+      const int textNode = levels.back().textNodes;
+      foundPath = currentPath() + "/text()" + (textNode > 1 ? "[" + std::to_string(textNode) + "]" : "") + "." +
+                  std::to_string(textNodeChars + charsBefore);
+      done = true;
+      return;
+    }
+    textNodeChars += chars;
+    return;
+  }
+
+  // FIND_OFFSET: only text directly inside the fully matched element, in the numbered text node. Whitespace ahead of
+  // a node's first content arrives in events of its own (line ends, write boundaries) and counts toward the offset,
+  // as it does above.
+  if (textIndex == 0 || !bodyMatched || matchedSteps != steps.size() || levels.size() != steps.size() + 2 ||
+      levels.back().textNodes + (textNodeCounted ? 0 : 1) != textIndex) {
+    return;
+  }
+  if (textNodeChars + chars > textOffset) {
+    // Byte where the wanted character starts; an entity is a single character
+    const uint32_t wanted = textOffset - textNodeChars;
+    int byte = 0;
+    if (decoded) {
+      uint32_t seen = 0;
+      for (; byte < len; byte++) {
+        if (isCodepointStart(s[byte])) {
+          if (seen == wanted) break;
+          seen++;
+        }
+      }
+    }
+    foundOffset = eventStart + byte;
+    done = true;
+    return;
+  }
+  textNodeChars += chars;
+  foundOffset = eventStart + len;
+}
@@ -0,0 +1,92 @@
+#pragma once
+#include <Epub.h>
+#include <Print.h>
+#include <expat.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Converts between byte offsets in a chapter's XHTML and KOReader (crengine) XPointers.
+ *
+ * Section files record where each page starts in the chapter's XHTML. KOReader addresses the same place by element
+ * path, e.g. "/body/DocFragment[3]/body/div[2]/p[5]/text().12": every element below the chapter's <body> by name
+ * and 1-based index among its same-named siblings, then the text node and a character offset into it.
+ *
+ * Both directions stream the chapter out of the EPUB through expat once; nothing is kept in memory beyond the open
+ * elements.
+ */
+class ChapterXPath final : public Print {
+ public:
+  /**
+   * XPointer of the text at a byte offset of a spine item's XHTML.
+   *
+   * @return The XPointer, or an empty string if the chapter could not be read
+   */
+  static std::string fromSourceOffset(const std::shared_ptr<Epub>& epub, int spineIndex, uint32_t sourceOffset);
+
+  /**
+   * Byte offset of the place an XPointer points at in a spine item's XHTML. A path that does not fully exist in
+   * this copy of the book resolves to the deepest element it matched.
+   *
+   * @return false if the chapter could not be read or not even the chapter's body matched
+   */
+  static bool toSourceOffset(const std::shared_ptr<Epub>& epub, int spineIndex, const std::string& xpath,
+                             uint32_t* sourceOffset);
+
+  size_t write(uint8_t) override;
+  size_t write(const uint8_t* buffer, size_t size) override;
+
+ private:
+  struct Step {
+    std::string name;
+    int index;
+  };
+
+  // An open element and how many children of each name it has had so far
+  struct Level {
+    std::string name;
+    int index = 0;
+    std::vector<std::pair<std::string, int>> childCounts;
+    int textNodes = 0;  // Text nodes with more than whitespace
+  };
+
+  enum Mode { FIND_PATH, FIND_OFFSET };
+
+  Mode mode;
+  XML_Parser parser = nullptr;
+  bool done = false;
+  std::vector<Level> levels;
+
+  // Text node being read: whether it has shown anything but whitespace and how many characters came before
+  bool textNodeCounted = false;
+  uint32_t textNodeChars = 0;
+
+  // FIND_PATH
+  uint32_t targetOffset = 0;
+  std::string foundPath;
+
+  // FIND_OFFSET
+  std::vector<Step> steps;
+  int textIndex = 0;  // 0 when the XPointer names no text node
+  uint32_t textOffset = 0;
+  size_t matchedSteps = 0;  // Leading steps matched by open elements
+  bool bodyMatched = false;
+  uint32_t foundOffset = 0;
+
+  explicit ChapterXPath(Mode mode) : mode(mode) {}
+  ~ChapterXPath() override;
+
+  bool run(const std::shared_ptr<Epub>& epub, int spineIndex);
+  bool parseXPath(const std::string& xpath);
+  std::string currentPath() const;
+  uint32_t currentByteIndex() const;
+  void endTextNode();
+  void text(const char* s, int len, bool decoded);
+
+  static void XMLCALL startElement(void* userData, const XML_Char* name, const XML_Char** atts);
+  static void XMLCALL endElement(void* userData, const XML_Char* name);
+  static void XMLCALL characterData(void* userData, const XML_Char* s, int len);
+  static void XMLCALL defaultHandler(void* userData, const XML_Char* s, int len);
+};
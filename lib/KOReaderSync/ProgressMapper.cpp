@@ -4,6 +4,8 @@
 
 #include <cmath>
 
+#include "ChapterXPath.h"
+
 KOReaderPosition ProgressMapper::toKOReader(const std::shared_ptr<Epub>& epub, const CrossPointPosition& pos) {
   KOReaderPosition result;
 
@@ -16,8 +18,13 @@ KOReaderPosition ProgressMapper::toKOReader(const std::shared_ptr<Epub>& epub, c
   // Calculate overall book progress (0.0-1.0)
   result.percentage = epub->calculateProgress(pos.spineIndex, intraSpineProgress);
 
-  // Generate XPath with estimated paragraph position based on page
-  result.xpath = generateXPath(pos.spineIndex, pos.pageNumber, pos.totalPages);
+  // Exact XPath of the page start when it is known, else one that only names the spine item
+  if (pos.sourceOffset != Section::UNKNOWN_SOURCE_OFFSET) {
+    result.xpath = ChapterXPath::fromSourceOffset(epub, pos.spineIndex, pos.sourceOffset);
+  }
+  if (result.xpath.empty()) {
+    result.xpath = generateXPath(pos.spineIndex, pos.pageNumber, pos.totalPages);
+  }
 
   // Get chapter info for logging
   const int tocIndex = epub->getTocIndexForSpineIndex(pos.spineIndex);
@@ -45,8 +52,13 @@ CrossPointPosition ProgressMapper::toCrossPoint(const std::shared_ptr<Epub>& epu
   int xpathSpineIndex = parseDocFragmentIndex(koPos.xpath);
   if (xpathSpineIndex >= 0 && xpathSpineIndex < epub->getSpineItemsCount()) {
     result.spineIndex = xpathSpineIndex;
-    // When we have XPath, go to page 0 of the spine - byte-based page calculation is unreliable
+    // When we have XPath, go to page 0 of the spine - byte-based page calculation is unreliable - unless the path
+    // leads to a place in the chapter, which the reader can turn into the exact page
     result.pageNumber = 0;
+    uint32_t sourceOffset;
+    if (ChapterXPath::toSourceOffset(epub, xpathSpineIndex, koPos.xpath, &sourceOffset)) {
+      result.sourceOffset = sourceOffset;
+    }
   } else {
     // Fall back to percentage-based lookup for both spine and page
     const size_t targetBytes = static_cast<size_t>(bookSize * koPos.percentage);
@@ -76,8 +88,9 @@ CrossPointPosition ProgressMapper::toCrossPoint(const std::shared_ptr<Epub>& epu
     }
   }
 
-  LOG_DBG("ProgressMapper", "KOReader -> CrossPoint: %.2f%% at %s -> spine=%d, page=%d", koPos.percentage * 100,
-          koPos.xpath.c_str(), result.spineIndex, result.pageNumber);
+  LOG_DBG("ProgressMapper", "KOReader -> CrossPoint: %.2f%% at %s -> spine=%d, page=%d, offset=%u",
+          koPos.percentage * 100, koPos.xpath.c_str(), result.spineIndex, result.pageNumber,
+          static_cast<unsigned>(result.sourceOffset));
 
   return result;
 }
@@ -1,5 +1,6 @@
 #pragma once
 #include <Epub.h>
+#include <Epub/Section.h>
 
 #include <memory>
 #include <string>
@@ -11,6 +12,7 @@ struct CrossPointPosition {
   int spineIndex;  // Current spine item (chapter) index
   int pageNumber;  // Current page within the spine item
   int totalPages;  // Total pages in the current spine item
+  uint32_t sourceOffset = Section::UNKNOWN_SOURCE_OFFSET;  // Byte offset of the page start in the spine item
 };
 
 /**
@@ -27,8 +29,9 @@ struct KOReaderPosition {
  * CrossPoint tracks position as (spineIndex, pageNumber).
  * KOReader uses XPath-like strings + percentage.
  *
- * Since CrossPoint discards HTML structure during parsing, we generate
- * synthetic XPath strings based on spine index, using percentage as the
+ * When the position carries the byte offset of its page in the chapter's XHTML,
+ * the XPath is the exact one for that spot (see ChapterXPath). Otherwise we
+ * generate a synthetic XPath based on spine index, using percentage as the
  * primary sync mechanism.
  */
 class ProgressMapper {
@@ -46,7 +49,8 @@ class ProgressMapper {
    * Convert KOReader position to CrossPoint format.
    *
    * Note: The returned pageNumber may be approximate since different
-   * rendering settings produce different page counts.
+   * rendering settings produce different page counts. When the XPath can be
+   * followed in the chapter, sourceOffset is set and locates the page exactly.
    *
    * @param epub The EPUB book
    * @param koPos KOReader position
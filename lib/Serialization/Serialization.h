@@ -11,38 +11,38 @@ constexpr uint32_t MAX_SERIALIZED_STRING_LENGTH = 256 * 1024;
 }
 
 template <typename T>
-static void writePod(std::ostream& os, const T& value) {
+inline void writePod(std::ostream& os, const T& value) {
   os.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
 
 template <typename T>
-static void writePod(FsFile& file, const T& value) {
+inline void writePod(FsFile& file, const T& value) {
   file.write(reinterpret_cast<const uint8_t*>(&value), sizeof(T));
 }
 
 template <typename T>
-static void readPod(std::istream& is, T& value) {
+inline void readPod(std::istream& is, T& value) {
   is.read(reinterpret_cast<char*>(&value), sizeof(T));
 }
 
 template <typename T>
-static void readPod(FsFile& file, T& value) {
+inline void readPod(FsFile& file, T& value) {
   file.read(reinterpret_cast<uint8_t*>(&value), sizeof(T));
 }
 
-static void writeString(std::ostream& os, const std::string& s) {
+inline void writeString(std::ostream& os, const std::string& s) {
   const uint32_t len = s.size();
   writePod(os, len);
   os.write(s.data(), len);
 }
 
-static void writeString(FsFile& file, const std::string& s) {
+inline void writeString(FsFile& file, const std::string& s) {
   const uint32_t len = s.size();
   writePod(file, len);
   file.write(reinterpret_cast<const uint8_t*>(s.data()), len);
 }
 
-static void readString(std::istream& is, std::string& s) {
+inline void readString(std::istream& is, std::string& s) {
   uint32_t len = 0;
   is.read(reinterpret_cast<char*>(&len), sizeof(len));
   if (!is) {
@@ -70,7 +70,7 @@ static void readString(std::istream& is, std::string& s) {
   }
 }
 
-static void readString(FsFile& file, std::string& s) {
+inline void readString(FsFile& file, std::string& s) {
   uint32_t len = 0;
   if (file.read(reinterpret_cast<uint8_t*>(&len), sizeof(len)) != sizeof(len)) {
     s.clear();
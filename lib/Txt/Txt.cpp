@@ -1,6 +1,7 @@
 #include "Txt.h"
 
 #include <FsHelpers.h>
+#include <HalSpiBus.h>
 #include <JpegToBmpConverter.h>
 #include <Logging.h>
 
@@ -175,6 +176,8 @@ bool Txt::readContent(uint8_t* buffer, size_t offset, size_t length) const {
     return false;
   }
 
+  // Read while the page before is refreshed, whose refresh takes the bus back when the panel is done
+  HalSpiBus::Lock bus;
   FsFile file;
   if (!Storage.openFileForRead("TXT", filepath, file)) {
     return false;
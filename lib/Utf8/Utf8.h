@@ -4,6 +4,8 @@
 #include <string>
 #define REPLACEMENT_GLYPH 0xFFFD
 
+// Length of the UTF-8 sequence introduced by lead byte c (1 for invalid lead bytes).
+int utf8CodepointLen(unsigned char c);
 uint32_t utf8NextCodepoint(const unsigned char** string);
 // Remove the last UTF-8 codepoint from a std::string and return the new size.
 size_t utf8RemoveLastChar(std::string& str);
@@ -1,5 +1,6 @@
 #include <HalDisplay.h>
 #include <HalGPIO.h>
+#include <HalSpiBus.h>
 
 #define SD_SPI_MISO 7
 
@@ -7,12 +8,53 @@ HalDisplay::HalDisplay() : einkDisplay(EPD_SCLK, EPD_MOSI, EPD_CS, EPD_DC, EPD_R
 
 HalDisplay::~HalDisplay() {}
 
-void HalDisplay::begin() { einkDisplay.begin(); }
+void HalDisplay::begin() {
+  HalSpiBus::begin();
+  {
+    HalSpiBus::Lock bus;
+    einkDisplay.begin();
+  }
+
+  if (refreshTaskHandle) {
+    return;
+  }
+  refreshIdle = xSemaphoreCreateBinary();
+  refreshOnBus = xSemaphoreCreateBinary();
+  if (!refreshIdle || !refreshOnBus) {
+    return;
+  }
+  xSemaphoreGive(refreshIdle);
+  // Above the refresh task, so it can stop it; it sleeps between polls of BUSY
+  if (xTaskCreate(&HalDisplay::busyWatchTrampoline, "DisplayBusyWatch",
+                  2048,             // Stack size
+                  this,             // Parameters
+                  2,                // Priority
+                  &busyWatchHandle  // Task handle
+                  ) != pdPASS) {
+    busyWatchHandle = nullptr;
+    return;
+  }
+  // Level with the activities' display tasks and the loop: the driver waits out BUSY inside the refresh call, and
+  // above them a wait that spins would starve both until the watch stops it. The hand-over does not need the edge,
+  // as the caller blocks until the refresh task holds the bus.
+  if (xTaskCreate(&HalDisplay::refreshTaskTrampoline, "DisplayRefreshTask",
+                  4096,               // Stack size
+                  this,               // Parameters
+                  1,                  // Priority
+                  &refreshTaskHandle  // Task handle
+                  ) != pdPASS) {
+    refreshTaskHandle = nullptr;
+  }
+}
 
-void HalDisplay::clearScreen(uint8_t color) const { einkDisplay.clearScreen(color); }
+void HalDisplay::clearScreen(uint8_t color) const {
+  waitForRefresh();
+  einkDisplay.clearScreen(color);
+}
 
 void HalDisplay::drawImage(const uint8_t* imageData, uint16_t x, uint16_t y, uint16_t w, uint16_t h,
                            bool fromProgmem) const {
+  waitForRefresh();
   einkDisplay.drawImage(imageData, x, y, w, h, fromProgmem);
 }
 
@@ -29,29 +71,184 @@ EInkDisplay::RefreshMode convertRefreshMode(HalDisplay::RefreshMode mode) {
 }
 
 void HalDisplay::displayBuffer(HalDisplay::RefreshMode mode, bool turnOffScreen) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
   einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
 }
 
 void HalDisplay::displayWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool turnOffScreen) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
   einkDisplay.displayWindow(x, y, w, h, turnOffScreen);
 }
 
 void HalDisplay::refreshDisplay(HalDisplay::RefreshMode mode, bool turnOffScreen) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
   einkDisplay.refreshDisplay(convertRefreshMode(mode), turnOffScreen);
 }
 
-void HalDisplay::deepSleep() { einkDisplay.deepSleep(); }
+void HalDisplay::deepSleep() {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
+  einkDisplay.deepSleep();
+}
 
-uint8_t* HalDisplay::getFrameBuffer() const { return einkDisplay.getFrameBuffer(); }
+uint8_t* HalDisplay::getFrameBuffer() const {
+  // The driver may swap frame buffers when a refresh is done
+  waitForRefresh();
+  return einkDisplay.getFrameBuffer();
+}
 
 void HalDisplay::copyGrayscaleBuffers(const uint8_t* lsbBuffer, const uint8_t* msbBuffer) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
   einkDisplay.copyGrayscaleBuffers(lsbBuffer, msbBuffer);
 }
 
-void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) { einkDisplay.copyGrayscaleLsbBuffers(lsbBuffer); }
+void HalDisplay::copyGrayscaleLsbBuffers(const uint8_t* lsbBuffer) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
+  einkDisplay.copyGrayscaleLsbBuffers(lsbBuffer);
+}
 
-void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) { einkDisplay.copyGrayscaleMsbBuffers(msbBuffer); }
+void HalDisplay::copyGrayscaleMsbBuffers(const uint8_t* msbBuffer) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
+  einkDisplay.copyGrayscaleMsbBuffers(msbBuffer);
+}
 
-void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) { einkDisplay.cleanupGrayscaleBuffers(bwBuffer); }
+void HalDisplay::cleanupGrayscaleBuffers(const uint8_t* bwBuffer) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
+  einkDisplay.cleanupGrayscaleBuffers(bwBuffer);
+}
+
+void HalDisplay::displayGrayBuffer(bool turnOffScreen) {
+  waitForRefresh();
+  HalSpiBus::Lock bus;
+  einkDisplay.displayGrayBuffer(turnOffScreen);
+}
+
+void HalDisplay::displayBufferAsync(HalDisplay::RefreshMode mode, bool turnOffScreen, std::function<void()> onDone) {
+  startRefresh(AsyncRefresh::BUFFER, mode, turnOffScreen, std::move(onDone));
+}
+
+void HalDisplay::displayGrayBufferAsync(bool turnOffScreen, std::function<void()> onDone) {
+  startRefresh(AsyncRefresh::GRAY_BUFFER, FAST_REFRESH, turnOffScreen, std::move(onDone));
+}
 
-void HalDisplay::displayGrayBuffer(bool turnOffScreen) { einkDisplay.displayGrayBuffer(turnOffScreen); }
+bool HalDisplay::waitForRefresh(const uint32_t timeoutMs) const {
+  if (!refreshIdle) {
+    return true;
+  }
+  const TickType_t ticks = timeoutMs == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs);
+  if (xSemaphoreTake(refreshIdle, ticks) != pdTRUE) {
+    return false;
+  }
+  xSemaphoreGive(refreshIdle);
+  return true;
+}
+
+void HalDisplay::startRefresh(const AsyncRefresh refresh, const RefreshMode mode, const bool turnOffScreen,
+                              std::function<void()> onDone) {
+  if (!refreshTaskHandle) {
+    {
+      HalSpiBus::Lock bus;
+      if (refresh == AsyncRefresh::GRAY_BUFFER) {
+        einkDisplay.displayGrayBuffer(turnOffScreen);
+      } else {
+        einkDisplay.displayBuffer(convertRefreshMode(mode), turnOffScreen);
+      }
+    }
+    if (onDone) {
+      onDone();
+    }
+    return;
+  }
+
+  // One refresh at a time: a second one waits for the panel like the blocking calls do
+  xSemaphoreTake(refreshIdle, portMAX_DELAY);
+  asyncRefresh = refresh;
+  asyncMode = mode;
+  asyncTurnOffScreen = turnOffScreen;
+  asyncDone = std::move(onDone);
+  refreshing = true;
+  xTaskNotifyGive(refreshTaskHandle);
+  // Whatever the caller does on the bus next waits until the frame is sent. From onDone the refresh task picks it up
+  // itself.
+  if (xTaskGetCurrentTaskHandle() != refreshTaskHandle) {
+    xSemaphoreTake(refreshOnBus, portMAX_DELAY);
+  }
+}
+
+void HalDisplay::refreshTaskTrampoline(void* param) {
+  auto* self = static_cast<HalDisplay*>(param);
+  self->refreshTaskLoop();
+}
+
+void HalDisplay::refreshTaskLoop() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    {
+      HalSpiBus::Lock bus;
+      xSemaphoreGive(refreshOnBus);
+      inRefreshCall = true;
+      xTaskNotifyGive(busyWatchHandle);
+      if (asyncRefresh == AsyncRefresh::GRAY_BUFFER) {
+        einkDisplay.displayGrayBuffer(asyncTurnOffScreen);
+      } else {
+        einkDisplay.displayBuffer(convertRefreshMode(asyncMode), asyncTurnOffScreen);
+      }
+      inRefreshCall = false;
+    }
+
+    // Taken before the panel is let go, as onDone may start the next refresh
+    const std::function<void()> onDone = std::move(asyncDone);
+    asyncDone = nullptr;
+    refreshing = false;
+    xSemaphoreGive(refreshIdle);
+    if (onDone) {
+      onDone();
+    }
+  }
+}
+
+void HalDisplay::busyWatchTrampoline(void* param) {
+  auto* self = static_cast<HalDisplay*>(param);
+  self->busyWatchLoop();
+}
+
+// While BUSY is high the panel runs a waveform and takes no commands, so the driver does nothing but poll the pin.
+// The refresh task is stopped for that stretch and its bus lent out, then given back before the task is resumed, so
+// it never sees BUSY drop without the bus. A stretch counts once BUSY is high on two polls a tick apart, by when the
+// driver has finished sending the command that started it.
+void HalDisplay::busyWatchLoop() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    int busyPolls = 0;
+    while (inRefreshCall) {
+      busyPolls = digitalRead(EPD_BUSY) == HIGH ? busyPolls + 1 : 0;
+      if (busyPolls < 2) {
+        vTaskDelay(1);
+        continue;
+      }
+      busyPolls = 0;
+
+      vTaskSuspend(refreshTaskHandle);
+      // The call may have returned between the poll and the suspend
+      if (!inRefreshCall || digitalRead(EPD_BUSY) != HIGH) {
+        vTaskResume(refreshTaskHandle);
+        continue;
+      }
+      const uint32_t lent = HalSpiBus::lend(refreshTaskHandle);
+      while (digitalRead(EPD_BUSY) == HIGH) {
+        vTaskDelay(1);
+      }
+      HalSpiBus::reclaim(refreshTaskHandle, lent);
+      vTaskResume(refreshTaskHandle);
+    }
+  }
+}
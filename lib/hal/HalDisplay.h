@@ -1,6 +1,12 @@
 #pragma once
 #include <Arduino.h>
 #include <EInkDisplay.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <atomic>
+#include <functional>
 
 class HalDisplay {
  public:
@@ -17,7 +23,7 @@ class HalDisplay {
     FAST_REFRESH   // Fast refresh using custom LUT
   };
 
-  // Initialize the display hardware and driver
+  // Initialize the display hardware and driver, and start the task asynchronous refreshes run on
   void begin();
 
   // Display dimensions
@@ -48,6 +54,40 @@ class HalDisplay {
 
   void displayGrayBuffer(bool turnOffScreen = false);
 
+  // Asynchronous refresh: hands the frame to the refresh task and returns while the panel updates (a half refresh
+  // takes ~1.7s), so the caller can do work that leaves the frame buffer alone, e.g. reading the next page from SD.
+  // The refresh holds the SPI bus (HalSpiBus.h) while it sends the frame and lends it out while the panel runs the
+  // waveform; these return once it has the bus and must not be called with the bus held. onDone runs on the refresh
+  // task once the panel is done and must be short. Every other call on the display waits for the refresh first, so
+  // the frame buffer is not written while it is sent. Before begin() these refresh in place.
+  void displayBufferAsync(RefreshMode mode = RefreshMode::FAST_REFRESH, bool turnOffScreen = false,
+                          std::function<void()> onDone = nullptr);
+  void displayGrayBufferAsync(bool turnOffScreen = false, std::function<void()> onDone = nullptr);
+  bool isRefreshing() const { return refreshing; }
+  // Blocks until an asynchronous refresh is done; false if it is still running after timeoutMs
+  bool waitForRefresh(uint32_t timeoutMs = UINT32_MAX) const;
+
  private:
+  enum class AsyncRefresh { BUFFER, GRAY_BUFFER };
+
   EInkDisplay einkDisplay;
+  TaskHandle_t refreshTaskHandle = nullptr;
+  // Lends the refresh task's bus out while the panel is busy
+  TaskHandle_t busyWatchHandle = nullptr;
+  std::atomic<bool> inRefreshCall{false};
+  // Held while an asynchronous refresh is queued or running
+  SemaphoreHandle_t refreshIdle = nullptr;
+  // Given by the refresh task once it holds the bus for the refresh it was handed
+  SemaphoreHandle_t refreshOnBus = nullptr;
+  std::atomic<bool> refreshing{false};
+  AsyncRefresh asyncRefresh = AsyncRefresh::BUFFER;
+  RefreshMode asyncMode = RefreshMode::FAST_REFRESH;
+  bool asyncTurnOffScreen = false;
+  std::function<void()> asyncDone;
+
+  void startRefresh(AsyncRefresh refresh, RefreshMode mode, bool turnOffScreen, std::function<void()> onDone);
+  static void refreshTaskTrampoline(void* param);
+  [[noreturn]] void refreshTaskLoop();
+  static void busyWatchTrampoline(void* param);
+  [[noreturn]] void busyWatchLoop();
 };
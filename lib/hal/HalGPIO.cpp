@@ -1,25 +1,49 @@
 #include <HalGPIO.h>
+#include <HalSpiBus.h>
 #include <SPI.h>
 #include <esp_sleep.h>
 
 void HalGPIO::begin() {
   inputMgr.begin();
   SPI.begin(EPD_SCLK, SPI_MISO, EPD_MOSI, EPD_CS);
+  HalSpiBus::begin();
   pinMode(BAT_GPIO0, INPUT);
   pinMode(UART0_RXD, INPUT);
 }
 
-void HalGPIO::update() { inputMgr.update(); }
+void HalGPIO::update() {
+  inputMgr.update();
+  pressedEvents = polledPresses;
+  releasedEvents = polledReleases;
+  polledPresses = 0;
+  polledReleases = 0;
+  for (uint8_t button = BTN_BACK; button <= BTN_POWER; button++) {
+    pressedEvents |= inputMgr.wasPressed(button) << button;
+    releasedEvents |= inputMgr.wasReleased(button) << button;
+  }
+}
+
+bool HalGPIO::pollInput() {
+  // The InputManager reports an edge only to the update() that sees it, so what this one sees is kept for the loop
+  inputMgr.update();
+  bool down = false;
+  for (uint8_t button = BTN_BACK; button <= BTN_POWER; button++) {
+    polledPresses |= inputMgr.wasPressed(button) << button;
+    polledReleases |= inputMgr.wasReleased(button) << button;
+    down = down || inputMgr.isPressed(button);
+  }
+  return down || polledPresses != 0 || polledReleases != 0;
+}
 
 bool HalGPIO::isPressed(uint8_t buttonIndex) const { return inputMgr.isPressed(buttonIndex); }
 
-bool HalGPIO::wasPressed(uint8_t buttonIndex) const { return inputMgr.wasPressed(buttonIndex); }
+bool HalGPIO::wasPressed(uint8_t buttonIndex) const { return pressedEvents >> buttonIndex & 1; }
 
-bool HalGPIO::wasAnyPressed() const { return inputMgr.wasAnyPressed(); }
+bool HalGPIO::wasAnyPressed() const { return pressedEvents != 0; }
 
-bool HalGPIO::wasReleased(uint8_t buttonIndex) const { return inputMgr.wasReleased(buttonIndex); }
+bool HalGPIO::wasReleased(uint8_t buttonIndex) const { return releasedEvents >> buttonIndex & 1; }
 
-bool HalGPIO::wasAnyReleased() const { return inputMgr.wasAnyReleased(); }
+bool HalGPIO::wasAnyReleased() const { return releasedEvents != 0; }
 
 unsigned long HalGPIO::getHeldTime() const { return inputMgr.getHeldTime(); }
 
@@ -22,6 +22,11 @@ class HalGPIO {
 #if CROSSPOINT_EMULATED == 0
   InputManager inputMgr;
 #endif
+  // Button events of the current loop as bit masks, and those pollInput() saw since, held for the next update()
+  uint8_t pressedEvents = 0;
+  uint8_t releasedEvents = 0;
+  uint8_t polledPresses = 0;
+  uint8_t polledReleases = 0;
 
  public:
   HalGPIO() = default;
@@ -37,6 +42,9 @@ class HalGPIO {
   bool wasReleased(uint8_t buttonIndex) const;
   bool wasAnyReleased() const;
   unsigned long getHeldTime() const;
+  // Reads the buttons between two update() calls, e.g. from a long background step, without losing their events;
+  // true if any button was pressed or released since the last update() or is down
+  bool pollInput();
 
   // Setup wake up GPIO and enter deep sleep
   void startDeepSleep();
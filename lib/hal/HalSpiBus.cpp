@@ -0,0 +1,71 @@
+#include "HalSpiBus.h"
+
+SemaphoreHandle_t HalSpiBus::token = nullptr;
+TaskHandle_t HalSpiBus::owner = nullptr;
+uint32_t HalSpiBus::depth = 0;
+
+void HalSpiBus::begin() {
+  if (!token) {
+    token = xSemaphoreCreateBinary();
+    if (token) {
+      xSemaphoreGive(token);
+    }
+  }
+}
+
+bool HalSpiBus::take(const TickType_t ticks) {
+  const TaskHandle_t self = xTaskGetCurrentTaskHandle();
+  // Only this task sets the owner to itself, so the check needs no lock
+  if (owner == self) {
+    depth++;
+    return true;
+  }
+  if (xSemaphoreTake(token, ticks) != pdTRUE) {
+    return false;
+  }
+  owner = self;
+  depth = 1;
+  return true;
+}
+
+void HalSpiBus::give() {
+  if (--depth == 0) {
+    owner = nullptr;
+    xSemaphoreGive(token);
+  }
+}
+
+uint32_t HalSpiBus::lend(const TaskHandle_t holder) {
+  if (!token || owner != holder) {
+    return 0;
+  }
+  const uint32_t lent = depth;
+  depth = 0;
+  owner = nullptr;
+  xSemaphoreGive(token);
+  return lent;
+}
+
+void HalSpiBus::reclaim(const TaskHandle_t holder, const uint32_t lentDepth) {
+  if (lentDepth == 0) {
+    return;
+  }
+  xSemaphoreTake(token, portMAX_DELAY);
+  owner = holder;
+  depth = lentDepth;
+}
+
+HalSpiBus::Lock::Lock(const uint32_t timeoutMs) {
+  if (!token) {
+    owned = true;
+    return;
+  }
+  taken = take(timeoutMs == UINT32_MAX ? portMAX_DELAY : pdMS_TO_TICKS(timeoutMs));
+  owned = taken;
+}
+
+HalSpiBus::Lock::~Lock() {
+  if (taken) {
+    give();
+  }
+}
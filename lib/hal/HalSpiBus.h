@@ -0,0 +1,46 @@
+#pragma once
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#include <cstdint>
+
+// The SD card and the display share one SPI bus (HalGPIO.h), and the display driver gives no word on where it lets go
+// of it, so whoever talks to either holds the bus for the whole exchange: the display for each driver call, HalStorage
+// for each call, and code that reads or writes an open file while a refresh may run. An asynchronous refresh lends the
+// bus out while the panel runs its waveform and takes it back when the panel is done (HalDisplay.cpp), so file work
+// that does not hold it could be cut into. Recursive, so a holder may call into HalStorage. Before begin() it is not
+// held, as only one task runs then.
+class HalSpiBus {
+ public:
+  // Holds the bus for its scope; given a timeout, check owns() before using the bus
+  class Lock {
+   public:
+    explicit Lock(uint32_t timeoutMs = UINT32_MAX);
+    ~Lock();
+    Lock(const Lock&) = delete;
+    Lock& operator=(const Lock&) = delete;
+
+    bool owns() const { return owned; }
+
+   private:
+    bool owned = false;
+    bool taken = false;
+  };
+
+  static void begin();
+
+  // Lets others have the bus that suspended task `holder` holds, and takes it back for the task before it is resumed.
+  // lend() returns what reclaim() needs. Only for a holder that cannot touch the bus until it is resumed.
+  static uint32_t lend(TaskHandle_t holder);
+  static void reclaim(TaskHandle_t holder, uint32_t depth);
+
+ private:
+  // A binary semaphore with the owner kept here, as a FreeRTOS mutex can only be given by the task that took it
+  static SemaphoreHandle_t token;
+  static TaskHandle_t owner;
+  static uint32_t depth;
+
+  static bool take(TickType_t ticks);
+  static void give();
+};
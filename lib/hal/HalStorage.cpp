@@ -2,43 +2,78 @@
 
 #include <SDCardManager.h>
 
+#include "HalSpiBus.h"
+
 #define SDCard SDCardManager::getInstance()
 
 HalStorage HalStorage::instance;
 
 HalStorage::HalStorage() {}
 
-bool HalStorage::begin() { return SDCard.begin(); }
+bool HalStorage::begin() {
+  HalSpiBus::Lock bus;
+  return SDCard.begin();
+}
 
 bool HalStorage::ready() const { return SDCard.ready(); }
 
-std::vector<String> HalStorage::listFiles(const char* path, int maxFiles) { return SDCard.listFiles(path, maxFiles); }
+std::vector<String> HalStorage::listFiles(const char* path, int maxFiles) {
+  HalSpiBus::Lock bus;
+  return SDCard.listFiles(path, maxFiles);
+}
 
-String HalStorage::readFile(const char* path) { return SDCard.readFile(path); }
+String HalStorage::readFile(const char* path) {
+  HalSpiBus::Lock bus;
+  return SDCard.readFile(path);
+}
 
 bool HalStorage::readFileToStream(const char* path, Print& out, size_t chunkSize) {
+  HalSpiBus::Lock bus;
   return SDCard.readFileToStream(path, out, chunkSize);
 }
 
 size_t HalStorage::readFileToBuffer(const char* path, char* buffer, size_t bufferSize, size_t maxBytes) {
+  HalSpiBus::Lock bus;
   return SDCard.readFileToBuffer(path, buffer, bufferSize, maxBytes);
 }
 
-bool HalStorage::writeFile(const char* path, const String& content) { return SDCard.writeFile(path, content); }
+bool HalStorage::writeFile(const char* path, const String& content) {
+  HalSpiBus::Lock bus;
+  return SDCard.writeFile(path, content);
+}
 
-bool HalStorage::ensureDirectoryExists(const char* path) { return SDCard.ensureDirectoryExists(path); }
+bool HalStorage::ensureDirectoryExists(const char* path) {
+  HalSpiBus::Lock bus;
+  return SDCard.ensureDirectoryExists(path);
+}
 
-FsFile HalStorage::open(const char* path, const oflag_t oflag) { return SDCard.open(path, oflag); }
+FsFile HalStorage::open(const char* path, const oflag_t oflag) {
+  HalSpiBus::Lock bus;
+  return SDCard.open(path, oflag);
+}
 
-bool HalStorage::mkdir(const char* path, const bool pFlag) { return SDCard.mkdir(path, pFlag); }
+bool HalStorage::mkdir(const char* path, const bool pFlag) {
+  HalSpiBus::Lock bus;
+  return SDCard.mkdir(path, pFlag);
+}
 
-bool HalStorage::exists(const char* path) { return SDCard.exists(path); }
+bool HalStorage::exists(const char* path) {
+  HalSpiBus::Lock bus;
+  return SDCard.exists(path);
+}
 
-bool HalStorage::remove(const char* path) { return SDCard.remove(path); }
+bool HalStorage::remove(const char* path) {
+  HalSpiBus::Lock bus;
+  return SDCard.remove(path);
+}
 
-bool HalStorage::rmdir(const char* path) { return SDCard.rmdir(path); }
+bool HalStorage::rmdir(const char* path) {
+  HalSpiBus::Lock bus;
+  return SDCard.rmdir(path);
+}
 
 bool HalStorage::openFileForRead(const char* moduleName, const char* path, FsFile& file) {
+  HalSpiBus::Lock bus;
   return SDCard.openFileForRead(moduleName, path, file);
 }
 
@@ -51,6 +86,7 @@ bool HalStorage::openFileForRead(const char* moduleName, const String& path, FsF
 }
 
 bool HalStorage::openFileForWrite(const char* moduleName, const char* path, FsFile& file) {
+  HalSpiBus::Lock bus;
   return SDCard.openFileForWrite(moduleName, path, file);
 }
 
@@ -62,4 +98,7 @@ bool HalStorage::openFileForWrite(const char* moduleName, const String& path, Fs
   return openFileForWrite(moduleName, path.c_str(), file);
 }
 
-bool HalStorage::removeDir(const char* path) { return SDCard.removeDir(path); }
\ No newline at end of file
+bool HalStorage::removeDir(const char* path) {
+  HalSpiBus::Lock bus;
+  return SDCard.removeDir(path);
+}
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include <vector>
 
+// Each call that reaches the card holds the SPI bus (HalSpiBus.h); reading or writing a returned FsFile does not
 class HalStorage {
  public:
   HalStorage();
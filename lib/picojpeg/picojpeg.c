@@ -18,6 +18,7 @@ typedef unsigned char uint8;
 typedef unsigned short uint16;
 typedef signed char int8;
 typedef signed short int16;
+typedef signed long int32;
 //------------------------------------------------------------------------------
 #if PJPG_RIGHT_SHIFT_IS_ALWAYS_UNSIGNED
 static int16 replicateSignBit16(int8 n) {
@@ -1725,184 +1726,80 @@ static void transformBlock(uint8 mcuBlock) {
   }
 }
 //------------------------------------------------------------------------------
-static void transformBlockReduce(uint8 mcuBlock) {
-  uint8 c = clamp(PJPG_DESCALE(gCoeffBuf[0]) + 128);
-  int16 cbG, cbB, crR, crG;
+// Reduced-size IDCT basis: M[n][u] = C(u) * cos((2n+1)u*pi/2N) / (2 * a(u)) in 4.12 fixed point, where a(u) is the
+// Winograd scale already folded into the quantization tables (a(0) = 1, a(u) = sqrt(2) * cos(u*pi/16)). Keeping the
+// 8-point normalization means the DC level matches the full-size decode.
+static const int16 gReduceBasis2[2 * 2] = {1448, 1044, 1448, -1044};
+static const int16 gReduceBasis4[4 * 4] = {1448, 1364, 1108, 667,   1448, 565,  -1108, -1609,
+                                           1448, -565, -1108, 1609, 1448, -1364, 1108, -667};
+
+static uint8 reduceBlockSize(void) {
+  switch (gReduce) {
+    case PJPG_REDUCE_1_8:
+      return 1;
+    case PJPG_REDUCE_1_4:
+      return 2;
+    case PJPG_REDUCE_1_2:
+      return 4;
+    default:
+      return 8;
+  }
+}
 
+// Offset of a luma block inside the MCU buffers (see pjpeg_image_info_t for the layout)
+static uint8 lumaBlockOffset(uint8 mcuBlock) {
   switch (gScanType) {
-    case PJPG_GRAYSCALE: {
-      // MCU size: 1, 1 block per MCU
-      gMCUBufR[0] = c;
-      break;
-    }
-    case PJPG_YH1V1: {
-      // MCU size: 8x8, 3 blocks per MCU
-      switch (mcuBlock) {
-        case 0: {
-          gMCUBufR[0] = c;
-          gMCUBufG[0] = c;
-          gMCUBufB[0] = c;
-          break;
-        }
-        case 1: {
-          cbG = ((c * 88U) >> 8U) - 44U;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], cbG);
-
-          cbB = (c + ((c * 198U) >> 8U)) - 227U;
-          gMCUBufB[0] = addAndClamp(gMCUBufB[0], cbB);
-          break;
-        }
-        case 2: {
-          crR = (c + ((c * 103U) >> 8U)) - 179;
-          gMCUBufR[0] = addAndClamp(gMCUBufR[0], crR);
-
-          crG = ((c * 183U) >> 8U) - 91;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], crG);
-          break;
-        }
-      }
-
-      break;
-    }
-    case PJPG_YH1V2: {
-      // MCU size: 8x16, 4 blocks per MCU
-      switch (mcuBlock) {
-        case 0: {
-          gMCUBufR[0] = c;
-          gMCUBufG[0] = c;
-          gMCUBufB[0] = c;
-          break;
-        }
-        case 1: {
-          gMCUBufR[128] = c;
-          gMCUBufG[128] = c;
-          gMCUBufB[128] = c;
-          break;
-        }
-        case 2: {
-          cbG = ((c * 88U) >> 8U) - 44U;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], cbG);
-          gMCUBufG[128] = subAndClamp(gMCUBufG[128], cbG);
-
-          cbB = (c + ((c * 198U) >> 8U)) - 227U;
-          gMCUBufB[0] = addAndClamp(gMCUBufB[0], cbB);
-          gMCUBufB[128] = addAndClamp(gMCUBufB[128], cbB);
-
-          break;
-        }
-        case 3: {
-          crR = (c + ((c * 103U) >> 8U)) - 179;
-          gMCUBufR[0] = addAndClamp(gMCUBufR[0], crR);
-          gMCUBufR[128] = addAndClamp(gMCUBufR[128], crR);
-
-          crG = ((c * 183U) >> 8U) - 91;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], crG);
-          gMCUBufG[128] = subAndClamp(gMCUBufG[128], crG);
-
-          break;
-        }
-      }
-      break;
-    }
-    case PJPG_YH2V1: {
-      // MCU size: 16x8, 4 blocks per MCU
-      switch (mcuBlock) {
-        case 0: {
-          gMCUBufR[0] = c;
-          gMCUBufG[0] = c;
-          gMCUBufB[0] = c;
-          break;
-        }
-        case 1: {
-          gMCUBufR[64] = c;
-          gMCUBufG[64] = c;
-          gMCUBufB[64] = c;
-          break;
-        }
-        case 2: {
-          cbG = ((c * 88U) >> 8U) - 44U;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], cbG);
-          gMCUBufG[64] = subAndClamp(gMCUBufG[64], cbG);
-
-          cbB = (c + ((c * 198U) >> 8U)) - 227U;
-          gMCUBufB[0] = addAndClamp(gMCUBufB[0], cbB);
-          gMCUBufB[64] = addAndClamp(gMCUBufB[64], cbB);
+    case PJPG_YH1V2:
+      return (uint8)(mcuBlock * 128);
+    case PJPG_YH2V1:
+    case PJPG_YH2V2:
+      return (uint8)(mcuBlock * 64);
+    default:
+      return 0;
+  }
+}
 
-          break;
-        }
-        case 3: {
-          crR = (c + ((c * 103U) >> 8U)) - 179;
-          gMCUBufR[0] = addAndClamp(gMCUBufR[0], crR);
-          gMCUBufR[64] = addAndClamp(gMCUBufR[64], crR);
+static void transformBlockReduce(uint8 mcuBlock) {
+  uint8 n = reduceBlockSize();
+  uint8 ofs, x, y, u, v;
+  const int16* pBasis;
+  int32 tmp[4 * 4];
+
+  // Chroma is entropy decoded to stay in sync but otherwise ignored
+  if (gMCUOrg[mcuBlock] != 0) return;
+
+  ofs = lumaBlockOffset(mcuBlock);
+
+  if (n == 1) {
+    uint8 c = clamp(PJPG_DESCALE(gCoeffBuf[0]) + 128);
+    gMCUBufR[ofs] = c;
+    gMCUBufG[ofs] = c;
+    gMCUBufB[ofs] = c;
+    return;
+  }
 
-          crG = ((c * 183U) >> 8U) - 91;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], crG);
-          gMCUBufG[64] = subAndClamp(gMCUBufG[64], crG);
+  pBasis = (n == 2) ? gReduceBasis2 : gReduceBasis4;
 
-          break;
-        }
-      }
-      break;
+  // Rows: tmp[v][x] = sum_u M[x][u] * coeff[v][u]
+  for (v = 0; v < n; v++) {
+    for (x = 0; x < n; x++) {
+      int32 sum = 0;
+      for (u = 0; u < n; u++) sum += (int32)pBasis[x * n + u] * gCoeffBuf[v * 8 + u];
+      tmp[v * 4 + x] = (sum + (1 << 11)) >> 12;
     }
-    case PJPG_YH2V2: {
-      // MCU size: 16x16, 6 blocks per MCU
-      switch (mcuBlock) {
-        case 0: {
-          gMCUBufR[0] = c;
-          gMCUBufG[0] = c;
-          gMCUBufB[0] = c;
-          break;
-        }
-        case 1: {
-          gMCUBufR[64] = c;
-          gMCUBufG[64] = c;
-          gMCUBufB[64] = c;
-          break;
-        }
-        case 2: {
-          gMCUBufR[128] = c;
-          gMCUBufG[128] = c;
-          gMCUBufB[128] = c;
-          break;
-        }
-        case 3: {
-          gMCUBufR[192] = c;
-          gMCUBufG[192] = c;
-          gMCUBufB[192] = c;
-          break;
-        }
-        case 4: {
-          cbG = ((c * 88U) >> 8U) - 44U;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], cbG);
-          gMCUBufG[64] = subAndClamp(gMCUBufG[64], cbG);
-          gMCUBufG[128] = subAndClamp(gMCUBufG[128], cbG);
-          gMCUBufG[192] = subAndClamp(gMCUBufG[192], cbG);
-
-          cbB = (c + ((c * 198U) >> 8U)) - 227U;
-          gMCUBufB[0] = addAndClamp(gMCUBufB[0], cbB);
-          gMCUBufB[64] = addAndClamp(gMCUBufB[64], cbB);
-          gMCUBufB[128] = addAndClamp(gMCUBufB[128], cbB);
-          gMCUBufB[192] = addAndClamp(gMCUBufB[192], cbB);
-
-          break;
-        }
-        case 5: {
-          crR = (c + ((c * 103U) >> 8U)) - 179;
-          gMCUBufR[0] = addAndClamp(gMCUBufR[0], crR);
-          gMCUBufR[64] = addAndClamp(gMCUBufR[64], crR);
-          gMCUBufR[128] = addAndClamp(gMCUBufR[128], crR);
-          gMCUBufR[192] = addAndClamp(gMCUBufR[192], crR);
-
-          crG = ((c * 183U) >> 8U) - 91;
-          gMCUBufG[0] = subAndClamp(gMCUBufG[0], crG);
-          gMCUBufG[64] = subAndClamp(gMCUBufG[64], crG);
-          gMCUBufG[128] = subAndClamp(gMCUBufG[128], crG);
-          gMCUBufG[192] = subAndClamp(gMCUBufG[192], crG);
+  }
 
-          break;
-        }
-      }
-      break;
+  // Columns, then descale and level shift
+  for (y = 0; y < n; y++) {
+    for (x = 0; x < n; x++) {
+      int32 sum = 0;
+      uint8 c;
+      for (v = 0; v < n; v++) sum += (int32)pBasis[y * n + v] * tmp[v * 4 + x];
+      // Coefficients carry a factor of 16 from the Winograd quantization tables
+      c = clamp((int16)((sum + (1 << 15)) >> 16) + 128);
+      gMCUBufR[ofs + y * 8 + x] = c;
+      gMCUBufG[ofs + y * 8 + x] = c;
+      gMCUBufB[ofs + y * 8 + x] = c;
     }
   }
 }
@@ -1942,22 +1839,36 @@ static uint8 decodeNextMCU(void) {
     compACTab = gCompACTab[componentID];
 
     if (gReduce) {
-      // Decode, but throw out the AC coefficients in reduce mode.
+      // Decode, but only keep the low-frequency AC coefficients the reduced IDCT uses
+      uint8 n = reduceBlockSize();
+      uint8 i;
+
+      for (i = 0; i < n; i++) {
+        for (k = (i == 0) ? 1 : 0; k < n; k++) gCoeffBuf[i * 8 + k] = 0;
+      }
+
       for (k = 1; k < 64; k++) {
+        uint16 extraBits = 0;
+
         s = huffDecode(compACTab ? &gHuffTab3 : &gHuffTab2, compACTab ? gHuffVal3 : gHuffVal2);
 
         numExtraBits = s & 0xF;
-        if (numExtraBits) getBits2(numExtraBits);
+        if (numExtraBits) extraBits = getBits2(numExtraBits);
 
         r = s >> 4;
         s &= 15;
 
         if (s) {
+          uint8 z;
+
           if (r) {
             if ((k + r) > 63) return PJPG_DECODE_ERROR;
 
             k = (uint8)(k + r);
           }
+
+          z = ZAG[k];
+          if ((z & 7) < n && (z >> 3) < n) gCoeffBuf[z] = huffExtend(extraBits, s) * pQ[k];
         } else {
           if (r == 15) {
             if ((k + 16) > 64) return PJPG_DECODE_ERROR;
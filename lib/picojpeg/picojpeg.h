@@ -105,10 +105,20 @@ typedef struct {
 typedef unsigned char (*pjpeg_need_bytes_callback_t)(unsigned char* pBuf, unsigned char buf_size,
                                                      unsigned char* pBytes_actually_read, void* pCallback_data);
 
+// Reduced-resolution decode modes for pjpeg_decode_init()'s reduce parameter
+enum {
+  PJPG_REDUCE_NONE = 0,  // Full 8x8 pixels per block
+  PJPG_REDUCE_1_8 = 1,   // DC only, 1x1 pixel per block
+  PJPG_REDUCE_1_4 = 2,   // 2x2 pixels per block from the 2x2 lowest frequencies
+  PJPG_REDUCE_1_2 = 3,   // 4x4 pixels per block from the 4x4 lowest frequencies
+};
+
 // Initializes the decompressor. Returns 0 on success, or one of the above error codes on failure.
 // pNeed_bytes_callback will be called to fill the decompressor's internal input buffer.
-// If reduce is 1, only the first pixel of each block will be decoded. This mode is much faster because it skips the AC
-// dequantization, IDCT and chroma upsampling of every image pixel. Not thread safe.
+// If reduce is one of the PJPG_REDUCE_1_* modes, each block is decoded to 1x1, 2x2 or 4x4 pixels stored in the top-left
+// corner of its usual 8x8 area of the MCU buffers. These modes are much faster because they skip most of the AC
+// dequantization and IDCT work and all chroma upsampling; colour images are returned as luma only (R = G = B = Y).
+// Not thread safe.
 unsigned char pjpeg_decode_init(pjpeg_image_info_t* pInfo, pjpeg_need_bytes_callback_t pNeed_bytes_callback,
                                 void* pCallback_data, unsigned char reduce);
 
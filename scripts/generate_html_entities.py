@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Generate the HTML named character reference table used by lib/Epub/Epub/htmlEntities.cpp.
+
+The names come from Python's copy of the WHATWG list (html.entities.html5). Only the forms terminated by ';' are
+kept; the legacy forms without it never reach the decoder. The table is laid out as a minimal perfect hash
+(hash and displace): a first hash picks a bucket, the bucket's displacement seeds a second hash that picks the slot,
+and every slot holds exactly one entity, so a lookup is two hashes of the name and one compare.
+"""
+
+from __future__ import annotations
+
+import argparse
+import html.entities
+import pathlib
+
+FNV_OFFSET = 2166136261
+FNV_PRIME = 16777619
+MASK = 0xFFFFFFFF
+KEYS_PER_BUCKET = 4
+
+
+def entity_hash(name: bytes, seed: int) -> int:
+    # Must match html_entities::hash() in the generated header.
+    h = FNV_OFFSET ^ seed
+    for b in name:
+        h ^= b
+        h = (h * FNV_PRIME) & MASK
+    h ^= h >> 15
+    h = (h * 0x2C1B3C6D) & MASK
+    h ^= h >> 12
+    return h
+
+
+def build_table(names: list[bytes]) -> tuple[list[int], list[bytes]]:
+    count = len(names)
+    bucket_count = (count + KEYS_PER_BUCKET - 1) // KEYS_PER_BUCKET
+    buckets: list[list[bytes]] = [[] for _ in range(bucket_count)]
+    for name in names:
+        buckets[entity_hash(name, 0) % bucket_count].append(name)
+
+    displacements = [0] * bucket_count
+    slots: list[bytes | None] = [None] * count
+    # Place the largest buckets first while most slots are still free
+    for index in sorted(range(bucket_count), key=lambda i: -len(buckets[i])):
+        bucket = buckets[index]
+        if not bucket:
+            continue
+        seed = 1
+        while True:
+            wanted = [entity_hash(name, seed) % count for name in bucket]
+            if len(set(wanted)) == len(wanted) and all(slots[s] is None for s in wanted):
+                break
+            seed += 1
+            if seed > 0xFFFF:
+                raise SystemExit(f"no displacement found for bucket {index}")
+        displacements[index] = seed
+        for name, slot in zip(bucket, wanted):
+            slots[slot] = name
+    return displacements, slots  # type: ignore[return-value]
+
+
+def format_list(values: list[str], per_line: int) -> str:
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def write_header(path: pathlib.Path) -> None:
+    entities = {name[:-1].encode("ascii"): value.encode("utf-8")
+                for name, value in html.entities.html5.items() if name.endswith(";")}
+    names = sorted(entities)
+    displacements, slots = build_table(names)
+
+    # Names are packed back to back; values are NUL-terminated and shared between aliases
+    name_blob = b"".join(slots)
+    name_offsets = {}
+    offset = 0
+    for name in slots:
+        name_offsets[name] = offset
+        offset += len(name)
+
+    value_blob = bytearray()
+    value_offsets: dict[bytes, int] = {}
+    for name in names:
+        value = entities[name]
+        if value not in value_offsets:
+            value_offsets[value] = len(value_blob)
+            value_blob += value + b"\0"
+
+    max_name = max(len(name) for name in names)
+    max_value = max(len(value) for value in entities.values())
+    assert len(name_blob) <= 0xFFFF and len(value_blob) <= 0xFFFF and max_name <= 0xFF
+
+    name_lines = []
+    for i in range(0, len(name_blob), 100):
+        name_lines.append('    "' + name_blob[i : i + 100].decode("ascii") + '"')
+    entity_rows = [f"{{{name_offsets[name]}, {value_offsets[entities[name]]}, {len(name)}}}" for name in slots]
+
+    content = f"""#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Auto-generated by generate_html_entities.py. Do not edit manually.
+// {len(names)} HTML named character references laid out as a minimal perfect hash (see the script for details).
+namespace html_entities {{
+
+constexpr size_t ENTITY_COUNT = {len(names)};
+constexpr size_t BUCKET_COUNT = {len(displacements)};
+constexpr size_t MAX_NAME_LENGTH = {max_name};
+constexpr size_t MAX_VALUE_LENGTH = {max_value};
+
+struct Entity {{
+  uint16_t nameOffset;   // Into NAMES, no '&' or ';'
+  uint16_t valueOffset;  // Into VALUES, NUL-terminated UTF-8
+  uint8_t nameLength;
+}};
+
+constexpr uint32_t hash(const char* name, const size_t len, const uint32_t seed) {{
+  uint32_t h = {FNV_OFFSET}u ^ seed;
+  for (size_t i = 0; i < len; ++i) {{
+    h ^= static_cast<uint8_t>(name[i]);
+    h *= {FNV_PRIME}u;
+  }}
+  h ^= h >> 15;
+  h *= 0x2C1B3C6Du;
+  h ^= h >> 12;
+  return h;
+}}
+
+constexpr char NAMES[] =
+{chr(10).join(name_lines)};
+
+constexpr uint8_t VALUES[] = {{
+{format_list([f"0x{b:02X}" for b in value_blob], 16)}
+}};
+
+// Indexed by slot
+constexpr Entity ENTITIES[] = {{
+{format_list(entity_rows, 6)}
+}};
+
+// Second-hash seed per first-hash bucket
+constexpr uint16_t DISPLACEMENTS[] = {{
+{format_list([str(d) for d in displacements], 16)}
+}};
+
+}}  // namespace html_entities
+"""
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_text(content)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    default_output = pathlib.Path(__file__).resolve().parent.parent / "lib/Epub/Epub/generated/html-entities.h"
+    parser.add_argument("--output", type=pathlib.Path, default=default_output,
+                        help="Destination header path")
+    args = parser.parse_args()
+    write_header(args.output)
+    print(f'wrote {args.output}')
+
+
+if __name__ == "__main__":
+    main()
@@ -1,10 +1,31 @@
 #!/usr/bin/env python3
-"""Embed hypher-generated `.bin` tries into constexpr headers."""
+"""Embed hypher-generated `.bin` tries into constexpr headers.
+
+Next to each hyph-<lang>.trie.h a hyph-<lang>.dense.h is written with direct-indexed transition tables for the top
+levels of the trie, where every Liang walk starts and where nodes have the most children. The number of levels is
+the largest that fits the flash budget (--dense-budget); deeper nodes keep the compact encoding.
+
+With --sd the tries are instead written as dictionaries for the SD card (/hyphenation/<tag>.bin), which the reader
+loads on demand through a small page cache: a short header carrying the script and the prefix/suffix minima, then
+the blob with its nodes rewritten in depth-first order.
+"""
 
 from __future__ import annotations
 
 import argparse
 import pathlib
+import struct
+
+# Must match DenseHyphenationLevels in SerializedHyphenationTrie.h
+DENSE_ROW_FLAG = 0x80000000
+DENSE_ROW_BYTES = 4
+DEFAULT_DENSE_BUDGET = 8192
+
+# Must match HyphenationTrieFile: header layout and the largest node a single cache page can hold
+SD_MAGIC = b'HYPH'
+SD_VERSION = 1
+SD_SCRIPTS = {'latin': 0, 'cyrillic': 1}
+SD_MAX_NODE_BYTES = 448
 
 
 def _format_bytes(blob: bytes, per_line: int = 16) -> str:
@@ -18,6 +39,10 @@ def _format_bytes(blob: bytes, per_line: int = 16) -> str:
     return '\n'.join(lines)
 
 
+def _format_list(values: list[str], per_line: int) -> str:
+    return '\n'.join("    " + ", ".join(values[i : i + per_line]) + "," for i in range(0, len(values), per_line))
+
+
 def _symbol_from_output(path: pathlib.Path) -> str:
     # Derive a stable C identifier from the destination header name (e.g., hyph-en.trie.h -> en).
     name = path.name
@@ -31,6 +56,230 @@ def _symbol_from_output(path: pathlib.Path) -> str:
     return name
 
 
+def _decode_node(blob: bytes, addr: int) -> tuple[int, int, list[tuple[int, int]]]:
+    # Mirrors decodeState() in LiangHyphenation.cpp: returns (levels offset, levels count, [(byte, child addr)]).
+    header = blob[addr]
+    pos = addr + 1
+    stride = (header >> 5) & 0x03 or 1
+    child_count = header & 0x1F
+    if child_count == 31:
+        child_count = blob[pos]
+        pos += 1
+    levels_offset = levels_len = 0
+    if header >> 7:
+        levels_offset = (blob[pos] << 4) | (blob[pos + 1] >> 4)
+        levels_len = blob[pos + 1] & 0x0F
+        pos += 2
+    transitions = blob[pos : pos + child_count]
+    pos += child_count
+    children = []
+    for i, letter in enumerate(transitions):
+        raw = int.from_bytes(blob[pos + i * stride : pos + (i + 1) * stride], 'big')
+        if stride == 1:
+            delta = raw - 0x100 if raw & 0x80 else raw
+        elif stride == 2:
+            delta = raw - 0x10000 if raw & 0x8000 else raw
+        else:
+            delta = raw - (1 << 23)
+        children.append((letter, addr + delta))
+    return levels_offset, levels_len, children
+
+
+def build_dense_levels(blob: bytes, budget: int) -> tuple[int, list[int], list[list[int]], list[tuple[int, int]]]:
+    # Returns (depth, columns, table rows, row levels) for the deepest top-level slice of the trie within budget.
+    root = int.from_bytes(blob[:4], 'big')
+    best = None
+    depth = 0
+    while True:
+        depth += 1
+        # Rows are the distinct nodes reachable in fewer than `depth` steps, in breadth-first order
+        rows = [root]
+        row_of = {root: 0}
+        frontier = [root]
+        for _ in range(depth - 1):
+            next_frontier = []
+            for addr in frontier:
+                for _, child in _decode_node(blob, addr)[2]:
+                    if child not in row_of:
+                        row_of[child] = len(rows)
+                        rows.append(child)
+                        next_frontier.append(child)
+            frontier = next_frontier
+        columns = sorted({letter for addr in rows for letter, _ in _decode_node(blob, addr)[2]})
+        size = 256 + len(rows) * len(columns) * 4 + len(rows) * DENSE_ROW_BYTES
+        if size > budget and best is not None:
+            return best
+        column_of = {letter: i for i, letter in enumerate(columns)}
+        table = []
+        levels = []
+        for addr in rows:
+            levels_offset, levels_len, children = _decode_node(blob, addr)
+            entries = [0] * len(columns)
+            for letter, child in children:
+                entries[column_of[letter]] = DENSE_ROW_FLAG | row_of[child] if child in row_of else child
+            table.append(entries)
+            levels.append((levels_offset, levels_len))
+        best = (depth, columns, table, levels)
+        if not frontier:
+            return best  # The whole trie fits
+
+
+def write_dense_header(path: pathlib.Path, blob: bytes, symbol: str, budget: int) -> int:
+    # Emit the dense top levels for the trie in the matching .trie.h; returns the table size in bytes.
+    depth, columns, table, levels = build_dense_levels(blob, budget)
+    symbols = [0] * 256
+    for i, letter in enumerate(columns):
+        symbols[letter] = i + 1
+    entries = [f"0x{value:08X}" for row in table for value in row]
+    rows = [f"{{{offset}, {count}}}" for offset, count in levels]
+    size = 256 + len(entries) * 4 + len(rows) * DENSE_ROW_BYTES
+    content = f"""#pragma once
+
+#include <cstdint>
+
+#include "../SerializedHyphenationTrie.h"
+
+// Auto-generated by generate_hyphenation_trie.py. Do not edit manually.
+// Top {depth} level(s) of {symbol}_trie_data as dense transition tables: {len(rows)} rows x {len(columns)} columns,
+// {size} bytes (budget {budget}).
+constexpr uint8_t {symbol}_dense_columns[256] = {{
+{_format_bytes(bytes(symbols))}
+}};
+
+constexpr uint32_t {symbol}_dense_next[] = {{
+{_format_list(entries, 8)}
+}};
+
+constexpr DenseHyphenationRow {symbol}_dense_rows[] = {{
+{_format_list(rows, 8)}
+}};
+
+constexpr DenseHyphenationLevels {symbol}_dense = {{
+    {symbol}_dense_columns,
+    {symbol}_dense_next,
+    {symbol}_dense_rows,
+    {len(columns)},
+    {len(rows)},
+}};
+"""
+    path.write_text(content)
+    return size
+
+
+def _all_nodes(blob: bytes) -> dict[int, tuple[int, int, list[tuple[int, int]]]]:
+    # Every node reachable from the root, keyed by address.
+    nodes = {}
+    pending = [int.from_bytes(blob[:4], 'big')]
+    while pending:
+        addr = pending.pop()
+        if addr in nodes:
+            continue
+        nodes[addr] = _decode_node(blob, addr)
+        pending.extend(child for _, child in nodes[addr][2])
+    return nodes
+
+
+def _node_bytes(child_count: int, has_levels: bool, stride: int) -> int:
+    return 1 + (child_count >= 31) + 2 * has_levels + child_count * (1 + stride)
+
+
+def _stride_for(delta: int) -> int:
+    if -0x80 <= delta < 0x80:
+        return 1
+    if -0x8000 <= delta < 0x8000:
+        return 2
+    if -(1 << 23) <= delta < (1 << 23):
+        return 3
+    raise SystemExit(f'node delta {delta} does not fit 24 bits')
+
+
+def relayout_depth_first(blob: bytes) -> bytes:
+    # Rewrite the node heap in depth-first order. A Liang walk descends one path per start position, and with each
+    # subtree stored contiguously the deeper nodes of that path usually share a page of the reader's cache instead
+    # of each costing an SD read. The levels tape and every node's levels and transitions are kept as they are.
+    nodes = _all_nodes(blob)
+    root = int.from_bytes(blob[:4], 'big')
+    heap_start = min(nodes)
+    if any(offset + count > heap_start for offset, count, _ in nodes.values()):
+        raise SystemExit('levels tape overlaps the node heap')
+
+    order = []
+    seen = set()
+    pending = [root]
+    while pending:
+        addr = pending.pop()
+        if addr in seen:
+            continue
+        seen.add(addr)
+        order.append(addr)
+        pending.extend(child for _, child in reversed(nodes[addr][2]))
+
+    # Deltas depend on addresses and node sizes on deltas: widen strides until the layout is stable
+    strides = {addr: 1 for addr in order}
+    while True:
+        new_addr = {}
+        pos = heap_start
+        for addr in order:
+            new_addr[addr] = pos
+            pos += _node_bytes(len(nodes[addr][2]), blob[addr] >> 7, strides[addr])
+        widened = False
+        for addr in order:
+            needed = max([_stride_for(new_addr[child] - new_addr[addr]) for _, child in nodes[addr][2]], default=1)
+            if needed > strides[addr]:
+                strides[addr] = needed
+                widened = True
+        if not widened:
+            break
+
+    out = bytearray(new_addr[root].to_bytes(4, 'big') + blob[4:heap_start])
+    for addr in order:
+        _, _, children = nodes[addr]
+        has_levels = blob[addr] >> 7
+        stride = strides[addr]
+        out.append((has_levels << 7) | (stride << 5) | min(len(children), 31))
+        if len(children) >= 31:
+            out.append(len(children))
+        if has_levels:
+            levels_header = addr + 1 + ((blob[addr] & 0x1F) == 31)
+            out += blob[levels_header : levels_header + 2]
+        out += bytes(letter for letter, _ in children)
+        for _, child in children:
+            delta = new_addr[child] - new_addr[addr]
+            out += (delta + (1 << 23) if stride == 3 else delta & ((1 << (8 * stride)) - 1)).to_bytes(stride, 'big')
+    _check_same_trie(blob, bytes(out))
+    return bytes(out)
+
+
+def _check_same_trie(original: bytes, rewritten: bytes) -> None:
+    # Walk both tries in lockstep: same levels and the same transitions everywhere.
+    pending = [(int.from_bytes(original[:4], 'big'), int.from_bytes(rewritten[:4], 'big'))]
+    seen = set()
+    while pending:
+        a, b = pending.pop()
+        if a in seen:
+            continue
+        seen.add(a)
+        levels_a, count_a, children_a = _decode_node(original, a)
+        levels_b, count_b, children_b = _decode_node(rewritten, b)
+        if (levels_a, count_a) != (levels_b, count_b) or [c for c, _ in children_a] != [c for c, _ in children_b]:
+            raise SystemExit(f'relayout changed the node at {a}')
+        pending.extend((x, y) for (_, x), (_, y) in zip(children_a, children_b))
+
+
+def write_sd_dictionary(path: pathlib.Path, blob: bytes, script: str, min_prefix: int, min_suffix: int) -> int:
+    blob = relayout_depth_first(blob)
+    # The reader fetches each node as one window of its page cache, so no node may be larger than a window.
+    for addr, (_, _, children) in _all_nodes(blob).items():
+        header = blob[addr]
+        node_bytes = _node_bytes(len(children), header >> 7, ((header >> 5) & 3) or 1)
+        if node_bytes > SD_MAX_NODE_BYTES:
+            raise SystemExit(f'{path}: node at {addr} is {node_bytes} bytes, the reader handles {SD_MAX_NODE_BYTES}')
+    header = SD_MAGIC + struct.pack('<BBBBI', SD_VERSION, SD_SCRIPTS[script], min_prefix, min_suffix, len(blob))
+    path.parent.mkdir(parents=True, exist_ok=True)
+    path.write_bytes(header + blob)
+    return len(header) + len(blob)
+
+
 def write_header(path: pathlib.Path, blob: bytes, symbol: str) -> None:
     # Emit a constexpr header containing the raw bytes plus a SerializedHyphenationPatterns descriptor.
     path.parent.mkdir(parents=True, exist_ok=True)
@@ -62,7 +311,17 @@ def main() -> None:
     parser.add_argument('--input', dest='inputs', action='append', required=True,
                         help='Path to a hypher-generated .bin trie')
     parser.add_argument('--output', dest='outputs', action='append', required=True,
-                        help='Destination header path (hyph-*.trie.h)')
+                        help='Destination header path (hyph-*.trie.h), or dictionary path (<tag>.bin) with --sd')
+    parser.add_argument('--dense-budget', type=int, default=DEFAULT_DENSE_BUDGET,
+                        help='Flash bytes per language for the dense top levels (default %(default)s)')
+    parser.add_argument('--sd', action='store_true',
+                        help='Write SD card dictionaries instead of firmware headers')
+    parser.add_argument('--script', choices=sorted(SD_SCRIPTS), default='latin',
+                        help='Letters the dictionary hyphenates (--sd only, default %(default)s)')
+    parser.add_argument('--min-prefix', type=int, default=2,
+                        help='Minimum letters before a break (--sd only, default %(default)s)')
+    parser.add_argument('--min-suffix', type=int, default=2,
+                        help='Minimum letters after a break (--sd only, default %(default)s)')
     args = parser.parse_args()
 
     if len(args.inputs) != len(args.outputs):
@@ -73,9 +332,16 @@ def main() -> None:
         src_path = pathlib.Path(src)
         blob = src_path.read_bytes()
         out_path = pathlib.Path(dst)
+        if args.sd:
+            size = write_sd_dictionary(out_path, blob, args.script, args.min_prefix, args.min_suffix)
+            print(f'wrote {dst} ({size} bytes)')
+            continue
         symbol = _symbol_from_output(out_path)
         write_header(out_path, blob, symbol)
         print(f'wrote {dst} ({len(blob)} bytes payload)')
+        dense_path = out_path.with_name(out_path.name.replace('.trie.h', '.dense.h'))
+        dense_size = write_dense_header(dense_path, blob, symbol, args.dense_budget)
+        print(f'wrote {dense_path} ({dense_size} bytes of dense tables)')
 
 
 if __name__ == '__main__':
@@ -0,0 +1,256 @@
+#include "CacheWarmer.h"
+
+#include <Epub.h>
+#include <Epub/Section.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+
+#include "CrossPointSettings.h"
+#include "CrossPointState.h"
+#include "RecentBooksStore.h"
+#include "ThumbnailAtlas.h"
+#include "components/UITheme.h"
+#include "util/StringUtils.h"
+
+namespace {
+constexpr char CACHE_DIR[] = "/.crosspoint";
+// Marker in a book's cache holding the layout signature it was warmed for
+constexpr char WARM_MARKER_FILE[] = "/warmed.bin";
+// Books already warmed cost one small read each; this many are checked per step
+constexpr int MAX_CHECKS_PER_STEP = 8;
+
+template <typename T>
+void hashPod(uint32_t& hash, const T& value) {
+  const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+  for (size_t i = 0; i < sizeof(T); i++) {
+    hash ^= bytes[i];
+    hash *= 16777619u;
+  }
+}
+}  // namespace
+
+CacheWarmer CacheWarmer::instance;
+
+uint32_t CacheWarmer::layoutSignature() {
+  uint32_t hash = 2166136261u;
+  hashPod(hash, SETTINGS.getReaderFontId());
+  hashPod(hash, SETTINGS.getReaderLineCompression());
+  hashPod(hash, SETTINGS.extraParagraphSpacing);
+  hashPod(hash, SETTINGS.paragraphAlignment);
+  hashPod(hash, SETTINGS.hyphenationEnabled);
+  hashPod(hash, SETTINGS.embeddedStyle);
+  hashPod(hash, APP_STATE.readerViewportWidth);
+  hashPod(hash, APP_STATE.readerViewportHeight);
+  return hash;
+}
+
+bool CacheWarmer::isFinished() const { return finished && signature == layoutSignature(); }
+
+void CacheWarmer::restart() {
+  started = false;
+  finished = false;
+  recentIndex = 0;
+  pendingFolders.clear();
+  folder.clear();
+  folderEntries.clear();
+  folderIndex = 0;
+  stage = NEXT_BOOK;
+  book.reset();
+}
+
+bool CacheWarmer::nextBookPath(std::string& path) {
+  const auto& recentBooks = RECENT_BOOKS.getBooks();
+  while (recentIndex < recentBooks.size()) {
+    const std::string& candidate = recentBooks[recentIndex++].path;
+    if (StringUtils::checkFileExtension(candidate, ".epub")) {
+      path = candidate;
+      return true;
+    }
+  }
+
+  while (true) {
+    const std::string prefix = folder.empty() || folder.back() == '/' ? folder : folder + "/";
+    while (folderIndex < folderEntries.size()) {
+      const LibraryEntry& entry = folderEntries[folderIndex++];
+      if (entry.format == LibraryEntry::EPUB) {
+        path = prefix + entry.name;
+        return true;
+      }
+    }
+    if (pendingFolders.empty()) {
+      return false;
+    }
+
+    folder = pendingFolders.back();
+    pendingFolders.pop_back();
+    folderIndex = 0;
+    folderEntries.clear();
+    LIBRARY_CATALOG.loadFolder(folder, folderEntries);
+    // Subfolders are visited after this folder's books, in listing order
+    const std::string folderPrefix = folder.back() == '/' ? folder : folder + "/";
+    for (auto it = folderEntries.rbegin(); it != folderEntries.rend(); ++it) {
+      if (it->isDirectory()) {
+        pendingFolders.push_back(folderPrefix + it->name.substr(0, it->name.length() - 1));
+      }
+    }
+  }
+}
+
+bool CacheWarmer::isWarm(const std::string& path) const {
+  const Epub epub(path, CACHE_DIR);
+  const std::string markerPath = epub.getCachePath() + WARM_MARKER_FILE;
+  FsFile file;
+  if (!Storage.exists(markerPath.c_str()) || !Storage.openFileForRead("CWM", markerPath, file)) {
+    return false;
+  }
+  uint32_t warmedSignature = 0;
+  serialization::readPod(file, warmedSignature);
+  file.close();
+  return warmedSignature == signature;
+}
+
+void CacheWarmer::markWarm() const {
+  FsFile file;
+  if (Storage.openFileForWrite("CWM", book->getCachePath() + WARM_MARKER_FILE, file)) {
+    serialization::writePod(file, signature);
+    file.close();
+  }
+}
+
+int CacheWarmer::readingSpineIndex() const {
+  // Same place the reader would open the book at
+  FsFile file;
+  const std::string progressPath = book->getCachePath() + "/progress.bin";
+  if (Storage.exists(progressPath.c_str()) && Storage.openFileForRead("CWM", progressPath, file)) {
+    uint8_t data[2];
+    const int read = file.read(data, 2);
+    file.close();
+    if (read == 2) {
+      return std::min(data[0] + (data[1] << 8), book->getSpineItemsCount() - 1);
+    }
+  }
+  return book->getSpineIndexForTextReference();
+}
+
+void CacheWarmer::warmNextSection(GfxRenderer& renderer, const std::function<bool()>& shouldStop) {
+  Section section(book, nextSpineIndex, renderer);
+  if (!section.loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                               SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment,
+                               APP_STATE.readerViewportWidth, APP_STATE.readerViewportHeight,
+                               SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle) &&
+      !section.createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
+                                 SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment,
+                                 APP_STATE.readerViewportWidth, APP_STATE.readerViewportHeight,
+                                 SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle, nullptr,
+                                 EpubProcessingProfile::optimized(), shouldStop)) {
+    if (section.wasStopped()) {
+      // Same section again next step
+      return;
+    }
+    LOG_ERR("CWM", "Could not build section %d of %s", nextSpineIndex, bookPath.c_str());
+  }
+  nextSpineIndex++;
+  sectionsLeft--;
+}
+
+bool CacheWarmer::step(GfxRenderer& renderer, const std::function<bool()>& shouldStop) {
+  if (isFinished()) {
+    return false;
+  }
+  if (!started || signature != layoutSignature()) {
+    // A new pass: everything is checked again against the current layout, finished books only by their marker
+    restart();
+    started = true;
+    signature = layoutSignature();
+    pendingFolders.emplace_back("/");
+    LOG_DBG("CWM", "Warming book caches");
+  }
+
+  switch (stage) {
+    case NEXT_BOOK:
+      for (int checked = 0; checked < MAX_CHECKS_PER_STEP; checked++) {
+        if (!nextBookPath(bookPath)) {
+          finished = true;
+          folderEntries.clear();
+          LOG_DBG("CWM", "All book caches are warm");
+          return false;
+        }
+        if (!isWarm(bookPath)) {
+          stage = METADATA;
+          break;
+        }
+      }
+      return true;
+
+    case METADATA:
+      // book.bin, the CSS rules get a step of their own
+      book = std::make_shared<Epub>(bookPath, CACHE_DIR);
+      if (!book->load(true, true, nullptr, shouldStop)) {
+        book.reset();
+        if (shouldStop && shouldStop()) {
+          return true;
+        }
+        // Left unmarked, the next pass tries again
+        LOG_ERR("CWM", "Could not load %s", bookPath.c_str());
+        stage = NEXT_BOOK;
+        return true;
+      }
+      LIBRARY_CATALOG.updateBookMetadata(bookPath, book->getTitle(), book->getAuthor(), book->getThumbBmpPath());
+      stage = STYLES;
+      return true;
+
+    case STYLES:
+      // Reads book.bin again, a small file, then the CSS rules cache or the CSS files when there is none
+      if (!book->load(false, false, nullptr, shouldStop)) {
+        LOG_ERR("CWM", "Could not load %s", bookPath.c_str());
+        book.reset();
+        stage = NEXT_BOOK;
+        return true;
+      }
+      if (!(shouldStop && shouldStop())) {
+        stage = COVERS;
+      }
+      return true;
+
+    case COVERS:
+      // Home screen thumbnails only, they decode at a reduced JPEG scale. The sleep screen builds its full-screen
+      // covers itself when it needs them.
+      if (!book->generateCoverBmps(false, false, UITheme::getCoverThumbHeights(), shouldStop) && shouldStop &&
+          shouldStop()) {
+        return true;
+      }
+      stage = GRID_THUMBNAIL;
+      return true;
+
+    case GRID_THUMBNAIL:
+      if (SETTINGS.libraryView == CrossPointSettings::LIBRARY_GRID) {
+        LibraryEntry entry;
+        if (LIBRARY_CATALOG.findBook(bookPath, entry) &&
+            !THUMBNAIL_ATLAS.has(bookPath, entry, ThumbnailAtlas::GRID_THUMB_HEIGHT) &&
+            !THUMBNAIL_ATLAS.generate(bookPath, entry, ThumbnailAtlas::GRID_THUMB_HEIGHT, shouldStop) && shouldStop &&
+            shouldStop()) {
+          // Same thumbnail again next step
+          return true;
+        }
+      }
+      // Sections need the reader's viewport, known once any book has been opened
+      nextSpineIndex = std::max(0, readingSpineIndex());
+      sectionsLeft = APP_STATE.readerViewportWidth > 0 && APP_STATE.readerViewportHeight > 0 ? SECTIONS_PER_BOOK : 0;
+      stage = SECTIONS;
+      return true;
+
+    case SECTIONS:
+      if (sectionsLeft > 0 && nextSpineIndex < book->getSpineItemsCount()) {
+        warmNextSection(renderer, shouldStop);
+        return true;
+      }
+      markWarm();
+      book.reset();
+      stage = NEXT_BOOK;
+      return true;
+  }
+  return true;
+}
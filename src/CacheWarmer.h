@@ -0,0 +1,72 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "LibraryCatalog.h"
+
+class Epub;
+class GfxRenderer;
+
+/**
+ * Builds book caches ahead of time while the device charges, so books open without indexing: the metadata and CSS
+ * caches, the cover thumbnails, and the first few sections for the reader's current layout. Recent books go
+ * first, then the rest of the library folder by folder.
+ *
+ * The main loop hands it one step at a time while the buttons are left alone, and a step builds at most one cache
+ * file. The ones that take seconds (indexing, the CSS rules, a cover decode, a section) poll shouldStop as they go
+ * and, when it fires, throw the file away and build it again on a later step, so a button press waits for one poll
+ * interval rather than one file. Everything it builds stays in the book caches, and a book that is finished is
+ * marked in its cache, so an interrupted pass skips ahead to where it stopped.
+ */
+class CacheWarmer {
+  enum Stage : uint8_t { NEXT_BOOK, METADATA, STYLES, COVERS, GRID_THUMBNAIL, SECTIONS };
+
+  static CacheWarmer instance;
+
+  bool started = false;
+  bool finished = false;
+  uint32_t signature = 0;  // Layout the sections are built for, stored in the marker of finished books
+
+  // Walk position: the recent books, then a folder at a time with the folders still to visit
+  size_t recentIndex = 0;
+  std::vector<std::string> pendingFolders;
+  std::string folder;
+  std::vector<LibraryEntry> folderEntries;
+  size_t folderIndex = 0;
+
+  // Book being warmed
+  Stage stage = NEXT_BOOK;
+  std::string bookPath;
+  std::shared_ptr<Epub> book;
+  int nextSpineIndex = 0;
+  int sectionsLeft = 0;
+
+  static uint32_t layoutSignature();
+  bool nextBookPath(std::string& path);
+  bool isWarm(const std::string& path) const;
+  void markWarm() const;
+  int readingSpineIndex() const;
+  void warmNextSection(GfxRenderer& renderer, const std::function<bool()>& shouldStop);
+
+ public:
+  // Sections built per book, starting from where it is being read (or where its text starts)
+  static constexpr int SECTIONS_PER_BOOK = 3;
+
+  ~CacheWarmer() = default;
+
+  static CacheWarmer& getInstance() { return instance; }
+
+  // Does the next piece of work; false once the whole library has been warmed in this session. A piece stopped by
+  // shouldStop is done again from its start on the next step.
+  bool step(GfxRenderer& renderer, const std::function<bool()>& shouldStop = nullptr);
+  // True once a pass has finished for the current layout
+  bool isFinished() const;
+  // Start over from the first recent book, e.g. after the caches were cleared
+  void restart();
+};
+
+// Helper macro to access the cache warmer
+#define CACHE_WARMER CacheWarmer::getInstance()
@@ -119,6 +119,9 @@ class CrossPointSettings {
   // UI Theme
   enum UI_THEME { CLASSIC = 0, LYRA = 1 };
 
+  // Library browser layout
+  enum LIBRARY_VIEW { LIBRARY_LIST = 0, LIBRARY_GRID = 1, LIBRARY_VIEW_COUNT };
+
   // Sleep screen settings
   uint8_t sleepScreen = DARK;
   // Sleep screen cover mode settings
@@ -171,6 +174,8 @@ class CrossPointSettings {
   uint8_t fadingFix = 0;
   // Use book's embedded CSS styles for EPUB rendering (1 = enabled, 0 = disabled)
   uint8_t embeddedStyle = 1;
+  // Library browser layout (list of names or grid of covers)
+  uint8_t libraryView = LIBRARY_LIST;
 
   ~CrossPointSettings() = default;
 
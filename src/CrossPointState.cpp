@@ -5,7 +5,7 @@
 #include <Serialization.h>
 
 namespace {
-constexpr uint8_t STATE_FILE_VERSION = 4;
+constexpr uint8_t STATE_FILE_VERSION = 5;
 constexpr char STATE_FILE[] = "/.crosspoint/state.bin";
 }  // namespace
 
@@ -22,6 +22,8 @@ bool CrossPointState::saveToFile() const {
   serialization::writePod(outputFile, lastSleepImage);
   serialization::writePod(outputFile, readerActivityLoadCount);
   serialization::writePod(outputFile, lastSleepFromReader);
+  serialization::writePod(outputFile, readerViewportWidth);
+  serialization::writePod(outputFile, readerViewportHeight);
   outputFile.close();
   return true;
 }
@@ -57,6 +59,11 @@ bool CrossPointState::loadFromFile() {
     lastSleepFromReader = false;
   }
 
+  if (version >= 5) {
+    serialization::readPod(inputFile, readerViewportWidth);
+    serialization::readPod(inputFile, readerViewportHeight);
+  }
+
   inputFile.close();
   return true;
 }
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <iosfwd>
 #include <string>
 
@@ -11,6 +12,9 @@ class CrossPointState {
   uint8_t lastSleepImage;
   uint8_t readerActivityLoadCount = 0;
   bool lastSleepFromReader = false;
+  // Text area of the last EPUB page laid out, so book caches can be built for it outside the reader
+  uint16_t readerViewportWidth = 0;
+  uint16_t readerViewportHeight = 0;
   ~CrossPointState() = default;
 
   // Get singleton instance
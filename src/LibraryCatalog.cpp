@@ -0,0 +1,688 @@
+#include "LibraryCatalog.h"
+
+#include <Epub.h>
+#include <HalStorage.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "util/StringUtils.h"
+
+namespace {
+// 3: entries sorted with ties broken on the raw name
+constexpr uint8_t LIBRARY_INDEX_FILE_VERSION = 3;
+constexpr uint8_t THUMB_TABLE_FILE_VERSION = 1;
+constexpr char LIBRARY_DIR[] = "/.crosspoint/library";
+constexpr char THUMB_TABLE_FILE[] = "/.crosspoint/library/thumbs.bin";
+// Comfortably more than the recent books list
+constexpr size_t THUMB_TABLE_SIZE = 32;
+// Guard against corrupted counts in index files causing huge allocations
+constexpr uint32_t MAX_FOLDER_ENTRIES = 20000;
+
+uint32_t readMtime(FsFile& file) {
+  uint16_t date = 0;
+  uint16_t time = 0;
+  file.getModifyDateTime(&date, &time);
+  return (static_cast<uint32_t>(date) << 16) | time;
+}
+
+bool isListable(const char* name) { return name[0] != '.' && strcmp(name, "System Volume Information") != 0; }
+
+bool entryLess(const LibraryEntry& a, const LibraryEntry& b) {
+  // Directories first
+  if (a.isDirectory() != b.isDirectory()) return a.isDirectory();
+  return LibraryCatalog::naturalLess(a.name, b.name);
+}
+
+uint32_t hashEntry(const char* name, const uint32_t size) {
+  // Mix the size in so a same-name replacement changes the folder hash even though its mtime does not
+  return LibraryCatalog::hashName(name) ^ (size * 2654435761u);
+}
+
+uint32_t hashEntries(const std::vector<LibraryEntry>& entries) {
+  // Order independent so hooks can update it without a rescan and a directory walk can recompute it unsorted
+  uint32_t hash = entries.size();
+  for (const auto& entry : entries) {
+    hash ^= hashEntry(entry.name.c_str(), entry.size);
+  }
+  return hash;
+}
+
+void fillFromBookCache(const std::string& path, LibraryEntry& entry) {
+  if (entry.format != LibraryEntry::EPUB) {
+    return;
+  }
+  // Only use metadata that has already been built, never index a book just to list it
+  Epub epub(path, "/.crosspoint");
+  if (!Storage.exists((epub.getCachePath() + "/book.bin").c_str()) || !epub.load(false, true)) {
+    return;
+  }
+  entry.title = epub.getTitle();
+  entry.author = epub.getAuthor();
+  entry.coverThumbPath = epub.getThumbBmpPath();
+}
+}  // namespace
+
+LibraryCatalog LibraryCatalog::instance;
+
+LibraryEntry::Format LibraryCatalog::formatForName(const std::string& name) {
+  if (StringUtils::checkFileExtension(name, ".epub")) {
+    return LibraryEntry::EPUB;
+  }
+  if (StringUtils::checkFileExtension(name, ".xtch") || StringUtils::checkFileExtension(name, ".xtc")) {
+    return LibraryEntry::XTC;
+  }
+  if (StringUtils::checkFileExtension(name, ".txt") || StringUtils::checkFileExtension(name, ".md")) {
+    return LibraryEntry::TXT;
+  }
+  return LibraryEntry::UNKNOWN;
+}
+
+bool LibraryCatalog::naturalLess(const std::string& str1, const std::string& str2) {
+  // Start naive natural sort
+  const char* s1 = str1.c_str();
+  const char* s2 = str2.c_str();
+
+  // Iterate while both strings have characters
+  while (*s1 && *s2) {
+    // Check if both are at the start of a number
+    if (isdigit(*s1) && isdigit(*s2)) {
+      // Skip leading zeros
+      while (*s1 == '0') s1++;
+      while (*s2 == '0') s2++;
+
+      // Count digits to compare lengths first
+      int len1 = 0, len2 = 0;
+      while (isdigit(s1[len1])) len1++;
+      while (isdigit(s2[len2])) len2++;
+
+      // Different length so return smaller integer value
+      if (len1 != len2) return len1 < len2;
+
+      // Same length so compare digit by digit
+      for (int i = 0; i < len1; i++) {
+        if (s1[i] != s2[i]) return s1[i] < s2[i];
+      }
+
+      // Numbers equal so advance pointers
+      s1 += len1;
+      s2 += len2;
+    } else {
+      // Regular case-insensitive character comparison
+      char c1 = tolower(*s1);
+      char c2 = tolower(*s2);
+      if (c1 != c2) return c1 < c2;
+      s1++;
+      s2++;
+    }
+  }
+
+  // One string is prefix of other
+  if (*s1 != '\0' || *s2 != '\0') return *s1 == '\0';
+
+  // Naturally equal ("a01" and "a1", "Book" and "book"): the raw bytes decide, so distinct names never compare equal
+  // and a binary search lands on the exact name
+  return str1 < str2;
+}
+
+// FNV-1a 32-bit
+uint32_t LibraryCatalog::hashName(const std::string& name) {
+  uint32_t hash = 2166136261u;
+  for (const char c : name) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+std::string LibraryCatalog::normaliseFolder(const std::string& folderPath) {
+  if (folderPath.empty() || folderPath == "/") {
+    return "/";
+  }
+  std::string folder = folderPath;
+  if (folder.front() != '/') folder.insert(folder.begin(), '/');
+  while (folder.size() > 1 && folder.back() == '/') folder.pop_back();
+  return folder;
+}
+
+void LibraryCatalog::splitPath(const std::string& path, std::string& folder, std::string& name) {
+  const size_t lastSlash = path.find_last_of('/');
+  if (lastSlash == std::string::npos) {
+    folder = "/";
+    name = path;
+    return;
+  }
+  folder = normaliseFolder(path.substr(0, lastSlash));
+  name = path.substr(lastSlash + 1);
+}
+
+std::string LibraryCatalog::indexPathForFolder(const std::string& folderPath) {
+  return std::string(LIBRARY_DIR) + "/folder_" + std::to_string(std::hash<std::string>{}(folderPath)) + ".bin";
+}
+
+bool LibraryCatalog::readIndex(const std::string& folderPath, std::vector<LibraryEntry>& entries, uint32_t& dirMtime,
+                               uint32_t& nameHash) const {
+  FsFile file;
+  if (!Storage.openFileForRead("LIB", indexPathForFolder(folderPath), file)) {
+    return false;
+  }
+
+  uint8_t version;
+  serialization::readPod(file, version);
+  if (version != LIBRARY_INDEX_FILE_VERSION) {
+    LOG_DBG("LIB", "Index version mismatch for %s (%u)", folderPath.c_str(), version);
+    file.close();
+    return false;
+  }
+
+  std::string storedFolder;
+  uint32_t count = 0;
+  serialization::readString(file, storedFolder);
+  serialization::readPod(file, dirMtime);
+  serialization::readPod(file, nameHash);
+  serialization::readPod(file, count);
+  if (storedFolder != folderPath || count > MAX_FOLDER_ENTRIES) {
+    // Hash collision between two folder paths or a corrupted header
+    file.close();
+    return false;
+  }
+
+  entries.clear();
+  entries.reserve(count);
+  for (uint32_t i = 0; i < count; i++) {
+    LibraryEntry entry;
+    serialization::readString(file, entry.name);
+    serialization::readPod(file, entry.format);
+    serialization::readPod(file, entry.size);
+    serialization::readPod(file, entry.mtime);
+    serialization::readString(file, entry.title);
+    serialization::readString(file, entry.author);
+    serialization::readString(file, entry.coverThumbPath);
+    serialization::readPod(file, entry.progress);
+    if (entry.name.empty()) {
+      LOG_ERR("LIB", "Corrupted index for %s", folderPath.c_str());
+      file.close();
+      entries.clear();
+      return false;
+    }
+    entries.push_back(std::move(entry));
+  }
+
+  file.close();
+  return true;
+}
+
+bool LibraryCatalog::writeIndex(const std::string& folderPath, const std::vector<LibraryEntry>& entries,
+                                const uint32_t dirMtime) const {
+  Storage.mkdir(LIBRARY_DIR);
+
+  FsFile file;
+  if (!Storage.openFileForWrite("LIB", indexPathForFolder(folderPath), file)) {
+    return false;
+  }
+
+  serialization::writePod(file, LIBRARY_INDEX_FILE_VERSION);
+  serialization::writeString(file, folderPath);
+  serialization::writePod(file, dirMtime);
+  serialization::writePod(file, hashEntries(entries));
+  serialization::writePod(file, static_cast<uint32_t>(entries.size()));
+  for (const auto& entry : entries) {
+    serialization::writeString(file, entry.name);
+    serialization::writePod(file, entry.format);
+    serialization::writePod(file, entry.size);
+    serialization::writePod(file, entry.mtime);
+    serialization::writeString(file, entry.title);
+    serialization::writeString(file, entry.author);
+    serialization::writeString(file, entry.coverThumbPath);
+    serialization::writePod(file, entry.progress);
+  }
+
+  file.close();
+  return true;
+}
+
+bool LibraryCatalog::scanFolder(const std::string& folderPath, const std::vector<LibraryEntry>& previous,
+                                std::vector<LibraryEntry>& entries, uint32_t& dirMtime) const {
+  entries.clear();
+
+  auto root = Storage.open(folderPath.c_str());
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return false;
+  }
+
+  const unsigned long start = millis();
+  dirMtime = readMtime(root);
+  root.rewindDirectory();
+
+  const std::string prefix = folderPath == "/" ? "/" : folderPath + "/";
+  int reused = 0;
+  char name[500];
+  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    if (!isListable(name)) {
+      file.close();
+      continue;
+    }
+
+    LibraryEntry entry;
+    if (file.isDirectory()) {
+      entry.name = std::string(name) + "/";
+      entry.format = LibraryEntry::DIRECTORY;
+    } else {
+      entry.name = name;
+      entry.format = formatForName(entry.name);
+      entry.size = file.fileSize();
+      entry.mtime = readMtime(file);
+    }
+    file.close();
+
+    if (entry.format == LibraryEntry::UNKNOWN) {
+      continue;
+    }
+
+    // Carry cached metadata over if the file itself did not change
+    const auto it = std::lower_bound(previous.begin(), previous.end(), entry, entryLess);
+    if (it != previous.end() && it->name == entry.name && it->size == entry.size && it->mtime == entry.mtime) {
+      entry = *it;
+      reused++;
+    } else {
+      fillFromBookCache(prefix + entry.name, entry);
+    }
+    entries.push_back(std::move(entry));
+  }
+  root.close();
+
+  std::sort(entries.begin(), entries.end(), entryLess);
+  LOG_DBG("LIB", "Scanned %s: %d entries (%d reused) in %lu ms", folderPath.c_str(), entries.size(), reused,
+          millis() - start);
+  return true;
+}
+
+bool LibraryCatalog::ensureCached(const std::string& folderPath) {
+  if (cacheValid && cachedFolder == folderPath) {
+    return true;
+  }
+  uint32_t nameHash = 0;
+  if (!readIndex(folderPath, cachedEntries, cachedDirMtime, nameHash)) {
+    cacheValid = false;
+    cachedEntries.clear();
+    return false;
+  }
+  cachedFolder = folderPath;
+  cacheValid = true;
+  return true;
+}
+
+LibraryEntry* LibraryCatalog::findCached(const std::string& name) {
+  LibraryEntry probe;
+  probe.name = name;
+  probe.format = (!name.empty() && name.back() == '/') ? LibraryEntry::DIRECTORY : LibraryEntry::UNKNOWN;
+  const auto it = std::lower_bound(cachedEntries.begin(), cachedEntries.end(), probe, entryLess);
+  if (it == cachedEntries.end() || it->name != name) {
+    return nullptr;
+  }
+  return &*it;
+}
+
+void LibraryCatalog::commitCached() {
+  // Hooks run right after the change, so the directory mtime on SD now reflects the updated index
+  auto dir = Storage.open(cachedFolder.c_str());
+  if (dir) {
+    cachedDirMtime = readMtime(dir);
+    dir.close();
+  }
+  if (!writeIndex(cachedFolder, cachedEntries, cachedDirMtime)) {
+    LOG_ERR("LIB", "Failed to write index for %s", cachedFolder.c_str());
+    cacheValid = false;
+  }
+}
+
+bool LibraryCatalog::loadFolder(const std::string& folderPath, std::vector<LibraryEntry>& entries) {
+  const std::string folder = normaliseFolder(folderPath);
+
+  uint32_t currentMtime = 0;
+  {
+    auto dir = Storage.open(folder.c_str());
+    if (!dir || !dir.isDirectory()) {
+      if (dir) dir.close();
+      entries.clear();
+      return false;
+    }
+    currentMtime = readMtime(dir);
+    dir.close();
+  }
+
+  if (ensureCached(folder) && cachedDirMtime == currentMtime) {
+    entries = cachedEntries;
+    return true;
+  }
+
+  std::vector<LibraryEntry> rebuilt;
+  uint32_t dirMtime = 0;
+  if (!scanFolder(folder, cacheValid ? cachedEntries : std::vector<LibraryEntry>{}, rebuilt, dirMtime)) {
+    entries.clear();
+    return false;
+  }
+
+  cachedFolder = folder;
+  cachedEntries = std::move(rebuilt);
+  cachedDirMtime = dirMtime;
+  cacheValid = true;
+  writeIndex(cachedFolder, cachedEntries, cachedDirMtime);
+
+  entries = cachedEntries;
+  return true;
+}
+
+bool LibraryCatalog::revalidateFolder(const std::string& folderPath, std::vector<LibraryEntry>& entries) {
+  const std::string folder = normaliseFolder(folderPath);
+  if (!ensureCached(folder)) {
+    return false;
+  }
+
+  auto root = Storage.open(folder.c_str());
+  if (!root || !root.isDirectory()) {
+    if (root) root.close();
+    return false;
+  }
+
+  // Name and size walk: no allocation per entry and no sort. The size comes from the directory entry that
+  // openNextFile() already read, so it costs no extra SD access.
+  uint32_t count = 0;
+  uint32_t nameHashes = 0;
+  char name[500];
+  root.rewindDirectory();
+  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+    file.getName(name, sizeof(name));
+    const bool isDir = file.isDirectory();
+    const uint32_t size = isDir ? 0 : file.fileSize();
+    file.close();
+    if (!isListable(name)) {
+      continue;
+    }
+    if (isDir) {
+      const size_t len = strlen(name);
+      if (len + 1 < sizeof(name)) {
+        name[len] = '/';
+        name[len + 1] = '\0';
+      }
+    } else if (formatForName(name) == LibraryEntry::UNKNOWN) {
+      continue;
+    }
+    count++;
+    nameHashes ^= hashEntry(name, size);
+  }
+  root.close();
+
+  if ((count ^ nameHashes) == hashEntries(cachedEntries)) {
+    return false;
+  }
+
+  LOG_DBG("LIB", "Folder %s changed outside of the catalog, rebuilding", folder.c_str());
+  std::vector<LibraryEntry> rebuilt;
+  uint32_t dirMtime = 0;
+  if (!scanFolder(folder, cachedEntries, rebuilt, dirMtime)) {
+    return false;
+  }
+  cachedEntries = std::move(rebuilt);
+  cachedDirMtime = dirMtime;
+  writeIndex(cachedFolder, cachedEntries, cachedDirMtime);
+  entries = cachedEntries;
+  return true;
+}
+
+bool LibraryCatalog::findBook(const std::string& path, LibraryEntry& out) {
+  std::string folder, name;
+  splitPath(path, folder, name);
+  if (!ensureCached(folder)) {
+    return false;
+  }
+  const LibraryEntry* entry = findCached(name);
+  if (!entry) {
+    return false;
+  }
+  out = *entry;
+  return true;
+}
+
+void LibraryCatalog::onFileAdded(const std::string& path) {
+  std::string folder, name;
+  splitPath(path, folder, name);
+  // An upload may have replaced the book, its old thumbnails went with the book cache
+  forgetThumb(path);
+  // Folders without an index get one on their first visit, nothing to update yet
+  if (!ensureCached(folder)) {
+    return;
+  }
+
+  auto file = Storage.open(path.c_str());
+  if (!file) {
+    return;
+  }
+  LibraryEntry entry;
+  if (file.isDirectory()) {
+    entry.name = name + "/";
+    entry.format = LibraryEntry::DIRECTORY;
+  } else {
+    entry.name = name;
+    entry.format = formatForName(name);
+    entry.size = file.fileSize();
+    entry.mtime = readMtime(file);
+  }
+  file.close();
+
+  if (entry.format == LibraryEntry::UNKNOWN || !isListable(name.c_str())) {
+    return;
+  }
+
+  // Replace an overwritten file in place so its stale metadata is dropped
+  const auto it = std::lower_bound(cachedEntries.begin(), cachedEntries.end(), entry, entryLess);
+  if (it != cachedEntries.end() && it->name == entry.name) {
+    *it = std::move(entry);
+  } else {
+    cachedEntries.insert(it, std::move(entry));
+  }
+  commitCached();
+}
+
+void LibraryCatalog::onFileRemoved(const std::string& path) {
+  std::string folder, name;
+  splitPath(path, folder, name);
+  forgetThumb(path);
+  if (!ensureCached(folder)) {
+    return;
+  }
+  LibraryEntry* entry = findCached(name);
+  if (!entry) {
+    return;
+  }
+  cachedEntries.erase(cachedEntries.begin() + (entry - cachedEntries.data()));
+  commitCached();
+}
+
+void LibraryCatalog::onFileMoved(const std::string& fromPath, const std::string& toPath) {
+  std::string fromFolder, fromName, toFolder, toName;
+  splitPath(fromPath, fromFolder, fromName);
+  splitPath(toPath, toFolder, toName);
+
+  // Preserve progress across the move; title/author/thumbs are tied to the old cache key and are rebuilt on open
+  uint8_t progress = 0;
+  forgetThumb(fromPath);
+  if (ensureCached(fromFolder)) {
+    if (LibraryEntry* entry = findCached(fromName)) {
+      progress = entry->progress;
+      cachedEntries.erase(cachedEntries.begin() + (entry - cachedEntries.data()));
+      commitCached();
+    }
+  }
+
+  onFileAdded(toPath);
+  if (progress > 0) {
+    updateProgress(toPath, progress);
+  }
+}
+
+void LibraryCatalog::onFolderRemoved(const std::string& folderPath) {
+  const std::string folder = normaliseFolder(folderPath);
+  Storage.remove(indexPathForFolder(folder).c_str());
+  if (cachedFolder == folder) {
+    cacheValid = false;
+    cachedEntries.clear();
+  }
+  // The table only has path hashes, so there is no telling which books were inside. It is small and rebuilt from
+  // Storage.exists() checks on the next home screen visit.
+  thumbRecords.clear();
+  thumbRecordsLoaded = true;
+  saveThumbRecords();
+
+  std::string parent, name;
+  splitPath(folder, parent, name);
+  if (!ensureCached(parent)) {
+    return;
+  }
+  LibraryEntry* entry = findCached(name + "/");
+  if (!entry) {
+    return;
+  }
+  cachedEntries.erase(cachedEntries.begin() + (entry - cachedEntries.data()));
+  commitCached();
+}
+
+void LibraryCatalog::updateBookMetadata(const std::string& path, const std::string& title, const std::string& author,
+                                        const std::string& coverThumbPath) {
+  std::string folder, name;
+  splitPath(path, folder, name);
+  if (!ensureCached(folder)) {
+    return;
+  }
+  LibraryEntry* entry = findCached(name);
+  if (!entry || (entry->title == title && entry->author == author && entry->coverThumbPath == coverThumbPath)) {
+    return;
+  }
+  entry->title = title;
+  entry->author = author;
+  if (entry->coverThumbPath != coverThumbPath) {
+    entry->coverThumbPath = coverThumbPath;
+    forgetThumb(path);
+  }
+  commitCached();
+}
+
+void LibraryCatalog::updateProgress(const std::string& path, const uint8_t progress) {
+  std::string folder, name;
+  splitPath(path, folder, name);
+  if (!ensureCached(folder)) {
+    return;
+  }
+  LibraryEntry* entry = findCached(name);
+  if (!entry || entry->progress == progress) {
+    return;
+  }
+  entry->progress = progress;
+  commitCached();
+}
+
+void LibraryCatalog::loadThumbRecords() {
+  if (thumbRecordsLoaded) {
+    return;
+  }
+  thumbRecordsLoaded = true;
+  thumbRecords.clear();
+
+  FsFile file;
+  if (!Storage.openFileForRead("LIB", THUMB_TABLE_FILE, file)) {
+    return;
+  }
+  uint8_t version = 0;
+  uint8_t count = 0;
+  serialization::readPod(file, version);
+  serialization::readPod(file, count);
+  if (version != THUMB_TABLE_FILE_VERSION || count > THUMB_TABLE_SIZE) {
+    LOG_DBG("LIB", "Ignoring thumbnail table (version %u, %u entries)", version, count);
+    file.close();
+    return;
+  }
+  thumbRecords.reserve(count);
+  for (uint8_t i = 0; i < count; i++) {
+    ThumbRecord record{};
+    serialization::readPod(file, record.pathHash);
+    serialization::readPod(file, record.height);
+    thumbRecords.push_back(record);
+  }
+  file.close();
+}
+
+void LibraryCatalog::saveThumbRecords() const {
+  Storage.mkdir(LIBRARY_DIR);
+
+  FsFile file;
+  if (!Storage.openFileForWrite("LIB", THUMB_TABLE_FILE, file)) {
+    return;
+  }
+  serialization::writePod(file, THUMB_TABLE_FILE_VERSION);
+  serialization::writePod(file, static_cast<uint8_t>(thumbRecords.size()));
+  for (const auto& record : thumbRecords) {
+    serialization::writePod(file, record.pathHash);
+    serialization::writePod(file, record.height);
+  }
+  file.close();
+}
+
+void LibraryCatalog::forgetThumb(const std::string& path) {
+  loadThumbRecords();
+  const uint32_t pathHash = hashName(path);
+  const auto it = std::find_if(thumbRecords.begin(), thumbRecords.end(),
+                               [pathHash](const ThumbRecord& record) { return record.pathHash == pathHash; });
+  if (it == thumbRecords.end()) {
+    return;
+  }
+  thumbRecords.erase(it);
+  saveThumbRecords();
+}
+
+void LibraryCatalog::markThumbReady(const std::string& path, const uint16_t height) {
+  if (height == 0) {
+    forgetThumb(path);
+    return;
+  }
+  loadThumbRecords();
+  const uint32_t pathHash = hashName(path);
+  const auto it = std::find_if(thumbRecords.begin(), thumbRecords.end(),
+                               [pathHash](const ThumbRecord& record) { return record.pathHash == pathHash; });
+  if (it != thumbRecords.end() && it == thumbRecords.begin() && it->height == height) {
+    return;
+  }
+  if (it != thumbRecords.end()) {
+    thumbRecords.erase(it);
+  }
+  thumbRecords.insert(thumbRecords.begin(), {pathHash, height});
+  if (thumbRecords.size() > THUMB_TABLE_SIZE) {
+    thumbRecords.resize(THUMB_TABLE_SIZE);
+  }
+  saveThumbRecords();
+}
+
+uint16_t LibraryCatalog::thumbHeightFor(const std::string& path) {
+  loadThumbRecords();
+  const uint32_t pathHash = hashName(path);
+  for (const auto& record : thumbRecords) {
+    if (record.pathHash == pathHash) {
+      return record.height;
+    }
+  }
+  return 0;
+}
+
+void LibraryCatalog::clearAll() {
+  cacheValid = false;
+  cachedFolder.clear();
+  cachedEntries.clear();
+  thumbRecords.clear();
+  thumbRecordsLoaded = true;
+  if (Storage.exists(LIBRARY_DIR)) {
+    Storage.removeDir(LIBRARY_DIR);
+  }
+}
@@ -0,0 +1,107 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// A single row of a folder listing. Directories carry a trailing '/' in `name` (same convention the library
+// browser has always used) and leave the book metadata fields empty.
+struct LibraryEntry {
+  enum Format : uint8_t { DIRECTORY = 0, EPUB = 1, XTC = 2, TXT = 3, UNKNOWN = 0xFF };
+
+  std::string name;
+  Format format = UNKNOWN;
+  uint32_t size = 0;
+  uint32_t mtime = 0;  // FAT date in the high 16 bits, FAT time in the low 16 bits
+  std::string title;
+  std::string author;
+  std::string coverThumbPath;  // Thumbnail path with a "[HEIGHT]" placeholder, empty if the book has no cover
+  uint8_t progress = 0;        // Reading progress in percent
+
+  bool isDirectory() const { return format == DIRECTORY; }
+};
+
+/**
+ * Persistent on-SD catalog of the library, stored as one sorted index file per folder under
+ * /.crosspoint/library/. Opening a folder is a single sequential read of its index instead of an
+ * openNextFile() walk plus a natural sort.
+ *
+ * The directory mtime is only a hint that triggers an early rebuild: FAT does not reliably bump it when the card
+ * is edited on a computer, and the device itself never stamps files or directories. Freshness comes from
+ * revalidation against a walk that hashes every name and file size, so additions, removals and same-name
+ * replacements of a different size are all caught. Books that are still present keep their cached metadata
+ * across rebuilds. The web server keeps indexes current through the onFile* hooks so uploads never force a full
+ * rescan.
+ *
+ * Thumbnail heights known to exist on SD are tracked separately, keyed by the hash of the book path, so the home
+ * screen can check its recent books without reading one folder index per book.
+ */
+class LibraryCatalog {
+  static LibraryCatalog instance;
+
+  // The most recently used folder index is kept in memory so hooks and metadata updates for the same folder do
+  // not re-read it from SD.
+  std::string cachedFolder;
+  std::vector<LibraryEntry> cachedEntries;
+  uint32_t cachedDirMtime = 0;
+  bool cacheValid = false;
+
+  // Most recently marked first, bounded to THUMB_TABLE_SIZE entries
+  struct ThumbRecord {
+    uint32_t pathHash;
+    uint16_t height;
+  };
+  std::vector<ThumbRecord> thumbRecords;
+  bool thumbRecordsLoaded = false;
+
+  static std::string indexPathForFolder(const std::string& folderPath);
+  static std::string normaliseFolder(const std::string& folderPath);
+  static void splitPath(const std::string& path, std::string& folder, std::string& name);
+
+  bool readIndex(const std::string& folderPath, std::vector<LibraryEntry>& entries, uint32_t& dirMtime,
+                 uint32_t& nameHash) const;
+  bool writeIndex(const std::string& folderPath, const std::vector<LibraryEntry>& entries, uint32_t dirMtime) const;
+  bool scanFolder(const std::string& folderPath, const std::vector<LibraryEntry>& previous,
+                  std::vector<LibraryEntry>& entries, uint32_t& dirMtime) const;
+  bool ensureCached(const std::string& folderPath);
+  LibraryEntry* findCached(const std::string& name);
+  void commitCached();
+  void loadThumbRecords();
+  void saveThumbRecords() const;
+  void forgetThumb(const std::string& path);
+
+ public:
+  ~LibraryCatalog() = default;
+
+  static LibraryCatalog& getInstance() { return instance; }
+
+  // Load the sorted listing for `folderPath`, rebuilding the index if it is missing or the directory mtime changed.
+  bool loadFolder(const std::string& folderPath, std::vector<LibraryEntry>& entries);
+
+  // Walk the folder names and file sizes and compare them against the stored index. If the folder changed behind
+  // our back the index is rebuilt, `entries` is refreshed and true is returned.
+  bool revalidateFolder(const std::string& folderPath, std::vector<LibraryEntry>& entries);
+
+  // Look up the catalog row for a book by full path. Returns false if the folder has no index or no such entry.
+  bool findBook(const std::string& path, LibraryEntry& out);
+
+  // Incremental update hooks used by the web server and the readers
+  void onFileAdded(const std::string& path);
+  void onFileRemoved(const std::string& path);
+  void onFileMoved(const std::string& fromPath, const std::string& toPath);
+  void onFolderRemoved(const std::string& folderPath);
+  void updateBookMetadata(const std::string& path, const std::string& title, const std::string& author,
+                          const std::string& coverThumbPath);
+  void updateProgress(const std::string& path, uint8_t progress);
+  void markThumbReady(const std::string& path, uint16_t height);
+  // Height of the last thumbnail marked ready for `path`, 0 if none. Never reads a folder index.
+  uint16_t thumbHeightFor(const std::string& path);
+  // Drop every folder index, e.g. after the book caches were wiped
+  void clearAll();
+
+  static LibraryEntry::Format formatForName(const std::string& name);
+  static bool naturalLess(const std::string& a, const std::string& b);
+  static uint32_t hashName(const std::string& name);
+};
+
+// Helper macro to access the library catalog
+#define LIBRARY_CATALOG LibraryCatalog::getInstance()
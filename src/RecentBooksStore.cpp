@@ -8,6 +8,7 @@
 
 #include <algorithm>
 
+#include "LibraryCatalog.h"
 #include "util/StringUtils.h"
 
 namespace {
@@ -29,6 +30,7 @@ void RecentBooksStore::addBook(const std::string& path, const std::string& title
 
   // Add to front
   recentBooks.insert(recentBooks.begin(), {path, title, author, coverBmpPath});
+  LIBRARY_CATALOG.updateBookMetadata(path, title, author, coverBmpPath);
 
   // Trim to max size
   if (recentBooks.size() > MAX_RECENT_BOOKS) {
@@ -48,6 +50,7 @@ void RecentBooksStore::updateBook(const std::string& path, const std::string& ti
     book.author = author;
     book.coverBmpPath = coverBmpPath;
     saveToFile();
+    LIBRARY_CATALOG.updateBookMetadata(path, title, author, coverBmpPath);
   }
 }
 
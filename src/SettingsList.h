@@ -28,6 +28,7 @@ inline std::vector<SettingInfo> getSettingsList() {
                         {"1 page", "5 pages", "10 pages", "15 pages", "30 pages"}, "refreshFrequency", "Display"),
       SettingInfo::Enum("UI Theme", &CrossPointSettings::uiTheme, {"Classic", "Lyra"}, "uiTheme", "Display"),
       SettingInfo::Toggle("Sunlight Fading Fix", &CrossPointSettings::fadingFix, "fadingFix", "Display"),
+      SettingInfo::Enum("Library View", &CrossPointSettings::libraryView, {"List", "Grid"}, "libraryView", "Display"),
 
       // --- Reader ---
       SettingInfo::Enum("Font Family", &CrossPointSettings::fontFamily, {"Bookerly", "Noto Sans", "Open Dyslexic"},
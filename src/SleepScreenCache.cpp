@@ -0,0 +1,220 @@
+#include "SleepScreenCache.h"
+
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <Serialization.h>
+
+#include <algorithm>
+#include <cstring>
+
+#include "CrossPointSettings.h"
+#include "LibraryCatalog.h"
+
+namespace {
+constexpr uint8_t SLEEP_CACHE_FILE_VERSION = 2;
+constexpr char CACHE_DIR[] = "/.crosspoint";
+// version + path hash + size + content hash + cover mode + cover filter + orientation + greyscale flag + plane size
+constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + 3 * sizeof(uint32_t) + 4 * sizeof(uint8_t) + sizeof(uint32_t);
+// The content hash covers the first block (BMP headers, palette and first rows) plus evenly spaced samples
+constexpr uint32_t HASH_HEAD_BYTES = 1024;
+constexpr uint32_t HASH_SAMPLES = 32;
+constexpr uint32_t HASH_SAMPLE_BYTES = 64;
+
+uint32_t fnv1a(uint32_t hash, const uint8_t* data, const size_t len) {
+  for (size_t i = 0; i < len; i++) {
+    hash ^= data[i];
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+// About 3 KB of reads, small next to a render and far cheaper than comparing the whole image
+uint32_t sampleContentHash(FsFile& file, const uint32_t size) {
+  uint8_t buffer[HASH_HEAD_BYTES];
+  uint32_t hash = 2166136261u;
+  const int headRead = file.read(buffer, std::min(size, HASH_HEAD_BYTES));
+  if (headRead > 0) {
+    hash = fnv1a(hash, buffer, headRead);
+  }
+  if (size <= HASH_HEAD_BYTES + HASH_SAMPLE_BYTES) {
+    return hash;
+  }
+
+  const uint32_t span = size - HASH_HEAD_BYTES - HASH_SAMPLE_BYTES;
+  for (uint32_t i = 0; i < HASH_SAMPLES; i++) {
+    const uint32_t offset = HASH_HEAD_BYTES + static_cast<uint32_t>(static_cast<uint64_t>(span) * i / HASH_SAMPLES);
+    if (!file.seek(offset)) {
+      break;
+    }
+    const int sampleRead = file.read(buffer, HASH_SAMPLE_BYTES);
+    if (sampleRead <= 0) {
+      break;
+    }
+    hash = fnv1a(hash, buffer, sampleRead);
+  }
+  return hash;
+}
+}  // namespace
+
+SleepScreenCache::SleepScreenCache(const GfxRenderer& renderer, const std::string& sourcePath) {
+  FsFile source;
+  if (!Storage.openFileForRead("SLC", sourcePath, source)) {
+    return;
+  }
+  key.size = source.size();
+  key.contentHash = sampleContentHash(source, key.size);
+  source.close();
+
+  key.pathHash = LibraryCatalog::hashName(sourcePath);
+  key.coverMode = SETTINGS.sleepScreenCoverMode;
+  key.coverFilter = SETTINGS.sleepScreenCoverFilter;
+  key.orientation = static_cast<uint8_t>(renderer.getOrientation());
+
+  char name[32];
+  snprintf(name, sizeof(name), "/sleep_%08lx.fb", static_cast<unsigned long>(key.pathHash));
+  cachePath = std::string(CACHE_DIR) + name;
+}
+
+SleepScreenCache::~SleepScreenCache() {
+  if (storing) {
+    // Render was abandoned half way, don't leave a partial file behind
+    storeFile.close();
+    Storage.remove(cachePath.c_str());
+  }
+}
+
+bool SleepScreenCache::render(GfxRenderer& renderer) const {
+  if (!isValid() || !Storage.exists(cachePath.c_str())) {
+    return false;
+  }
+
+  FsFile file;
+  if (!Storage.openFileForRead("SLC", cachePath, file)) {
+    return false;
+  }
+
+  uint8_t version;
+  Key stored;
+  uint8_t hasGreyscale;
+  uint32_t planeSize;
+  serialization::readPod(file, version);
+  serialization::readPod(file, stored.pathHash);
+  serialization::readPod(file, stored.size);
+  serialization::readPod(file, stored.contentHash);
+  serialization::readPod(file, stored.coverMode);
+  serialization::readPod(file, stored.coverFilter);
+  serialization::readPod(file, stored.orientation);
+  serialization::readPod(file, hasGreyscale);
+  serialization::readPod(file, planeSize);
+
+  const size_t planes = hasGreyscale ? 3 : 1;
+  if (version != SLEEP_CACHE_FILE_VERSION || stored.pathHash != key.pathHash || stored.size != key.size ||
+      stored.contentHash != key.contentHash || stored.coverMode != key.coverMode ||
+      stored.coverFilter != key.coverFilter || stored.orientation != key.orientation ||
+      planeSize != GfxRenderer::getBufferSize() ||
+      file.size() != HEADER_SIZE + planes * planeSize) {
+    LOG_DBG("SLC", "Stale sleep screen cache %s", cachePath.c_str());
+    file.close();
+    return false;
+  }
+
+  // The BW plane must be read completely before anything reaches the panel, so a short read is still a clean miss
+  if (file.read(renderer.getFrameBuffer(), planeSize) != static_cast<int>(planeSize)) {
+    LOG_ERR("SLC", "Short read from %s", cachePath.c_str());
+    file.close();
+    return false;
+  }
+  renderer.displayBuffer(HalDisplay::HALF_REFRESH);
+
+  if (hasGreyscale) {
+    // Planes are stored as drawn, the display buffer copies take care of the rest
+    bool ok = file.read(renderer.getFrameBuffer(), planeSize) == static_cast<int>(planeSize);
+    if (ok) {
+      renderer.copyGrayscaleLsbBuffers();
+      ok = file.read(renderer.getFrameBuffer(), planeSize) == static_cast<int>(planeSize);
+    }
+    if (ok) {
+      renderer.copyGrayscaleMsbBuffers();
+      renderer.displayGrayBuffer();
+    } else {
+      LOG_ERR("SLC", "Short read of greyscale planes from %s", cachePath.c_str());
+    }
+  }
+
+  file.close();
+  LOG_DBG("SLC", "Sleep screen from cache: %s", cachePath.c_str());
+  return true;
+}
+
+bool SleepScreenCache::beginStore(const bool hasGreyscale) {
+  if (!isValid() || !Storage.openFileForWrite("SLC", cachePath, storeFile)) {
+    return false;
+  }
+
+  // The header is written last, an interrupted store leaves a file that fails the version check
+  const uint8_t placeholder[HEADER_SIZE] = {};
+  storeFile.write(placeholder, sizeof(placeholder));
+  storing = true;
+  storeGreyscale = hasGreyscale;
+  planesStored = 0;
+  return true;
+}
+
+void SleepScreenCache::storePlane(const GfxRenderer& renderer) {
+  if (!storing) {
+    return;
+  }
+
+  const size_t planeSize = GfxRenderer::getBufferSize();
+  if (storeFile.write(renderer.getFrameBuffer(), planeSize) != planeSize) {
+    LOG_ERR("SLC", "Failed to write sleep screen plane to %s", cachePath.c_str());
+    storeFile.close();
+    Storage.remove(cachePath.c_str());
+    storing = false;
+    return;
+  }
+  planesStored++;
+}
+
+void SleepScreenCache::commitStore() {
+  if (!storing) {
+    return;
+  }
+  storing = false;
+
+  if (planesStored != (storeGreyscale ? 3 : 1)) {
+    LOG_ERR("SLC", "Incomplete sleep screen (%u planes), discarding", planesStored);
+    storeFile.close();
+    Storage.remove(cachePath.c_str());
+    return;
+  }
+
+  storeFile.seek(0);
+  serialization::writePod(storeFile, SLEEP_CACHE_FILE_VERSION);
+  serialization::writePod(storeFile, key.pathHash);
+  serialization::writePod(storeFile, key.size);
+  serialization::writePod(storeFile, key.contentHash);
+  serialization::writePod(storeFile, key.coverMode);
+  serialization::writePod(storeFile, key.coverFilter);
+  serialization::writePod(storeFile, key.orientation);
+  serialization::writePod(storeFile, static_cast<uint8_t>(storeGreyscale ? 1 : 0));
+  serialization::writePod(storeFile, static_cast<uint32_t>(GfxRenderer::getBufferSize()));
+  storeFile.close();
+  LOG_DBG("SLC", "Stored sleep screen: %s", cachePath.c_str());
+}
+
+void SleepScreenCache::clear() {
+  auto root = Storage.open(CACHE_DIR);
+  if (root && root.isDirectory()) {
+    char name[64];
+    for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+      file.getName(name, sizeof(name));
+      const bool isSleepCache = !file.isDirectory() && strncmp(name, "sleep_", 6) == 0 && strstr(name, ".fb");
+      file.close();
+      if (isSleepCache) {
+        Storage.remove((std::string(CACHE_DIR) + "/" + name).c_str());
+      }
+    }
+  }
+  if (root) root.close();
+}
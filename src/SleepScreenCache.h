@@ -0,0 +1,55 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <cstdint>
+#include <string>
+
+class GfxRenderer;
+
+/**
+ * Cache of fully rendered sleep screens, one file per source image under /.crosspoint/.
+ *
+ * Each file holds the raw frame buffer planes exactly as they are sent to the display: the BW plane and, for
+ * greyscale images, the LSB and MSB planes. A hit skips BMP parsing, scaling and dithering entirely; showing the
+ * sleep screen becomes one sequential read per plane straight into the frame buffer. Entries are keyed on the
+ * source path, its size, a hash of its header and a strided sample of its pixel data, the cover mode and filter
+ * settings and the render orientation, so any change to the image or to how it would be drawn causes a re-render.
+ * The mtime is not used: the device never writes it, so an image replaced over the web server would keep it.
+ */
+class SleepScreenCache {
+  struct Key {
+    uint32_t pathHash = 0;
+    uint32_t size = 0;
+    uint32_t contentHash = 0;
+    uint8_t coverMode = 0;
+    uint8_t coverFilter = 0;
+    uint8_t orientation = 0;
+  };
+
+  Key key;
+  std::string cachePath;
+  FsFile storeFile;
+  bool storing = false;
+  bool storeGreyscale = false;
+  uint8_t planesStored = 0;
+
+ public:
+  // Builds the key from the source file on SD. isValid() is false if the source cannot be opened.
+  SleepScreenCache(const GfxRenderer& renderer, const std::string& sourcePath);
+  ~SleepScreenCache();
+
+  bool isValid() const { return !cachePath.empty(); }
+
+  // Show the cached sleep screen (BW refresh, then the greyscale pass if stored). Returns false on a cache miss,
+  // in which case nothing has been drawn.
+  bool render(GfxRenderer& renderer) const;
+
+  // Record a render in progress: call beginStore before drawing, storePlane each time a plane is complete in the
+  // frame buffer (BW, then LSB and MSB for greyscale images) and commitStore once all planes are written.
+  bool beginStore(bool hasGreyscale);
+  void storePlane(const GfxRenderer& renderer);
+  void commitStore();
+
+  // Drop all cached sleep screens, e.g. after the book caches were wiped
+  static void clear();
+};
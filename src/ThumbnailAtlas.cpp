@@ -0,0 +1,377 @@
+#include "ThumbnailAtlas.h"
+
+#include <Bitmap.h>
+#include <Epub.h>
+#include <GfxRenderer.h>
+#include <Logging.h>
+#include <Serialization.h>
+#include <Xtc.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace {
+constexpr uint8_t ATLAS_FILE_VERSION = 2;
+constexpr char CACHE_DIR[] = "/.crosspoint";
+// version + thumb height + slot count
+constexpr uint32_t HEADER_SIZE = sizeof(uint8_t) + sizeof(uint16_t) + sizeof(uint16_t);
+// key + stamp + offset + width + height
+constexpr uint32_t SLOT_SIZE = 3 * sizeof(uint32_t) + 2 * sizeof(uint16_t);
+constexpr uint32_t DATA_START = HEADER_SIZE + ThumbnailAtlas::MAX_SLOTS * SLOT_SIZE;
+// Start over once this much of the card is spent on (partly dead) thumbnails
+constexpr uint32_t MAX_ATLAS_SIZE = 4 * 1024 * 1024;
+}  // namespace
+
+ThumbnailAtlas ThumbnailAtlas::instance;
+
+std::string ThumbnailAtlas::atlasPath() const {
+  return std::string(CACHE_DIR) + "/thumbs_" + std::to_string(thumbHeight) + ".atlas";
+}
+
+bool ThumbnailAtlas::ensureLoaded(const uint16_t height) {
+  if (loaded && thumbHeight == height) {
+    return true;
+  }
+
+  thumbHeight = height;
+  slots.clear();
+  loaded = true;
+
+  const std::string path = atlasPath();
+  if (!Storage.exists(path.c_str())) {
+    return true;
+  }
+
+  FsFile file;
+  if (!Storage.openFileForRead("ATL", path, file)) {
+    return false;
+  }
+
+  uint8_t version;
+  uint16_t storedHeight;
+  uint16_t count;
+  serialization::readPod(file, version);
+  serialization::readPod(file, storedHeight);
+  serialization::readPod(file, count);
+  if (version != ATLAS_FILE_VERSION || storedHeight != height || count > MAX_SLOTS) {
+    LOG_DBG("ATL", "Discarding atlas %s (version %u, height %u, count %u)", path.c_str(), version, storedHeight,
+            count);
+    file.close();
+    return reset();
+  }
+
+  slots.resize(count);
+  for (auto& slot : slots) {
+    serialization::readPod(file, slot.key);
+    serialization::readPod(file, slot.stamp);
+    serialization::readPod(file, slot.offset);
+    serialization::readPod(file, slot.width);
+    serialization::readPod(file, slot.height);
+  }
+  file.close();
+
+  LOG_DBG("ATL", "Loaded atlas %s with %u thumbnails", path.c_str(), count);
+  return true;
+}
+
+const ThumbnailAtlas::Slot* ThumbnailAtlas::findSlot(const uint32_t key) const {
+  for (const auto& slot : slots) {
+    if (slot.key == key) {
+      return &slot;
+    }
+  }
+  return nullptr;
+}
+
+bool ThumbnailAtlas::writeSlot(FsFile& file, const size_t index, const Slot& slot) const {
+  if (!file.seek(HEADER_SIZE + index * SLOT_SIZE)) {
+    return false;
+  }
+  serialization::writePod(file, slot.key);
+  serialization::writePod(file, slot.stamp);
+  serialization::writePod(file, slot.offset);
+  serialization::writePod(file, slot.width);
+  serialization::writePod(file, slot.height);
+  return true;
+}
+
+bool ThumbnailAtlas::reset() {
+  Storage.remove(atlasPath().c_str());
+  slots.clear();
+  return true;
+}
+
+bool ThumbnailAtlas::appendSlot(const Slot& slot, const std::string& bmpPath) {
+  Slot stored = slot;
+  uint8_t* pixels = nullptr;
+  size_t pixelBytes = 0;
+
+  if (!bmpPath.empty()) {
+    FsFile bmpFile;
+    if (!Storage.openFileForRead("ATL", bmpPath, bmpFile)) {
+      return false;
+    }
+    Bitmap bitmap(bmpFile);
+    if (bitmap.parseHeaders() != BmpReaderError::Ok) {
+      LOG_ERR("ATL", "Unreadable thumbnail %s", bmpPath.c_str());
+      bmpFile.close();
+      return false;
+    }
+
+    // Center-crop to the atlas cell, same as the themes do when drawing per-book thumbnails
+    const int maxWidth = static_cast<int>(thumbHeight * THUMB_ASPECT);
+    const int outWidth = std::min(bitmap.getWidth(), maxWidth);
+    const int outHeight = std::min(bitmap.getHeight(), static_cast<int>(thumbHeight));
+    const int cropX = (bitmap.getWidth() - outWidth) / 2;
+    const int cropY = (bitmap.getHeight() - outHeight) / 2;
+    const int outRowBytes = (outWidth + 7) / 8;
+
+    pixelBytes = static_cast<size_t>(outRowBytes) * outHeight;
+    pixels = static_cast<uint8_t*>(malloc(pixelBytes));
+    auto* rowBuffer = static_cast<uint8_t*>(malloc(bitmap.getRowBytes()));
+    auto* outputRow = static_cast<uint8_t*>(malloc((bitmap.getWidth() + 3) / 4));
+    if (!pixels || !rowBuffer || !outputRow) {
+      LOG_ERR("ATL", "Failed to allocate thumbnail buffers");
+      free(pixels);
+      free(rowBuffer);
+      free(outputRow);
+      bmpFile.close();
+      return false;
+    }
+    memset(pixels, 0xFF, pixelBytes);
+
+    bool ok = true;
+    for (int bmpY = 0; bmpY < bitmap.getHeight(); bmpY++) {
+      if (bitmap.readNextRow(outputRow, rowBuffer) != BmpReaderError::Ok) {
+        ok = false;
+        break;
+      }
+      const int imageY = (bitmap.isTopDown() ? bmpY : bitmap.getHeight() - 1 - bmpY) - cropY;
+      if (imageY < 0 || imageY >= outHeight) {
+        continue;
+      }
+      uint8_t* dst = pixels + imageY * outRowBytes;
+      for (int x = 0; x < outWidth; x++) {
+        const int srcX = x + cropX;
+        // readNextRow yields 2-bit levels, the two darker ones become ink
+        const uint8_t val = outputRow[srcX / 4] >> (6 - ((srcX * 2) % 8)) & 0x3;
+        if (val < 2) {
+          dst[x / 8] &= ~(0x80 >> (x % 8));
+        }
+      }
+    }
+    free(rowBuffer);
+    free(outputRow);
+    bmpFile.close();
+
+    if (!ok) {
+      LOG_ERR("ATL", "Short read while packing %s", bmpPath.c_str());
+      free(pixels);
+      return false;
+    }
+    stored.width = outWidth;
+    stored.height = outHeight;
+  }
+
+  // Find the slot to (re)use, starting over when the table or the file is full
+  size_t index = slots.size();
+  for (size_t i = 0; i < slots.size(); i++) {
+    if (slots[i].key == stored.key) {
+      index = i;
+      break;
+    }
+  }
+  if (index == slots.size() && slots.size() >= MAX_SLOTS) {
+    LOG_DBG("ATL", "Atlas full, starting over");
+    reset();
+    index = 0;
+  }
+
+  Storage.mkdir(CACHE_DIR);
+  const std::string path = atlasPath();
+  FsFile file = Storage.open(path.c_str(), O_RDWR | O_CREAT);
+  if (!file) {
+    LOG_ERR("ATL", "Failed to open %s", path.c_str());
+    free(pixels);
+    return false;
+  }
+
+  if (file.size() > MAX_ATLAS_SIZE) {
+    LOG_DBG("ATL", "Atlas file too large, starting over");
+    file.close();
+    reset();
+    index = 0;
+    file = Storage.open(path.c_str(), O_RDWR | O_CREAT);
+    if (!file) {
+      free(pixels);
+      return false;
+    }
+  }
+
+  if (file.size() < DATA_START) {
+    // Fresh file: header plus an empty, fixed-size offset table
+    file.seek(0);
+    serialization::writePod(file, ATLAS_FILE_VERSION);
+    serialization::writePod(file, thumbHeight);
+    serialization::writePod(file, static_cast<uint16_t>(0));
+    uint8_t zeros[256] = {};
+    for (uint32_t written = HEADER_SIZE; written < DATA_START;) {
+      const size_t chunk = std::min<uint32_t>(sizeof(zeros), DATA_START - written);
+      file.write(zeros, chunk);
+      written += chunk;
+    }
+  }
+
+  if (pixels) {
+    stored.offset = file.size();
+    file.seek(stored.offset);
+    const size_t written = file.write(pixels, pixelBytes);
+    free(pixels);
+    if (written != pixelBytes) {
+      LOG_ERR("ATL", "Failed to append thumbnail to %s", path.c_str());
+      file.close();
+      return false;
+    }
+  }
+
+  // Table entry last, so an interrupted append never points at missing rows
+  const auto count = static_cast<uint16_t>(std::max(slots.size(), index + 1));
+  if (!writeSlot(file, index, stored) || !file.seek(HEADER_SIZE - sizeof(uint16_t))) {
+    file.close();
+    return false;
+  }
+  serialization::writePod(file, count);
+  file.close();
+
+  if (index == slots.size()) {
+    slots.push_back(stored);
+  } else {
+    slots[index] = stored;
+  }
+  return true;
+}
+
+bool ThumbnailAtlas::has(const std::string& bookPath, const LibraryEntry& entry, const uint16_t height) {
+  if (!ensureLoaded(height)) {
+    return false;
+  }
+  const Slot* slot = findSlot(LibraryCatalog::hashName(bookPath));
+  return slot && slot->stamp == entry.size;
+}
+
+bool ThumbnailAtlas::generate(const std::string& bookPath, const LibraryEntry& entry, const uint16_t height,
+                              const std::function<bool()>& shouldStop) {
+  if (!ensureLoaded(height)) {
+    return false;
+  }
+
+  const unsigned long start = millis();
+  std::string bmpPath;
+  if (entry.format == LibraryEntry::EPUB) {
+    Epub epub(bookPath, CACHE_DIR);
+    if (epub.load(true, true, nullptr, shouldStop)) {
+      // Listing shows the proper title from now on
+      LIBRARY_CATALOG.updateBookMetadata(bookPath, epub.getTitle(), epub.getAuthor(), epub.getThumbBmpPath());
+      if (epub.generateThumbBmp(height, shouldStop)) {
+        bmpPath = epub.getThumbBmpPath(height);
+      }
+    }
+  } else if (entry.format == LibraryEntry::XTC) {
+    Xtc xtc(bookPath, CACHE_DIR);
+    if (xtc.load() && xtc.generateThumbBmp(height)) {
+      bmpPath = xtc.getThumbBmpPath(height);
+    }
+  }
+
+  // A "no cover" slot for a stopped book would stick until the book changes
+  if (bmpPath.empty() && shouldStop && shouldStop()) {
+    return false;
+  }
+
+  // Books without a cover still get a slot so they are not retried on every idle pass
+  Slot slot;
+  slot.key = LibraryCatalog::hashName(bookPath);
+  slot.stamp = entry.size;
+  if (!appendSlot(slot, bmpPath)) {
+    return false;
+  }
+
+  if (!bmpPath.empty()) {
+    // The atlas copy is the one the library draws from
+    Storage.remove(bmpPath.c_str());
+  }
+  LOG_DBG("ATL", "Thumbnail for %s ready in %lu ms", bookPath.c_str(), millis() - start);
+  return true;
+}
+
+void ThumbnailAtlas::forget(const std::string& bookPath) {
+  if (!ensureLoaded(GRID_THUMB_HEIGHT)) {
+    return;
+  }
+  const uint32_t key = LibraryCatalog::hashName(bookPath);
+  for (size_t i = 0; i < slots.size(); i++) {
+    if (slots[i].key != key) {
+      continue;
+    }
+    // Zeroed slots never match a path hash in practice and are reused once the atlas starts over
+    FsFile file = Storage.open(atlasPath().c_str(), O_RDWR);
+    if (!file) {
+      return;
+    }
+    slots[i] = Slot{};
+    writeSlot(file, i, slots[i]);
+    file.close();
+    return;
+  }
+}
+
+bool ThumbnailAtlas::openForDraw(const uint16_t height, FsFile& file) {
+  if (!ensureLoaded(height) || slots.empty()) {
+    return false;
+  }
+  return Storage.openFileForRead("ATL", atlasPath(), file);
+}
+
+bool ThumbnailAtlas::drawThumb(const GfxRenderer& renderer, FsFile& file, const std::string& bookPath, const int x,
+                               const int y, const int maxWidth, const int maxHeight) const {
+  const Slot* slot = findSlot(LibraryCatalog::hashName(bookPath));
+  if (!slot || slot->offset == 0 || !file) {
+    return false;
+  }
+
+  const size_t bytes = static_cast<size_t>((slot->width + 7) / 8) * slot->height;
+  auto* pixels = static_cast<uint8_t*>(malloc(bytes));
+  if (!pixels) {
+    LOG_ERR("ATL", "Failed to allocate thumbnail buffer");
+    return false;
+  }
+  if (!file.seek(slot->offset) || file.read(pixels, bytes) != static_cast<int>(bytes)) {
+    free(pixels);
+    return false;
+  }
+
+  renderer.drawPackedBitmap(pixels, x + std::max(0, (maxWidth - slot->width) / 2),
+                            y + std::max(0, (maxHeight - slot->height) / 2), slot->width, slot->height);
+  free(pixels);
+  return true;
+}
+
+void ThumbnailAtlas::clear() {
+  auto root = Storage.open(CACHE_DIR);
+  if (root && root.isDirectory()) {
+    char name[64];
+    for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
+      file.getName(name, sizeof(name));
+      const bool isAtlas = !file.isDirectory() && strncmp(name, "thumbs_", 7) == 0 && strstr(name, ".atlas");
+      file.close();
+      if (isAtlas) {
+        Storage.remove((std::string(CACHE_DIR) + "/" + name).c_str());
+      }
+    }
+  }
+  if (root) root.close();
+
+  slots.clear();
+  loaded = false;
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <HalStorage.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "LibraryCatalog.h"
+
+class GfxRenderer;
+
+/**
+ * Packed store of library cover thumbnails, one file per thumbnail height under /.crosspoint/.
+ *
+ * The file starts with a fixed-capacity offset table followed by the thumbnails themselves, each stored as raw
+ * 1-bit rows (MSB first, set bit = white, same polarity as the frame buffer) so a screen of covers can be painted
+ * with a single open file, a seek per cover and no image decoding. Thumbnails are appended by an idle-time
+ * generation step; replaced thumbnails leave dead space behind until the atlas fills up and is started over.
+ *
+ * Slots are stamped with the book's file size rather than its mtime, which the device never writes. A replacement of
+ * the same size is caught by the web server dropping the slot through forget() when the book is uploaded, renamed
+ * or deleted.
+ */
+class ThumbnailAtlas {
+  struct Slot {
+    uint32_t key = 0;     // FNV-1a hash of the book path
+    uint32_t stamp = 0;   // Book file size when the thumbnail was made
+    uint32_t offset = 0;  // Offset of the first row in the atlas file, 0 for books without a cover
+    uint16_t width = 0;
+    uint16_t height = 0;
+  };
+
+  static ThumbnailAtlas instance;
+
+  uint16_t thumbHeight = 0;
+  bool loaded = false;
+  std::vector<Slot> slots;
+
+  std::string atlasPath() const;
+  bool ensureLoaded(uint16_t height);
+  const Slot* findSlot(uint32_t key) const;
+  bool appendSlot(const Slot& slot, const std::string& bmpPath);
+  bool writeSlot(FsFile& file, size_t index, const Slot& slot) const;
+  bool reset();
+
+ public:
+  // Maximum number of books an atlas can hold before it is started over
+  static constexpr uint16_t MAX_SLOTS = 512;
+  // Thumbnails are cropped to this aspect ratio (width / height), matching the per-book thumbnails
+  static constexpr float THUMB_ASPECT = 0.6f;
+  // Height of the thumbnails in the library's cover grid
+  static constexpr uint16_t GRID_THUMB_HEIGHT = 180;
+  // Free heap generate() needs: inflating the cover takes about 44 KB (window and decompressor), decoding it one row
+  // of MCUs at the reduced scale
+  static constexpr size_t GENERATE_HEAP_BUDGET = 64 * 1024;
+
+  ~ThumbnailAtlas() = default;
+
+  static ThumbnailAtlas& getInstance() { return instance; }
+
+  // True if the atlas holds an up-to-date thumbnail (or a "no cover" marker) for the book
+  bool has(const std::string& bookPath, const LibraryEntry& entry, uint16_t height);
+
+  // Generate the thumbnail for one book and append it to the atlas. Slow (unzips and decodes the cover), meant to
+  // be called one book at a time while the UI is idle. shouldStop is polled while the book cache is built and the
+  // cover decoded; a stopped generation stores nothing, so the book is tried again. Returns false if nothing could be
+  // stored.
+  bool generate(const std::string& bookPath, const LibraryEntry& entry, uint16_t height,
+                const std::function<bool()>& shouldStop = nullptr);
+
+  // Drop the book's grid thumbnail so the next idle pass makes a new one
+  void forget(const std::string& bookPath);
+
+  // Open the atlas once per screen; pass the handle to drawThumb for every visible cover
+  bool openForDraw(uint16_t height, FsFile& file);
+  // Draw the book's thumbnail centered in the given box. Returns false if the book has no thumbnail yet.
+  bool drawThumb(const GfxRenderer& renderer, FsFile& file, const std::string& bookPath, int x, int y, int maxWidth,
+                 int maxHeight) const;
+
+  // Drop all atlases, e.g. after the book caches were wiped
+  void clear();
+};
+
+// Helper macro to access the thumbnail atlas
+#define THUMBNAIL_ATLAS ThumbnailAtlas::getInstance()
@@ -2,6 +2,7 @@
 
 #include <Logging.h>
 
+#include <functional>
 #include <string>
 #include <utility>
 
@@ -24,4 +25,7 @@ class Activity {
   virtual bool skipLoopDelay() { return false; }
   virtual bool preventAutoSleep() { return false; }
   virtual bool isReaderActivity() const { return false; }
+  // Runs background work from the main loop while the activity is idle, keeping its display task off the SD card
+  // and the renderer meanwhile. Returns false without running it if the activity cannot do that right now.
+  virtual bool runIdleWork(const std::function<void()>& /*work*/) { return false; }
 };
@@ -1,5 +1,7 @@
 #include "ActivityWithSubactivity.h"
 
+#include <GfxRenderer.h>
+
 void ActivityWithSubactivity::exitActivity() {
   if (subActivity) {
     subActivity->onExit();
@@ -8,6 +10,8 @@ void ActivityWithSubactivity::exitActivity() {
 }
 
 void ActivityWithSubactivity::enterNewActivity(Activity* activity) {
+  // Activities read the card as they start, without holding the bus against a refresh taking it back
+  renderer.waitForRefresh();
   subActivity.reset(activity);
   subActivity->onEnter();
 }
@@ -13,6 +13,7 @@
 #include "Battery.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
@@ -64,7 +65,14 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
   for (RecentBook& book : recentBooks) {
     if (!book.coverBmpPath.empty()) {
       std::string coverPath = UITheme::getCoverThumbPath(book.coverBmpPath, coverHeight);
-      if (!Storage.exists(coverPath.c_str())) {
+      // The catalog remembers generated thumbnails, which saves an SD lookup per book on every visit
+      if (LIBRARY_CATALOG.thumbHeightFor(book.path) == coverHeight) {
+        progress++;
+        continue;
+      }
+      if (Storage.exists(coverPath.c_str())) {
+        LIBRARY_CATALOG.markThumbReady(book.path, coverHeight);
+      } else {
         // If epub, try to load the metadata for title/author and cover
         if (StringUtils::checkFileExtension(book.path, ".epub")) {
           Epub epub(book.path, "/.crosspoint");
@@ -77,8 +85,12 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
             popupRect = GUI.drawPopup(renderer, "Loading...");
           }
           GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
-          bool success = epub.generateThumbBmp(coverHeight);
-          if (!success) {
+          // Both themes' thumbnails come out of one reduced-scale decode. The full-screen covers are left to the
+          // sleep screen, asking for them here would force a near full-resolution decode.
+          bool success = epub.generateCoverBmps(false, false, UITheme::getCoverThumbHeights());
+          if (success) {
+            LIBRARY_CATALOG.markThumbReady(book.path, coverHeight);
+          } else {
             RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
             book.coverBmpPath = "";
           }
@@ -96,7 +108,9 @@ void HomeActivity::loadRecentCovers(int coverHeight) {
             }
             GUI.fillPopupProgress(renderer, popupRect, 10 + progress * (90 / recentBooks.size()));
             bool success = xtc.generateThumbBmp(coverHeight);
-            if (!success) {
+            if (success) {
+              LIBRARY_CATALOG.markThumbReady(book.path, coverHeight);
+            } else {
               RECENT_BOOKS.updateBook(book.path, book.title, book.author, "");
               book.coverBmpPath = "";
             }
@@ -234,6 +248,20 @@ void HomeActivity::loop() {
   }
 }
 
+bool HomeActivity::runIdleWork(const std::function<void()>& work) {
+  // The recent covers are loaded from the display task, let that finish first
+  if (!recentsLoaded || updateRequired) {
+    return false;
+  }
+  // A display task in the middle of a refresh has the bus, the work waits for the next loop
+  if (xSemaphoreTake(renderingMutex, 0) != pdTRUE) {
+    return false;
+  }
+  work();
+  xSemaphoreGive(renderingMutex);
+  return true;
+}
+
 void HomeActivity::displayTaskLoop() {
   while (true) {
     if (updateRequired) {
@@ -60,4 +60,5 @@ class HomeActivity final : public Activity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  bool runIdleWork(const std::function<void()>& work) override;
 };
@@ -5,105 +5,119 @@
 
 #include <algorithm>
 
+#include "CrossPointSettings.h"
 #include "MappedInputManager.h"
+#include "ThumbnailAtlas.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
-#include "util/StringUtils.h"
 
 namespace {
 constexpr unsigned long GO_HOME_MS = 1000;
+// Cover grid geometry
+constexpr int GRID_THUMB_HEIGHT = ThumbnailAtlas::GRID_THUMB_HEIGHT;
+constexpr int GRID_THUMB_WIDTH = static_cast<int>(GRID_THUMB_HEIGHT * ThumbnailAtlas::THUMB_ASPECT);
+constexpr int GRID_TILE_PADDING = 8;
+constexpr int GRID_TILE_WIDTH = GRID_THUMB_WIDTH + 2 * GRID_TILE_PADDING + 24;
+constexpr int GRID_LABEL_HEIGHT = 26;
+constexpr int GRID_TILE_HEIGHT = GRID_THUMB_HEIGHT + 2 * GRID_TILE_PADDING + GRID_LABEL_HEIGHT;
+// Missing thumbnails are only generated after the buttons have been left alone for this long
+constexpr unsigned long THUMB_IDLE_MS = 1500;
 }  // namespace
 
-void sortFileList(std::vector<std::string>& strs) {
-  std::sort(begin(strs), end(strs), [](const std::string& str1, const std::string& str2) {
-    // Directories first
-    bool isDir1 = str1.back() == '/';
-    bool isDir2 = str2.back() == '/';
-    if (isDir1 != isDir2) return isDir1;
-
-    // Start naive natural sort
-    const char* s1 = str1.c_str();
-    const char* s2 = str2.c_str();
-
-    // Iterate while both strings have characters
-    while (*s1 && *s2) {
-      // Check if both are at the start of a number
-      if (isdigit(*s1) && isdigit(*s2)) {
-        // Skip leading zeros and track them
-        const char* start1 = s1;
-        const char* start2 = s2;
-        while (*s1 == '0') s1++;
-        while (*s2 == '0') s2++;
-
-        // Count digits to compare lengths first
-        int len1 = 0, len2 = 0;
-        while (isdigit(s1[len1])) len1++;
-        while (isdigit(s2[len2])) len2++;
-
-        // Different length so return smaller integer value
-        if (len1 != len2) return len1 < len2;
-
-        // Same length so compare digit by digit
-        for (int i = 0; i < len1; i++) {
-          if (s1[i] != s2[i]) return s1[i] < s2[i];
-        }
-
-        // Numbers equal so advance pointers
-        s1 += len1;
-        s2 += len2;
-      } else {
-        // Regular case-insensitive character comparison
-        char c1 = tolower(*s1);
-        char c2 = tolower(*s2);
-        if (c1 != c2) return c1 < c2;
-        s1++;
-        s2++;
-      }
-    }
-
-    // One string is prefix of other
-    return *s1 == '\0' && *s2 != '\0';
-  });
-}
-
 void MyLibraryActivity::taskTrampoline(void* param) {
   auto* self = static_cast<MyLibraryActivity*>(param);
   self->displayTaskLoop();
 }
 
 void MyLibraryActivity::loadFiles() {
-  files.clear();
+  LIBRARY_CATALOG.loadFolder(basepath, files);
+  // The index is trusted for the first paint, then checked against the directory once idle
+  revalidatePending = true;
+  thumbsComplete = false;
+}
 
-  auto root = Storage.open(basepath.c_str());
-  if (!root || !root.isDirectory()) {
-    if (root) root.close();
-    return;
+bool MyLibraryActivity::isGridView() { return SETTINGS.libraryView == CrossPointSettings::LIBRARY_GRID; }
+
+int MyLibraryActivity::contentTop() const {
+  const auto metrics = UITheme::getInstance().getMetrics();
+  return metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
+}
+
+int MyLibraryActivity::contentHeight() const {
+  const auto metrics = UITheme::getInstance().getMetrics();
+  return renderer.getScreenHeight() - contentTop() - metrics.buttonHintsHeight - metrics.verticalSpacing;
+}
+
+int MyLibraryActivity::gridColumns() const { return std::max(1, renderer.getScreenWidth() / GRID_TILE_WIDTH); }
+
+int MyLibraryActivity::gridRows() const { return std::max(1, contentHeight() / GRID_TILE_HEIGHT); }
+
+int MyLibraryActivity::itemsPerPage() const {
+  if (isGridView()) {
+    return gridColumns() * gridRows();
   }
+  return UITheme::getInstance().getNumberOfItemsPerPage(renderer, true, false, true, false);
+}
 
-  root.rewindDirectory();
+void MyLibraryActivity::startThumbnailJob() {
+  JobScheduler::JobSpec spec;
+  spec.name = "grid thumbnails";
+  spec.priority = JobScheduler::Priority::NORMAL;
+  // Waits while the heap is short instead of failing the cover decode and marking the book as having none
+  spec.heapBudget = ThumbnailAtlas::GENERATE_HEAP_BUDGET;
+  spec.isRunnable = [this] { return !updateRequired && millis() - lastInputTime >= THUMB_IDLE_MS; };
+  // One book per step, run from runIdleWork with the rendering mutex held
+  spec.step = [this](JobScheduler::Context& context) { return generateNextThumbnail(context); };
+  spec.onDone = [this](bool) { thumbnailJob = JobScheduler::NO_JOB; };
+  thumbnailJob = JOB_SCHEDULER.submit(std::move(spec));
+}
+
+bool MyLibraryActivity::generateNextThumbnail(const JobScheduler::Context& context) {
+  // Visible page first, then the rest of the folder
+  const size_t pageItems = itemsPerPage();
+  const size_t pageStart = selectorIndex / pageItems * pageItems;
+  const std::string prefix = basepath.back() == '/' ? basepath : basepath + "/";
 
-  char name[500];
-  for (auto file = root.openNextFile(); file; file = root.openNextFile()) {
-    file.getName(name, sizeof(name));
-    if (name[0] == '.' || strcmp(name, "System Volume Information") == 0) {
-      file.close();
+  for (size_t n = 0; n < files.size(); n++) {
+    const size_t i = (pageStart + n) % files.size();
+    const LibraryEntry& entry = files[i];
+    if (entry.isDirectory() || THUMBNAIL_ATLAS.has(prefix + entry.name, entry, GRID_THUMB_HEIGHT)) {
       continue;
     }
 
-    if (file.isDirectory()) {
-      files.emplace_back(std::string(name) + "/");
-    } else {
-      auto filename = std::string(name);
-      if (StringUtils::checkFileExtension(filename, ".epub") || StringUtils::checkFileExtension(filename, ".xtch") ||
-          StringUtils::checkFileExtension(filename, ".xtc") || StringUtils::checkFileExtension(filename, ".txt") ||
-          StringUtils::checkFileExtension(filename, ".md")) {
-        files.emplace_back(filename);
+    // Building the book cache and decoding the cover take seconds, a press stops them and the book is redone
+    if (!THUMBNAIL_ATLAS.generate(prefix + entry.name, entry, GRID_THUMB_HEIGHT,
+                                  [&context] { return context.isInterrupted(); })) {
+      if (context.isInterrupted()) {
+        return true;
       }
+      // Do not spin on a book that keeps failing, the next visit retries it
+      thumbsComplete = true;
+      return false;
     }
-    file.close();
+    // Pick up the title the book cache may just have produced
+    LIBRARY_CATALOG.findBook(prefix + entry.name, files[i]);
+    if (i >= pageStart && i < pageStart + pageItems) {
+      updateRequired = true;
+    }
+    return true;
   }
-  root.close();
-  sortFileList(files);
+  thumbsComplete = true;
+  return false;
+}
+
+bool MyLibraryActivity::runIdleWork(const std::function<void()>& work) {
+  // The folder's own upkeep goes first
+  if (updateRequired || revalidatePending) {
+    return false;
+  }
+  // A display task in the middle of a refresh has the bus, the work waits for the next loop
+  if (xSemaphoreTake(renderingMutex, 0) != pdTRUE) {
+    return false;
+  }
+  work();
+  xSemaphoreGive(renderingMutex);
+  return true;
 }
 
 void MyLibraryActivity::onEnter() {
@@ -114,6 +128,7 @@ void MyLibraryActivity::onEnter() {
   loadFiles();
 
   selectorIndex = 0;
+  lastInputTime = millis();
   updateRequired = true;
 
   xTaskCreate(&MyLibraryActivity::taskTrampoline, "MyLibraryActivityTask",
@@ -129,6 +144,7 @@ void MyLibraryActivity::onExit() {
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  JOB_SCHEDULER.cancel(thumbnailJob);
   if (displayTaskHandle) {
     vTaskDelete(displayTaskHandle);
     displayTaskHandle = nullptr;
@@ -140,6 +156,29 @@ void MyLibraryActivity::onExit() {
 }
 
 void MyLibraryActivity::loop() {
+  // Once the cached listing is on screen, make sure the folder was not changed outside of the catalog
+  if (revalidatePending && !updateRequired) {
+    revalidatePending = false;
+    // The walk touches every directory entry, so it runs without the mutex and only the swap is guarded
+    std::vector<LibraryEntry> refreshed;
+    if (LIBRARY_CATALOG.revalidateFolder(basepath, refreshed)) {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      files = std::move(refreshed);
+      if (selectorIndex >= files.size()) {
+        selectorIndex = 0;
+      }
+      updateRequired = true;
+      xSemaphoreGive(renderingMutex);
+    }
+  }
+
+  if (mappedInput.wasAnyPressed() || mappedInput.wasAnyReleased()) {
+    lastInputTime = millis();
+  }
+  if (isGridView() && !thumbsComplete && thumbnailJob == JobScheduler::NO_JOB) {
+    startThumbnailJob();
+  }
+
   // Long press BACK (1s+) goes to root folder
   if (mappedInput.isPressed(MappedInputManager::Button::Back) && mappedInput.getHeldTime() >= GO_HOME_MS &&
       basepath != "/") {
@@ -150,7 +189,7 @@ void MyLibraryActivity::loop() {
     return;
   }
 
-  const int pageItems = UITheme::getInstance().getNumberOfItemsPerPage(renderer, true, false, true, false);
+  const int pageItems = itemsPerPage();
 
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     if (files.empty()) {
@@ -158,13 +197,14 @@ void MyLibraryActivity::loop() {
     }
 
     if (basepath.back() != '/') basepath += "/";
-    if (files[selectorIndex].back() == '/') {
-      basepath += files[selectorIndex].substr(0, files[selectorIndex].length() - 1);
+    const std::string& selected = files[selectorIndex].name;
+    if (files[selectorIndex].isDirectory()) {
+      basepath += selected.substr(0, selected.length() - 1);
       loadFiles();
       selectorIndex = 0;
       updateRequired = true;
     } else {
-      onSelectBook(basepath + files[selectorIndex]);
+      onSelectBook(basepath + selected);
       return;
     }
   }
@@ -229,20 +269,21 @@ void MyLibraryActivity::render() const {
   renderer.clearScreen();
 
   const auto pageWidth = renderer.getScreenWidth();
-  const auto pageHeight = renderer.getScreenHeight();
   auto metrics = UITheme::getInstance().getMetrics();
 
   auto folderName = basepath == "/" ? "SD card" : basepath.substr(basepath.rfind('/') + 1).c_str();
   GUI.drawHeader(renderer, Rect{0, metrics.topPadding, pageWidth, metrics.headerHeight}, folderName);
 
-  const int contentTop = metrics.topPadding + metrics.headerHeight + metrics.verticalSpacing;
-  const int contentHeight = pageHeight - contentTop - metrics.buttonHintsHeight - metrics.verticalSpacing;
+  const int top = contentTop();
+  const int height = contentHeight();
   if (files.empty()) {
-    renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, contentTop + 20, "No books found");
+    renderer.drawText(UI_10_FONT_ID, metrics.contentSidePadding, top + 20, "No books found");
+  } else if (isGridView()) {
+    renderGrid(top);
   } else {
     GUI.drawList(
-        renderer, Rect{0, contentTop, pageWidth, contentHeight}, files.size(), selectorIndex,
-        [this](int index) { return files[index]; }, nullptr, nullptr, nullptr);
+        renderer, Rect{0, top, pageWidth, height}, files.size(), selectorIndex,
+        [this](int index) { return files[index].name; }, nullptr, nullptr, nullptr);
   }
 
   // Help text
@@ -252,8 +293,53 @@ void MyLibraryActivity::render() const {
   renderer.displayBuffer();
 }
 
+void MyLibraryActivity::renderGrid(const int top) const {
+  const int columns = gridColumns();
+  const int pageItems = columns * gridRows();
+  const int pageStart = static_cast<int>(selectorIndex) / pageItems * pageItems;
+  const int pageEnd = std::min(pageStart + pageItems, static_cast<int>(files.size()));
+  const int sideMargin = (renderer.getScreenWidth() - columns * GRID_TILE_WIDTH) / 2;
+  const std::string prefix = basepath.back() == '/' ? basepath : basepath + "/";
+
+  // One open file for the whole page, every cover is a seek and a raw row copy
+  FsFile atlasFile;
+  const bool atlasOpen = THUMBNAIL_ATLAS.openForDraw(GRID_THUMB_HEIGHT, atlasFile);
+
+  for (int i = pageStart; i < pageEnd; i++) {
+    const LibraryEntry& entry = files[i];
+    const int tileX = sideMargin + ((i - pageStart) % columns) * GRID_TILE_WIDTH;
+    const int tileY = top + ((i - pageStart) / columns) * GRID_TILE_HEIGHT;
+    const int coverX = tileX + (GRID_TILE_WIDTH - GRID_THUMB_WIDTH) / 2;
+    const int coverY = tileY + GRID_TILE_PADDING;
+
+    const bool coverDrawn = !entry.isDirectory() && atlasOpen &&
+                            THUMBNAIL_ATLAS.drawThumb(renderer, atlasFile, prefix + entry.name, coverX, coverY,
+                                                      GRID_THUMB_WIDTH, GRID_THUMB_HEIGHT);
+    if (!coverDrawn) {
+      if (entry.isDirectory()) {
+        renderer.fillRectDither(coverX, coverY, GRID_THUMB_WIDTH, GRID_THUMB_HEIGHT, Color::LightGray);
+      }
+      renderer.drawRect(coverX, coverY, GRID_THUMB_WIDTH, GRID_THUMB_HEIGHT);
+    }
+
+    const std::string& label = entry.title.empty() ? entry.name : entry.title;
+    const std::string text =
+        renderer.truncatedText(UI_10_FONT_ID, label.c_str(), GRID_TILE_WIDTH - 2 * GRID_TILE_PADDING);
+    const int textX = tileX + (GRID_TILE_WIDTH - renderer.getTextWidth(UI_10_FONT_ID, text.c_str())) / 2;
+    renderer.drawText(UI_10_FONT_ID, textX, coverY + GRID_THUMB_HEIGHT + GRID_TILE_PADDING / 2, text.c_str());
+
+    if (i == static_cast<int>(selectorIndex)) {
+      renderer.drawRoundedRect(tileX + 2, tileY + 2, GRID_TILE_WIDTH - 4, GRID_TILE_HEIGHT - 4, 3, 6, true);
+    }
+  }
+
+  if (atlasOpen) {
+    atlasFile.close();
+  }
+}
+
 size_t MyLibraryActivity::findEntry(const std::string& name) const {
   for (size_t i = 0; i < files.size(); i++)
-    if (files[i] == name) return i;
+    if (files[i].name == name) return i;
   return 0;
 }
\ No newline at end of file
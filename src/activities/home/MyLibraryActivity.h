@@ -1,4 +1,5 @@
 #pragma once
+#include <JobScheduler.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
@@ -8,6 +9,7 @@
 #include <vector>
 
 #include "../Activity.h"
+#include "LibraryCatalog.h"
 #include "RecentBooksStore.h"
 #include "util/ButtonNavigator.h"
 
@@ -19,10 +21,15 @@ class MyLibraryActivity final : public Activity {
 
   size_t selectorIndex = 0;
   bool updateRequired = false;
+  bool revalidatePending = false;
+  // Cover grid: set once every book in the folder has an atlas thumbnail
+  bool thumbsComplete = false;
+  JobScheduler::JobId thumbnailJob = JobScheduler::NO_JOB;
+  unsigned long lastInputTime = 0;
 
   // Files state
   std::string basepath = "/";
-  std::vector<std::string> files;
+  std::vector<LibraryEntry> files;
 
   // Callbacks
   const std::function<void(const std::string& path)> onSelectBook;
@@ -31,6 +38,15 @@ class MyLibraryActivity final : public Activity {
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
   void render() const;
+  void renderGrid(int top) const;
+  static bool isGridView();
+  int contentTop() const;
+  int contentHeight() const;
+  int gridColumns() const;
+  int gridRows() const;
+  int itemsPerPage() const;
+  void startThumbnailJob();
+  bool generateNextThumbnail(const JobScheduler::Context& context);
 
   // Data loading
   void loadFiles();
@@ -48,4 +64,5 @@ class MyLibraryActivity final : public Activity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  bool runIdleWork(const std::function<void()>& work) override;
 };
@@ -1,24 +1,28 @@
 #include "EpubReaderActivity.h"
 
+#include <Epub/BookPaginationJob.h>
 #include <Epub/Page.h>
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
+#include <HalSpiBus.h>
 #include <HalStorage.h>
 #include <Logging.h>
 
+#include <algorithm>
+
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "EpubReaderChapterSelectionActivity.h"
 #include "EpubReaderPercentSelectionActivity.h"
 #include "KOReaderCredentialStore.h"
 #include "KOReaderSyncActivity.h"
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 
 namespace {
-// pagesPerRefresh now comes from SETTINGS.getRefreshFrequency()
 constexpr unsigned long skipChapterMs = 700;
 constexpr unsigned long goHomeMs = 1000;
 constexpr int statusBarMargin = 19;
@@ -79,17 +83,20 @@ void EpubReaderActivity::onEnter() {
 
   FsFile f;
   if (Storage.openFileForRead("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[6];
-    int dataSize = f.read(data, 6);
-    if (dataSize == 4 || dataSize == 6) {
+    uint8_t data[10];
+    int dataSize = f.read(data, 10);
+    if (dataSize == 4 || dataSize == 6 || dataSize == 10) {
       currentSpineIndex = data[0] + (data[1] << 8);
       nextPageNumber = data[2] + (data[3] << 8);
       cachedSpineIndex = currentSpineIndex;
       LOG_DBG("ERS", "Loaded cache: %d, %d", currentSpineIndex, nextPageNumber);
     }
-    if (dataSize == 6) {
+    if (dataSize == 6 || dataSize == 10) {
       cachedChapterTotalPageCount = data[4] + (data[5] << 8);
     }
+    if (dataSize == 10) {
+      cachedPageSourceOffset = data[6] | (data[7] << 8) | (data[8] << 16) | (static_cast<uint32_t>(data[9]) << 24);
+    }
     f.close();
   }
   // We may want a better condition to detect if we are opening for the first time.
@@ -129,6 +136,12 @@ void EpubReaderActivity::onExit() {
 
   // Wait until not rendering to delete task to avoid killing mid-instruction to EPD
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  // Pages counted so far are saved, counting again picks up from there
+  JOB_SCHEDULER.cancel(paginationJob);
+  renderer.stopGhostingTracking();
+  LOG_DBG("ERS", "Pages drawn ahead: %lu shown, %lu thrown away", static_cast<unsigned long>(prerendered.getHits()),
+          static_cast<unsigned long>(prerendered.getMisses()));
+  prerendered.release();
   if (displayTaskHandle) {
     vTaskDelete(displayTaskHandle);
     displayTaskHandle = nullptr;
@@ -137,6 +150,10 @@ void EpubReaderActivity::onExit() {
   renderingMutex = nullptr;
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  if (epub && section && section->pageCount > 0) {
+    const float bookProgress = calculateBookProgress();
+    LIBRARY_CATALOG.updateProgress(epub->getPath(), clampPercent(static_cast<int>(bookProgress + 0.5f)));
+  }
   section.reset();
   epub.reset();
 }
@@ -193,12 +210,11 @@ void EpubReaderActivity::loop() {
     xSemaphoreTake(renderingMutex, portMAX_DELAY);
     const int currentPage = section ? section->currentPage + 1 : 0;
     const int totalPages = section ? section->pageCount : 0;
-    float bookProgress = 0.0f;
-    if (epub && epub->getBookSize() > 0 && section && section->pageCount > 0) {
-      const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
-      bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
-    }
+    const float bookProgress = calculateBookProgress();
     const int bookProgressPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
+    // The menu's jumps replace turns that have not been drawn, and its settings may change the status bar
+    pageTurns.clear();
+    prerendered.invalidate();
     exitActivity();
     enterNewActivity(new EpubReaderMenuActivity(
         this->renderer, this->mappedInput, epub->getTitle(), currentPage, totalPages, bookProgressPercent,
@@ -246,49 +262,15 @@ void EpubReaderActivity::loop() {
   }
 
   const bool skipChapter = SETTINGS.longPressChapterSkip && mappedInput.getHeldTime() > skipChapterMs;
+  const int direction = prevTriggered ? -1 : 1;
 
+  // The display task applies the turns when it starts its next render, so presses during a refresh add up to one
   if (skipChapter) {
-    // We don't want to delete the section mid-render, so grab the semaphore
-    xSemaphoreTake(renderingMutex, portMAX_DELAY);
-    nextPageNumber = 0;
-    currentSpineIndex = nextTriggered ? currentSpineIndex + 1 : currentSpineIndex - 1;
-    section.reset();
-    xSemaphoreGive(renderingMutex);
-    updateRequired = true;
-    return;
-  }
-
-  // No current section, attempt to rerender the book
-  if (!section) {
-    updateRequired = true;
-    return;
-  }
-
-  if (prevTriggered) {
-    if (section->currentPage > 0) {
-      section->currentPage--;
-    } else {
-      // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      nextPageNumber = UINT16_MAX;
-      currentSpineIndex--;
-      section.reset();
-      xSemaphoreGive(renderingMutex);
-    }
-    updateRequired = true;
+    pageTurns.addChapters(direction);
   } else {
-    if (section->currentPage < section->pageCount - 1) {
-      section->currentPage++;
-    } else {
-      // We don't want to delete the section mid-render, so grab the semaphore
-      xSemaphoreTake(renderingMutex, portMAX_DELAY);
-      nextPageNumber = 0;
-      currentSpineIndex++;
-      section.reset();
-      xSemaphoreGive(renderingMutex);
-    }
-    updateRequired = true;
+    pageTurns.addPages(direction);
   }
+  updateRequired = true;
 }
 
 void EpubReaderActivity::onReaderMenuBack(const uint8_t orientation) {
@@ -314,6 +296,23 @@ void EpubReaderActivity::jumpToPercent(int percent) {
   // Normalize input to 0-100 to avoid invalid jumps.
   percent = clampPercent(percent);
 
+  // A paginated book jumps straight to the page at that percentage
+  if (hasCompletePageTable()) {
+    const uint32_t totalPages = pageTable->getTotalPages();
+    const uint32_t targetPage =
+        std::min(totalPages - 1, static_cast<uint32_t>(static_cast<uint64_t>(totalPages) * percent / 100));
+    int targetSpineIndex;
+    int targetPageInSpine;
+    if (pageTable->locate(targetPage, &targetSpineIndex, &targetPageInSpine)) {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      currentSpineIndex = targetSpineIndex;
+      nextPageNumber = targetPageInSpine;
+      section.reset();
+      xSemaphoreGive(renderingMutex);
+      return;
+    }
+  }
+
   // Convert percent into a byte-like absolute position across the spine sizes.
   // Use an overflow-safe computation: (bookSize / 100) * percent + (bookSize % 100) * percent / 100
   size_t targetSize =
@@ -382,10 +381,12 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
             exitActivity();
             updateRequired = true;
           },
-          [this](const int newSpineIndex) {
-            if (currentSpineIndex != newSpineIndex) {
+          [this](const int newSpineIndex, const std::string& anchor) {
+            // An anchor needs the section reloaded even within the current spine item to look up its page
+            if (currentSpineIndex != newSpineIndex || !anchor.empty()) {
               currentSpineIndex = newSpineIndex;
               nextPageNumber = 0;
+              pendingAnchor = anchor;
               section.reset();
             }
             exitActivity();
@@ -406,11 +407,7 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
     }
     case EpubReaderMenuActivity::MenuAction::GO_TO_PERCENT: {
       // Launch the slider-based percent selector and return here on confirm/cancel.
-      float bookProgress = 0.0f;
-      if (epub && epub->getBookSize() > 0 && section && section->pageCount > 0) {
-        const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
-        bookProgress = epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
-      }
+      const float bookProgress = calculateBookProgress();
       const int initialPercent = clampPercent(static_cast<int>(bookProgress + 0.5f));
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       exitActivity();
@@ -435,6 +432,14 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
       pendingGoHome = true;
       break;
     }
+    case EpubReaderMenuActivity::MenuAction::COUNT_PAGES: {
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      exitActivity();
+      startBookPagination();
+      updateRequired = true;
+      xSemaphoreGive(renderingMutex);
+      break;
+    }
     case EpubReaderMenuActivity::MenuAction::DELETE_CACHE: {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       if (epub) {
@@ -443,15 +448,18 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
         uint16_t backupSpine = currentSpineIndex;
         uint16_t backupPage = section->currentPage;
         uint16_t backupPageCount = section->pageCount;
+        uint32_t backupSourceOffset = section->currentPageSourceOffset;
 
         section.reset();
+        pageTable.reset();
         // 3. WIPE: Clear the cache directory
         epub->clearCache();
+        LIBRARY_CATALOG.markThumbReady(epub->getPath(), 0);
 
         // 4. RESTORE: Re-setup the directory and rewrite the progress file
         epub->setupCacheDir();
 
-        saveProgress(backupSpine, backupPage, backupPageCount);
+        saveProgress(backupSpine, backupPage, backupPageCount, backupSourceOffset);
       }
       xSemaphoreGive(renderingMutex);
       // Defer go home to avoid race condition with display task
@@ -463,18 +471,23 @@ void EpubReaderActivity::onReaderMenuConfirm(EpubReaderMenuActivity::MenuAction
         xSemaphoreTake(renderingMutex, portMAX_DELAY);
         const int currentPage = section ? section->currentPage : 0;
         const int totalPages = section ? section->pageCount : 0;
+        const uint32_t sourceOffset = section ? section->currentPageSourceOffset : Section::UNKNOWN_SOURCE_OFFSET;
         exitActivity();
         enterNewActivity(new KOReaderSyncActivity(
-            renderer, mappedInput, epub, epub->getPath(), currentSpineIndex, currentPage, totalPages,
+            renderer, mappedInput, epub, epub->getPath(), currentSpineIndex, currentPage, totalPages, sourceOffset,
             [this]() {
               // On cancel - defer exit to avoid use-after-free
               pendingSubactivityExit = true;
             },
-            [this](int newSpineIndex, int newPage) {
+            [this](int newSpineIndex, int newPage, uint32_t newSourceOffset) {
               // On sync complete - update position and defer exit
-              if (currentSpineIndex != newSpineIndex || (section && section->currentPage != newPage)) {
+              if (currentSpineIndex != newSpineIndex || (section && section->currentPage != newPage) ||
+                  newSourceOffset != Section::UNKNOWN_SOURCE_OFFSET) {
                 currentSpineIndex = newSpineIndex;
                 nextPageNumber = newPage;
+                // Found in the chapter: the page is looked up once the section is loaded
+                cachedSpineIndex = newSpineIndex;
+                cachedPageSourceOffset = newSourceOffset;
                 section.reset();
               }
               pendingSubactivityExit = true;
@@ -497,6 +510,7 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
   if (section) {
     cachedSpineIndex = currentSpineIndex;
     cachedChapterTotalPageCount = section->pageCount;
+    cachedPageSourceOffset = section->currentPageSourceOffset;
     nextPageNumber = section->currentPage;
   }
 
@@ -507,8 +521,9 @@ void EpubReaderActivity::applyOrientation(const uint8_t orientation) {
   // Update renderer orientation to match the new logical coordinate system.
   applyReaderOrientation(renderer, SETTINGS.orientation);
 
-  // Reset section to force re-layout in the new orientation.
+  // Reset section to force re-layout in the new orientation. Pages counted for the old one stay in its cache.
   section.reset();
+  JOB_SCHEDULER.cancel(paginationJob);
   xSemaphoreGive(renderingMutex);
 }
 
@@ -519,6 +534,15 @@ void EpubReaderActivity::displayTaskLoop() {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
       renderScreen();
       xSemaphoreGive(renderingMutex);
+    } else if (prerenderPending) {
+      // A turn of its own, so the loop gets the mutex between the page shown and the one drawn ahead. The page is
+      // read while the panel runs the waveform, which lends the bus out.
+      xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      prerenderPending = false;
+      if (section && !subActivity && !updateRequired) {
+        prerenderNextPage(aheadMarginTop, aheadMarginRight, aheadMarginBottom, aheadMarginLeft);
+      }
+      xSemaphoreGive(renderingMutex);
     }
     vTaskDelay(10 / portTICK_PERIOD_MS);
   }
@@ -530,6 +554,15 @@ void EpubReaderActivity::renderScreen() {
     return;
   }
 
+  // Turns pressed since the last render; page turns that run off a chapter are carried into the next one below
+  const int chapterTurns = pageTurns.takeChapters();
+  if (chapterTurns != 0) {
+    currentSpineIndex += chapterTurns;
+    nextPageNumber = 0;
+    section.reset();
+  }
+  pageTurnsToApply += pageTurns.takePages();
+
   // edge case handling for sub-zero spine index
   if (currentSpineIndex < 0) {
     currentSpineIndex = 0;
@@ -541,6 +574,7 @@ void EpubReaderActivity::renderScreen() {
 
   // Show end of book screen
   if (currentSpineIndex == epub->getSpineItemsCount()) {
+    pageTurnsToApply = 0;
     renderer.clearScreen();
     renderer.drawCenteredText(UI_12_FONT_ID, 300, "End of book", true, EpdFontFamily::BOLD);
     renderer.displayBuffer();
@@ -568,13 +602,16 @@ void EpubReaderActivity::renderScreen() {
                             (showProgressBar ? (metrics.bookProgressBarHeight + progressBarMarginTop) : 0);
   }
 
+  const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
+  const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+
   if (!section) {
     const auto filepath = epub->getSpineItem(currentSpineIndex).href;
     LOG_DBG("ERS", "Loading file: %s, index: %d", filepath.c_str(), currentSpineIndex);
     section = std::unique_ptr<Section>(new Section(epub, currentSpineIndex, renderer));
-
-    const uint16_t viewportWidth = renderer.getScreenWidth() - orientedMarginLeft - orientedMarginRight;
-    const uint16_t viewportHeight = renderer.getScreenHeight() - orientedMarginTop - orientedMarginBottom;
+    // Saved with the rest of the state when the reader closes or the device sleeps
+    APP_STATE.readerViewportWidth = viewportWidth;
+    APP_STATE.readerViewportHeight = viewportHeight;
 
     if (!section->loadSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                   SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
@@ -582,6 +619,9 @@ void EpubReaderActivity::renderScreen() {
       LOG_DBG("ERS", "Cache not found, building...");
 
       const auto popupFn = [this]() { GUI.drawPopup(renderer, "Indexing..."); };
+      // Laying out a chapter needs the heap more than the ghosting estimate and the page drawn ahead do
+      renderer.freeGhostingFrame();
+      prerendered.release();
 
       if (!section->createSectionFile(SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(),
                                       SETTINGS.extraParagraphSpacing, SETTINGS.paragraphAlignment, viewportWidth,
@@ -593,6 +633,9 @@ void EpubReaderActivity::renderScreen() {
     } else {
       LOG_DBG("ERS", "Cache found, skipping build...");
     }
+    sectionLoads++;
+    // The section may be in a different layout than the last one, so its page table is read again
+    reloadPageTable();
 
     if (nextPageNumber == UINT16_MAX) {
       section->currentPage = section->pageCount - 1;
@@ -600,8 +643,18 @@ void EpubReaderActivity::renderScreen() {
       section->currentPage = nextPageNumber;
     }
 
-    // handles changes in reader settings and reset to approximate position based on cached progress
-    if (cachedChapterTotalPageCount > 0) {
+    // handles changes in reader settings: back to the page holding the cached position, or to the same relative
+    // position for progress saved without one
+    if (cachedPageSourceOffset != Section::UNKNOWN_SOURCE_OFFSET) {
+      if (currentSpineIndex == cachedSpineIndex) {
+        const int page = section->findPageForSourceOffset(cachedPageSourceOffset);
+        if (page >= 0) {
+          section->currentPage = page;
+        }
+      }
+      cachedPageSourceOffset = Section::UNKNOWN_SOURCE_OFFSET;
+      cachedChapterTotalPageCount = 0;
+    } else if (cachedChapterTotalPageCount > 0) {
       // only goes to relative position if spine index matches cached value
       if (currentSpineIndex == cachedSpineIndex && section->pageCount != cachedChapterTotalPageCount) {
         float progress = static_cast<float>(section->currentPage) / static_cast<float>(cachedChapterTotalPageCount);
@@ -620,6 +673,18 @@ void EpubReaderActivity::renderScreen() {
       section->currentPage = newPage;
       pendingPercentJump = false;
     }
+
+    if (!pendingAnchor.empty()) {
+      const int anchorPage = section->findPageForAnchor(pendingAnchor);
+      if (anchorPage >= 0) {
+        section->currentPage = anchorPage;
+      }
+      pendingAnchor.clear();
+    }
+  }
+
+  if (pageTurnsToApply != 0 && applyPageTurns()) {
+    return renderScreen();
   }
 
   renderer.clearScreen();
@@ -641,75 +706,225 @@ void EpubReaderActivity::renderScreen() {
   }
 
   {
-    auto p = section->loadPageFromSectionFile();
+    const auto start = millis();
+    uint32_t sourceOffset = 0;
+    auto p = prerendered.take(sectionLoads, section->currentPage, &sourceOffset);
+    const bool drawnAhead = p != nullptr;
+    if (drawnAhead) {
+      section->currentPageSourceOffset = sourceOffset;
+      renderer.copyToFrameBuffer(prerendered.getFrame());
+    } else {
+      p = section->loadPageFromSectionFile();
+    }
     if (!p) {
       LOG_ERR("ERS", "Failed to load page from SD - clearing section cache");
       section->clearCache();
       section.reset();
       return renderScreen();
     }
-    const auto start = millis();
-    renderContents(std::move(p), orientedMarginTop, orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
-    LOG_DBG("ERS", "Rendered page in %dms", millis() - start);
+    renderContents(std::move(p), drawnAhead, orientedMarginTop, orientedMarginRight, orientedMarginBottom,
+                   orientedMarginLeft);
+    LOG_DBG("ERS", "Rendered page in %dms%s, %lu drawn ahead shown, %lu thrown away", millis() - start,
+            drawnAhead ? " (drawn ahead)" : "", static_cast<unsigned long>(prerendered.getHits()),
+            static_cast<unsigned long>(prerendered.getMisses()));
   }
-  saveProgress(currentSpineIndex, section->currentPage, section->pageCount);
+  saveProgress(currentSpineIndex, section->currentPage, section->pageCount, section->currentPageSourceOffset);
+  prerenderPending = true;
+  aheadMarginTop = orientedMarginTop;
+  aheadMarginRight = orientedMarginRight;
+  aheadMarginBottom = orientedMarginBottom;
+  aheadMarginLeft = orientedMarginLeft;
 }
 
-void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount) {
+void EpubReaderActivity::prerenderNextPage(const int orientedMarginTop, const int orientedMarginRight,
+                                           const int orientedMarginBottom, const int orientedMarginLeft) {
+  prerendered.releaseIfHeapShort();
+  // Not across chapters, whose section is not loaded yet, nor while the book is paginated, which needs the heap;
+  // turns already pressed are drawn next anyway
+  if (section->currentPage + 1 >= section->pageCount || paginationJob != JobScheduler::NO_JOB ||
+      pageTurns.pendingPages() != 0 || !prerendered.reserve(renderer.getBufferSize())) {
+    return;
+  }
+
+  // The status bar is drawn for the next page, then the section goes back to the page on screen
+  const int shownPage = section->currentPage;
+  const uint32_t shownSourceOffset = section->currentPageSourceOffset;
+  section->currentPage = shownPage + 1;
+  auto page = section->loadPageFromSectionFile();
+  if (page) {
+    // Drawing offscreen does not wait for the refresh of the page on screen
+    renderer.beginOffscreen(prerendered.getFrame());
+    renderer.clearScreen();
+    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+    if (renderer.endOffscreen()) {
+      prerendered.store(sectionLoads, section->currentPage, section->currentPageSourceOffset, std::move(page));
+    }
+  }
+  section->currentPage = shownPage;
+  section->currentPageSourceOffset = shownSourceOffset;
+}
+
+bool EpubReaderActivity::applyPageTurns() {
+  // An empty chapter still takes a turn to get past
+  const int pageCount = std::max(static_cast<int>(section->pageCount), 1);
+  const int target = std::max(0, std::min(section->currentPage, pageCount - 1)) + pageTurnsToApply;
+  if (target >= pageCount) {
+    pageTurnsToApply = target - pageCount;
+    currentSpineIndex++;
+    nextPageNumber = 0;
+    section.reset();
+    return true;
+  }
+  if (target < 0 && currentSpineIndex > 0) {
+    pageTurnsToApply = target + 1;
+    currentSpineIndex--;
+    nextPageNumber = UINT16_MAX;
+    section.reset();
+    return true;
+  }
+  if (section->pageCount > 0) {
+    section->currentPage = std::max(0, target);
+  }
+  pageTurnsToApply = 0;
+  return false;
+}
+
+void EpubReaderActivity::reloadPageTable() {
+  // Book page numbers in the status bar may change
+  prerendered.invalidate();
+  pageTable.reset(new BookPageTable(section->getLayoutCachePath()));
+  // A section loaded from its cache is checked too, its item may have been counted before the cache was rebuilt
+  if (pageTable->load(static_cast<uint16_t>(epub->getSpineItemsCount()))) {
+    pageTable->verify(currentSpineIndex, section->pageCount);
+  }
+}
+
+void EpubReaderActivity::startBookPagination() {
+  if (paginationJob != JobScheduler::NO_JOB || APP_STATE.readerViewportWidth == 0) {
+    return;
+  }
+  // Same layout as the open section, whose viewport was recorded when it loaded
+  auto job = std::make_shared<BookPaginationJob>(
+      epub, renderer, SETTINGS.getReaderFontId(), SETTINGS.getReaderLineCompression(), SETTINGS.extraParagraphSpacing,
+      SETTINGS.paragraphAlignment, APP_STATE.readerViewportWidth, APP_STATE.readerViewportHeight,
+      SETTINGS.hyphenationEnabled, SETTINGS.embeddedStyle);
+
+  JobScheduler::JobSpec spec;
+  spec.name = "count pages";
+  spec.priority = JobScheduler::Priority::NORMAL;
+  // One chapter per step, and each step saves the table, so turning the device off part way loses at most that
+  spec.step = [this, job](JobScheduler::Context& context) {
+    renderer.freeGhostingFrame();
+    prerendered.release();
+    // The step holds the rendering mutex, a page turn must not wait for a whole chapter's layout
+    return job->step([&context] { return context.isInterrupted(); });
+  };
+  spec.onDone = [this, job](const bool completed) {
+    paginationJob = JobScheduler::NO_JOB;
+    if (!completed) {
+      return;
+    }
+    if (job->hasFailed()) {
+      LOG_ERR("ERS", "Book pagination stopped early");
+    }
+    // Runs with the rendering mutex held, from runIdleWork
+    if (section) {
+      reloadPageTable();
+    }
+    updateRequired = true;
+  };
+  paginationJob = JOB_SCHEDULER.submit(std::move(spec));
+}
+
+bool EpubReaderActivity::runIdleWork(const std::function<void()>& work) {
+  if (subActivity || updateRequired || !section) {
+    return false;
+  }
+  // A page being drawn has the renderer and the bus, the work waits for the next loop
+  if (xSemaphoreTake(renderingMutex, 0) != pdTRUE) {
+    return false;
+  }
+  work();
+  xSemaphoreGive(renderingMutex);
+  return true;
+}
+
+float EpubReaderActivity::calculateBookProgress() const {
+  if (!epub || !section || section->pageCount == 0) {
+    return 0.0f;
+  }
+  if (hasCompletePageTable()) {
+    const uint32_t bookPage = pageTable->getFirstPage(currentSpineIndex) + section->currentPage;
+    return static_cast<float>(bookPage) * 100.0f / static_cast<float>(pageTable->getTotalPages());
+  }
+  const float chapterProgress = static_cast<float>(section->currentPage) / static_cast<float>(section->pageCount);
+  return epub->calculateProgress(currentSpineIndex, chapterProgress) * 100.0f;
+}
+
+void EpubReaderActivity::saveProgress(int spineIndex, int currentPage, int pageCount, uint32_t sourceOffset) {
+  // Written while the page is refreshed
+  HalSpiBus::Lock bus;
   FsFile f;
   if (Storage.openFileForWrite("ERS", epub->getCachePath() + "/progress.bin", f)) {
-    uint8_t data[6];
+    uint8_t data[10];
     data[0] = currentSpineIndex & 0xFF;
     data[1] = (currentSpineIndex >> 8) & 0xFF;
     data[2] = currentPage & 0xFF;
     data[3] = (currentPage >> 8) & 0xFF;
     data[4] = pageCount & 0xFF;
     data[5] = (pageCount >> 8) & 0xFF;
-    f.write(data, 6);
+    data[6] = sourceOffset & 0xFF;
+    data[7] = (sourceOffset >> 8) & 0xFF;
+    data[8] = (sourceOffset >> 16) & 0xFF;
+    data[9] = (sourceOffset >> 24) & 0xFF;
+    f.write(data, 10);
     f.close();
     LOG_DBG("ERS", "Progress saved: Chapter %d, Page %d", spineIndex, currentPage);
   } else {
     LOG_ERR("ERS", "Could not save progress!");
   }
 }
-void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const int orientedMarginTop,
-                                        const int orientedMarginRight, const int orientedMarginBottom,
-                                        const int orientedMarginLeft) {
-  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-  renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+void EpubReaderActivity::renderContents(std::unique_ptr<Page> page, const bool drawnAhead,
+                                        const int orientedMarginTop, const int orientedMarginRight,
+                                        const int orientedMarginBottom, const int orientedMarginLeft) {
+  if (!drawnAhead) {
+    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+    renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
+  }
+  // Clean refreshes follow the ghosting the fast ones have left, estimated from the pixels they flipped
+  HalDisplay::RefreshMode refreshMode = renderer.pickRefreshMode(SETTINGS.getRefreshFrequency());
   if (forceInitialFullRefresh) {
-    renderer.displayBuffer(HalDisplay::FULL_REFRESH);
+    refreshMode = HalDisplay::FULL_REFRESH;
     forceInitialFullRefresh = false;
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
   }
 
+  // Without the grayscale passes nothing more is drawn, so the display task lets go while the panel updates
+  if (!SETTINGS.textAntiAliasing) {
+    renderer.displayBufferAsync(refreshMode);
+    return;
+  }
+  renderer.displayBuffer(refreshMode);
+
   // Save bw buffer to reset buffer state after grayscale data sync
   renderer.storeBwBuffer();
 
   // grayscale rendering
   // TODO: Only do this if font supports it
-  if (SETTINGS.textAntiAliasing) {
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleLsbBuffers();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleLsbBuffers();
 
-    // Render and copy to MSB buffer
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
-    renderer.copyGrayscaleMsbBuffers();
+  // Render and copy to MSB buffer
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  page->render(renderer, SETTINGS.getReaderFontId(), orientedMarginLeft, orientedMarginTop);
+  renderer.copyGrayscaleMsbBuffers();
 
-    // display grayscale part
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
-  }
+  // display grayscale part
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
 
   // restore the bw data
   renderer.restoreBwBuffer();
@@ -743,9 +958,13 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const in
   const auto textY = screenHeight - orientedMarginBottom - 4;
   int progressTextWidth = 0;
 
-  // Calculate progress in book
-  const float sectionChapterProg = static_cast<float>(section->currentPage) / section->pageCount;
-  const float bookProgress = epub->calculateProgress(currentSpineIndex, sectionChapterProg) * 100;
+  // Calculate progress in book; a paginated book counts its pages instead of the chapter's
+  const float bookProgress = calculateBookProgress();
+  const bool showBookPages = hasCompletePageTable();
+  const int shownPage =
+      showBookPages ? static_cast<int>(pageTable->getFirstPage(currentSpineIndex)) + section->currentPage + 1
+                    : section->currentPage + 1;
+  const int shownPageCount = showBookPages ? static_cast<int>(pageTable->getTotalPages()) : section->pageCount;
 
   if (showProgressText || showProgressPercentage || showBookPercentage) {
     // Right aligned text for progress counter
@@ -753,12 +972,11 @@ void EpubReaderActivity::renderStatusBar(const int orientedMarginRight, const in
 
     // Hide percentage when progress bar is shown to reduce clutter
     if (showProgressPercentage) {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d  %.0f%%", section->currentPage + 1, section->pageCount,
-               bookProgress);
+      snprintf(progressStr, sizeof(progressStr), "%d/%d  %.0f%%", shownPage, shownPageCount, bookProgress);
     } else if (showBookPercentage) {
       snprintf(progressStr, sizeof(progressStr), "%.0f%%", bookProgress);
     } else {
-      snprintf(progressStr, sizeof(progressStr), "%d/%d", section->currentPage + 1, section->pageCount);
+      snprintf(progressStr, sizeof(progressStr), "%d/%d", shownPage, shownPageCount);
     }
 
     progressTextWidth = renderer.getTextWidth(SMALL_FONT_ID, progressStr);
@@ -1,29 +1,53 @@
 #pragma once
 #include <Epub.h>
+#include <Epub/BookPageTable.h>
 #include <Epub/Section.h>
+#include <JobScheduler.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/semphr.h>
 #include <freertos/task.h>
 
 #include "EpubReaderMenuActivity.h"
+#include "PendingPageTurns.h"
+#include "PrerenderedPage.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class EpubReaderActivity final : public ActivityWithSubactivity {
   std::shared_ptr<Epub> epub;
   std::unique_ptr<Section> section = nullptr;
+  // Page counts of the whole book for the current layout, complete once the book has been paginated
+  std::unique_ptr<BookPageTable> pageTable = nullptr;
   TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentSpineIndex = 0;
   int nextPageNumber = 0;
-  int pagesUntilFullRefresh = 0;
+  PendingPageTurns pageTurns;
+  // Page turns taken from pageTurns that still have to be applied, display task only
+  int pageTurnsToApply = 0;
   bool forceInitialFullRefresh = true;
   int cachedSpineIndex = 0;
   int cachedChapterTotalPageCount = 0;
+  // Where the cached page starts in its chapter's XHTML, restores the exact page after a re-layout
+  uint32_t cachedPageSourceOffset = Section::UNKNOWN_SOURCE_OFFSET;
   // Signals that the next render should reposition within the newly loaded section
   // based on a cross-book percentage jump.
   bool pendingPercentJump = false;
   // Normalized 0.0-1.0 progress within the target spine item, computed from book percentage.
   float pendingSpineProgress = 0.0f;
+  // Element id to open the next loaded section at, from a TOC entry with a fragment
+  std::string pendingAnchor;
+  // Background job paginating the whole book, NO_JOB when none is running
+  JobScheduler::JobId paginationJob = JobScheduler::NO_JOB;
+  // The next page, drawn ahead while the panel shows the current one; display task only
+  PrerenderedPage prerendered;
+  // Set by a render for the display task's next turn, with the margins it used
+  bool prerenderPending = false;
+  int aheadMarginTop = 0;
+  int aheadMarginRight = 0;
+  int aheadMarginBottom = 0;
+  int aheadMarginLeft = 0;
+  // Counts sections loaded, so a page drawn ahead is not shown in another layout of the same chapter
+  uint32_t sectionLoads = 0;
   bool updateRequired = false;
   bool pendingSubactivityExit = false;  // Defer subactivity exit to avoid use-after-free
   bool pendingGoHome = false;           // Defer go home to avoid race condition with display task
@@ -34,10 +58,20 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   static void taskTrampoline(void* param);
   [[noreturn]] void displayTaskLoop();
   void renderScreen();
-  void renderContents(std::unique_ptr<Page> page, int orientedMarginTop, int orientedMarginRight,
+  // drawnAhead: the frame buffer already holds the page and its status bar
+  void renderContents(std::unique_ptr<Page> page, bool drawnAhead, int orientedMarginTop, int orientedMarginRight,
                       int orientedMarginBottom, int orientedMarginLeft);
+  void prerenderNextPage(int orientedMarginTop, int orientedMarginRight, int orientedMarginBottom,
+                         int orientedMarginLeft);
   void renderStatusBar(int orientedMarginRight, int orientedMarginBottom, int orientedMarginLeft) const;
-  void saveProgress(int spineIndex, int currentPage, int pageCount);
+  void saveProgress(int spineIndex, int currentPage, int pageCount, uint32_t sourceOffset);
+  // Book progress (0-100): exact from the page table once the book is paginated, estimated from sizes before that
+  float calculateBookProgress() const;
+  bool hasCompletePageTable() const { return pageTable && pageTable->isComplete() && pageTable->getTotalPages() > 0; }
+  // Moves by pageTurnsToApply within the section; true if that runs off it and the neighbouring one has to be loaded
+  bool applyPageTurns();
+  void startBookPagination();
+  void reloadPageTable();
   // Jump to a percentage of the book (0-100), mapping it to spine and page.
   void jumpToPercent(int percent);
   void onReaderMenuBack(uint8_t orientation);
@@ -54,4 +88,5 @@ class EpubReaderActivity final : public ActivityWithSubactivity {
   void onEnter() override;
   void onExit() override;
   void loop() override;
+  bool runIdleWork(const std::function<void()>& work) override;
 };
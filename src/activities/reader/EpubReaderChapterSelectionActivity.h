@@ -21,7 +21,7 @@ class EpubReaderChapterSelectionActivity final : public ActivityWithSubactivity
   int selectorIndex = 0;
   bool updateRequired = false;
   const std::function<void()> onGoBack;
-  const std::function<void(int newSpineIndex)> onSelectSpineIndex;
+  const std::function<void(int newSpineIndex, const std::string& anchor)> onSelectSpineIndex;
   const std::function<void(int newSpineIndex, int newPage)> onSyncPosition;
 
   // Number of items that fit on a page, derived from logical screen height.
@@ -36,12 +36,12 @@ class EpubReaderChapterSelectionActivity final : public ActivityWithSubactivity
   void renderScreen();
 
  public:
-  explicit EpubReaderChapterSelectionActivity(GfxRenderer& renderer, MappedInputManager& mappedInput,
-                                              const std::shared_ptr<Epub>& epub, const std::string& epubPath,
-                                              const int currentSpineIndex, const int currentPage,
-                                              const int totalPagesInSpine, const std::function<void()>& onGoBack,
-                                              const std::function<void(int newSpineIndex)>& onSelectSpineIndex,
-                                              const std::function<void(int newSpineIndex, int newPage)>& onSyncPosition)
+  explicit EpubReaderChapterSelectionActivity(
+      GfxRenderer& renderer, MappedInputManager& mappedInput, const std::shared_ptr<Epub>& epub,
+      const std::string& epubPath, const int currentSpineIndex, const int currentPage, const int totalPagesInSpine,
+      const std::function<void()>& onGoBack,
+      const std::function<void(int newSpineIndex, const std::string& anchor)>& onSelectSpineIndex,
+      const std::function<void(int newSpineIndex, int newPage)>& onSyncPosition)
       : ActivityWithSubactivity("EpubReaderChapterSelection", renderer, mappedInput),
         epub(epub),
         epubPath(epubPath),
@@ -125,7 +125,7 @@ void KOReaderSyncActivity::performSync() {
   remotePosition = ProgressMapper::toCrossPoint(epub, koPos, totalPagesInSpine);
 
   // Calculate local progress in KOReader format (for display)
-  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine};
+  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine, currentSourceOffset};
   localProgress = ProgressMapper::toKOReader(epub, localPos);
 
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
@@ -144,7 +144,7 @@ void KOReaderSyncActivity::performUpload() {
   vTaskDelay(10 / portTICK_PERIOD_MS);
 
   // Convert current position to KOReader format
-  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine};
+  CrossPointPosition localPos = {currentSpineIndex, currentPage, totalPagesInSpine, currentSourceOffset};
   KOReaderPosition koPos = ProgressMapper::toKOReader(epub, localPos);
 
   KOReaderProgress progress;
@@ -398,7 +398,7 @@ void KOReaderSyncActivity::loop() {
     if (mappedInput.wasPressed(MappedInputManager::Button::Confirm)) {
       if (selectedOption == 0) {
         // Apply remote progress
-        onSyncComplete(remotePosition.spineIndex, remotePosition.pageNumber);
+        onSyncComplete(remotePosition.spineIndex, remotePosition.pageNumber, remotePosition.sourceOffset);
       } else if (selectedOption == 1) {
         // Upload local progress
         performUpload();
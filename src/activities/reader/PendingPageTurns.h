@@ -0,0 +1,25 @@
+#pragma once
+#include <atomic>
+
+/**
+ * Page and chapter turns the input loop has seen and the display task has not drawn yet.
+ *
+ * The loop adds every press, also while the display task is busy with a refresh, and the display task takes the sum
+ * when it starts its next render. Presses that arrive during a refresh so cost one render and one refresh of the
+ * page they end on instead of one each.
+ */
+class PendingPageTurns {
+  std::atomic<int> pages{0};
+  std::atomic<int> chapters{0};
+
+ public:
+  void addPages(const int count) { pages += count; }
+  void addChapters(const int count) { chapters += count; }
+  int pendingPages() const { return pages; }
+  int takePages() { return pages.exchange(0); }
+  int takeChapters() { return chapters.exchange(0); }
+  void clear() {
+    pages = 0;
+    chapters = 0;
+  }
+};
@@ -0,0 +1,74 @@
+#include "PrerenderedPage.h"
+
+#include <Arduino.h>
+#include <Epub/Page.h>
+#include <Logging.h>
+
+#include <cstdlib>
+
+namespace {
+// Heap left besides the spare frame: the grayscale passes store the BW frame, and the ghosting estimate keeps one
+constexpr uint32_t MIN_FREE_HEAP = 112 * 1024;
+// Freed below this rather than at MIN_FREE_HEAP, so it is not taken and freed on every page
+constexpr uint32_t RELEASE_FREE_HEAP = 64 * 1024;
+}  // namespace
+
+PrerenderedPage::~PrerenderedPage() { release(); }
+
+bool PrerenderedPage::reserve(const size_t frameBytes) {
+  if (frame) {
+    return true;
+  }
+  if (ESP.getFreeHeap() < frameBytes + MIN_FREE_HEAP || ESP.getMaxAllocHeap() < frameBytes) {
+    return false;
+  }
+  frame = static_cast<uint8_t*>(malloc(frameBytes));
+  if (!frame) {
+    LOG_ERR("PRE", "Failed to allocate spare frame (%zu bytes)", frameBytes);
+    return false;
+  }
+  return true;
+}
+
+void PrerenderedPage::release() {
+  invalidate();
+  free(frame);
+  frame = nullptr;
+}
+
+void PrerenderedPage::releaseIfHeapShort() {
+  if (frame && ESP.getFreeHeap() < RELEASE_FREE_HEAP) {
+    LOG_DBG("PRE", "Freeing spare frame, %lu bytes of heap left", static_cast<unsigned long>(ESP.getFreeHeap()));
+    release();
+  }
+}
+
+void PrerenderedPage::store(const uint32_t sectionLoad, const int pageNumber, const uint32_t sourceOffset,
+                            std::unique_ptr<Page> drawnPage) {
+  invalidate();
+  page = std::move(drawnPage);
+  pageSectionLoad = sectionLoad;
+  this->pageNumber = pageNumber;
+  pageSourceOffset = sourceOffset;
+}
+
+std::unique_ptr<Page> PrerenderedPage::take(const uint32_t sectionLoad, const int pageNumber,
+                                            uint32_t* sourceOffset) {
+  if (!page || !frame) {
+    return nullptr;
+  }
+  if (sectionLoad != pageSectionLoad || pageNumber != this->pageNumber) {
+    invalidate();
+    return nullptr;
+  }
+  hits++;
+  *sourceOffset = pageSourceOffset;
+  return std::move(page);
+}
+
+void PrerenderedPage::invalidate() {
+  if (page) {
+    misses++;
+    page.reset();
+  }
+}
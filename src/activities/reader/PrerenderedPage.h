@@ -0,0 +1,51 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+class Page;
+
+/**
+ * The page after the one on screen, drawn ahead into a spare frame buffer while the panel updates, so turning to it
+ * copies the frame instead of reading the page from SD and drawing it after the press. The page itself is kept too,
+ * for the grayscale passes when anti-aliasing is on.
+ *
+ * The spare buffer is only taken while the heap has room for it besides what the reader needs, and given back when
+ * the heap runs short or a chapter is laid out. Hits count pages shown from a frame drawn ahead, misses frames that
+ * were drawn and then thrown away.
+ */
+class PrerenderedPage {
+ public:
+  PrerenderedPage() = default;
+  ~PrerenderedPage();
+  PrerenderedPage(const PrerenderedPage&) = delete;
+  PrerenderedPage& operator=(const PrerenderedPage&) = delete;
+
+  // Takes the spare buffer if it is not held yet and the heap allows; false if drawing ahead should be skipped
+  bool reserve(size_t frameBytes);
+  // Frees the spare buffer, e.g. before laying out a chapter
+  void release();
+  // Frees the spare buffer if the heap has run short since it was taken
+  void releaseIfHeapShort();
+  uint8_t* getFrame() const { return frame; }
+
+  // The frame now holds pageNumber of the section loaded as sectionLoad
+  void store(uint32_t sectionLoad, int pageNumber, uint32_t sourceOffset, std::unique_ptr<Page> drawnPage);
+  // The page drawn ahead if it is pageNumber of sectionLoad, with its frame in getFrame(); nullptr otherwise, and a
+  // page drawn ahead for another place is dropped
+  std::unique_ptr<Page> take(uint32_t sectionLoad, int pageNumber, uint32_t* sourceOffset);
+  // Drops the page drawn ahead, e.g. when something the status bar shows changes
+  void invalidate();
+
+  uint32_t getHits() const { return hits; }
+  uint32_t getMisses() const { return misses; }
+
+ private:
+  uint8_t* frame = nullptr;
+  std::unique_ptr<Page> page;
+  uint32_t pageSectionLoad = 0;
+  int pageNumber = 0;
+  uint32_t pageSourceOffset = 0;
+  uint32_t hits = 0;
+  uint32_t misses = 0;
+};
@@ -35,4 +35,6 @@ class ReaderActivity final : public ActivityWithSubactivity {
         onGoToLibrary(onGoToLibrary) {}
   void onEnter() override;
   bool isReaderActivity() const override { return true; }
+  // The open reader decides when its own background work can run
+  bool runIdleWork(const std::function<void()>& work) override { return subActivity && subActivity->runIdleWork(work); }
 };
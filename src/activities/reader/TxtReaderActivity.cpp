@@ -1,12 +1,14 @@
 #include "TxtReaderActivity.h"
 
 #include <GfxRenderer.h>
+#include <HalSpiBus.h>
 #include <HalStorage.h>
 #include <Serialization.h>
 #include <Utf8.h>
 
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "components/UITheme.h"
@@ -83,6 +85,7 @@ void TxtReaderActivity::onExit() {
 
   // Wait until not rendering to delete task
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  renderer.stopGhostingTracking();
   if (displayTaskHandle) {
     vTaskDelete(displayTaskHandle);
     displayTaskHandle = nullptr;
@@ -93,6 +96,9 @@ void TxtReaderActivity::onExit() {
   currentPageLines.clear();
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  if (txt && totalPages > 0) {
+    LIBRARY_CATALOG.updateProgress(txt->getPath(), static_cast<uint8_t>((currentPage + 1) * 100 / totalPages));
+  }
   txt.reset();
 }
 
@@ -132,11 +138,11 @@ void TxtReaderActivity::loop() {
     return;
   }
 
-  if (prevTriggered && currentPage > 0) {
-    currentPage--;
-    updateRequired = true;
-  } else if (nextTriggered && currentPage < totalPages - 1) {
-    currentPage++;
+  // Added up until the display task starts its next render, so presses during a refresh cost one
+  const int direction = prevTriggered ? -1 : 1;
+  const int target = currentPage + pageTurns.pendingPages() + direction;
+  if (target >= 0 && target < totalPages) {
+    pageTurns.addPages(direction);
     updateRequired = true;
   }
 }
@@ -389,6 +395,8 @@ void TxtReaderActivity::renderScreen() {
     return;
   }
 
+  currentPage += pageTurns.takePages();
+
   // Bounds check
   if (currentPage < 0) currentPage = 0;
   if (currentPage >= totalPages) currentPage = totalPages - 1;
@@ -457,35 +465,32 @@ void TxtReaderActivity::renderPage() {
   renderLines();
   renderStatusBar(orientedMarginRight, orientedMarginBottom, orientedMarginLeft);
 
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
+  // Without the grayscale pass nothing more is drawn, so the display task lets go while the panel updates
+  if (!SETTINGS.textAntiAliasing) {
+    renderer.displayBufferAsync(renderer.pickRefreshMode(SETTINGS.getRefreshFrequency()));
+    return;
   }
+  renderer.displayBuffer(renderer.pickRefreshMode(SETTINGS.getRefreshFrequency()));
 
   // Grayscale rendering pass (for anti-aliased fonts)
-  if (SETTINGS.textAntiAliasing) {
-    // Save BW buffer for restoration after grayscale pass
-    renderer.storeBwBuffer();
+  // Save BW buffer for restoration after grayscale pass
+  renderer.storeBwBuffer();
 
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
-    renderLines();
-    renderer.copyGrayscaleLsbBuffers();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_LSB);
+  renderLines();
+  renderer.copyGrayscaleLsbBuffers();
 
-    renderer.clearScreen(0x00);
-    renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
-    renderLines();
-    renderer.copyGrayscaleMsbBuffers();
+  renderer.clearScreen(0x00);
+  renderer.setRenderMode(GfxRenderer::GRAYSCALE_MSB);
+  renderLines();
+  renderer.copyGrayscaleMsbBuffers();
 
-    renderer.displayGrayBuffer();
-    renderer.setRenderMode(GfxRenderer::BW);
+  renderer.displayGrayBuffer();
+  renderer.setRenderMode(GfxRenderer::BW);
 
-    // Restore BW buffer
-    renderer.restoreBwBuffer();
-  }
+  // Restore BW buffer
+  renderer.restoreBwBuffer();
 }
 
 void TxtReaderActivity::renderStatusBar(const int orientedMarginRight, const int orientedMarginBottom,
@@ -563,6 +568,8 @@ void TxtReaderActivity::renderStatusBar(const int orientedMarginRight, const int
 }
 
 void TxtReaderActivity::saveProgress() const {
+  // Written while the page is refreshed
+  HalSpiBus::Lock bus;
   FsFile f;
   if (Storage.openFileForWrite("TRS", txt->getCachePath() + "/progress.bin", f)) {
     uint8_t data[4];
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "CrossPointSettings.h"
+#include "PendingPageTurns.h"
 #include "activities/ActivityWithSubactivity.h"
 
 class TxtReaderActivity final : public ActivityWithSubactivity {
@@ -15,8 +16,8 @@ class TxtReaderActivity final : public ActivityWithSubactivity {
   TaskHandle_t displayTaskHandle = nullptr;
   SemaphoreHandle_t renderingMutex = nullptr;
   int currentPage = 0;
+  PendingPageTurns pageTurns;
   int totalPages = 1;
-  int pagesUntilFullRefresh = 0;
   bool updateRequired = false;
   const std::function<void()> onGoBack;
   const std::function<void()> onGoHome;
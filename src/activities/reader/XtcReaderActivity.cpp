@@ -9,10 +9,14 @@
 
 #include <FsHelpers.h>
 #include <GfxRenderer.h>
+#include <HalSpiBus.h>
 #include <HalStorage.h>
 
+#include <algorithm>
+
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
 #include "RecentBooksStore.h"
 #include "XtcReaderChapterSelectionActivity.h"
@@ -64,6 +68,7 @@ void XtcReaderActivity::onExit() {
 
   // Wait until not rendering to delete task
   xSemaphoreTake(renderingMutex, portMAX_DELAY);
+  renderer.stopGhostingTracking();
   if (displayTaskHandle) {
     vTaskDelete(displayTaskHandle);
     displayTaskHandle = nullptr;
@@ -72,6 +77,9 @@ void XtcReaderActivity::onExit() {
   renderingMutex = nullptr;
   APP_STATE.readerActivityLoadCount = 0;
   APP_STATE.saveToFile();
+  if (xtc) {
+    LIBRARY_CATALOG.updateProgress(xtc->getPath(), xtc->calculateProgress(currentPage));
+  }
   xtc.reset();
 }
 
@@ -86,6 +94,8 @@ void XtcReaderActivity::loop() {
   if (mappedInput.wasReleased(MappedInputManager::Button::Confirm)) {
     if (xtc && xtc->hasChapters() && !xtc->getChapters().empty()) {
       xSemaphoreTake(renderingMutex, portMAX_DELAY);
+      // The chapter picked replaces turns that have not been drawn
+      pageTurns.clear();
       exitActivity();
       enterNewActivity(new XtcReaderChapterSelectionActivity(
           this->renderer, this->mappedInput, xtc, currentPage,
@@ -142,20 +152,9 @@ void XtcReaderActivity::loop() {
   const bool skipPages = SETTINGS.longPressChapterSkip && mappedInput.getHeldTime() > skipPageMs;
   const int skipAmount = skipPages ? 10 : 1;
 
-  if (prevTriggered) {
-    if (currentPage >= static_cast<uint32_t>(skipAmount)) {
-      currentPage -= skipAmount;
-    } else {
-      currentPage = 0;
-    }
-    updateRequired = true;
-  } else if (nextTriggered) {
-    currentPage += skipAmount;
-    if (currentPage >= xtc->getPageCount()) {
-      currentPage = xtc->getPageCount();  // Allow showing "End of book"
-    }
-    updateRequired = true;
-  }
+  // Added up until the display task starts its next render, so presses during a refresh cost one
+  pageTurns.addPages(prevTriggered ? -skipAmount : skipAmount);
+  updateRequired = true;
 }
 
 void XtcReaderActivity::displayTaskLoop() {
@@ -175,6 +174,13 @@ void XtcReaderActivity::renderScreen() {
     return;
   }
 
+  const int turns = pageTurns.takePages();
+  if (turns != 0) {
+    // One past the last page shows "End of book"
+    const int64_t target = static_cast<int64_t>(currentPage) + turns;
+    currentPage = static_cast<uint32_t>(std::max<int64_t>(0, std::min<int64_t>(target, xtc->getPageCount())));
+  }
+
   // Bounds check
   if (currentPage >= xtc->getPageCount()) {
     // Show end of book screen
@@ -213,8 +219,13 @@ void XtcReaderActivity::renderPage() {
     return;
   }
 
-  // Load page data
-  size_t bytesRead = xtc->loadPage(currentPage, pageBuffer, pageBufferSize);
+  // Load page data, from the book file kept open, while the page before is refreshed, whose refresh takes the bus back
+  // when the panel is done
+  size_t bytesRead;
+  {
+    HalSpiBus::Lock bus;
+    bytesRead = xtc->loadPage(currentPage, pageBuffer, pageBufferSize);
+  }
   if (bytesRead == 0) {
     LOG_ERR("XTR", "Failed to load page %lu", currentPage);
     free(pageBuffer);
@@ -277,14 +288,8 @@ void XtcReaderActivity::renderPage() {
       }
     }
 
-    // Display BW with conditional refresh based on pagesUntilFullRefresh
-    if (pagesUntilFullRefresh <= 1) {
-      renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-      pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-    } else {
-      renderer.displayBuffer();
-      pagesUntilFullRefresh--;
-    }
+    // Display BW, with a half refresh once the fast ones have left enough ghosting
+    renderer.displayBuffer(renderer.pickRefreshMode(SETTINGS.getRefreshFrequency()));
 
     // Pass 2: LSB buffer - mark DARK gray only (XTH value 1)
     // In LUT: 0 bit = apply gray effect, 1 bit = untouched
@@ -356,19 +361,15 @@ void XtcReaderActivity::renderPage() {
 
   // XTC pages already have status bar pre-rendered, no need to add our own
 
-  // Display with appropriate refresh
-  if (pagesUntilFullRefresh <= 1) {
-    renderer.displayBuffer(HalDisplay::HALF_REFRESH);
-    pagesUntilFullRefresh = SETTINGS.getRefreshFrequency();
-  } else {
-    renderer.displayBuffer();
-    pagesUntilFullRefresh--;
-  }
+  // Display with a half refresh once the fast ones have left enough ghosting, letting go while the panel updates
+  renderer.displayBufferAsync(renderer.pickRefreshMode(SETTINGS.getRefreshFrequency()));
 
   LOG_DBG("XTR", "Rendered page %lu/%lu (%u-bit)", currentPage + 1, xtc->getPageCount(), bitDepth);
 }
 
 void XtcReaderActivity::saveProgress() const {
+  // Written while the page is refreshed
+  HalSpiBus::Lock bus;
   FsFile f;
   if (Storage.openFileForWrite("XTR", xtc->getCachePath() + "/progress.bin", f)) {
     uint8_t data[4];
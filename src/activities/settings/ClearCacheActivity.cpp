@@ -4,7 +4,11 @@
 #include <HalStorage.h>
 #include <Logging.h>
 
+#include "CacheWarmer.h"
+#include "LibraryCatalog.h"
 #include "MappedInputManager.h"
+#include "SleepScreenCache.h"
+#include "ThumbnailAtlas.h"
 #include "components/UITheme.h"
 #include "fontIds.h"
 
@@ -144,6 +148,12 @@ void ClearCacheActivity::clearCache() {
   }
   root.close();
 
+  // Catalog rows point at the thumbnails that were just removed
+  LIBRARY_CATALOG.clearAll();
+  THUMBNAIL_ATLAS.clear();
+  SleepScreenCache::clear();
+  CACHE_WARMER.restart();
+
   LOG_DBG("CLEAR_CACHE", "Cache cleared: %d removed, %d failed", clearedCount, failedCount);
 
   state = SUCCESS;
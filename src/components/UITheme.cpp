@@ -61,3 +61,7 @@ std::string UITheme::getCoverThumbPath(std::string coverBmpPath, int coverHeight
   }
   return coverBmpPath;
 }
+
+std::vector<int> UITheme::getCoverThumbHeights() {
+  return {BaseMetrics::values.homeCoverHeight, LyraMetrics::values.homeCoverHeight};
+}
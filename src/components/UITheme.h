@@ -21,6 +21,8 @@ class UITheme {
   static int getNumberOfItemsPerPage(const GfxRenderer& renderer, bool hasHeader, bool hasTabBar, bool hasButtonHints,
                                      bool hasSubtitle);
   static std::string getCoverThumbPath(std::string coverBmpPath, int coverHeight);
+  // Home screen cover heights of every theme, so a book's thumbnails can all be built from one cover decode
+  static std::vector<int> getCoverThumbHeights();
 
  private:
   const ThemeMetrics* currentMetrics;
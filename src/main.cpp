@@ -1,9 +1,12 @@
 #include <Arduino.h>
 #include <Epub.h>
+#include <Epub/EpubProcessingProfile.h>
 #include <GfxRenderer.h>
 #include <HalDisplay.h>
 #include <HalGPIO.h>
+#include <HalSpiBus.h>
 #include <HalStorage.h>
+#include <JobScheduler.h>
 #include <Logging.h>
 #include <SPI.h>
 #include <builtinFonts/all.h>
@@ -11,6 +14,7 @@
 #include <cstring>
 
 #include "Battery.h"
+#include "CacheWarmer.h"
 #include "CrossPointSettings.h"
 #include "CrossPointState.h"
 #include "KOReaderCredentialStore.h"
@@ -133,6 +137,36 @@ unsigned long t2 = 0;
 #define KEEP_AWAKE_ON_USB_POWER 0
 #endif
 
+// While on USB power, book caches are built once the buttons have been left alone this long
+constexpr unsigned long CACHE_WARM_IDLE_MS = 5000;
+
+// Last button press or release, or background work an activity keeps the device awake for
+unsigned long lastActivityTime = 0;
+
+// Background jobs only run between input polls, so input seen by this loop's poll holds them off until the next one.
+// Long steps check again as they go; pollInput() keeps what it reads for the next loop.
+void setupJobScheduler() {
+  JOB_SCHEDULER.setHooks(JobScheduler::Hooks{
+      [] { return static_cast<uint32_t>(millis()); },
+      [] { return gpio.wasAnyPressed() || gpio.wasAnyReleased() || gpio.pollInput(); },
+      [] { return static_cast<size_t>(ESP.getFreeHeap()); }});
+
+  // Idle time on the charger goes to building book caches, outside the reader which needs the heap for its own book
+  JobScheduler::JobSpec warmCaches;
+  warmCaches.name = "warm caches";
+  warmCaches.priority = JobScheduler::Priority::BACKGROUND;
+  warmCaches.isRunnable = [] {
+    return currentActivity && !currentActivity->isReaderActivity() && gpio.isUsbConnected() &&
+           millis() - lastActivityTime >= CACHE_WARM_IDLE_MS && !CACHE_WARMER.isFinished();
+  };
+  // Never done: a new layout or cleared caches give it more to do
+  warmCaches.step = [](JobScheduler::Context& context) {
+    CACHE_WARMER.step(renderer, [&context] { return context.isInterrupted(); });
+    return true;
+  };
+  JOB_SCHEDULER.submit(std::move(warmCaches));
+}
+
 void exitActivity() {
   if (currentActivity) {
     currentActivity->onExit();
@@ -142,6 +176,8 @@ void exitActivity() {
 }
 
 void enterNewActivity(Activity* activity) {
+  // Activities read the card as they start, without holding the bus against a refresh taking it back
+  renderer.waitForRefresh();
   currentActivity = activity;
   currentActivity->onEnter();
 }
@@ -345,6 +381,10 @@ void setup() {
 
   APP_STATE.loadFromFile();
   RECENT_BOOKS.loadFromFile();
+  setupJobScheduler();
+  // Section builds size their buffers and layout window from the heap and lay out early when it runs low
+  EpubProcessingProfile::heapHooks = {[] { return static_cast<size_t>(ESP.getFreeHeap()); },
+                                      [] { return static_cast<size_t>(ESP.getMaxAllocHeap()); }};
 
   // Boot to home screen if no book is open, last sleep was not from reader, back button is held, or reader activity
   // crashed (indicated by readerActivityLoadCount > 0)
@@ -362,6 +402,7 @@ void setup() {
 
   // Ensure we're not still holding the power button before leaving setup
   waitForPowerRelease();
+  lastActivityTime = millis();
 }
 
 void loop() {
@@ -396,13 +437,15 @@ void loop() {
   }
 
   // Check for any user activity (button press or release) or active background work
-  static unsigned long lastActivityTime = millis();
   if (gpio.wasAnyPressed() || gpio.wasAnyReleased() || (currentActivity && currentActivity->preventAutoSleep())) {
     lastActivityTime = millis();  // Reset inactivity timer
   }
 
+  // Set while background jobs have work and the current activity lets them run; sleep waits for them to finish
+  static bool runningJobs = false;
+
   const unsigned long sleepTimeoutMs = SETTINGS.getSleepTimeoutMs();
-  if (millis() - lastActivityTime >= sleepTimeoutMs) {
+  if (millis() - lastActivityTime >= sleepTimeoutMs && !runningJobs) {
     LOG_DBG("SLP", "Auto-sleep triggered after %lu ms of inactivity", sleepTimeoutMs);
     enterDeepSleep();
     // This should never be hit as `enterDeepSleep` calls esp_deep_sleep_start
@@ -421,6 +464,15 @@ void loop() {
   }
   const unsigned long activityDuration = millis() - activityStartTime;
 
+  // What is left of the iteration goes to background jobs, one time slice at a time while the activity is idle. A
+  // slice keeps its files open across steps, so it holds the bus, and is skipped while a refresh has it.
+  runningJobs = currentActivity && JOB_SCHEDULER.hasRunnableJob() && currentActivity->runIdleWork([] {
+    HalSpiBus::Lock bus(0);
+    if (bus.owns()) {
+      JOB_SCHEDULER.runSlice();
+    }
+  });
+
   const unsigned long loopDuration = millis() - loopStartTime;
   if (loopDuration > maxLoopDuration) {
     maxLoopDuration = loopDuration;
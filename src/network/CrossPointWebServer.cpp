@@ -11,7 +11,9 @@
 #include <algorithm>
 
 #include "CrossPointSettings.h"
+#include "LibraryCatalog.h"
 #include "SettingsList.h"
+#include "ThumbnailAtlas.h"
 #include "html/FilesPageHtml.generated.h"
 #include "html/HomePageHtml.generated.h"
 #include "html/SettingsPageHtml.generated.h"
@@ -42,6 +44,8 @@ unsigned long wsLastCompleteAt = 0;
 
 // Helper function to clear epub cache after upload
 void clearEpubCacheIfNeeded(const String& filePath) {
+  // The device never stamps files, so a replaced book is only told apart from the old one here
+  THUMBNAIL_ATLAS.forget(filePath.c_str());
   // Only clear cache for .epub files
   if (StringUtils::checkFileExtension(filePath, ".epub")) {
     Epub(filePath.c_str(), "/.crosspoint").clearCache();
@@ -655,6 +659,7 @@ void CrossPointWebServer::handleUpload(UploadState& state) const {
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += state.fileName;
         clearEpubCacheIfNeeded(filePath);
+        LIBRARY_CATALOG.onFileAdded(filePath.c_str());
       }
     }
   } else if (upload.status == UPLOAD_FILE_ABORTED) {
@@ -724,6 +729,7 @@ void CrossPointWebServer::handleCreateFolder() const {
   // Create the folder
   if (Storage.mkdir(folderPath.c_str())) {
     LOG_DBG("WEB", "Folder created successfully: %s", folderPath.c_str());
+    LIBRARY_CATALOG.onFileAdded(folderPath.c_str());
     server->send(200, "text/plain", "Folder created: " + folderName);
   } else {
     LOG_DBG("WEB", "Failed to create folder: %s", folderPath.c_str());
@@ -806,6 +812,7 @@ void CrossPointWebServer::handleRename() const {
 
   if (success) {
     LOG_DBG("WEB", "Renamed file: %s -> %s", itemPath.c_str(), newPath.c_str());
+    LIBRARY_CATALOG.onFileMoved(itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Renamed successfully");
   } else {
     LOG_ERR("WEB", "Failed to rename file: %s -> %s", itemPath.c_str(), newPath.c_str());
@@ -899,6 +906,7 @@ void CrossPointWebServer::handleMove() const {
 
   if (success) {
     LOG_DBG("WEB", "Moved file: %s -> %s", itemPath.c_str(), newPath.c_str());
+    LIBRARY_CATALOG.onFileMoved(itemPath.c_str(), newPath.c_str());
     server->send(200, "text/plain", "Moved successfully");
   } else {
     LOG_ERR("WEB", "Failed to move file: %s -> %s", itemPath.c_str(), newPath.c_str());
@@ -981,6 +989,12 @@ void CrossPointWebServer::handleDelete() const {
 
   if (success) {
     LOG_DBG("WEB", "Successfully deleted: %s", itemPath.c_str());
+    if (itemType == "folder") {
+      LIBRARY_CATALOG.onFolderRemoved(itemPath.c_str());
+    } else {
+      LIBRARY_CATALOG.onFileRemoved(itemPath.c_str());
+      THUMBNAIL_ATLAS.forget(itemPath.c_str());
+    }
     server->send(200, "text/plain", "Deleted successfully");
   } else {
     LOG_ERR("WEB", "Failed to delete: %s", itemPath.c_str());
@@ -1288,6 +1302,7 @@ void CrossPointWebServer::onWebSocketEvent(uint8_t num, WStype_t type, uint8_t*
         if (!filePath.endsWith("/")) filePath += "/";
         filePath += wsUploadFileName;
         clearEpubCacheIfNeeded(filePath);
+        LIBRARY_CATALOG.onFileAdded(filePath.c_str());
 
         wsServer->sendTXT(num, "DONE");
         lastProgressSent = 0;
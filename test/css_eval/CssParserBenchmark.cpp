@@ -0,0 +1,466 @@
+// Host benchmark and regression check for the EPUB CSS parser.
+//
+// Builds a calibre-style stylesheet, then replays a synthetic chapter's worth of elements through the same calls
+// ChapterHtmlSlimParser makes per element, once with embedded styles off and once with them on. Reports time and
+// heap allocations per element and fails if style resolution allocates or resolves a known element wrongly.
+// The stylesheet is also streamed through CssParser::StreamLoader in awkward chunk sizes to check that the rules do
+// not depend on where the writes split, and a large sheet is streamed to check peak heap stays flat with input size.
+// Descendant and child selectors are checked against hand-built trees and timed against the plain lookup, including
+// a pathological sheet where every rule shares the rightmost key and no ancestor can be ruled out by the bloom filter.
+
+#include <HalStorage.h>
+#include <malloc.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <initializer_list>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/css/CssParser.h"
+
+namespace {
+size_t gAllocations = 0;
+size_t gLiveBytes = 0;
+size_t gPeakBytes = 0;
+}  // namespace
+
+// Count every heap allocation made by the code under test, with live and peak bytes from the allocator itself
+void* operator new(const size_t size) {
+  void* ptr = std::malloc(size);
+  if (!ptr) throw std::bad_alloc();
+  ++gAllocations;
+  gLiveBytes += malloc_usable_size(ptr);
+  if (gLiveBytes > gPeakBytes) gPeakBytes = gLiveBytes;
+  return ptr;
+}
+
+void operator delete(void* ptr) noexcept {
+  if (!ptr) return;
+  gLiveBytes -= malloc_usable_size(ptr);
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept { operator delete(ptr); }
+
+namespace {
+
+constexpr int CLASS_COUNT = 200;
+constexpr int ELEMENT_COUNT = 200000;
+
+struct Element {
+  const char* tag;
+  const char* classAttr;
+  const char* styleAttr;
+  int depth;
+};
+
+std::string buildStylesheet() {
+  std::string css =
+      "/* Generated by a typical EPUB conversion tool */\n"
+      "body { margin: 0 5pt; }\n"
+      "p { text-indent: 1.5em; margin-top: 0; margin-bottom: 0; }\n"
+      "h1, h2, h3 { text-align: center; font-weight: bold; margin-top: 2em; }\n"
+      "@media amzn-kf8 { p { text-indent: 2em; } }\n"
+      "@font-face { font-family: Serif; src: url(fonts/serif.ttf); }\n"
+      "a:hover { text-decoration: underline; }\n"
+      "blockquote > p { margin-left: 2em; }\n"
+      "div.chapter p { text-indent: 2em; }\n"
+      "div.calibre3 > p.calibre2 span { font-style: italic; }\n"
+      "p + p, ul ~ p, #id p, [lang] p { text-indent: 3em; }\n";
+  for (int i = 0; i < CLASS_COUNT; ++i) {
+    const std::string name = "calibre" + std::to_string(i);
+    switch (i % 4) {
+      case 0:
+        css += "." + name + " { font-style: italic; }\n";
+        break;
+      case 1:
+        css += "." + name + " { font-weight: bold; text-align: justify; }\n";
+        break;
+      case 2:
+        css += "p." + name + " { text-indent: 0; margin: 1em 0 0.5em; }\n";
+        break;
+      default:
+        css += "span." + name + ", div." + name + " { text-decoration: underline; padding-left: 3%; }\n";
+        break;
+    }
+  }
+  return css;
+}
+
+std::vector<Element> buildElements(std::vector<std::string>& storage) {
+  static const char* TAGS[] = {"p", "span", "p", "div", "em", "p", "h2", "a"};
+  static const char* STYLES[] = {"", "", "", "text-align: center", "margin-left: 2em; font-style: italic",
+                                 "", "font-weight: bold", "", "text-indent: 0"};
+
+  // Class attribute values are built up front so the timed loops see stable pointers, like expat's attribute array
+  storage.reserve(64);
+  for (int i = 0; i < 64; ++i) {
+    std::string value = "calibre" + std::to_string((i * 7) % CLASS_COUNT);
+    if (i % 3 == 0) value += " calibre" + std::to_string((i * 13 + 1) % CLASS_COUNT);
+    if (i % 5 == 0) value += " unknown-class";
+    storage.push_back(value);
+  }
+
+  std::vector<Element> elements;
+  elements.reserve(ELEMENT_COUNT);
+  for (int i = 0; i < ELEMENT_COUNT; ++i) {
+    const char* classAttr = (i % 4 == 3) ? "" : storage[(i * 31) % storage.size()].c_str();
+    // Nesting goes up one level at a time and falls back to the top, like a chapter of short nested blocks
+    elements.push_back({TAGS[i % 8], classAttr, STYLES[(i / 3) % 9], i % 7});
+  }
+  return elements;
+}
+
+bool loadStylesheet(CssParser& parser, const std::string& css) {
+  const std::string path = "build/css_eval/benchmark.css";
+  FILE* out = fopen(path.c_str(), "wb");
+  if (!out) return false;
+  fwrite(css.data(), 1, css.size(), out);
+  fclose(out);
+
+  FsFile file;
+  if (!file.open(path.c_str(), "rb")) return false;
+  const bool ok = parser.loadFromStream(file);
+  file.close();
+  std::remove(path.c_str());
+  return ok;
+}
+
+// Feed the stylesheet to a StreamLoader the way ZipFile does while inflating, in fixed-size writes
+void streamStylesheet(CssParser& parser, const std::string& css, const size_t chunkSize) {
+  CssParser::StreamLoader loader(parser);
+  const auto* data = reinterpret_cast<const uint8_t*>(css.data());
+  for (size_t pos = 0; pos < css.size(); pos += chunkSize) {
+    loader.write(data + pos, std::min(chunkSize, css.size() - pos));
+  }
+}
+
+int failures = 0;
+
+void expect(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL: " << what << std::endl;
+    ++failures;
+  }
+}
+
+void checkResolution(const CssParser& parser) {
+  const CssStyle p = parser.resolveStyle("p", "");
+  expect(p.hasTextIndent() && p.textIndent.value == 1.5f && p.textIndent.unit == CssUnit::Em, "p text-indent");
+
+  const CssStyle h2 = parser.resolveStyle("H2", nullptr);
+  expect(h2.hasTextAlign() && h2.textAlign == CssTextAlign::Center, "h2 centered (case-insensitive tag)");
+  expect(h2.hasFontWeight() && h2.fontWeight == CssFontWeight::Bold, "h2 bold");
+
+  // .calibre0 is italic, .calibre1 bold + justify, p.calibre2 resets the indent
+  const CssStyle combined = parser.resolveStyle("p", "  calibre0\tCALIBRE1 calibre2 ");
+  expect(combined.hasFontStyle() && combined.fontStyle == CssFontStyle::Italic, "class italic");
+  expect(combined.hasFontWeight() && combined.fontWeight == CssFontWeight::Bold, "class bold");
+  expect(combined.textIndent.value == 0.0f, "p.class overrides p");
+  expect(combined.hasMarginBottom() && combined.marginBottom.value == 0.5f, "margin shorthand");
+
+  const CssStyle span = parser.resolveStyle("span", "calibre2 calibre3");
+  expect(!span.hasTextIndent(), "p.class does not apply to span");
+  expect(span.hasTextDecoration() && span.textDecoration == CssTextDecoration::Underline, "span.class underline");
+
+  const CssStyle unknown = parser.resolveStyle("section", "nope");
+  expect(!unknown.defined.anySet(), "unknown tag and class resolve to nothing");
+
+  const CssStyle inlineStyle = parser.resolveInlineStyle("margin-left: 2em; font-style: italic");
+  const CssStyle reference = CssParser::parseInlineStyle("margin-left: 2em; font-style: italic");
+  expect(inlineStyle.hasMarginLeft() && inlineStyle.marginLeft.value == reference.marginLeft.value &&
+             inlineStyle.hasFontStyle() && inlineStyle.fontStyle == reference.fontStyle,
+         "memoized inline style matches parseInlineStyle");
+}
+
+// Comments, @-rules and braces placed where a chunked reader is most likely to split them
+void checkTokenizer() {
+  const std::string css =
+      "p/* { font-weight: bold } */{ font-style: italic }/**/\n"
+      ".a { font-weight: bold; } @import url(other.css);\n"
+      "@media print { .a { font-weight: normal; } } } .b/*x*/{ text-align: center; /* ; } */ }\n"
+      "/* unterminated";
+  for (const size_t chunkSize : {size_t{1}, size_t{2}, size_t{3}, css.size()}) {
+    CssParser parser;
+    streamStylesheet(parser, css, chunkSize);
+    const std::string suffix = " (chunk " + std::to_string(chunkSize) + ")";
+    expect(parser.ruleCount() == 3, "three rules" + suffix);
+    const CssStyle p = parser.resolveStyle("p", "");
+    expect(p.hasFontStyle() && p.fontStyle == CssFontStyle::Italic && !p.hasFontWeight(),
+           "comment in selector" + suffix);
+    const CssStyle a = parser.resolveStyle("div", "a");
+    expect(a.hasFontWeight() && a.fontWeight == CssFontWeight::Bold, "@media block skipped" + suffix);
+    const CssStyle b = parser.resolveStyle("div", "b");
+    expect(b.hasTextAlign() && b.textAlign == CssTextAlign::Center, "rule after stray brace" + suffix);
+  }
+}
+
+// Resolve a path of elements from the root down, returning the innermost element's style
+struct Node {
+  const char* tag;
+  const char* classAttr;
+};
+
+CssStyle resolvePath(const CssParser& parser, CssParser::AncestorStack& ancestors, std::initializer_list<Node> path) {
+  ancestors.clear();
+  CssStyle style;
+  int depth = 0;
+  for (const Node& node : path) {
+    style = parser.resolveStyle(node.tag, node.classAttr, ancestors, depth++);
+  }
+  return style;
+}
+
+void checkCombinators(const CssParser& parser) {
+  CssParser::AncestorStack ancestors;
+  expect(parser.hasCombinatorRules(), "combinator rules loaded");
+
+  const CssStyle inChapter = resolvePath(parser, ancestors, {{"body", ""}, {"div", "chapter"}, {"div", ""}, {"p", ""}});
+  expect(inChapter.hasTextIndent() && inChapter.textIndent.value == 2.0f, "div.chapter p (descendant)");
+  const CssStyle outside = resolvePath(parser, ancestors, {{"body", ""}, {"div", "intro"}, {"p", ""}});
+  expect(outside.textIndent.value == 1.5f, "div.chapter p does not match outside the chapter");
+
+  const CssStyle quoted = resolvePath(parser, ancestors, {{"blockquote", ""}, {"p", ""}});
+  expect(quoted.hasMarginLeft() && quoted.marginLeft.value == 2.0f, "blockquote > p (child)");
+  const CssStyle nested = resolvePath(parser, ancestors, {{"blockquote", ""}, {"div", ""}, {"p", ""}});
+  expect(!nested.hasMarginLeft(), "blockquote > p does not match a grandchild");
+
+  const CssStyle span =
+      resolvePath(parser, ancestors, {{"div", "calibre3"}, {"p", "calibre2"}, {"em", ""}, {"span", "calibre3"}});
+  expect(span.hasFontStyle() && span.fontStyle == CssFontStyle::Italic, "div.c3 > p.c2 span");
+  expect(span.hasTextDecoration(), "span.calibre0 still gets its own simple rules");
+
+  // Leaving elements restores the ancestor chain for the next sibling
+  ancestors.clear();
+  (void)parser.resolveStyle("blockquote", "", ancestors, 0);
+  (void)parser.resolveStyle("div", "", ancestors, 1);
+  ancestors.leave(1);
+  const CssStyle sibling = parser.resolveStyle("p", "", ancestors, 1);
+  expect(sibling.hasMarginLeft(), "sibling after leave() sees its real parent");
+
+  expect(resolvePath(parser, ancestors, {{"ul", ""}, {"p", ""}}).textIndent.value == 1.5f,
+         "unsupported combinators are dropped");
+
+  // A run of child steps after a descendant step must match as a unit; the nearest .b is not a child of .a
+  CssParser tricky;
+  streamStylesheet(tricky,
+                   ".a > .b .c { font-style: italic; } .x { font-weight: bold; } div p { font-weight: normal; }", 64);
+  const CssStyle deep =
+      resolvePath(tricky, ancestors, {{"div", "a"}, {"div", "b"}, {"div", "b"}, {"div", "x"}, {"span", "c"}});
+  expect(deep.hasFontStyle() && deep.fontStyle == CssFontStyle::Italic, "child run matched past the nearest ancestor");
+  const CssStyle noA = resolvePath(tricky, ancestors, {{"div", ""}, {"div", "b"}, {"span", "c"}});
+  expect(!noA.hasFontStyle(), "child run requires the parent");
+
+  // Specificity beats source order: .x wins over the later "div p"
+  const CssStyle specific = resolvePath(tricky, ancestors, {{"div", ""}, {"p", "x"}});
+  expect(specific.fontWeight == CssFontWeight::Bold, "class beats two type selectors");
+
+  // Equal-specificity classes apply in source order, not class attribute order, whether or not the sheet has
+  // combinator rules
+  const std::string classOrder = ".b { font-weight: bold; } .a { font-weight: normal; }";
+  CssParser plain;
+  streamStylesheet(plain, classOrder, 64);
+  CssParser withCombinator;
+  streamStylesheet(withCombinator, classOrder + " div p { text-align: center; }", 64);
+  expect(plain.resolveStyle("span", "a b").fontWeight == CssFontWeight::Normal, "later class wins in plain lookup");
+  expect(resolvePath(plain, ancestors, {{"span", "a b"}}).fontWeight == CssFontWeight::Normal,
+         "later class wins without combinator rules");
+  expect(resolvePath(withCombinator, ancestors, {{"span", "a b"}}).fontWeight == CssFontWeight::Normal,
+         "later class wins with combinator rules");
+
+  // Combinator rules survive the section cache
+  const std::string path = "build/css_eval/benchmark.cache";
+  FsFile file;
+  bool cached = file.open(path.c_str(), "wb") && tricky.saveToCache(file);
+  file.close();
+  CssParser reloaded;
+  cached = cached && file.open(path.c_str(), "rb") && reloaded.loadFromCache(file);
+  file.close();
+  std::remove(path.c_str());
+  expect(cached && reloaded.ruleCount() == tricky.ruleCount(), "combinator rules round-trip through the cache");
+  const CssStyle reloadedDeep =
+      resolvePath(reloaded, ancestors, {{"div", "a"}, {"div", "b"}, {"div", "b"}, {"div", "x"}, {"span", "c"}});
+  expect(reloadedDeep.hasFontStyle(), "reloaded combinator rule still matches");
+}
+
+// Every rule shares the subject "p" and names ancestors that are all open, so nothing is rejected early
+std::string buildPathologicalStylesheet() {
+  std::string css;
+  for (int i = 0; i < 2000; ++i) {
+    css += "div div div div div div div div div div p, section > div > div > div > p { text-indent: 1em; }\n";
+    css += "div .calibre" + std::to_string(i % CLASS_COUNT) + " div p { text-indent: 2em; }\n";
+  }
+  return css;
+}
+
+struct RunResult {
+  double nsPerElement = 0;
+  double allocationsPerElement = 0;
+  uint32_t checksum = 0;
+};
+
+// Every per-element result is stored here so the compiler cannot fold or vectorise a loop away, which it did for
+// the trivial CSS-off baseline
+volatile uint32_t gSink = 0;
+
+template <typename Fn>
+RunResult runElements(const std::vector<Element>& elements, Fn&& perElement) {
+  RunResult result;
+  const size_t allocationsBefore = gAllocations;
+  const auto start = std::chrono::steady_clock::now();
+  for (const auto& element : elements) {
+    gSink = perElement(element);
+    result.checksum += gSink;
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  result.nsPerElement = std::chrono::duration<double, std::nano>(elapsed).count() / elements.size();
+  result.allocationsPerElement = static_cast<double>(gAllocations - allocationsBefore) / elements.size();
+  return result;
+}
+
+uint32_t styleChecksum(const CssStyle& style) {
+  return static_cast<uint32_t>(style.textAlign) + static_cast<uint32_t>(style.fontStyle) * 3 +
+         static_cast<uint32_t>(style.fontWeight) * 5 + static_cast<uint32_t>(style.textIndent.value * 10);
+}
+
+}  // namespace
+
+int main() {
+  const std::string css = buildStylesheet();
+
+  CssParser parser;
+  const size_t allocationsBeforeLoad = gAllocations;
+  gPeakBytes = gLiveBytes;
+  const size_t liveBeforeLoad = gLiveBytes;
+  const auto loadStart = std::chrono::steady_clock::now();
+  if (!loadStylesheet(parser, css)) {
+    std::cerr << "Could not write or parse the benchmark stylesheet" << std::endl;
+    return 1;
+  }
+  const double loadMs =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - loadStart).count();
+
+  std::cout << "Stylesheet: " << css.size() << " bytes, " << parser.ruleCount() << " rules" << std::endl;
+  std::cout << "  parse time:     " << loadMs << " ms" << std::endl;
+  std::cout << "  allocations:    " << gAllocations - allocationsBeforeLoad << std::endl;
+  std::cout << "  peak heap:      " << gPeakBytes - liveBeforeLoad << " bytes" << std::endl;
+
+  checkResolution(parser);
+  checkTokenizer();
+  checkCombinators(parser);
+
+  // Chunk boundaries must not change what gets parsed
+  for (const size_t chunkSize : {size_t{1}, size_t{7}, size_t{512}}) {
+    CssParser streamed;
+    streamStylesheet(streamed, css, chunkSize);
+    expect(streamed.ruleCount() == parser.ruleCount(), "streamed rule count (chunk " + std::to_string(chunkSize) + ")");
+    checkResolution(streamed);
+  }
+
+  // Peak heap while streaming is bounded by the longest rule, so a much larger sheet peaks where a small one does
+  const auto streamPeak = [](const std::string& sheet, double& mbPerSecond) {
+    CssParser streamed;
+    const size_t liveBefore = gLiveBytes;
+    gPeakBytes = gLiveBytes;
+    const auto start = std::chrono::steady_clock::now();
+    streamStylesheet(streamed, sheet, 1024);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    mbPerSecond = sheet.size() / seconds / (1024.0 * 1024.0);
+    return gPeakBytes - liveBefore;
+  };
+  std::string largeCss;
+  while (largeCss.size() < 300 * 1024) largeCss += css;
+  double smallRate = 0;
+  double largeRate = 0;
+  const size_t smallPeak = streamPeak(css, smallRate);
+  const size_t largePeak = streamPeak(largeCss, largeRate);
+  std::cout << "Streaming: " << css.size() << " bytes peak " << smallPeak << " bytes heap, " << largeCss.size()
+            << " bytes peak " << largePeak << " bytes heap, " << largeRate << " MB/s" << std::endl;
+  expect(largePeak <= smallPeak + 4096, "streaming peak heap must not grow with stylesheet size");
+
+  std::vector<std::string> classStorage;
+  const std::vector<Element> elements = buildElements(classStorage);
+
+  // Embedded styles off: the parser only looks at the attributes
+  const RunResult off = runElements(elements, [](const Element& element) {
+    return static_cast<uint32_t>(element.classAttr[0] + element.styleAttr[0]);
+  });
+
+  // Warm the inline style memo once, the steady state is what matters for a chapter
+  runElements(elements, [&parser](const Element& element) {
+    return *element.styleAttr ? styleChecksum(parser.resolveInlineStyle(element.styleAttr)) : 0u;
+  });
+
+  const RunResult on = runElements(elements, [&parser](const Element& element) {
+    CssStyle style = parser.resolveStyle(element.tag, element.classAttr);
+    if (*element.styleAttr) {
+      style.applyOver(parser.resolveInlineStyle(element.styleAttr));
+    }
+    return styleChecksum(style);
+  });
+
+  const RunResult resolveOnly = runElements(elements, [&parser](const Element& element) {
+    return styleChecksum(parser.resolveStyle(element.tag, element.classAttr));
+  });
+
+  // Same elements with the ancestor chain, so descendant and child selectors take part
+  CssParser::AncestorStack ancestors;
+  runElements(elements, [&parser, &ancestors](const Element& element) {
+    return styleChecksum(parser.resolveStyle(element.tag, element.classAttr, ancestors, element.depth));
+  });
+  const RunResult withAncestors = runElements(elements, [&parser, &ancestors](const Element& element) {
+    return styleChecksum(parser.resolveStyle(element.tag, element.classAttr, ancestors, element.depth));
+  });
+
+  CssParser pathological;
+  const std::string pathologicalCss = buildPathologicalStylesheet();
+  const auto pathologicalStart = std::chrono::steady_clock::now();
+  streamStylesheet(pathological, pathologicalCss, 1024);
+  const double pathologicalMs =
+      std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - pathologicalStart).count();
+  CssParser::AncestorStack deepAncestors;
+  static const char* DEEP_TAGS[] = {"section", "div", "div", "div", "div", "div", "div", "div", "div", "div", "div"};
+  std::vector<Element> deepElements;
+  deepElements.reserve(ELEMENT_COUNT / 10);
+  for (int i = 0; i < ELEMENT_COUNT / 10; ++i) {
+    const int depth = i % 12;
+    deepElements.push_back({depth < 11 ? DEEP_TAGS[depth] : "p", elements[i].classAttr, "", depth});
+  }
+  const auto resolveDeep = [&pathological, &deepAncestors](const Element& element) {
+    return styleChecksum(pathological.resolveStyle(element.tag, element.classAttr, deepAncestors, element.depth));
+  };
+  runElements(deepElements, resolveDeep);
+  const RunResult worstCase = runElements(deepElements, resolveDeep);
+
+  std::cout << "Elements: " << elements.size() << std::endl;
+  std::cout << "  CSS off:        " << off.nsPerElement << " ns/element, " << off.allocationsPerElement
+            << " allocations/element" << std::endl;
+  std::cout << "  CSS on:         " << on.nsPerElement << " ns/element, " << on.allocationsPerElement
+            << " allocations/element (checksum " << on.checksum << ")" << std::endl;
+  std::cout << "  resolveStyle:   " << resolveOnly.nsPerElement << " ns/element, "
+            << resolveOnly.allocationsPerElement << " allocations/element" << std::endl;
+  std::cout << "  with ancestors: " << withAncestors.nsPerElement << " ns/element, "
+            << withAncestors.allocationsPerElement << " allocations/element" << std::endl;
+  std::cout << "Pathological sheet: " << pathologicalCss.size() << " bytes, " << pathological.ruleCount()
+            << " rules, parsed in " << pathologicalMs << " ms" << std::endl;
+  std::cout << "  deep tree:      " << worstCase.nsPerElement << " ns/element, " << worstCase.allocationsPerElement
+            << " allocations/element" << std::endl;
+
+  expect(resolveOnly.allocationsPerElement == 0.0, "resolveStyle must not allocate");
+  expect(on.allocationsPerElement < 0.01, "memoized inline styles must not allocate in steady state");
+  expect(withAncestors.allocationsPerElement == 0.0, "ancestor matching must not allocate in steady state");
+  expect(worstCase.allocationsPerElement == 0.0, "pathological matching must not allocate in steady state");
+  expect(pathological.ruleCount() <= 1024 + 1, "combinator rule count is capped");
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}
@@ -0,0 +1,65 @@
+#pragma once
+// Host stand-in for the firmware's HalStorage: just enough of FsFile and HalStorage for the CSS parser and the
+// hyphenation dictionaries, backed by stdio. Absolute SD paths resolve below a host directory set with setRoot().
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+class FsFile {
+  FILE* file = nullptr;
+
+ public:
+  FsFile() = default;
+  explicit FsFile(FILE* f) : file(f) {}
+
+  bool open(const char* path, const char* mode) {
+    close();
+    file = fopen(path, mode);
+    return file != nullptr;
+  }
+  void close() {
+    if (file) fclose(file);
+    file = nullptr;
+  }
+
+  explicit operator bool() const { return file != nullptr; }
+
+  size_t size() const {
+    const long pos = ftell(file);
+    fseek(file, 0, SEEK_END);
+    const long end = ftell(file);
+    fseek(file, pos, SEEK_SET);
+    return static_cast<size_t>(end);
+  }
+  int available() const { return static_cast<int>(size() - ftell(file)); }
+  bool seek(const size_t pos) { return fseek(file, static_cast<long>(pos), SEEK_SET) == 0; }
+  int read(void* buf, const size_t count) { return static_cast<int>(fread(buf, 1, count, file)); }
+  size_t write(const uint8_t b) { return fputc(b, file) == EOF ? 0 : 1; }
+  size_t write(const uint8_t* buf, const size_t count) { return fwrite(buf, 1, count, file); }
+};
+
+class HalStorage {
+  std::string root = ".";
+
+ public:
+  void setRoot(const std::string& hostDir) { root = hostDir; }
+  std::string hostPath(const char* path) const { return root + path; }
+
+  bool exists(const char* path) const {
+    FILE* f = fopen(hostPath(path).c_str(), "rb");
+    if (f) fclose(f);
+    return f != nullptr;
+  }
+  bool openFileForRead(const char*, const std::string& path, FsFile& file) const {
+    return file.open(hostPath(path.c_str()).c_str(), "rb");
+  }
+
+  static HalStorage& getInstance() {
+    static HalStorage instance;
+    return instance;
+  }
+};
+
+#define Storage HalStorage::getInstance()
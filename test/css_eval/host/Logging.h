@@ -0,0 +1,6 @@
+#pragma once
+// Host stand-in for the firmware logger: logging is compiled out of the benchmarks.
+
+#define LOG_ERR(origin, format, ...)
+#define LOG_INF(origin, format, ...)
+#define LOG_DBG(origin, format, ...)
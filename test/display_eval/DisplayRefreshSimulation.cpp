@@ -0,0 +1,217 @@
+// Host simulation for the asynchronous refresh in HalDisplay.
+//
+// Runs lib/hal/HalDisplay.cpp and lib/hal/HalSpiBus.cpp against the stand-in driver in test/display_eval/host, which
+// keeps the panel busy for its refresh times (scaled down by EInkDisplay::TIME_SCALE) and checks that the frame buffer
+// is left alone while a refresh sends it. Turns pages the way the readers do, first with blocking refreshes (read the
+// page, lay it out and draw it, refresh) and then with asynchronous ones (draw, start the refresh, read and lay out
+// the next page while the panel updates), with a background job reading the card between its slices as the main loop
+// does, and reports the time per page in panel milliseconds. Reads hold the SPI bus, which a refresh holds while it
+// sends and lends out while the panel runs the waveform.
+//
+// Fails if the frame buffer was written during a refresh, if the driver was called while a refresh ran, if the card
+// was read while the driver sent, if no read overlapped a waveform, if onDone did not run once per refresh and after
+// the panel was done, if waitForRefresh reported a running refresh as done, if a refresh started from onDone did not
+// happen, if an asynchronous refresh before begin() did not refresh in place, if the background job never got a
+// slice, or if asynchronous page turns did not hide most of the page reads and layout.
+
+#include <HalDisplay.h>
+#include <HalSpiBus.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+constexpr int PAGES = 30;
+constexpr int PAGES_PER_HALF_REFRESH = 15;
+// Reading the next page from the section cache, laying it out and drawing it, in panel milliseconds
+constexpr int READ_MS = 40;
+constexpr int LAYOUT_MS = 260;
+constexpr int DRAW_MS = 60;
+// A background job's slice reading the card
+constexpr int SLICE_MS = 20;
+
+int failures = 0;
+std::atomic<int> readsDuringSend{0};
+std::atomic<int> readsDuringWaveform{0};
+
+void check(const bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAIL: " << message << std::endl;
+    failures++;
+  }
+}
+
+void work(const int panelMs) {
+  std::this_thread::sleep_for(std::chrono::microseconds(panelMs * 1000 / EInkDisplay::TIME_SCALE));
+}
+
+double panelMsSince(const std::chrono::steady_clock::time_point start) {
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  return std::chrono::duration<double, std::milli>(elapsed).count() * EInkDisplay::TIME_SCALE;
+}
+
+// Holds the bus like HalStorage and the code that reads an open file do
+void readCard(const int panelMs) {
+  HalSpiBus::Lock bus;
+  auto& stats = EInkDisplay::stats();
+  stats.cardActive = true;
+  if (stats.sending) readsDuringSend++;
+  if (digitalRead(EPD_BUSY) == HIGH) readsDuringWaveform++;
+  work(panelMs);
+  if (stats.sending) readsDuringSend++;
+  stats.cardActive = false;
+}
+
+void preparePage() {
+  readCard(READ_MS);
+  work(LAYOUT_MS);
+}
+
+HalDisplay::RefreshMode modeFor(const int page) {
+  return page % PAGES_PER_HALF_REFRESH == 0 ? HalDisplay::HALF_REFRESH : HalDisplay::FAST_REFRESH;
+}
+
+// Draws through the pointer the HAL hands out, as GfxRenderer does
+void drawPage(HalDisplay& display, const int page) {
+  uint8_t* frame = display.getFrameBuffer();
+  memset(frame, 0xFF, HalDisplay::BUFFER_SIZE);
+  for (uint32_t i = page % 7; i < HalDisplay::BUFFER_SIZE; i += 7) frame[i] = static_cast<uint8_t>(page);
+  work(DRAW_MS);
+}
+
+double turnPagesBlocking(HalDisplay& display) {
+  const auto start = std::chrono::steady_clock::now();
+  for (int page = 0; page < PAGES; page++) {
+    preparePage();
+    drawPage(display, page);
+    display.displayBuffer(modeFor(page));
+  }
+  return panelMsSince(start) / PAGES;
+}
+
+double turnPagesAsync(HalDisplay& display) {
+  std::atomic<int> done{0};
+  std::atomic<int> doneWhileBusy{0};
+  // The main loop's job slices, which skip a loop while a refresh has the bus
+  std::atomic<bool> turning{true};
+  std::atomic<int> slices{0};
+  std::thread job([&] {
+    while (turning) {
+      {
+        HalSpiBus::Lock bus(0);
+        if (bus.owns()) {
+          readCard(SLICE_MS);
+          slices++;
+        }
+      }
+      work(10);
+    }
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  preparePage();
+  for (int page = 0; page < PAGES; page++) {
+    drawPage(display, page);
+    display.displayBufferAsync(modeFor(page), false, [&] {
+      if (EInkDisplay::stats().busy || display.isRefreshing()) doneWhileBusy++;
+      done++;
+    });
+    if (page == 0) {
+      check(!display.waitForRefresh(0), "waitForRefresh(0) reported a running refresh as done");
+    }
+    // The next page is read and laid out while the panel updates
+    preparePage();
+  }
+  display.waitForRefresh();
+  const double perPage = panelMsSince(start) / PAGES;
+  turning = false;
+  job.join();
+  check(slices > 0, "the background job never got the bus");
+
+  // onDone runs just after the refresh lets go of the panel
+  for (int i = 0; i < 100 && done < PAGES; i++) work(10);
+  check(done == PAGES, "onDone ran " + std::to_string(done.load()) + " times for " + std::to_string(PAGES) +
+                           " refreshes");
+  check(doneWhileBusy == 0, "onDone ran while the panel was busy");
+  return perPage;
+}
+
+void checkChainedRefresh(HalDisplay& display) {
+  const int before = EInkDisplay::stats().refreshes;
+  std::atomic<bool> secondDone{false};
+  display.displayBufferAsync(HalDisplay::FAST_REFRESH, false, [&] {
+    display.displayBufferAsync(HalDisplay::FAST_REFRESH, false, [&] { secondDone = true; });
+  });
+  for (int i = 0; i < 200 && !secondDone; i++) work(10);
+  display.waitForRefresh();
+  check(secondDone, "a refresh started from onDone did not finish");
+  check(EInkDisplay::stats().refreshes - before == 2, "a refresh started from onDone did not happen");
+}
+
+void checkBlockingCallsWait(HalDisplay& display) {
+  display.displayBufferAsync(HalDisplay::HALF_REFRESH);
+  // Each of these reaches the driver only once the refresh is done
+  display.clearScreen(0xFF);
+  display.displayBufferAsync(HalDisplay::FAST_REFRESH);
+  display.displayGrayBufferAsync();
+  display.cleanupGrayscaleBuffers(display.getFrameBuffer());
+  display.displayBuffer(HalDisplay::FAST_REFRESH);
+  display.deepSleep();
+  check(!display.isRefreshing(), "a blocking call returned while a refresh ran");
+}
+
+void checkBeforeBegin() {
+  HalDisplay display;
+  const int before = EInkDisplay::stats().refreshes;
+  bool done = false;
+  display.displayBufferAsync(HalDisplay::FAST_REFRESH, false, [&] { done = true; });
+  check(done && EInkDisplay::stats().refreshes == before + 1 && !display.isRefreshing(),
+        "an asynchronous refresh before begin() did not refresh in place");
+}
+
+}  // namespace
+
+int main() {
+  checkBeforeBegin();
+
+  // The refresh task keeps a pointer to the display, so it outlives main
+  auto* display = new HalDisplay();
+  display->begin();
+  EInkDisplay::stats().reset();
+
+  const double blockingMs = turnPagesBlocking(*display);
+  const double asyncMs = turnPagesAsync(*display);
+  checkChainedRefresh(*display);
+  checkBlockingCallsWait(*display);
+
+  std::cout << "Page turns with " << READ_MS << " ms to read a page, " << LAYOUT_MS << " ms to lay it out and "
+            << DRAW_MS << " ms to draw it, a half refresh every " << PAGES_PER_HALF_REFRESH << " pages" << std::endl;
+  std::cout << std::left << std::setw(16) << "refresh" << std::right << std::setw(14) << "ms/page" << std::endl;
+  std::cout << std::fixed << std::setprecision(0);
+  std::cout << std::left << std::setw(16) << "blocking" << std::right << std::setw(14) << blockingMs << std::endl;
+  std::cout << std::left << std::setw(16) << "asynchronous" << std::right << std::setw(14) << asyncMs << std::endl;
+
+  const auto& stats = EInkDisplay::stats();
+  check(stats.writesDuringRefresh == 0,
+        std::to_string(stats.writesDuringRefresh.load()) + " refresh(es) saw the frame buffer change while sending it");
+  check(stats.callsDuringRefresh == 0,
+        std::to_string(stats.callsDuringRefresh.load()) + " driver call(s) arrived while a refresh ran");
+  const int collisions = readsDuringSend + stats.sendsDuringCardAccess;
+  check(collisions == 0, std::to_string(collisions) + " card read(s) overlapped the driver sending on the shared bus");
+  check(readsDuringWaveform > 0, "no card read overlapped a waveform, so the refresh kept the bus throughout");
+  // The page read and layout fit inside the waveform; polling BUSY and thread wakeups eat a little
+  check(asyncMs < blockingMs - (READ_MS + LAYOUT_MS) * 0.8, "asynchronous page turns did not hide the page reads");
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "\nAll checks passed" << std::endl;
+  return 0;
+}
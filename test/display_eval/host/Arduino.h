@@ -0,0 +1,19 @@
+#pragma once
+// Host stand-in for the parts of Arduino.h the display HAL uses
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+inline unsigned long millis() {
+  static const auto start = std::chrono::steady_clock::now();
+  return static_cast<unsigned long>(
+      std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count());
+}
+
+#define LOW 0
+#define HIGH 1
+
+// Defined by the stand-in driver, which tells whether the panel is busy
+inline int digitalRead(uint8_t pin);
+
+inline void delay(const unsigned long ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
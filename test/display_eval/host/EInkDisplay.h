@@ -0,0 +1,144 @@
+#pragma once
+// Host stand-in for the panel driver: keeps the frame buffer in memory and, for a refresh, sends it, holds BUSY high
+// for the time the waveform keeps the panel busy and polls it like the driver does, then sends a last command; all
+// scaled down by TIME_SCALE. The frame buffer is read while a refresh runs, so a checksum taken before and after tells
+// whether anything wrote to it in between. Calls that arrive while a refresh runs are counted too, and so are sends
+// while the card is being read (cardActive, set by the caller's stand-in for the card). Statistics are shared by all
+// instances.
+#include <HalGPIO.h>
+#include <freertos/FreeRTOS.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <thread>
+
+class EInkDisplay {
+ public:
+  enum RefreshMode { FULL_REFRESH, HALF_REFRESH, FAST_REFRESH };
+
+  static constexpr uint16_t DISPLAY_WIDTH = 800;
+  static constexpr uint16_t DISPLAY_HEIGHT = 480;
+  static constexpr uint32_t BUFFER_SIZE = DISPLAY_WIDTH / 8 * DISPLAY_HEIGHT;
+
+  // Milliseconds on the panel per millisecond here
+  static constexpr int TIME_SCALE = 10;
+  // Sending the frame over SPI, then the waveforms (HALF_REFRESH as noted in HalDisplay.h), then the command that
+  // follows a refresh
+  static constexpr int SEND_MS = 20;
+  static constexpr int AFTER_MS = 2;
+  static constexpr int FULL_MS = 2600;
+  static constexpr int HALF_MS = 1720;
+  static constexpr int FAST_MS = 420;
+  static constexpr int GRAY_MS = 480;
+
+  struct Stats {
+    std::atomic<int> refreshes{0};
+    std::atomic<int> halfRefreshes{0};
+    std::atomic<int> writesDuringRefresh{0};
+    std::atomic<int> callsDuringRefresh{0};
+    std::atomic<int> sendsDuringCardAccess{0};
+    std::atomic<bool> busy{false};
+    std::atomic<bool> sending{false};
+    std::atomic<bool> cardActive{false};
+    std::atomic<int64_t> busyUntilUs{0};
+
+    void reset() {
+      refreshes = 0;
+      halfRefreshes = 0;
+      writesDuringRefresh = 0;
+      callsDuringRefresh = 0;
+      sendsDuringCardAccess = 0;
+    }
+  };
+  static Stats& stats() {
+    static Stats instance;
+    return instance;
+  }
+
+  static int64_t nowUs() {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+  // When set, every refresh swaps the frame buffer for the other one, as the driver may in dual-buffer mode
+  bool swapBuffers = true;
+
+  EInkDisplay(int, int, int, int, int, int) {}
+
+  void begin() { memset(buffers, 0xFF, sizeof(buffers)); }
+
+  void clearScreen(const uint8_t color) const {
+    noteCall();
+    memset(frameBuffer(), color, BUFFER_SIZE);
+  }
+  void drawImage(const uint8_t* imageData, const uint16_t x, const uint16_t y, const uint16_t w, const uint16_t h,
+                 bool) const {
+    noteCall();
+    for (uint16_t row = 0; row < h && y + row < DISPLAY_HEIGHT; row++) {
+      memcpy(frameBuffer() + (y + row) * (DISPLAY_WIDTH / 8) + x / 8, imageData + row * (w / 8), w / 8);
+    }
+  }
+
+  void displayBuffer(const RefreshMode mode, bool) {
+    refresh(mode == FULL_REFRESH ? FULL_MS : mode == HALF_REFRESH ? HALF_MS : FAST_MS);
+    stats().halfRefreshes += mode != FAST_REFRESH;
+  }
+  void displayWindow(uint16_t, uint16_t, uint16_t, uint16_t, bool) { refresh(FAST_MS); }
+  void refreshDisplay(const RefreshMode mode, const bool turnOffScreen) { displayBuffer(mode, turnOffScreen); }
+  void displayGrayBuffer(bool) { refresh(GRAY_MS); }
+  void deepSleep() { noteCall(); }
+
+  uint8_t* getFrameBuffer() const { return frameBuffer(); }
+
+  void copyGrayscaleBuffers(const uint8_t*, const uint8_t*) { noteCall(); }
+  void copyGrayscaleLsbBuffers(const uint8_t*) { noteCall(); }
+  void copyGrayscaleMsbBuffers(const uint8_t*) { noteCall(); }
+  void cleanupGrayscaleBuffers(const uint8_t*) { noteCall(); }
+
+ private:
+  mutable uint8_t buffers[2][BUFFER_SIZE];
+  int current = 0;
+
+  uint8_t* frameBuffer() const { return buffers[current]; }
+
+  static void noteCall() {
+    if (stats().busy) stats().callsDuringRefresh++;
+  }
+
+  static uint64_t checksum(const uint8_t* data) {
+    uint64_t sum = 1469598103934665603ull;
+    for (uint32_t i = 0; i < BUFFER_SIZE; i++) sum = (sum ^ data[i]) * 1099511628211ull;
+    return sum;
+  }
+
+  static void send(const int panelMs) {
+    stats().sending = true;
+    if (stats().cardActive) stats().sendsDuringCardAccess++;
+    std::this_thread::sleep_for(std::chrono::microseconds(panelMs * 1000 / TIME_SCALE));
+    if (stats().cardActive) stats().sendsDuringCardAccess++;
+    stats().sending = false;
+  }
+
+  void refresh(const int panelMs) {
+    if (stats().busy.exchange(true)) stats().callsDuringRefresh++;
+    const uint64_t before = checksum(frameBuffer());
+    send(SEND_MS);
+    // The panel drops BUSY on its own time, whether or not this task runs
+    stats().busyUntilUs = nowUs() + panelMs * 1000 / TIME_SCALE;
+    while (digitalRead(EPD_BUSY) == HIGH) host_freertos::sleepFor(std::chrono::microseconds(200));
+    send(AFTER_MS);
+    if (checksum(frameBuffer()) != before) stats().writesDuringRefresh++;
+    if (swapBuffers) {
+      memcpy(buffers[1 - current], buffers[current], BUFFER_SIZE);
+      current = 1 - current;
+    }
+    stats().refreshes++;
+    stats().busy = false;
+  }
+};
+
+inline int digitalRead(const uint8_t pin) {
+  return pin == EPD_BUSY && EInkDisplay::stats().busyUntilUs > EInkDisplay::nowUs() ? HIGH : LOW;
+}
@@ -0,0 +1,90 @@
+#pragma once
+// Host stand-in for the FreeRTOS calls the display HAL uses, on std::thread; a tick is a millisecond
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+using TickType_t = uint32_t;
+using BaseType_t = int;
+using UBaseType_t = unsigned;
+
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) (static_cast<TickType_t>(ms))
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+
+namespace host_freertos {
+
+// A thread's task: its notification value, and for tasks made by xTaskCreate a gate it holds while it runs and lets
+// go of while it blocks, which vTaskSuspend holds to keep it from running on. Other threads get one on first use,
+// without the gate.
+struct Task;
+Task* currentTask();
+
+// Lets go of the current task's gate for its scope
+struct Blocking {
+  Task* task;
+  Blocking();
+  ~Blocking();
+};
+
+// A count guarded by a condition variable: a binary semaphore or a task's notification value
+struct Signal {
+  std::mutex mutex;
+  std::condition_variable changed;
+  uint32_t count = 0;
+
+  bool take(const TickType_t ticks, const bool clear) {
+    Blocking blocking;
+    std::unique_lock<std::mutex> lock(mutex);
+    const auto ready = [this] { return count > 0; };
+    if (ticks == portMAX_DELAY) {
+      changed.wait(lock, ready);
+    } else if (!changed.wait_for(lock, std::chrono::milliseconds(ticks), ready)) {
+      return false;
+    }
+    count = clear ? 0 : count - 1;
+    return true;
+  }
+
+  void give(const uint32_t limit) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (count < limit) count++;
+    }
+    changed.notify_all();
+  }
+};
+
+struct Task : Signal {
+  std::mutex gate;
+  bool gated = false;
+};
+
+inline thread_local Task* threadTask = nullptr;
+
+inline Task* currentTask() {
+  if (!threadTask) threadTask = new Task();
+  return threadTask;
+}
+
+inline Blocking::Blocking() : task(currentTask()) {
+  if (task->gated) task->gate.unlock();
+}
+
+inline Blocking::~Blocking() {
+  if (task->gated) task->gate.lock();
+}
+
+// Sleeps as a blocked task, e.g. the driver waiting on the panel
+inline void sleepFor(const std::chrono::microseconds duration) {
+  Blocking blocking;
+  std::this_thread::sleep_for(duration);
+}
+
+}  // namespace host_freertos
@@ -0,0 +1,13 @@
+#pragma once
+#include "FreeRTOS.h"
+
+using SemaphoreHandle_t = host_freertos::Signal*;
+
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return new host_freertos::Signal(); }
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t semaphore, const TickType_t ticks) {
+  return semaphore->take(ticks, false) ? pdTRUE : pdFALSE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t semaphore) {
+  semaphore->give(1);
+  return pdTRUE;
+}
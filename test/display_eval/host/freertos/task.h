@@ -0,0 +1,33 @@
+#pragma once
+#include <thread>
+
+#include "FreeRTOS.h"
+
+using TaskFunction_t = void (*)(void*);
+// Tasks run on detached threads and are never deleted
+using TaskHandle_t = host_freertos::Task*;
+
+inline BaseType_t xTaskCreate(TaskFunction_t function, const char*, uint32_t, void* param, UBaseType_t,
+                              TaskHandle_t* handle) {
+  const TaskHandle_t task = new host_freertos::Task();
+  task->gated = true;
+  *handle = task;
+  std::thread([=] {
+    host_freertos::threadTask = task;
+    task->gate.lock();
+    function(param);
+  }).detach();
+  return pdPASS;
+}
+inline TaskHandle_t xTaskGetCurrentTaskHandle() { return host_freertos::currentTask(); }
+inline uint32_t ulTaskNotifyTake(const BaseType_t clearOnExit, const TickType_t ticks) {
+  return host_freertos::currentTask()->take(ticks, clearOnExit == pdTRUE) ? 1 : 0;
+}
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  task->give(UINT32_MAX);
+  return pdPASS;
+}
+inline void vTaskDelay(const TickType_t ticks) { host_freertos::sleepFor(std::chrono::milliseconds(ticks)); }
+// Returns once the task is blocked, which is where a suspended task stops on a single core
+inline void vTaskSuspend(TaskHandle_t task) { task->gate.lock(); }
+inline void vTaskResume(TaskHandle_t task) { task->gate.unlock(); }
@@ -0,0 +1,309 @@
+// Host benchmark for the ghosting-aware refresh choice in GhostingTracker.
+//
+// Counts the changed pixels between 48 KB frames bit by bit, through a per-byte table and word-wide with popcount (as
+// the tracker does), checks that all three agree and reports the time per frame; the tracker's residue count is
+// checked against a pixel by pixel one too. Then reads a stream of synthetic pages through the tracker the way the
+// readers do, with the refresh frequency at its default of 15 pages, and compares the half refreshes it asks for with
+// the fixed page counter it replaces: body text only, text with an image page every few pages, and text with
+// inverted (white on black) pages.
+//
+// Fails if the counts disagree, if plain text gets more than two thirds of the fixed counter's half refreshes, if an
+// image or inverted page is not followed by a half refresh within two pages, if a frequency of 1 does not give a half
+// refresh for every page, or if the tracker without its frame copy differs from the fixed counter.
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lib/GfxRenderer/GhostingTracker.h"
+
+namespace {
+
+constexpr int WIDTH = 800;
+constexpr int HEIGHT = 480;
+constexpr size_t WIDTH_BYTES = WIDTH / 8;
+constexpr size_t FRAME_BYTES = WIDTH_BYTES * HEIGHT;
+constexpr size_t CHUNK_BYTES = 8000;
+constexpr int PAGES_PER_REFRESH = 15;
+constexpr int STREAM_PAGES = 150;
+
+int failures = 0;
+
+void check(const bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAIL: " << message << std::endl;
+    failures++;
+  }
+}
+
+struct Random {
+  uint32_t state;
+  explicit Random(const uint32_t seed) : state(seed) {}
+  uint32_t next() {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+  }
+  int range(const int low, const int high) { return low + static_cast<int>(next() % (high - low + 1)); }
+};
+
+// Set bits are white, as in the display frame buffer
+using Frame = std::vector<uint8_t>;
+
+void setBlack(Frame& frame, const int x, const int y) { frame[y * WIDTH_BYTES + x / 8] &= ~(0x80 >> (x % 8)); }
+void setWhite(Frame& frame, const int x, const int y) { frame[y * WIDTH_BYTES + x / 8] |= 0x80 >> (x % 8); }
+
+// Lines of words made of glyph-like strokes: 2 px stems, and bars across the glyph at the top, middle or bottom
+void drawText(Frame& frame, Random& random, const int top, const int bottom, const bool inverted) {
+  constexpr int lineHeight = 30;
+  constexpr int glyphHeight = 18;
+  constexpr int glyphWidth = 10;
+  const auto ink = [&](const int x, const int y) { inverted ? setWhite(frame, x, y) : setBlack(frame, x, y); };
+  for (int lineTop = top; lineTop + lineHeight <= bottom; lineTop += lineHeight) {
+    int x = 24;
+    while (true) {
+      const int glyphs = random.range(1, 8);
+      if (x + glyphs * glyphWidth > WIDTH - 24) break;
+      for (int glyph = 0; glyph < glyphs; glyph++, x += glyphWidth) {
+        const uint32_t shape = random.next();
+        // Ascenders reach the top of the line, other glyphs start at the x-height
+        const int glyphTop = lineTop + (shape & 1 ? 0 : 6);
+        for (int stem = 0; stem < 2; stem++) {
+          if (!(shape >> (1 + stem) & 1)) continue;
+          const int stemX = x + 1 + stem * 5;
+          for (int y = glyphTop; y < lineTop + glyphHeight; y++) {
+            ink(stemX, y);
+            ink(stemX + 1, y);
+          }
+        }
+        for (int bar = 0; bar < 3; bar++) {
+          if (!(shape >> (3 + bar) & 1)) continue;
+          const int barY = bar == 0 ? lineTop + 6 : bar == 1 ? lineTop + 11 : lineTop + glyphHeight - 2;
+          for (int dx = 1; dx < glyphWidth - 2; dx++) {
+            ink(x + dx, barY);
+            ink(x + dx, barY + 1);
+          }
+        }
+      }
+      x += 7;
+    }
+  }
+}
+
+Frame textPage(const uint32_t seed) {
+  Frame frame(FRAME_BYTES, 0xFF);
+  Random random(seed);
+  drawText(frame, random, 20, HEIGHT - 20, false);
+  return frame;
+}
+
+// Half the page is a dithered picture, the rest text
+Frame imagePage(const uint32_t seed) {
+  Frame frame(FRAME_BYTES, 0xFF);
+  Random random(seed);
+  for (int y = 20; y < 260; y++) {
+    for (int x = 24; x < WIDTH - 24; x++) {
+      if (random.next() % 2 == 0) setBlack(frame, x, y);
+    }
+  }
+  drawText(frame, random, 270, HEIGHT - 20, false);
+  return frame;
+}
+
+Frame invertedPage(const uint32_t seed) {
+  Frame frame(FRAME_BYTES, 0x00);
+  Random random(seed);
+  drawText(frame, random, 20, HEIGHT - 20, true);
+  return frame;
+}
+
+// Changed pixels, for the report
+uint32_t countChanged(const uint8_t* a, const uint8_t* b, const size_t bytes) {
+  uint32_t changed = 0;
+  for (size_t i = 0; i < bytes; i++) {
+    for (int bit = 0; bit < 8; bit++) {
+      changed += ((a[i] ^ b[i]) >> bit) & 1;
+    }
+  }
+  return changed;
+}
+
+// Whitened pixels bit by bit, 4 each in bytes with at least 4 of them and 1 each otherwise
+uint32_t residueBitByBit(const uint8_t* a, const uint8_t* b, const size_t bytes) {
+  uint32_t residue = 0;
+  for (size_t i = 0; i < bytes; i++) {
+    int whitened = 0;
+    for (int bit = 0; bit < 8; bit++) {
+      whitened += !((a[i] >> bit) & 1) && ((b[i] >> bit) & 1);
+    }
+    residue += whitened * (whitened >= 4 ? 4 : 1);
+  }
+  return residue;
+}
+
+uint32_t residueByTable(const uint8_t* a, const uint8_t* b, const size_t bytes) {
+  static uint8_t table[256] = {};
+  if (table[255] == 0) {
+    for (int i = 1; i < 256; i++) {
+      const int count = __builtin_popcount(i);
+      table[i] = static_cast<uint8_t>(count * (count >= 4 ? 4 : 1));
+    }
+  }
+  uint32_t residue = 0;
+  for (size_t i = 0; i < bytes; i++) residue += table[static_cast<uint8_t>(~a[i] & b[i])];
+  return residue;
+}
+
+template <typename Count>
+double microsecondsPerFrame(const Count& count, const Frame& a, const Frame& b, const int iterations,
+                            uint32_t& result) {
+  const auto start = std::chrono::steady_clock::now();
+  uint64_t sink = 0;
+  for (int i = 0; i < iterations; i++) {
+    sink += count(a.data(), b.data(), FRAME_BYTES);
+  }
+  const auto elapsed = std::chrono::steady_clock::now() - start;
+  result = static_cast<uint32_t>(sink / iterations);
+  return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+}
+
+void benchmarkCounting() {
+  // A picture page going, the frame with the most residue
+  const Frame a = imagePage(2);
+  const Frame b = textPage(1);
+  uint32_t bits = 0, table = 0, words = 0;
+  const double bitsUs = microsecondsPerFrame(residueBitByBit, a, b, 200, bits);
+  const double tableUs = microsecondsPerFrame(residueByTable, a, b, 2000, table);
+  const double wordsUs = microsecondsPerFrame(GhostingTracker::countResidue, a, b, 20000, words);
+
+  std::cout << "Residue between two 48 KB frames (" << words << " quarter pixels)" << std::endl;
+  std::cout << std::left << std::setw(16) << "method" << std::right << std::setw(14) << "us/frame" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << std::left << std::setw(16) << "bit by bit" << std::right << std::setw(14) << bitsUs << std::endl;
+  std::cout << std::left << std::setw(16) << "byte table" << std::right << std::setw(14) << tableUs << std::endl;
+  std::cout << std::left << std::setw(16) << "word-wide" << std::right << std::setw(14) << wordsUs << std::endl;
+
+  check(bits == table && table == words, "residue counts disagree: " + std::to_string(bits) + ", " +
+                                             std::to_string(table) + ", " + std::to_string(words));
+  // Odd lengths and every byte value
+  Frame x(FRAME_BYTES), y(FRAME_BYTES);
+  for (size_t i = 0; i < FRAME_BYTES; i++) {
+    x[i] = static_cast<uint8_t>(i * 7);
+    y[i] = static_cast<uint8_t>(i * 13 + 5);
+  }
+  for (const size_t bytes : {size_t{4}, size_t{12}, size_t{2000}, size_t{6000}, FRAME_BYTES}) {
+    check(GhostingTracker::countResidue(x.data(), y.data(), bytes) == residueBitByBit(x.data(), y.data(), bytes),
+          "word-wide residue is off for " + std::to_string(bytes) + " bytes");
+  }
+}
+
+enum class PageKind { TEXT, IMAGE, INVERTED };
+
+struct StreamResult {
+  int halfRefreshes = 0;
+  std::vector<bool> clean;
+};
+
+// Pages through the tracker as the readers do: the first page gets a half refresh, as the panel is unknown
+StreamResult runTracker(const std::vector<PageKind>& pages, const int pagesPerRefresh, const bool canAllocate) {
+  GhostingTracker tracker(FRAME_BYTES, CHUNK_BYTES);
+  StreamResult result;
+  for (size_t i = 0; i < pages.size(); i++) {
+    const uint32_t seed = 1000 + static_cast<uint32_t>(i);
+    const Frame frame = pages[i] == PageKind::TEXT    ? textPage(seed)
+                        : pages[i] == PageKind::IMAGE ? imagePage(seed)
+                                                      : invertedPage(seed);
+    const bool clean = i == 0 || tracker.needsCleanRefresh(frame.data(), pagesPerRefresh);
+    tracker.frameShown(frame.data(), clean, canAllocate);
+    result.clean.push_back(clean);
+    if (clean && i > 0) result.halfRefreshes++;
+  }
+  return result;
+}
+
+// The readers' old choice: a half refresh on the first page and then every pagesPerRefresh pages
+StreamResult runCounter(const size_t pageCount, const int pagesPerRefresh) {
+  StreamResult result;
+  int pagesUntilFullRefresh = 0;
+  for (size_t i = 0; i < pageCount; i++) {
+    const bool clean = pagesUntilFullRefresh <= 1;
+    pagesUntilFullRefresh = clean ? pagesPerRefresh : pagesUntilFullRefresh - 1;
+    result.clean.push_back(clean);
+    if (clean && i > 0) result.halfRefreshes++;
+  }
+  return result;
+}
+
+void checkCleanedAfter(const std::vector<PageKind>& pages, const StreamResult& result, const std::string& name) {
+  for (size_t i = 0; i < pages.size(); i++) {
+    if (pages[i] == PageKind::TEXT) continue;
+    bool cleaned = false;
+    for (size_t j = i; j < pages.size() && j <= i + 2; j++) cleaned = cleaned || result.clean[j];
+    check(cleaned || i + 2 >= pages.size(), name + ": no half refresh within two pages of page " + std::to_string(i));
+  }
+}
+
+void benchmarkPolicy() {
+  const Frame a = textPage(7);
+  const Frame b = textPage(8);
+  const Frame c = imagePage(9);
+  const double panelPixels = FRAME_BYTES * 8;
+  const double textChange = 100.0 * countChanged(a.data(), b.data(), FRAME_BYTES) / panelPixels;
+  const double textResidue = 25.0 * GhostingTracker::countResidue(a.data(), b.data(), FRAME_BYTES) / panelPixels;
+  const double imageResidue = 25.0 * GhostingTracker::countResidue(c.data(), b.data(), FRAME_BYTES) / panelPixels;
+  std::cout << "\nA text page turn flips " << std::setprecision(1) << textChange << "% of the panel and leaves "
+            << textResidue << "% residue, leaving an image page " << imageResidue << "% (threshold "
+            << GhostingTracker::RESIDUE_THRESHOLD_PERCENT << "% of a band)" << std::endl;
+
+  std::vector<PageKind> text(STREAM_PAGES, PageKind::TEXT);
+  std::vector<PageKind> images = text;
+  for (size_t i = 5; i < images.size(); i += 7) images[i] = PageKind::IMAGE;
+  std::vector<PageKind> inverted = text;
+  for (size_t i = 10; i < inverted.size(); i += 20) inverted[i] = PageKind::INVERTED;
+
+  const StreamResult counter = runCounter(STREAM_PAGES, PAGES_PER_REFRESH);
+  std::cout << "\nHalf refreshes over " << STREAM_PAGES << " pages, refresh frequency " << PAGES_PER_REFRESH
+            << std::endl;
+  std::cout << std::left << std::setw(22) << "stream" << std::right << std::setw(10) << "counter" << std::setw(10)
+            << "adaptive" << std::endl;
+  const auto report = [&](const std::string& name, const std::vector<PageKind>& pages) {
+    const StreamResult adaptive = runTracker(pages, PAGES_PER_REFRESH, true);
+    std::cout << std::left << std::setw(22) << name << std::right << std::setw(10) << counter.halfRefreshes
+              << std::setw(10) << adaptive.halfRefreshes << std::endl;
+    return adaptive;
+  };
+  const StreamResult textResult = report("text", text);
+  const StreamResult imageResult = report("text + image pages", images);
+  const StreamResult invertedResult = report("text + inverted pages", inverted);
+
+  check(textResult.halfRefreshes * 3 <= counter.halfRefreshes * 2,
+        "plain text got " + std::to_string(textResult.halfRefreshes) + " half refreshes, the counter " +
+            std::to_string(counter.halfRefreshes));
+  checkCleanedAfter(images, imageResult, "image pages");
+  checkCleanedAfter(inverted, invertedResult, "inverted pages");
+
+  const StreamResult everyPage = runTracker(images, 1, true);
+  check(everyPage.halfRefreshes == STREAM_PAGES - 1, "a refresh frequency of 1 skipped half refreshes");
+
+  const StreamResult blind = runTracker(images, PAGES_PER_REFRESH, false);
+  check(blind.clean == counter.clean, "without its frame copy the tracker differs from the page counter");
+}
+
+}  // namespace
+
+int main() {
+  benchmarkCounting();
+  benchmarkPolicy();
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "\nAll checks passed" << std::endl;
+  return 0;
+}
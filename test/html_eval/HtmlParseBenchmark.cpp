@@ -0,0 +1,393 @@
+// Host benchmark for the per-element work ChapterHtmlSlimParser does in its expat callbacks.
+//
+// Generates a synthetic chapter with the tag mix of a typical converted EPUB and parses it with the bundled expat
+// three times: with empty callbacks, with the strcmp-chain tag classification the parser used before HtmlTags, and
+// with HtmlTags::classify carried on a tag stack. Whole-parse timings include expat's own work and are noisy, so the
+// classification of the chapter's tag sequence is also timed on its own. Fails if the two classifications ever
+// disagree.
+//
+// Entity decoding is checked against every entry of the generated HTML5 table plus numeric and malformed references,
+// and the perfect-hash lookup is timed against the linear scan over the old 240-entry table.
+
+#include <expat.h>
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/generated/html-entities.h"
+#include "lib/Epub/Epub/htmlEntities.h"
+#include "lib/Epub/Epub/parsers/HtmlTags.h"
+
+namespace {
+
+constexpr int PARAGRAPH_COUNT = 20000;
+constexpr int REPEATS = 10;
+
+int failures = 0;
+
+void expect(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL: " << what << std::endl;
+    ++failures;
+  }
+}
+
+// The classification ChapterHtmlSlimParser did before HtmlTags: one strcmp per candidate tag, in this order
+const char* HEADER_TAGS[] = {"h1", "h2", "h3", "h4", "h5", "h6"};
+const char* BLOCK_TAGS[] = {"p", "li", "div", "br", "blockquote"};
+const char* BOLD_TAGS[] = {"b", "strong"};
+const char* ITALIC_TAGS[] = {"i", "em"};
+const char* UNDERLINE_TAGS[] = {"u", "ins"};
+const char* IMAGE_TAGS[] = {"img"};
+const char* SKIP_TAGS[] = {"head"};
+
+template <size_t N>
+bool matches(const char* name, const char* (&tags)[N]) {
+  for (const char* tag : tags) {
+    if (strcmp(name, tag) == 0) return true;
+  }
+  return false;
+}
+
+bool isHeaderOrBlock(const char* name) { return matches(name, HEADER_TAGS) || matches(name, BLOCK_TAGS); }
+
+// Same decisions as the old startElement, folded into the HtmlTags bitmask so the two can be compared
+uint16_t legacyStartCategories(const char* name) {
+  if (strcmp(name, "table") == 0) return HtmlTags::TABLE;
+  if (matches(name, IMAGE_TAGS)) return HtmlTags::IMAGE;
+  if (matches(name, SKIP_TAGS)) return HtmlTags::SKIP;
+  if (matches(name, HEADER_TAGS)) return HtmlTags::HEADER;
+  if (matches(name, BLOCK_TAGS)) {
+    if (strcmp(name, "br") == 0) return HtmlTags::BLOCK | HtmlTags::LINE_BREAK;
+    return strcmp(name, "li") == 0 ? HtmlTags::BLOCK | HtmlTags::LIST_ITEM : HtmlTags::BLOCK;
+  }
+  if (matches(name, UNDERLINE_TAGS)) return HtmlTags::UNDERLINE;
+  if (matches(name, BOLD_TAGS)) return HtmlTags::BOLD;
+  if (matches(name, ITALIC_TAGS)) return HtmlTags::ITALIC;
+  if (strcmp(name, "span") == 0) return HtmlTags::SPAN;
+  return isHeaderOrBlock(name) ? HtmlTags::BLOCK : 0;
+}
+
+// Same decisions as the old endElement flush check
+bool legacyEndFlushes(const char* name) {
+  return isHeaderOrBlock(name) || matches(name, BOLD_TAGS) || matches(name, ITALIC_TAGS) ||
+         matches(name, UNDERLINE_TAGS) || strcmp(name, "table") == 0 || matches(name, IMAGE_TAGS);
+}
+
+constexpr uint16_t FLUSH_ON_END = HtmlTags::HEADER | HtmlTags::BLOCK | HtmlTags::BOLD | HtmlTags::ITALIC |
+                                  HtmlTags::UNDERLINE | HtmlTags::TABLE | HtmlTags::IMAGE;
+
+std::string buildChapter() {
+  std::string html =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+      "<html xmlns=\"http://www.w3.org/1999/xhtml\"><head><title>Chapter</title>"
+      "<link rel=\"stylesheet\" type=\"text/css\" href=\"stylesheet.css\"/></head><body>\n"
+      "<section class=\"chapter\"><h2 class=\"calibre3\">Chapter One</h2>\n";
+  for (int i = 0; i < PARAGRAPH_COUNT; ++i) {
+    switch (i % 10) {
+      case 0:
+        html += "<div class=\"calibre5\"><p class=\"calibre1\">The <em>quick</em> brown fox <span class=\"calibre7\">"
+                "jumps</span> over the <a href=\"#n1\">lazy</a> dog.</p></div>\n";
+        break;
+      case 3:
+        html += "<blockquote><p>She said <i>nothing</i> at all,<br/>and <strong>left</strong>.</p></blockquote>\n";
+        break;
+      case 6:
+        html += "<ul><li>One <b>item</b></li><li>Two <u>items</u></li></ul>\n";
+        break;
+      case 8:
+        html += "<p class=\"calibre2\"><img src=\"images/fig.jpg\" alt=\"Figure\"/></p>"
+                "<table><tr><td>cell</td></tr></table>\n";
+        break;
+      default:
+        html += "<p class=\"calibre1\">Plain text with a <span class=\"calibre6\">styled</span> word, "
+                "<sup><a href=\"#note\">1</a></sup> and <small>small print</small>.</p>\n";
+        break;
+    }
+  }
+  html += "</section></body></html>\n";
+  return html;
+}
+
+struct Counters {
+  size_t elements = 0;
+  uint32_t checksum = 0;
+  std::vector<uint16_t> tagStack;
+  std::vector<std::string>* names = nullptr;  // Collects element names when set
+};
+
+using StartHandler = void (*)(void*, const XML_Char*, const XML_Char**);
+using EndHandler = void (*)(void*, const XML_Char*);
+
+double parseNsPerElement(const std::string& html, const StartHandler onStart, const EndHandler onEnd,
+                         Counters& counters) {
+  double best = 0;
+  for (int repeat = 0; repeat < REPEATS; ++repeat) {
+    std::vector<std::string>* names = counters.names;
+    counters = Counters();
+    counters.names = repeat == 0 ? names : nullptr;
+    counters.tagStack.reserve(64);
+    XML_Parser parser = XML_ParserCreate(nullptr);
+    XML_SetUserData(parser, &counters);
+    XML_SetElementHandler(parser, onStart, onEnd);
+    const auto start = std::chrono::steady_clock::now();
+    const bool ok = XML_Parse(parser, html.data(), static_cast<int>(html.size()), 1) == XML_STATUS_OK;
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    XML_ParserFree(parser);
+    expect(ok, "chapter parses");
+    const double perElement = ns / counters.elements;
+    if (repeat == 0 || perElement < best) best = perElement;
+  }
+  return best;
+}
+
+void XMLCALL emptyStart(void* userData, const XML_Char* name, const XML_Char**) {
+  auto* counters = static_cast<Counters*>(userData);
+  ++counters->elements;
+  if (counters->names) counters->names->emplace_back(name);
+}
+
+void XMLCALL emptyEnd(void*, const XML_Char*) {}
+
+void XMLCALL legacyStart(void* userData, const XML_Char* name, const XML_Char**) {
+  auto* counters = static_cast<Counters*>(userData);
+  ++counters->elements;
+  counters->checksum += legacyStartCategories(name);
+}
+
+void XMLCALL legacyEnd(void* userData, const XML_Char* name) {
+  static_cast<Counters*>(userData)->checksum += legacyEndFlushes(name) ? 1 : 0;
+}
+
+void XMLCALL hashedStart(void* userData, const XML_Char* name, const XML_Char**) {
+  auto* counters = static_cast<Counters*>(userData);
+  ++counters->elements;
+  const uint16_t tag = HtmlTags::classify(name);
+  counters->tagStack.push_back(tag);
+  counters->checksum += tag;
+}
+
+void XMLCALL hashedEnd(void* userData, const XML_Char*) {
+  auto* counters = static_cast<Counters*>(userData);
+  const uint16_t tag = counters->tagStack.back();
+  counters->tagStack.pop_back();
+  counters->checksum += (tag & FLUSH_ON_END) ? 1 : 0;
+}
+
+void checkClassification() {
+  // Every tag the parser knows, tags from real chapters it does not, and near misses of known names
+  static const char* NAMES[] = {
+      "h1", "h2", "h3", "h4", "h5", "h6", "p", "li", "div", "br", "blockquote", "b", "strong", "i", "em", "u",
+      "ins", "img", "head", "table", "span", "a", "sup", "small", "tr", "td", "html", "body", "title", "link", "ul",
+      "ol", "section", "hr", "pre", "code", "image", "svg", "bold", "h7", "blockquotes", "tables", "",
+  };
+  for (const char* name : NAMES) {
+    expect(HtmlTags::classify(name) == legacyStartCategories(name), std::string("start categories of <") + name + ">");
+    expect(((HtmlTags::classify(name) & FLUSH_ON_END) != 0) == legacyEndFlushes(name),
+           std::string("end flush of <") + name + ">");
+  }
+}
+
+// The entity names the decoder knew before the HTML5 table, in their original order, for the linear-scan baseline
+const char* LEGACY_ENTITY_NAMES[] = {
+    "&quot;", "&frasl;", "&amp;", "&lt;", "&gt;", "&Agrave;", "&Aacute;", "&Acirc;", "&Atilde;", "&Auml;", "&Aring;",
+    "&AElig;", "&Ccedil;", "&Egrave;", "&Eacute;", "&Ecirc;", "&Euml;", "&Igrave;", "&Iacute;", "&Icirc;", "&Iuml;",
+    "&ETH;", "&Ntilde;", "&Ograve;", "&Oacute;", "&Ocirc;", "&Otilde;", "&Ouml;", "&Oslash;", "&Ugrave;", "&Uacute;",
+    "&Ucirc;", "&Uuml;", "&Yacute;", "&THORN;", "&szlig;", "&agrave;", "&aacute;", "&acirc;", "&atilde;", "&auml;",
+    "&aring;", "&aelig;", "&ccedil;", "&egrave;", "&eacute;", "&ecirc;", "&euml;", "&igrave;", "&iacute;", "&icirc;",
+    "&iuml;", "&eth;", "&ntilde;", "&ograve;", "&oacute;", "&ocirc;", "&otilde;", "&ouml;", "&oslash;", "&ugrave;",
+    "&uacute;", "&ucirc;", "&uuml;", "&yacute;", "&thorn;", "&yuml;", "&nbsp;", "&iexcl;", "&cent;", "&pound;",
+    "&curren;", "&yen;", "&brvbar;", "&sect;", "&uml;", "&copy;", "&ordf;", "&laquo;", "&not;", "&shy;", "&reg;",
+    "&macr;", "&deg;", "&plusmn;", "&sup2;", "&sup3;", "&acute;", "&micro;", "&para;", "&cedil;", "&sup1;", "&ordm;",
+    "&raquo;", "&frac14;", "&frac12;", "&frac34;", "&iquest;", "&times;", "&divide;", "&forall;", "&part;", "&exist;",
+    "&empty;", "&nabla;", "&isin;", "&notin;", "&ni;", "&prod;", "&sum;", "&minus;", "&lowast;", "&radic;", "&prop;",
+    "&infin;", "&ang;", "&and;", "&or;", "&cap;", "&cup;", "&int;", "&there4;", "&sim;", "&cong;", "&asymp;", "&ne;",
+    "&equiv;", "&le;", "&ge;", "&sub;", "&sup;", "&nsub;", "&sube;", "&supe;", "&oplus;", "&otimes;", "&perp;",
+    "&sdot;", "&Alpha;", "&Beta;", "&Gamma;", "&Delta;", "&Epsilon;", "&Zeta;", "&Eta;", "&Theta;", "&Iota;",
+    "&Kappa;", "&Lambda;", "&Mu;", "&Nu;", "&Xi;", "&Omicron;", "&Pi;", "&Rho;", "&Sigma;", "&Tau;", "&Upsilon;",
+    "&Phi;", "&Chi;", "&Psi;", "&Omega;", "&alpha;", "&beta;", "&gamma;", "&delta;", "&epsilon;", "&zeta;", "&eta;",
+    "&theta;", "&iota;", "&kappa;", "&lambda;", "&mu;", "&nu;", "&xi;", "&omicron;", "&pi;", "&rho;", "&sigmaf;",
+    "&sigma;", "&tau;", "&upsilon;", "&phi;", "&chi;", "&psi;", "&omega;", "&thetasym;", "&upsih;", "&piv;",
+    "&OElig;", "&oelig;", "&Scaron;", "&scaron;", "&Yuml;", "&fnof;", "&circ;", "&tilde;", "&ensp;", "&emsp;",
+    "&thinsp;", "&zwnj;", "&zwj;", "&lrm;", "&rlm;", "&ndash;", "&mdash;", "&lsquo;", "&rsquo;", "&sbquo;", "&ldquo;",
+    "&rdquo;", "&bdquo;", "&dagger;", "&Dagger;", "&bull;", "&hellip;", "&permil;", "&prime;", "&Prime;", "&lsaquo;",
+    "&rsaquo;", "&oline;", "&euro;", "&trade;", "&larr;", "&uarr;", "&rarr;", "&darr;", "&harr;", "&crarr;",
+    "&lceil;", "&rceil;", "&lfloor;", "&rfloor;", "&loz;", "&spades;", "&clubs;", "&hearts;", "&diams;",
+};
+
+const char* legacyLookup(const char* entity, const int len) {
+  for (const char* key : LEGACY_ENTITY_NAMES) {
+    const size_t keyLen = strlen(key);
+    if (static_cast<size_t>(len) == keyLen && memcmp(entity, key, keyLen) == 0) return key;
+  }
+  return nullptr;
+}
+
+bool decodesTo(const char* entity, const char* expected) {
+  const char* value = lookupHtmlEntity(entity, static_cast<int>(strlen(entity)));
+  return expected ? value && strcmp(value, expected) == 0 : value == nullptr;
+}
+
+// Same handler setup as ChapterHtmlSlimParser: character data is collected, references that reach the default
+// handler are recorded and resolved through lookupHtmlEntity
+struct ExpandedText {
+  std::string text;
+  std::vector<std::string> defaultReferences;
+};
+
+void XMLCALL collectText(void* userData, const XML_Char* s, const int len) {
+  static_cast<ExpandedText*>(userData)->text.append(s, len);
+}
+
+void XMLCALL collectDefault(void* userData, const XML_Char* s, const int len) {
+  auto* expanded = static_cast<ExpandedText*>(userData);
+  if (len >= 3 && s[0] == '&' && s[len - 1] == ';') {
+    expanded->defaultReferences.emplace_back(s, len);
+    const char* value = lookupHtmlEntity(s, len);
+    expanded->text += value ? value : std::string(s, len);
+  }
+}
+
+void checkExpatReferences() {
+  const std::string xhtml =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+      "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\" \"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\n"
+      "<html><body><p>a&#8212;b&#x41;&nbsp;c&#150;&amp;</p></body></html>";
+  ExpandedText expanded;
+  XML_Parser parser = XML_ParserCreate(nullptr);
+  XML_SetUserData(parser, &expanded);
+  XML_SetDefaultHandlerExpand(parser, collectDefault);
+  XML_SetCharacterDataHandler(parser, collectText);
+  const bool ok = XML_Parse(parser, xhtml.data(), static_cast<int>(xhtml.size()), 1) == XML_STATUS_OK;
+  XML_ParserFree(parser);
+
+  // Numeric references are expanded by expat before any handler sees them, only named HTML ones need the table
+  expect(ok, "XHTML with HTML entities parses");
+  expect(expanded.defaultReferences == std::vector<std::string>{"&nbsp;"}, "only &nbsp; reaches the default handler");
+  expect(expanded.text == "a\xE2\x80\x94" "bA\xC2\xA0" "c\xC2\x96&", "numeric references expanded by expat");
+}
+
+void checkEntities() {
+  using namespace html_entities;
+
+  // Every generated entry must be found in its own slot
+  size_t found = 0;
+  for (const Entity& entity : ENTITIES) {
+    const std::string reference = "&" + std::string(NAMES + entity.nameOffset, entity.nameLength) + ";";
+    const char* value = lookupHtmlEntity(reference.data(), static_cast<int>(reference.size()));
+    // The tables have internal linkage, so compare the bytes rather than the pointers
+    found += value && strcmp(value, reinterpret_cast<const char*>(VALUES + entity.valueOffset)) == 0;
+  }
+  expect(found == ENTITY_COUNT, "all " + std::to_string(ENTITY_COUNT) + " named entities resolve");
+  for (const char* name : LEGACY_ENTITY_NAMES) {
+    expect(lookupHtmlEntity(name, static_cast<int>(strlen(name))) != nullptr, std::string("legacy entity ") + name);
+  }
+
+  expect(decodesTo("&nbsp;", "\xC2\xA0"), "&nbsp;");
+  expect(decodesTo("&mdash;", "\xE2\x80\x94"), "&mdash;");
+  expect(decodesTo("&AMP;", "&"), "&AMP;");
+  expect(decodesTo("&NotNestedGreaterGreater;", "\xE2\xAA\xA2\xCC\xB8"), "two code point entity");
+  expect(decodesTo("&CounterClockwiseContourIntegral;", "\xE2\x88\xB3"), "longest entity name");
+  expect(decodesTo("&#8212;", nullptr) && decodesTo("&#x2014;", nullptr), "numeric references are left to expat");
+  expect(decodesTo("&Nbsp;", nullptr) && decodesTo("&nbsp", nullptr) && decodesTo("&;", nullptr), "bad names");
+  expect(decodesTo("&zzzz;", nullptr) && decodesTo("&CounterClockwiseContourIntegralX;", nullptr), "unknown names");
+}
+
+// Classification alone, once for the start and once for the end of every element in the chapter
+template <typename Fn>
+double classifyNsPerElement(const std::vector<const char*>& names, Fn&& classifyElement, uint32_t& checksum) {
+  double best = 0;
+  for (int repeat = 0; repeat < REPEATS; ++repeat) {
+    checksum = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (const char* name : names) checksum += classifyElement(name);
+    const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    const double perElement = ns / names.size();
+    if (repeat == 0 || perElement < best) best = perElement;
+  }
+  return best;
+}
+
+}  // namespace
+
+int main() {
+  checkClassification();
+  checkEntities();
+  checkExpatReferences();
+
+  const std::string html = buildChapter();
+  std::vector<std::string> nameStorage;
+  Counters baseline;
+  baseline.names = &nameStorage;
+  Counters legacy;
+  Counters hashed;
+  const double emptyNs = parseNsPerElement(html, emptyStart, emptyEnd, baseline);
+  const double legacyNs = parseNsPerElement(html, legacyStart, legacyEnd, legacy);
+  const double hashedNs = parseNsPerElement(html, hashedStart, hashedEnd, hashed);
+  expect(legacy.checksum == hashed.checksum, "both classifications agree over the whole chapter");
+
+  std::vector<const char*> names;
+  names.reserve(nameStorage.size());
+  for (const auto& name : nameStorage) names.push_back(name.c_str());
+  uint32_t legacyChecksum = 0;
+  uint32_t hashedChecksum = 0;
+  const double legacyClassifyNs = classifyNsPerElement(
+      names, [](const char* name) { return legacyStartCategories(name) + (legacyEndFlushes(name) ? 1u : 0u); },
+      legacyChecksum);
+  const double hashedClassifyNs = classifyNsPerElement(
+      names,
+      [](const char* name) {
+        const uint16_t tag = HtmlTags::classify(name);
+        return tag + ((tag & FLUSH_ON_END) ? 1u : 0u);
+      },
+      hashedChecksum);
+  expect(legacyChecksum == hashedChecksum, "both classifications agree on the tag sequence");
+
+  std::cout << "Chapter: " << html.size() << " bytes, " << baseline.elements << " elements" << std::endl;
+  std::cout << "  expat only:         " << emptyNs << " ns/element" << std::endl;
+  std::cout << "  strcmp chain:       " << legacyNs << " ns/element (" << std::showpos << legacyNs - emptyNs
+            << std::noshowpos << ")" << std::endl;
+  std::cout << "  HtmlTags::classify: " << hashedNs << " ns/element (" << std::showpos << hashedNs - emptyNs
+            << std::noshowpos << ")" << std::endl;
+  std::cout << "Classification only (start + end):" << std::endl;
+  std::cout << "  strcmp chain:       " << legacyClassifyNs << " ns/element" << std::endl;
+  std::cout << "  HtmlTags::classify: " << hashedClassifyNs << " ns/element" << std::endl;
+
+  // Entity references in the proportions of a typical converted book; the last two are not in the old table
+  static const char* ENTITY_STREAM[] = {"&nbsp;",  "&rsquo;", "&mdash;",  "&ldquo;", "&rdquo;",  "&rsquo;",
+                                        "&hellip;", "&amp;",  "&eacute;", "&rsquo;", "&ndash;",  "&nbsp;",
+                                        "&lsquo;", "&copy;",  "&hairsp;", "&ZeroWidthSpace;"};
+  std::vector<std::pair<const char*, int>> references;
+  for (int i = 0; i < 200000; ++i) {
+    const char* entity = ENTITY_STREAM[(i * 7) % (sizeof(ENTITY_STREAM) / sizeof(ENTITY_STREAM[0]))];
+    references.emplace_back(entity, static_cast<int>(strlen(entity)));
+  }
+  const auto timeLookups = [&references](const auto& lookup) {
+    double best = 0;
+    for (int repeat = 0; repeat < REPEATS; ++repeat) {
+      size_t hits = 0;
+      const auto start = std::chrono::steady_clock::now();
+      for (const auto& [entity, len] : references) hits += lookup(entity, len) != nullptr;
+      const double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+      expect(hits > 0, "entity lookups hit");
+      const double perLookup = ns / references.size();
+      if (repeat == 0 || perLookup < best) best = perLookup;
+    }
+    return best;
+  };
+  const double legacyEntityNs = timeLookups(legacyLookup);
+  const double hashedEntityNs = timeLookups(lookupHtmlEntity);
+  std::cout << "Entity lookup (" << html_entities::ENTITY_COUNT << " names):" << std::endl;
+  std::cout << "  linear scan (240):  " << legacyEntityNs << " ns/reference" << std::endl;
+  std::cout << "  perfect hash:       " << hashedEntityNs << " ns/reference" << std::endl;
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "All checks passed" << std::endl;
+  return 0;
+}
@@ -1,19 +1,39 @@
+#include <HalStorage.h>
 #include <Utf8.h>
 
 #include <algorithm>
 #include <cctype>
+#include <chrono>
 #include <cmath>
+#include <cstdlib>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <new>
 #include <sstream>
 #include <string>
 #include <vector>
 
 #include "lib/Epub/Epub/hyphenation/HyphenationCommon.h"
+#include "lib/Epub/Epub/hyphenation/HyphenationTrieFile.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageHyphenator.h"
 #include "lib/Epub/Epub/hyphenation/LanguageRegistry.h"
 
+// Counts heap allocations so the benchmark can check that hyphenating a word never allocates
+size_t allocationCount = 0;
+
+void* operator new(const size_t size) {
+  ++allocationCount;
+  if (void* p = std::malloc(size ? size : 1)) {
+    return p;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
 struct TestCase {
   std::string word;
   std::string hyphenated;
@@ -129,10 +149,15 @@ std::string positionsToHyphenated(const std::string& word, const std::vector<siz
 }
 
 std::vector<size_t> hyphenateWordWithHyphenator(const std::string& word, const LanguageHyphenator& hyphenator) {
-  auto cps = collectCodepoints(word);
+  WordCodepoints cps;
+  if (!collectCodepoints(word, cps)) {
+    return {};
+  }
   trimSurroundingPunctuationAndFootnote(cps);
 
-  return hyphenator.breakIndexes(cps);
+  uint8_t indexes[MAX_HYPHENATION_WORD_BYTES];
+  const size_t count = hyphenator.breakIndexes(cps, indexes);
+  return std::vector<size_t>(indexes, indexes + count);
 }
 
 std::vector<LanguageConfig> resolveLanguages(const std::string& selection) {
@@ -302,16 +327,189 @@ void printResults(const std::string& language, const std::vector<TestCase>& test
   }
 }
 
+bool sameBreaks(const Hyphenator::Breaks& a, const Hyphenator::Breaks& b) {
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a.items[i].byteOffset != b.items[i].byteOffset ||
+        a.items[i].requiresInsertedHyphen != b.items[i].requiresInsertedHyphen) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// In-memory copy of the trie the hyphenator walks: the built-in blob, or an SD dictionary read whole past its header
+std::vector<uint8_t> trieBytes(const LanguageConfig& lang, const LanguageHyphenator& hyphenator) {
+  if (!hyphenator.patterns().file) {
+    return {hyphenator.patterns().data, hyphenator.patterns().data + hyphenator.patterns().size};
+  }
+  constexpr size_t DICTIONARY_HEADER_BYTES = 12;
+  std::ifstream in(Storage.hostPath("/hyphenation/") + lang.primaryTag + ".bin", std::ios::binary);
+  std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+  bytes.erase(bytes.begin(), bytes.begin() + std::min(bytes.size(), DICTIONARY_HEADER_BYTES));
+  return bytes;
+}
+
+// Words per second through the Liang evaluator alone, walking the compact trie in memory and the way the reader
+// does (dense top levels for built-in languages, the page cache for SD dictionaries), and through
+// Hyphenator::breakOffsets for a stream of words drawn with the frequencies of the book the test data
+// came from, which is what the word LRU sees during a section build. Returns false if hyphenating a word allocates,
+// if the two walks disagree or if a cached result differs from a fresh one.
+bool runBenchmark(const LanguageConfig& lang, const LanguageHyphenator& hyphenator,
+                  const std::vector<TestCase>& testCases) {
+  constexpr int REPEATS = 5;
+  constexpr size_t STREAM_WORDS = 200000;
+  bool ok = true;
+  const std::vector<uint8_t> blob = trieBytes(lang, hyphenator);
+  const SerializedHyphenationPatterns inMemory{blob.data(), blob.size()};
+  const bool paged = hyphenator.patterns().file != nullptr;
+
+  // Best of REPEATS, in words per second
+  const auto measure = [](const size_t words, const auto& body) {
+    double best = 0;
+    for (int repeat = 0; repeat < REPEATS; ++repeat) {
+      const auto start = std::chrono::steady_clock::now();
+      body();
+      const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      best = std::max(best, words / seconds);
+    }
+    return best;
+  };
+
+  // The first word of an SD language fills the page cache with the top of the trie
+  uint8_t warmUp[MAX_HYPHENATION_WORD_BYTES];
+  WordCodepoints cps;
+  collectCodepoints(testCases.front().word, cps);
+  size_t checksum = hyphenator.breakIndexes(cps, warmUp);
+
+  const size_t allocationsBefore = allocationCount;
+  const double compactRate = measure(testCases.size(), [&] {
+    for (const auto& testCase : testCases) {
+      WordCodepoints cps;
+      if (collectCodepoints(testCase.word, cps)) {
+        trimSurroundingPunctuationAndFootnote(cps);
+        uint8_t indexes[MAX_HYPHENATION_WORD_BYTES];
+        checksum += liangBreakIndexes(cps, inMemory, nullptr, hyphenator.config(), indexes);
+      }
+    }
+  });
+  const uint32_t loadsBefore = paged ? hyphenator.patterns().file->pageLoads() : 0;
+  const double readerRate = measure(testCases.size(), [&] {
+    for (const auto& testCase : testCases) {
+      WordCodepoints cps;
+      if (collectCodepoints(testCase.word, cps)) {
+        trimSurroundingPunctuationAndFootnote(cps);
+        uint8_t indexes[MAX_HYPHENATION_WORD_BYTES];
+        checksum += hyphenator.breakIndexes(cps, indexes);
+      }
+    }
+  });
+  // SD reads per word over the REPEATS passes of the reader walk
+  const double loadsPerWord =
+      paged ? static_cast<double>(hyphenator.patterns().file->pageLoads() - loadsBefore) / (REPEATS * testCases.size())
+            : 0;
+  if (allocationCount != allocationsBefore) {
+    std::cerr << "FAIL: " << lang.cliName << " Liang evaluation allocated "
+              << (allocationCount - allocationsBefore) << " times" << std::endl;
+    ok = false;
+  }
+
+  size_t walkMismatches = 0;
+  for (const auto& testCase : testCases) {
+    WordCodepoints cps;
+    if (!collectCodepoints(testCase.word, cps)) {
+      continue;
+    }
+    trimSurroundingPunctuationAndFootnote(cps);
+    uint8_t compact[MAX_HYPHENATION_WORD_BYTES];
+    uint8_t reader[MAX_HYPHENATION_WORD_BYTES];
+    const size_t compactCount = liangBreakIndexes(cps, inMemory, nullptr, hyphenator.config(), compact);
+    const size_t readerCount = hyphenator.breakIndexes(cps, reader);
+    walkMismatches += compactCount != readerCount || !std::equal(compact, compact + compactCount, reader);
+  }
+  if (walkMismatches > 0) {
+    std::cerr << "FAIL: " << lang.cliName << (paged ? " paged" : " dense") << " and compact walks disagree on "
+              << walkMismatches << " words" << std::endl;
+    ok = false;
+  }
+
+  // Frequency-weighted draw with a fixed LCG so every run sees the same stream
+  std::vector<double> cumulative;
+  double total = 0;
+  for (const auto& testCase : testCases) {
+    total += std::max(testCase.frequency, 1);
+    cumulative.push_back(total);
+  }
+  std::vector<const std::string*> stream;
+  stream.reserve(STREAM_WORDS);
+  uint32_t state = 12345;
+  for (size_t i = 0; i < STREAM_WORDS; ++i) {
+    state = state * 1664525u + 1013904223u;
+    const double pick = (state >> 8) / static_cast<double>(1u << 24) * total;
+    const size_t index = std::upper_bound(cumulative.begin(), cumulative.end(), pick) - cumulative.begin();
+    stream.push_back(&testCases[std::min(index, testCases.size() - 1)].word);
+  }
+
+  Hyphenator::setPreferredLanguage(lang.primaryTag);
+  const double streamRate = measure(stream.size(), [&] {
+    for (const std::string* word : stream) {
+      checksum += Hyphenator::breakOffsets(*word, false).size();
+    }
+  });
+
+  // Cached results against fresh ones: releasing the language empties the cache and closes an SD dictionary, which
+  // setPreferredLanguage then reopens
+  size_t mismatches = 0;
+  for (size_t i = 0; i < 2000; ++i) {
+    const Hyphenator::Breaks cached = Hyphenator::breakOffsets(*stream[i], false);
+    Hyphenator::releaseLanguage();
+    Hyphenator::setPreferredLanguage(lang.primaryTag);
+    mismatches += !sameBreaks(cached, Hyphenator::breakOffsets(*stream[i], false));
+  }
+  if (mismatches > 0) {
+    std::cerr << "FAIL: " << lang.cliName << " " << mismatches << " cached results differ" << std::endl;
+    ok = false;
+  }
+
+  std::cout << lang.cliName << ": Liang compact " << static_cast<long>(compactRate)
+            << (paged ? " / SD paged " : " / dense ") << static_cast<long>(readerRate) << " words/s";
+  if (paged) {
+    std::cout << " (" << loadsPerWord << " SD reads/word)";
+  }
+  std::cout << ", breakOffsets stream " << static_cast<long>(streamRate) << " words/s (checksum "
+            << checksum % 1000 << ")" << std::endl;
+  return ok;
+}
+
 int main(int argc, char* argv[]) {
+  const bool benchmarkMode = argc > 1 && std::string(argv[1]) == "benchmark";
+  if (benchmarkMode) {
+    --argc;
+    ++argv;
+  }
   const bool summaryMode = argc <= 1;
   const std::string languageSelection = summaryMode ? "all" : argv[1];
 
+  // SD dictionaries are read from the checked-in card layout; the script runs from the repository root
+  Storage.setRoot("sd");
+
+  // Tags come from book metadata, nothing but a plain subtag may reach the dictionary path
+  for (const char* tag : {"../hyphenation/de", "de/", "DE", "de.bin", ""}) {
+    if (getLanguageHyphenatorForPrimaryTag(tag)) {
+      std::cerr << "FAIL: language tag \"" << tag << "\" opened a dictionary" << std::endl;
+      return 1;
+    }
+  }
+
   std::vector<LanguageConfig> languages = resolveLanguages(languageSelection);
   if (languages.empty()) {
     std::cerr << "Unknown language: " << languageSelection << std::endl;
     return 1;
   }
 
+  bool benchmarkOk = true;
   for (const auto& lang : languages) {
     const auto* hyphenator = getLanguageHyphenatorForPrimaryTag(lang.primaryTag);
     if (!hyphenator) {
@@ -332,6 +530,11 @@ int main(int argc, char* argv[]) {
       continue;
     }
 
+    if (benchmarkMode) {
+      benchmarkOk = runBenchmark(lang, *hyphenator, testCases) && benchmarkOk;
+      continue;
+    }
+
     if (!summaryMode) {
       std::cout << "Loaded " << testCases.size() << " test cases for " << lang.cliName << std::endl;
       std::cout << std::endl;
@@ -386,5 +589,5 @@ int main(int argc, char* argv[]) {
                  totalRecall, totalF1, totalWeighted, totalTP, totalFP, totalFN, hyphenateFunc);
   }
 
-  return 0;
+  return benchmarkOk ? 0 : 1;
 }
\ No newline at end of file
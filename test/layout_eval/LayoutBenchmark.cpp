@@ -0,0 +1,433 @@
+// Host benchmark for laying out text without spaces (CJK) through ParsedText.
+//
+// Generates paragraphs of Japanese-like text (kanji, kana, small kana, brackets, punctuation and the odd Latin word)
+// and feeds each paragraph to ParsedText the way ChapterHtmlSlimParser::characterData did before LineBreak existed
+// (one word per 200 bytes, separated by spaces) and the way it does now (one word per UAX #14 break opportunity,
+// abutted). Both are laid out with hyphenation off and on at several paragraph lengths and timed per character, so
+// the cost should stay flat as paragraphs grow.
+//
+// The lines of the new segmentation are drawn through the host renderer and checked: no line may start with closing
+// punctuation or a nonstarter (small kana, prolonged sound mark) or end with opening punctuation, nothing may be
+// hyphenated, no character may be lost and justified lines must end at the right edge. The same counts are reported
+// for the old segmentation.
+//
+// Long paragraphs are laid out in windows while they are parsed. A Latin paragraph is fed word by word with the
+// window and lookahead EpubProcessingProfile picks for several heap sizes (and the fixed 750 words / one line it
+// replaced). Fails if a line other than the first is indented, if a word is lost or if the line breaking cost
+// strays more than 5% from laying out the whole paragraph at once.
+
+#include <GfxRenderer.h>
+#include <Utf8.h>
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/EpubProcessingProfile.h"
+#include "lib/Epub/Epub/ParsedText.h"
+#include "lib/Epub/Epub/hyphenation/Hyphenator.h"
+#include "lib/Epub/Epub/parsers/LineBreak.h"
+
+namespace {
+
+constexpr size_t MAX_WORD_SIZE = 200;  // As in ChapterHtmlSlimParser.h
+constexpr uint16_t VIEWPORT_WIDTH = 480;
+constexpr int PARAGRAPH_LENGTHS[] = {200, 1000, 5000};
+constexpr int TOTAL_CHARACTERS = 200000;
+
+int failures = 0;
+
+void expect(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL: " << what << std::endl;
+    ++failures;
+  }
+}
+
+uint32_t lcgState = 12345;
+uint32_t nextRandom() {
+  lcgState = lcgState * 1103515245u + 12345u;
+  return lcgState >> 8;
+}
+
+void appendCodepoint(std::string& out, const uint32_t cp) {
+  if (cp < 0x80) {
+    out += static_cast<char>(cp);
+  } else if (cp < 0x800) {
+    out += static_cast<char>(0xC0 | (cp >> 6));
+    out += static_cast<char>(0x80 | (cp & 0x3F));
+  } else {
+    out += static_cast<char>(0xE0 | (cp >> 12));
+    out += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+    out += static_cast<char>(0x80 | (cp & 0x3F));
+  }
+}
+
+// A paragraph of roughly `length` codepoints made of sentences, some of them quoted
+std::string makeParagraph(const int length) {
+  std::string text;
+  int count = 0;
+  while (count < length) {
+    const bool quoted = nextRandom() % 7 == 0;
+    if (quoted) {
+      appendCodepoint(text, 0x300C);  // 「
+      ++count;
+    }
+    const int sentenceLength = 6 + static_cast<int>(nextRandom() % 19);
+    for (int i = 0; i < sentenceLength; ++i) {
+      const uint32_t pick = nextRandom() % 100;
+      if (pick < 50) {
+        appendCodepoint(text, 0x4E00 + nextRandom() % 3000);
+      } else if (pick < 82) {
+        appendCodepoint(text, 0x3042 + nextRandom() % 0x52);  // Hiragana, small kana included
+      } else if (pick < 96) {
+        appendCodepoint(text, 0x30A2 + nextRandom() % 0x52);  // Katakana
+      } else if (pick < 98) {
+        appendCodepoint(text, 0x30FC);  // ー
+      } else {
+        text += "EPUB3";
+        count += 4;
+      }
+      ++count;
+    }
+    if (quoted) {
+      appendCodepoint(text, 0x300D);  // 」
+      ++count;
+    }
+    appendCodepoint(text, nextRandom() % 3 == 0 ? 0x3001 : 0x3002);  // 、 or 。
+    ++count;
+  }
+  return text;
+}
+
+size_t codepointCount(const std::string& text) {
+  size_t count = 0;
+  for (const char c : text) {
+    count += (static_cast<unsigned char>(c) & 0xC0) != 0x80;
+  }
+  return count;
+}
+
+// characterData before LineBreak: no whitespace in the run, so it was cut into MAX_WORD_SIZE byte words (possibly in
+// the middle of a character) that were laid out as if separated by spaces
+void addLegacyWords(ParsedText& block, const std::string& text) {
+  for (size_t offset = 0; offset < text.size(); offset += MAX_WORD_SIZE) {
+    block.addWord(text.substr(offset, MAX_WORD_SIZE), EpdFontFamily::REGULAR);
+  }
+}
+
+// characterData now: a new abutted word at every break opportunity, and at codepoint boundaries when a run without
+// opportunities fills the buffer
+void addSegmentedWords(ParsedText& block, const std::string& text) {
+  LineBreak::Breaker breaker;
+  std::string word;
+  bool abut = false;
+  const auto* bytes = reinterpret_cast<const unsigned char*>(text.data());
+  for (size_t i = 0; i < text.size();) {
+    const int sequenceLen = utf8CodepointLen(bytes[i]);
+    const unsigned char* cursor = bytes + i;
+    const uint32_t cp = utf8NextCodepoint(&cursor);
+    if (breaker.breakBefore(cp) || word.size() + sequenceLen > MAX_WORD_SIZE) {
+      if (!word.empty()) {
+        block.addWord(std::move(word), EpdFontFamily::REGULAR, false, false, abut);
+        word.clear();
+      }
+      abut = true;
+    }
+    word.append(text, i, sequenceLen);
+    i += sequenceLen;
+  }
+  block.addWord(std::move(word), EpdFontFamily::REGULAR, false, false, abut);
+}
+
+struct LayoutResult {
+  std::vector<std::vector<GfxRenderer::DrawnText>> lines;
+};
+
+LayoutResult layout(const std::string& text, const bool segmented, const bool hyphenation, const bool justify) {
+  BlockStyle style;
+  style.alignment = justify ? CssTextAlign::Justify : CssTextAlign::Left;
+  style.textIndentDefined = true;  // No em space indent, every drawn character comes from the paragraph
+  ParsedText block(false, hyphenation, style);
+  if (segmented) {
+    addSegmentedWords(block, text);
+  } else {
+    addLegacyWords(block, text);
+  }
+
+  LayoutResult result;
+  GfxRenderer renderer;
+  block.layoutAndExtractLines(renderer, 0, VIEWPORT_WIDTH, [&](const std::shared_ptr<TextBlock>& line) {
+    renderer.drawn.clear();
+    line->render(renderer, 0, 0, 0);
+    result.lines.push_back(renderer.drawn);
+  });
+  return result;
+}
+
+uint32_t firstCodepoint(const std::string& text) {
+  const auto* cursor = reinterpret_cast<const unsigned char*>(text.c_str());
+  return utf8NextCodepoint(&cursor);
+}
+
+uint32_t lastCodepoint(const std::string& text) {
+  size_t start = text.size();
+  while (start > 0 && (static_cast<unsigned char>(text[--start]) & 0xC0) == 0x80) {
+  }
+  return firstCodepoint(text.substr(start));
+}
+
+struct LineChecks {
+  int lines = 0;
+  int badStarts = 0;
+  int badEnds = 0;
+  int hyphens = 0;
+  int ragged = 0;
+  size_t characters = 0;
+};
+
+LineChecks checkLines(const LayoutResult& result) {
+  const GfxRenderer metrics;
+  LineChecks checks;
+  for (size_t i = 0; i < result.lines.size(); ++i) {
+    const auto& line = result.lines[i];
+    if (line.empty()) continue;
+    ++checks.lines;
+
+    const LineBreak::Class first = LineBreak::classify(firstCodepoint(line.front().text));
+    checks.badStarts += first == LineBreak::CL || first == LineBreak::CP || first == LineBreak::NS ||
+                        first == LineBreak::EX || first == LineBreak::IS;
+    checks.badEnds += LineBreak::classify(lastCodepoint(line.back().text)) == LineBreak::OP;
+
+    for (const auto& word : line) {
+      checks.hyphens += word.text.find('-') != std::string::npos;
+      checks.characters += codepointCount(word.text);
+    }
+
+    // Justified lines other than the last must reach the right edge, give or take the rounding of the spacing
+    if (i + 1 < result.lines.size()) {
+      const int end = line.back().x + metrics.getTextWidth(0, line.back().text.c_str());
+      checks.ragged += end > VIEWPORT_WIDTH || end < VIEWPORT_WIDTH - static_cast<int>(line.size());
+    }
+  }
+  return checks;
+}
+
+void runChecks() {
+  lcgState = 777;
+  const std::string text = makeParagraph(5000);
+  const size_t characters = codepointCount(text);
+
+  const LineChecks segmented = checkLines(layout(text, true, false, true));
+  const LineChecks legacy = checkLines(layout(text, false, false, true));
+
+  std::cout << "5000 character paragraph, justified, hyphenation off:\n";
+  std::cout << "  legacy:    " << legacy.lines << " lines, " << legacy.badStarts << " bad starts, " << legacy.badEnds
+            << " bad ends, " << legacy.hyphens << " hyphenated, " << legacy.ragged << " ragged\n";
+  std::cout << "  segmented: " << segmented.lines << " lines, " << segmented.badStarts << " bad starts, "
+            << segmented.badEnds << " bad ends, " << segmented.hyphens << " hyphenated, " << segmented.ragged
+            << " ragged\n";
+
+  expect(segmented.badStarts == 0, "no line may start with closing punctuation or a nonstarter");
+  expect(segmented.badEnds == 0, "no line may end with opening punctuation");
+  expect(segmented.hyphens == 0, "segmented CJK text must not be hyphenated");
+  expect(segmented.ragged == 0, "justified CJK lines must reach the right edge");
+  expect(segmented.characters == characters, "every character must be laid out exactly once");
+
+  const LineChecks hyphenated = checkLines(layout(text, true, true, true));
+  expect(hyphenated.badStarts == 0 && hyphenated.badEnds == 0 && hyphenated.hyphens == 0,
+         "kinsoku must hold with hyphenation on");
+  expect(hyphenated.characters == characters, "every character must be laid out exactly once with hyphenation on");
+
+  // A run with no break opportunities at all is cut at codepoint boundaries and still wraps without gaps
+  std::string latin(3 * MAX_WORD_SIZE + 17, 'x');
+  const LayoutResult longRun = layout(latin + "\xE3\x80\x82", true, false, false);
+  size_t longRunCharacters = 0;
+  for (const auto& line : longRun.lines) {
+    for (const auto& word : line) longRunCharacters += word.text.size() - (word.text.back() == '-');
+  }
+  expect(longRunCharacters == latin.size() + 3, "an unbreakable run must keep all of its bytes");
+}
+
+// A paragraph of Latin words with a rough English length distribution
+std::vector<std::string> makeLatinWords(const int count) {
+  std::vector<std::string> words;
+  for (int i = 0; i < count; ++i) {
+    std::string word(1 + nextRandom() % 4 + nextRandom() % 4 + nextRandom() % 4, 'a');
+    for (char& c : word) c = static_cast<char>('a' + nextRandom() % 26);
+    if (nextRandom() % 9 == 0) word += nextRandom() % 2 ? "," : ".";
+    words.push_back(std::move(word));
+  }
+  return words;
+}
+
+struct WindowedLayout {
+  double cost = 0;          // Sum of squared slack over all lines but the last, what the line breaker minimizes
+  int indentedLines = 0;    // Lines other than the first that start away from the left edge
+  bool wordsIntact = true;  // Every word laid out once, in order
+  bool offsetsIntact = true;  // Each line reports the source offset of its first word (never going back)
+};
+
+// The paragraph fed to ParsedText one word at a time and laid out the way ChapterHtmlSlimParser does once the
+// profile's window is full
+WindowedLayout layoutInWindows(const std::vector<std::string>& words, const EpubProcessingProfile& profile,
+                               const bool hyphenation) {
+  BlockStyle style;
+  style.alignment = CssTextAlign::Left;
+  style.textIndentDefined = true;
+  style.textIndent = 30;
+  ParsedText block(false, hyphenation, style);
+  GfxRenderer renderer;
+  std::vector<int> slack;
+  std::string text;
+  WindowedLayout result;
+  // Source offsets as if the words were separated by single spaces
+  std::vector<uint32_t> offsets;
+  uint32_t sourceOffset = 0;
+  for (const auto& word : words) {
+    offsets.push_back(sourceOffset);
+    sourceOffset += word.size() + 1;
+  }
+  size_t placedWords = 0;
+  uint32_t lastLineOffset = 0;
+  const auto collect = [&](const std::shared_ptr<TextBlock>& line) {
+    renderer.drawn.clear();
+    line->render(renderer, 0, 0, 0);
+    const auto& last = renderer.drawn.back();
+    slack.push_back(VIEWPORT_WIDTH - last.x - renderer.getTextWidth(0, last.text.c_str()));
+    result.indentedLines += !slack.empty() && slack.size() > 1 && renderer.drawn.front().x != 0;
+    for (const auto& word : renderer.drawn) text += word.text + ' ';
+    // Hyphenation splits words, so only the order of the offsets can be checked with it
+    const uint32_t lineOffset = block.lastLineSourceOffset();
+    result.offsetsIntact &= hyphenation ? lineOffset >= lastLineOffset
+                                        : placedWords < offsets.size() && lineOffset == offsets[placedWords];
+    lastLineOffset = lineOffset;
+    placedWords += renderer.drawn.size();
+  };
+  for (size_t i = 0; i < words.size(); ++i) {
+    const auto& word = words[i];
+    block.addWord(word, EpdFontFamily::REGULAR, false, false, false, offsets[i]);
+    if (block.size() >= profile.layoutWindowWords) {
+      block.layoutAndExtractLines(renderer, 0, VIEWPORT_WIDTH, collect, profile.layoutLookaheadLines);
+    }
+  }
+  block.layoutAndExtractLines(renderer, 0, VIEWPORT_WIDTH, collect);
+
+  for (size_t i = 0; i + 1 < slack.size(); ++i) {
+    result.cost += static_cast<double>(slack[i]) * slack[i];
+  }
+  std::string expected;
+  for (const auto& word : words) expected += word + ' ';
+  result.wordsIntact = hyphenation || text == expected;
+  return result;
+}
+
+void runWindowedLayout() {
+  lcgState = 99;
+  const std::vector<std::string> words = makeLatinWords(20000);
+  EpubProcessingProfile whole;
+  whole.layoutWindowWords = UINT16_MAX;
+
+  struct Case {
+    const char* name;
+    EpubProcessingProfile profile;
+  };
+  EpubProcessingProfile fixed;
+  fixed.layoutWindowWords = 750;
+  fixed.layoutLookaheadLines = 1;
+  const Case cases[] = {
+      {"fixed 750 words", fixed},
+      {"heap 40 KB", EpubProcessingProfile{}.fittedToHeap(40 * 1024, 32 * 1024)},
+      {"heap 80 KB", EpubProcessingProfile{}.fittedToHeap(80 * 1024, 64 * 1024)},
+      {"heap 160 KB", EpubProcessingProfile{}.fittedToHeap(160 * 1024, 96 * 1024)},
+      {"heap 256 KB", EpubProcessingProfile{}.fittedToHeap(256 * 1024, 96 * 1024)},
+  };
+  // Once the heap can hold the default window the fitted one never drops below it
+  for (const size_t freeHeap : {110 * 1024, 160 * 1024, 256 * 1024}) {
+    expect(EpubProcessingProfile{}.fittedToHeap(freeHeap, 64 * 1024).layoutWindowWords >= fixed.layoutWindowWords,
+           "a heap that holds the default window must not shrink it");
+  }
+
+  std::cout << "\n20000 word paragraph laid out in windows, line breaking cost over a whole-paragraph layout:\n";
+  const WindowedLayout reference = layoutInWindows(words, whole, false);
+  for (const Case& c : cases) {
+    const WindowedLayout windowed = layoutInWindows(words, c.profile, false);
+    const double excess = 100.0 * (windowed.cost - reference.cost) / reference.cost;
+    std::cout << "  " << std::left << std::setw(16) << c.name << std::right << " window " << std::setw(4)
+              << c.profile.layoutWindowWords << " words, lookahead " << c.profile.layoutLookaheadLines << " lines, "
+              << c.profile.htmlParseChunkSize << " byte chunks: +" << std::fixed << std::setprecision(2) << excess
+              << "%\n";
+    expect(windowed.indentedLines == 0, std::string("only the first line may be indented: ") + c.name);
+    expect(windowed.wordsIntact, std::string("windowed layout must keep every word in order: ") + c.name);
+    expect(windowed.offsetsIntact, std::string("lines must report their first word's source offset: ") + c.name);
+    if (&c != &cases[0]) {
+      expect(excess < 5.0, std::string("windowed layout must stay close to the whole paragraph: ") + c.name);
+    }
+
+    const WindowedLayout hyphenated = layoutInWindows(words, c.profile, true);
+    expect(hyphenated.indentedLines == 0, std::string("only the first line may be indented: ") + c.name);
+    expect(hyphenated.offsetsIntact, std::string("line source offsets must not go back: ") + c.name);
+  }
+}
+
+void runTimings() {
+  std::cout << "\nLayout time per character (ns):\n";
+  std::cout << "  paragraph   hyphenation   legacy   segmented\n";
+  // Segmented layout with hyphenation, per paragraph length: the cost per character must not grow with the length
+  std::vector<double> hyphenatedNs;
+  for (const int length : PARAGRAPH_LENGTHS) {
+    lcgState = 4242;
+    std::vector<std::string> paragraphs;
+    for (int total = 0; total < TOTAL_CHARACTERS; total += length) {
+      paragraphs.push_back(makeParagraph(length));
+    }
+    size_t characters = 0;
+    for (const auto& paragraph : paragraphs) characters += codepointCount(paragraph);
+
+    for (const bool hyphenation : {false, true}) {
+      double nsPerCharacter[2];
+      for (const bool segmented : {false, true}) {
+        const auto start = std::chrono::steady_clock::now();
+        size_t lines = 0;
+        for (const auto& paragraph : paragraphs) {
+          lines += layout(paragraph, segmented, hyphenation, true).lines.size();
+        }
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        nsPerCharacter[segmented] =
+            std::chrono::duration<double, std::nano>(elapsed).count() / static_cast<double>(characters);
+        expect(lines > 0, "layout must produce lines");
+      }
+      std::cout << "  " << std::setw(9) << length << "   " << std::setw(11) << (hyphenation ? "on" : "off") << "   "
+                << std::fixed << std::setprecision(1) << std::setw(6) << nsPerCharacter[0] << "   " << std::setw(9)
+                << nsPerCharacter[1] << "\n";
+      if (hyphenation) {
+        hyphenatedNs.push_back(nsPerCharacter[1]);
+      }
+    }
+  }
+  // Generous margin for timing noise; looking words up from the front of the list on every split doubled it
+  expect(hyphenatedNs.back() < 1.6 * *std::min_element(hyphenatedNs.begin(), hyphenatedNs.end() - 1),
+         "hyphenated layout time per character must stay flat as paragraphs grow");
+}
+
+}  // namespace
+
+int main() {
+  Hyphenator::setPreferredLanguage("ja");
+  runChecks();
+  runWindowedLayout();
+  runTimings();
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "\nAll checks passed" << std::endl;
+  return 0;
+}
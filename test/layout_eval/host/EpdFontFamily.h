@@ -0,0 +1,9 @@
+#pragma once
+// Host stand-in for the firmware font family: only the style flags ParsedText and TextBlock carry around.
+
+#include <cstdint>
+
+class EpdFontFamily {
+ public:
+  enum Style : uint8_t { REGULAR = 0, BOLD = 1, ITALIC = 2, BOLD_ITALIC = 3, UNDERLINE = 4 };
+};
@@ -0,0 +1,50 @@
+#pragma once
+// Host stand-in for the firmware renderer: a made up proportional metric (East Asian wide characters are two cells,
+// ASCII letters vary around one cell) and a record of every drawText call, so laid out lines can be read back.
+
+#include <EpdFontFamily.h>
+#include <Utf8.h>
+
+#include <string>
+#include <vector>
+
+#include "lib/Epub/Epub/parsers/LineBreak.h"
+
+class GfxRenderer {
+ public:
+  static constexpr int CELL_WIDTH = 10;
+  static constexpr int SPACE_WIDTH = 5;
+  static constexpr int LETTER_WIDTHS[26] = {10, 11, 9, 11, 10, 6, 11, 11, 5, 5, 10, 5, 16,
+                                            11, 11, 11, 11, 7, 8, 7, 11, 10, 14, 10, 10, 9};
+
+  struct DrawnText {
+    int x;
+    std::string text;
+  };
+  mutable std::vector<DrawnText> drawn;
+
+  int getTextWidth(int /*fontId*/, const char* text, EpdFontFamily::Style /*style*/ = EpdFontFamily::REGULAR) const {
+    int width = 0;
+    const auto* cursor = reinterpret_cast<const unsigned char*>(text);
+    while (*cursor) {
+      const uint32_t cp = utf8NextCodepoint(&cursor);
+      if (LineBreak::isWide(cp)) {
+        width += 2 * CELL_WIDTH;
+      } else if (cp >= 'a' && cp <= 'z') {
+        width += LETTER_WIDTHS[cp - 'a'];
+      } else {
+        width += CELL_WIDTH;
+      }
+    }
+    return width;
+  }
+  int getSpaceWidth(int /*fontId*/) const { return SPACE_WIDTH; }
+  int getTextAdvanceX(int fontId, const char* text) const { return getTextWidth(fontId, text); }
+  int getFontAscenderSize(int /*fontId*/) const { return 2 * CELL_WIDTH; }
+
+  void drawText(int /*fontId*/, const int x, int /*y*/, const char* text, bool /*black*/ = true,
+                EpdFontFamily::Style /*style*/ = EpdFontFamily::REGULAR) const {
+    drawn.push_back({x, text});
+  }
+  void drawLine(int /*x1*/, int /*y1*/, int /*x2*/, int /*y2*/, bool /*state*/ = true) const {}
+};
@@ -0,0 +1,122 @@
+// Host check for the page drawn ahead in the EPUB reader.
+//
+// Links src/activities/reader/PrerenderedPage.cpp against stand-ins for Arduino.h (a heap the check sizes) and
+// Epub/Page.h in test/prerender_eval/host. Reads a chapter the way EpubReaderActivity does: after each page shown it
+// draws the next one ahead if the spare frame can be had, and the next render takes it. The reader turns forward,
+// now and then back, opens the menu (which drops the page drawn ahead), loads the next chapter and runs short of heap
+// for a while. Reports the pages shown from a frame drawn ahead and those thrown away, against a count kept here.
+//
+// Fails if a page drawn ahead is shown for another page or section load, if hits or misses differ from the count
+// kept here, if the spare frame is taken with the heap short or kept once it runs out, or if a frame drawn ahead is
+// shown after the menu dropped it.
+
+#include <Arduino.h>
+#include <Epub/Page.h>
+
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <string>
+
+#include "src/activities/reader/PrerenderedPage.h"
+
+namespace {
+
+constexpr size_t FRAME_BYTES = 48000;
+constexpr int PAGES_PER_CHAPTER = 40;
+constexpr int TURNS = 2000;
+
+int failures = 0;
+
+void check(const bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAIL: " << message << std::endl;
+    failures++;
+  }
+}
+
+}  // namespace
+
+int main() {
+  PrerenderedPage prerendered;
+  std::mt19937 random(7);
+
+  uint32_t sectionLoads = 1;
+  int page = 0;
+  uint32_t expectedHits = 0;
+  uint32_t expectedMisses = 0;
+  // The page drawn ahead and the section load it belongs to, as kept here; -1 when none is held
+  int aheadPage = -1;
+  uint32_t aheadLoad = 0;
+  int heapShortTurns = 0;
+
+  for (int turn = 0; turn < TURNS; turn++) {
+    // Show the page: from the frame drawn ahead if it is this one
+    uint32_t sourceOffset = 0;
+    auto shown = prerendered.take(sectionLoads, page, &sourceOffset);
+    if (aheadPage >= 0) {
+      if (aheadPage == page && aheadLoad == sectionLoads) {
+        expectedHits++;
+        check(shown && shown->number == page, "the page drawn ahead was not shown for its page");
+        check(sourceOffset == static_cast<uint32_t>(page) * 100, "the page drawn ahead lost its source offset");
+        check(prerendered.getFrame()[0] == static_cast<uint8_t>(page), "the frame drawn ahead was not kept");
+      } else {
+        expectedMisses++;
+        check(!shown, "a page drawn ahead was shown for page " + std::to_string(page));
+      }
+      aheadPage = -1;
+    } else {
+      check(!shown, "a page was shown from a frame nothing was drawn into");
+    }
+
+    // The heap runs short now and then, as when a chapter with images is laid out
+    if (heapShortTurns == 0 && random() % 50 == 0) heapShortTurns = 5;
+    ESP.freeHeap = heapShortTurns > 0 ? 40 * 1024 : 200 * 1024;
+    if (heapShortTurns > 0) heapShortTurns--;
+
+    // Draw the next page ahead, as prerenderNextPage does
+    prerendered.releaseIfHeapShort();
+    check(ESP.freeHeap >= 64 * 1024 || !prerendered.getFrame(), "the spare frame was kept with the heap short");
+    if (page + 1 < PAGES_PER_CHAPTER && prerendered.reserve(FRAME_BYTES)) {
+      check(ESP.freeHeap >= FRAME_BYTES + 112 * 1024, "the spare frame was taken with the heap short");
+      memset(prerendered.getFrame(), page + 1, FRAME_BYTES);
+      prerendered.store(sectionLoads, page + 1, (page + 1) * 100, std::unique_ptr<Page>(new Page(page + 1)));
+      aheadPage = page + 1;
+      aheadLoad = sectionLoads;
+    }
+
+    // What the reader does next
+    const unsigned action = random() % 20;
+    if (action == 0 && aheadPage >= 0) {
+      // The menu drops the page drawn ahead; closing it shows the same page again
+      prerendered.invalidate();
+      expectedMisses++;
+      aheadPage = -1;
+    } else if (action == 1 && page > 0) {
+      page--;
+    } else if (page + 1 >= PAGES_PER_CHAPTER) {
+      page = 0;
+      sectionLoads++;
+    } else {
+      page++;
+    }
+  }
+  prerendered.release();
+  if (aheadPage >= 0) expectedMisses++;
+
+  const uint32_t hits = prerendered.getHits();
+  const uint32_t misses = prerendered.getMisses();
+  std::cout << TURNS << " page turns in chapters of " << PAGES_PER_CHAPTER << " pages: " << hits
+            << " shown from a frame drawn ahead, " << misses << " thrown away" << std::endl;
+  check(hits == expectedHits, "counted " + std::to_string(hits) + " hits, expected " + std::to_string(expectedHits));
+  check(misses == expectedMisses,
+        "counted " + std::to_string(misses) + " misses, expected " + std::to_string(expectedMisses));
+  check(hits > TURNS / 2, "fewer than half the turns were shown from a frame drawn ahead");
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "\nAll checks passed" << std::endl;
+  return 0;
+}
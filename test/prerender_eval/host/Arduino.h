@@ -0,0 +1,14 @@
+#pragma once
+// Host stand-in for the parts of Arduino.h PrerenderedPage uses: a heap whose free and largest block sizes the check
+// sets
+#include <cstdint>
+
+struct EspClass {
+  uint32_t freeHeap = 200 * 1024;
+  uint32_t maxAllocHeap = 100 * 1024;
+
+  uint32_t getFreeHeap() const { return freeHeap; }
+  uint32_t getMaxAllocHeap() const { return maxAllocHeap; }
+};
+
+inline EspClass ESP;
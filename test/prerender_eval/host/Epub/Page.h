@@ -0,0 +1,7 @@
+#pragma once
+// Host stand-in for a laid out page: only which page it is
+class Page {
+ public:
+  explicit Page(const int number) : number(number) {}
+  int number;
+};
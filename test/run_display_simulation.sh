@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/display_eval"
+BINARY="$BUILD_DIR/DisplayRefreshSimulation"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/display_eval/DisplayRefreshSimulation.cpp"
+  "$ROOT_DIR/lib/hal/HalDisplay.cpp"
+  "$ROOT_DIR/lib/hal/HalSpiBus.cpp"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/test/display_eval/host"
+  -I"$ROOT_DIR/lib/hal"
+  -pthread
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+cd "$ROOT_DIR"
+"$BINARY" "$@"
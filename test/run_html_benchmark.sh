@@ -0,0 +1,40 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/html_eval"
+BINARY="$BUILD_DIR/HtmlParseBenchmark"
+
+mkdir -p "$BUILD_DIR"
+
+# Bundled expat, configured like the firmware build (see platformio.ini)
+EXPAT_FLAGS=(
+  -O2
+  -DXML_GE=0
+  -DXML_CONTEXT_BYTES=1024
+  -I"$ROOT_DIR/lib/expat"
+)
+EXPAT_OBJECTS=()
+for source in xmlparse xmlrole xmltok; do
+  cc "${EXPAT_FLAGS[@]}" -c "$ROOT_DIR/lib/expat/$source.c" -o "$BUILD_DIR/$source.o"
+  EXPAT_OBJECTS+=("$BUILD_DIR/$source.o")
+done
+
+SOURCES=(
+  "$ROOT_DIR/test/html_eval/HtmlParseBenchmark.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/htmlEntities.cpp"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/lib/expat"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" "${EXPAT_OBJECTS[@]}" -o "$BINARY"
+
+"$BINARY" "$@"
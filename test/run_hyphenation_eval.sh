@@ -13,6 +13,7 @@ SOURCES=(
   "$ROOT_DIR/lib/Epub/Epub/hyphenation/LanguageRegistry.cpp"
   "$ROOT_DIR/lib/Epub/Epub/hyphenation/LiangHyphenation.cpp"
   "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationCommon.cpp"
+  "$ROOT_DIR/lib/Epub/Epub/hyphenation/HyphenationTrieFile.cpp"
   "$ROOT_DIR/lib/Utf8/Utf8.cpp"
 )
 
@@ -25,8 +26,11 @@ CXXFLAGS=(
   -I"$ROOT_DIR"
   -I"$ROOT_DIR/lib"
   -I"$ROOT_DIR/lib/Utf8"
+  -I"$ROOT_DIR/test/css_eval/host"
 )
 
 c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
 
+# SD dictionaries are looked up relative to the repository root
+cd "$ROOT_DIR"
 "$BINARY" "$@"
@@ -0,0 +1,29 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/prerender_eval"
+BINARY="$BUILD_DIR/PrerenderedPageCheck"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/prerender_eval/PrerenderedPageCheck.cpp"
+  "$ROOT_DIR/src/activities/reader/PrerenderedPage.cpp"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/test/prerender_eval/host"
+  -I"$ROOT_DIR/test/css_eval/host"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+cd "$ROOT_DIR"
+"$BINARY" "$@"
@@ -0,0 +1,29 @@
+#!/usr/bin/env bash
+set -euo pipefail
+
+ROOT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")/.." && pwd)"
+BUILD_DIR="$ROOT_DIR/build/scheduler_eval"
+BINARY="$BUILD_DIR/JobSchedulerSimulation"
+
+mkdir -p "$BUILD_DIR"
+
+SOURCES=(
+  "$ROOT_DIR/test/scheduler_eval/JobSchedulerSimulation.cpp"
+  "$ROOT_DIR/lib/JobScheduler/JobScheduler.cpp"
+)
+
+CXXFLAGS=(
+  -std=c++20
+  -O2
+  -Wall
+  -Wextra
+  -pedantic
+  -I"$ROOT_DIR"
+  -I"$ROOT_DIR/lib/JobScheduler"
+  -I"$ROOT_DIR/test/css_eval/host"
+)
+
+c++ "${CXXFLAGS[@]}" "${SOURCES[@]}" -o "$BINARY"
+
+cd "$ROOT_DIR"
+"$BINARY" "$@"
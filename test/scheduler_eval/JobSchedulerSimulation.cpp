@@ -0,0 +1,352 @@
+// Host simulation of the cooperative background job scheduler.
+//
+// A main loop like the firmware's runs on a simulated millisecond clock: it polls the buttons, lets the activity
+// handle them and, when nothing was pressed, hands the rest of the iteration to JobScheduler::runSlice() before the
+// loop delay. A press starts a page refresh that holds the display bus, which the pause check reports. Background
+// jobs modelled on the firmware's (section indexing, cover thumbnails, cache eviction that needs heap the reader is
+// still using, a sync that arrives part way, a search that is cancelled, and book pagination whose steps lay out a
+// whole chapter) are kept busy while button presses arrive at random times, in bursts with reading pauses between.
+//
+// Reports the delay between a press and the loop seeing it, with the jobs run through the scheduler and with the
+// same jobs run inline to completion when submitted (how indexing used to block the reader). Fails if a press under
+// the scheduler waits longer than the slice budget plus the longest step (for pagination, the gap between its
+// interruption checks) plus one loop delay, if a job loses or repeats work across pauses, if the urgent job does not
+// run ahead of the others, if a cancelled job takes another step or completes, or if the eviction job runs while the
+// heap is short.
+
+#include <algorithm>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "lib/JobScheduler/JobScheduler.h"
+
+namespace {
+
+constexpr uint32_t SIMULATED_MS = 120000;
+constexpr uint32_t LOOP_DELAY_MS = 10;
+constexpr uint32_t INPUT_HANDLING_MS = 3;
+// A press starts a page refresh on the display task, which holds the SPI bus meanwhile
+constexpr uint32_t REFRESH_MS = 450;
+constexpr uint32_t SLICE_BUDGET_MS = JobScheduler::DEFAULT_SLICE_MS;
+constexpr size_t EVICTION_HEAP_BUDGET = 48 * 1024;
+
+int failures = 0;
+
+void check(const bool condition, const std::string& message) {
+  if (!condition) {
+    std::cerr << "FAIL: " << message << std::endl;
+    failures++;
+  }
+}
+
+struct Clock {
+  uint32_t now = 0;
+};
+
+// Deterministic press times: a press every 150 to 1500 ms, and after every eighth a pause of 4 to 12 s to read
+std::vector<uint32_t> pressTimes() {
+  std::vector<uint32_t> presses;
+  uint32_t state = 12345;
+  uint32_t t = 500;
+  while (t < SIMULATED_MS) {
+    presses.push_back(t);
+    state = state * 1103515245u + 12345u;
+    t += presses.size() % 8 == 0 ? 4000 + (state >> 8) % 8000 : 150 + (state >> 8) % 1350;
+  }
+  return presses;
+}
+
+// Free heap seen by the scheduler: short every other few seconds, while a chapter is being laid out
+size_t freeHeapAt(const uint32_t now) { return (now / 3000) % 2 == 0 ? 32 * 1024 : 96 * 1024; }
+
+struct JobModel {
+  std::string name;
+  JobScheduler::Priority priority;
+  uint32_t stepMs;
+  int items;
+  size_t heapBudget = 0;
+  uint32_t submitAt = 0;
+  uint32_t cancelAt = 0;  // 0 to let it finish
+  // Steps that cannot be cut short keep their place: they check isInterrupted() this often and drop the item
+  uint32_t checkEveryMs = 0;
+
+  JobModel(std::string name, const JobScheduler::Priority priority, const uint32_t stepMs, const int items,
+           const size_t heapBudget = 0, const uint32_t submitAt = 0, const uint32_t cancelAt = 0,
+           const uint32_t checkEveryMs = 0)
+      : name(std::move(name)),
+        priority(priority),
+        stepMs(stepMs),
+        items(items),
+        heapBudget(heapBudget),
+        submitAt(submitAt),
+        cancelAt(cancelAt),
+        checkEveryMs(checkEveryMs) {}
+
+  // Longest the job keeps the loop from polling input
+  uint32_t busyMs() const { return checkEveryMs > 0 ? checkEveryMs : stepMs; }
+
+  // Filled in by the run
+  JobScheduler::JobId id = JobScheduler::NO_JOB;
+  std::vector<int> done;  // Items in the order they were done
+  int stepsAfterCancel = 0;
+  int stepsWhileHeapShort = 0;
+  int itemsDropped = 0;
+  bool submitted = false;
+  bool cancelled = false;
+  bool finished = false;
+  bool completed = false;
+  uint32_t finishedAt = 0;
+};
+
+std::vector<JobModel> jobModels() {
+  return {
+      {"index", JobScheduler::Priority::NORMAL, 180, 120},
+      {"thumbnails", JobScheduler::Priority::BACKGROUND, 70, 300},
+      {"evict", JobScheduler::Priority::BACKGROUND, 12, 60, EVICTION_HEAP_BUDGET},
+      {"sync", JobScheduler::Priority::URGENT, 40, 25, 0, 20000},
+      {"search", JobScheduler::Priority::NORMAL, 25, 1000, 0, 50000, 53000},
+      // A chapter's layout, a few seconds with an interruption check per parsed chunk
+      {"paginate", JobScheduler::Priority::BACKGROUND, 2400, 6, 0, 0, 0, 40},
+  };
+}
+
+struct Latency {
+  std::vector<uint32_t> waits;
+
+  uint32_t max() const { return waits.empty() ? 0 : *std::max_element(waits.begin(), waits.end()); }
+  double mean() const {
+    double total = 0;
+    for (const auto wait : waits) total += wait;
+    return waits.empty() ? 0 : total / waits.size();
+  }
+  uint32_t percentile(const double p) const {
+    if (waits.empty()) return 0;
+    std::vector<uint32_t> sorted = waits;
+    std::sort(sorted.begin(), sorted.end());
+    return sorted[std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()))];
+  }
+};
+
+struct RunResult {
+  Latency latency;
+  std::vector<JobModel> jobs;
+  JobScheduler::Stats stats;
+  uint32_t urgentStartedAt = 0;
+  uint32_t lowerStepsWhileUrgentPending = 0;
+};
+
+// Polls the presses that have arrived by now, recording how long each waited
+bool pollInput(const Clock& clock, const std::vector<uint32_t>& presses, size_t& nextPress, Latency& latency) {
+  bool pressed = false;
+  while (nextPress < presses.size() && presses[nextPress] <= clock.now) {
+    latency.waits.push_back(clock.now - presses[nextPress]);
+    nextPress++;
+    pressed = true;
+  }
+  return pressed;
+}
+
+size_t itemsDoneExcept(const std::vector<JobModel>& jobs, const JobModel* skip) {
+  size_t items = 0;
+  for (const auto& model : jobs) {
+    if (&model != skip) items += model.done.size();
+  }
+  return items;
+}
+
+RunResult runScheduled() {
+  RunResult result;
+  result.jobs = jobModels();
+  Clock clock;
+  bool inputPending = false;
+  uint32_t refreshEndsAt = 0;
+  const auto presses = pressTimes();
+  size_t nextPress = 0;
+
+  // Like the firmware's, the pause check reads the buttons again and so sees presses made since the loop's poll
+  JobScheduler scheduler(
+      JobScheduler::Hooks{[&clock] { return clock.now; },
+                          [&] {
+                            return inputPending || clock.now < refreshEndsAt ||
+                                   (nextPress < presses.size() && presses[nextPress] <= clock.now);
+                          },
+                          [&clock] { return freeHeapAt(clock.now); }},
+      SLICE_BUDGET_MS);
+
+  const auto submit = [&](JobModel& model) {
+    model.submitted = true;
+    auto next = std::make_shared<int>(0);
+    JobScheduler::JobSpec spec;
+    spec.name = model.name;
+    spec.priority = model.priority;
+    spec.heapBudget = model.heapBudget;
+    spec.step = [&model, &clock, &result, next](JobScheduler::Context& context) {
+      if (model.cancelled) model.stepsAfterCancel++;
+      if (model.heapBudget > 0 && freeHeapAt(clock.now) < model.heapBudget) model.stepsWhileHeapShort++;
+      if (model.priority == JobScheduler::Priority::URGENT && result.urgentStartedAt == 0) {
+        result.urgentStartedAt = clock.now;
+      }
+      if (model.checkEveryMs > 0) {
+        // The slice running out does not stop it, only input or a cancel, and then the whole item is lost
+        for (uint32_t spent = 0; spent < model.stepMs;) {
+          const uint32_t chunk = std::min(model.checkEveryMs, model.stepMs - spent);
+          clock.now += chunk;
+          spent += chunk;
+          if (spent < model.stepMs && context.isInterrupted()) {
+            model.itemsDropped++;
+            return true;
+          }
+        }
+        model.done.push_back((*next)++);
+        return *next < model.items;
+      }
+      // One item per step; a step that finds time left and nothing waiting carries on with short items
+      do {
+        clock.now += model.stepMs;
+        model.done.push_back((*next)++);
+      } while (*next < model.items && model.stepMs < 20 && !context.shouldYield());
+      return *next < model.items;
+    };
+    spec.onDone = [&model, &clock](const bool completed) {
+      model.finished = true;
+      model.completed = completed;
+      model.finishedAt = clock.now;
+    };
+    model.id = scheduler.submit(std::move(spec));
+  };
+
+  JobModel* urgent = nullptr;
+  for (auto& model : result.jobs) {
+    if (model.priority == JobScheduler::Priority::URGENT) urgent = &model;
+  }
+
+  while (clock.now < SIMULATED_MS) {
+    for (auto& model : result.jobs) {
+      if (!model.submitted && clock.now >= model.submitAt) submit(model);
+      if (model.cancelAt > 0 && !model.cancelled && clock.now >= model.cancelAt) {
+        model.cancelled = true;
+        scheduler.cancel(model.id);
+      }
+    }
+
+    inputPending = pollInput(clock, presses, nextPress, result.latency);
+    if (inputPending) {
+      clock.now += INPUT_HANDLING_MS;
+      refreshEndsAt = clock.now + REFRESH_MS;
+    } else {
+      const bool urgentWaiting = urgent && urgent->submitted && !urgent->finished;
+      const size_t lowerBefore = itemsDoneExcept(result.jobs, urgent);
+      scheduler.runSlice();
+      if (urgentWaiting) {
+        result.lowerStepsWhileUrgentPending += itemsDoneExcept(result.jobs, urgent) - lowerBefore;
+      }
+    }
+    clock.now += LOOP_DELAY_MS;
+  }
+  result.stats = scheduler.getStats();
+  return result;
+}
+
+// The same jobs with every one run to completion as soon as it is submitted
+RunResult runInline() {
+  RunResult result;
+  result.jobs = jobModels();
+  Clock clock;
+  const auto presses = pressTimes();
+  size_t nextPress = 0;
+
+  while (clock.now < SIMULATED_MS) {
+    for (auto& model : result.jobs) {
+      if (model.submitted || clock.now < model.submitAt) continue;
+      model.submitted = true;
+      for (int item = 0; item < model.items; item++) {
+        clock.now += model.stepMs;
+        model.done.push_back(item);
+        if (model.cancelAt > 0 && clock.now >= model.cancelAt) break;
+      }
+      model.finished = true;
+      model.finishedAt = clock.now;
+    }
+    if (pollInput(clock, presses, nextPress, result.latency)) {
+      clock.now += INPUT_HANDLING_MS;
+    }
+    clock.now += LOOP_DELAY_MS;
+  }
+  return result;
+}
+
+void printLatency(const std::string& mode, const RunResult& result) {
+  std::cout << std::left << std::setw(12) << mode << std::right << std::setw(8) << result.latency.waits.size()
+            << std::setw(10) << std::fixed << std::setprecision(1) << result.latency.mean() << std::setw(8)
+            << result.latency.percentile(0.95) << std::setw(8) << result.latency.max() << std::endl;
+}
+
+void checkScheduled(const RunResult& result) {
+  uint32_t longestStep = 0;
+  for (const auto& model : result.jobs) longestStep = std::max(longestStep, model.busyMs());
+  const uint32_t bound = SLICE_BUDGET_MS + longestStep + LOOP_DELAY_MS;
+  check(result.latency.max() <= bound, "press waited " + std::to_string(result.latency.max()) + " ms, bound is " +
+                                           std::to_string(bound) + " ms");
+
+  for (const auto& model : result.jobs) {
+    // Every item exactly once and in order, however often the job was paused
+    bool inOrder = true;
+    for (size_t i = 0; i < model.done.size(); i++) inOrder = inOrder && model.done[i] == static_cast<int>(i);
+    check(inOrder, model.name + " repeated or skipped work across pauses");
+
+    if (model.cancelAt > 0) {
+      check(model.finished && !model.completed, model.name + " was not reported as cancelled");
+      check(model.stepsAfterCancel == 0, model.name + " took a step after it was cancelled");
+      check(static_cast<int>(model.done.size()) < model.items, model.name + " ran to the end despite the cancel");
+    } else {
+      check(model.completed, model.name + " did not complete");
+      check(static_cast<int>(model.done.size()) == model.items, model.name + " did not do all of its items");
+    }
+    check(model.stepsWhileHeapShort == 0, model.name + " ran while the heap was below its budget");
+  }
+
+  check(result.urgentStartedAt > 0, "urgent job never ran");
+  check(result.lowerStepsWhileUrgentPending == 0,
+        std::to_string(result.lowerStepsWhileUrgentPending) + " lower priority items ran while the urgent job waited");
+  check(result.stats.heapDeferrals > 0, "eviction was never held back by its heap budget");
+}
+
+}  // namespace
+
+int main() {
+  const RunResult inlineRun = runInline();
+  const RunResult scheduled = runScheduled();
+
+  std::cout << "Input latency over " << SIMULATED_MS / 1000 << " s of background work (ms)" << std::endl;
+  std::cout << std::left << std::setw(12) << "mode" << std::right << std::setw(8) << "presses" << std::setw(10)
+            << "mean" << std::setw(8) << "p95" << std::setw(8) << "max" << std::endl;
+  printLatency("inline", inlineRun);
+  printLatency("scheduled", scheduled);
+
+  std::cout << "\nScheduler: " << scheduled.stats.slices << " slices, " << scheduled.stats.steps << " steps, "
+            << scheduled.stats.pauses << " paused, " << scheduled.stats.heapDeferrals << " heap deferrals, "
+            << "longest step " << scheduled.stats.longestStepMs << " ms" << std::endl;
+  std::cout << std::left << std::setw(12) << "job" << std::right << std::setw(10) << "items" << std::setw(14)
+            << "inline done" << std::setw(16) << "scheduled done" << std::setw(10) << "dropped" << std::endl;
+  for (size_t i = 0; i < scheduled.jobs.size(); i++) {
+    const auto& model = scheduled.jobs[i];
+    std::cout << std::left << std::setw(12) << model.name << std::right << std::setw(10) << model.done.size()
+              << std::setw(14) << inlineRun.jobs[i].finishedAt << std::setw(16)
+              << (model.finished ? std::to_string(model.finishedAt) : "-") << std::setw(10) << model.itemsDropped
+              << std::endl;
+  }
+
+  checkScheduled(scheduled);
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed" << std::endl;
+    return 1;
+  }
+  std::cout << "\nAll checks passed" << std::endl;
+  return 0;
+}
@@ -195,6 +195,9 @@ void test_large_epub_processing_optimized_vs_baseline() {
 }
 
 void setup() {
+  // Same heap hooks as the firmware, so the optimized profile adapts to the heap here too
+  EpubProcessingProfile::heapHooks = {[] { return static_cast<size_t>(ESP.getFreeHeap()); },
+                                      [] { return static_cast<size_t>(ESP.getMaxAllocHeap()); }};
   UNITY_BEGIN();
   RUN_TEST(test_large_epub_processing_optimized_vs_baseline);
   UNITY_END();
@@ -0,0 +1,182 @@
+// Host round-trip check for the KOReader XPointer conversion.
+//
+// Links lib/KOReaderSync/ChapterXPath.cpp and the bundled expat against a stand-in for Epub.h in
+// test/xpath_eval/host that streams chapters held in memory. The chapter has named, predefined and numeric entities,
+// nested div/p, and paragraphs split into several text nodes by inline elements. Every byte offset of the chapter
+// goes offset -> XPointer -> offset, with the chapter streamed in 1, 7 and 1024 byte writes.
+//
+// Fails if an offset at a character of text does not come back to itself, if any offset's XPointer does not come
+// back to the same XPointer, or if hand-written KOReader XPointers (indices left out where they are 1) resolve to the
+// wrong byte.
+
+#include <Epub.h>
+
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "lib/KOReaderSync/ChapterXPath.h"
+
+namespace {
+
+int failures = 0;
+
+void expect(const bool condition, const std::string& what) {
+  if (!condition) {
+    std::cerr << "FAIL: " << what << "\n";
+    failures++;
+  }
+}
+
+std::string paragraph(const char* text) { return std::string("  <p>") + text + "</p>\n"; }
+
+std::string buildChapter(const int number) {
+  std::string xhtml =
+      "<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+      "<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\" \"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\n"
+      "<html xmlns=\"http://www.w3.org/1999/xhtml\">\n"
+      "<head><title>Chapter " +
+      std::to_string(number) +
+      "</title></head>\n"
+      "<body>\n"
+      "<div class=\"chapter\">\n"
+      "  <h2>III. Caf\xC3\xA9 &amp; Co</h2>\n";
+  xhtml += paragraph("First paragraph, plain text.");
+  xhtml += paragraph("Second with <em>emphasis</em> and a tail &mdash; after it.");
+  xhtml += "  <div><p>Nested in a div, <span>a <b>deep</b> run</span> then text.</p></div>\n";
+  xhtml += paragraph("Third: &lt;quoted&gt; &#8220;curly&#8221; and \xC3\xA9 \xC3\xBC in UTF-8.");
+  xhtml += paragraph("\xC3\x9Cn\xC3\xAF" "c\xC3\xB6" "d\xC3\xA9 first.");
+  xhtml += paragraph("Fifth paragraph&nbsp;with an entity &hellip; after character twelve.");
+  // Text opening on a line end, which expat reports as an event of its own
+  xhtml += "  <p>\n    Wrapped over\n    <em>two</em> lines.</p>\n";
+  // Enough text that 1024 byte writes split it too
+  for (int i = 0; i < 12; i++) {
+    xhtml += paragraph("Filler with <i>an aside</i>, &amp; a tail long enough to reach past a write of a kilobyte.");
+  }
+  xhtml += "</div>\n</body>\n</html>\n";
+  return xhtml;
+}
+
+// Bytes at which a character of body text starts: outside tags, not inside an entity reference, and not whitespace
+// leading a text node (crengine drops whitespace-only text and the XPointer lands on what follows it)
+std::vector<bool> textCharacterStarts(const std::string& xhtml) {
+  std::vector<bool> starts(xhtml.size(), false);
+  const size_t bodyStart = xhtml.find("<body>");
+  const size_t bodyEnd = xhtml.find("</body>");
+  bool inTag = false;
+  bool inEntity = false;
+  bool runHasContent = false;
+  for (size_t i = bodyStart; i < bodyEnd; i++) {
+    const char c = xhtml[i];
+    if (inTag) {
+      inTag = c != '>';
+      continue;
+    }
+    if (c == '<') {
+      inTag = true;
+      runHasContent = false;
+      continue;
+    }
+    if (inEntity) {
+      inEntity = c != ';';
+      continue;
+    }
+    if ((static_cast<unsigned char>(c) & 0xC0) == 0x80) continue;
+    const bool whitespace = c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    if (!whitespace) runHasContent = true;
+    if (c == '&') inEntity = true;
+    starts[i] = runHasContent;
+  }
+  return starts;
+}
+
+void checkRoundTrip(const std::shared_ptr<Epub>& epub, const int spineIndex, const std::string& xhtml,
+                    const size_t chunkSize) {
+  epub->streamChunkSize = chunkSize;
+  const std::vector<bool> exact = textCharacterStarts(xhtml);
+  const std::string suffix = " (writes of " + std::to_string(chunkSize) + ")";
+  size_t checked = 0;
+  size_t exactChecked = 0;
+
+  for (uint32_t offset = 0; offset < xhtml.size(); offset++) {
+    const std::string xpath = ChapterXPath::fromSourceOffset(epub, spineIndex, offset);
+    if (xpath.empty()) {
+      // Only from the end of the body's last text on is there nothing to point at
+      expect(offset >= xhtml.rfind("</p>"), "XPointer for offset " + std::to_string(offset) + suffix);
+      continue;
+    }
+    uint32_t back = 0;
+    if (!ChapterXPath::toSourceOffset(epub, spineIndex, xpath, &back)) {
+      expect(false, "resolve " + xpath + suffix);
+      continue;
+    }
+    checked++;
+    if (exact[offset]) {
+      exactChecked++;
+      expect(back == offset, "offset " + std::to_string(offset) + " -> " + xpath + " -> " + std::to_string(back) +
+                                 suffix);
+    }
+    const std::string again = ChapterXPath::fromSourceOffset(epub, spineIndex, back);
+    expect(again == xpath, xpath + " -> " + std::to_string(back) + " -> " + again + suffix);
+  }
+
+  std::cout << "  writes of " << chunkSize << ": " << checked << " offsets round-tripped, " << exactChecked
+            << " of them at a character of text\n";
+}
+
+// A hand-written KOReader XPointer resolves to the byte of the given text and comes back in canonical form
+void checkXPointer(const std::shared_ptr<Epub>& epub, const int spineIndex, const std::string& xhtml,
+                   const std::string& xpath, const std::string& anchor, const size_t charsIn,
+                   const std::string& canonical) {
+  uint32_t offset = 0;
+  const bool resolved = ChapterXPath::toSourceOffset(epub, spineIndex, xpath, &offset);
+  expect(resolved, "resolve " + xpath);
+  const size_t expected = xhtml.find(anchor) + charsIn;
+  expect(offset == expected, xpath + " at byte " + std::to_string(offset) + ", expected " + std::to_string(expected));
+  const std::string back = ChapterXPath::fromSourceOffset(epub, spineIndex, offset);
+  expect(back == canonical, xpath + " came back as " + back);
+}
+
+}  // namespace
+
+int main() {
+  std::vector<std::string> chapters;
+  for (int i = 1; i <= 3; i++) chapters.push_back(buildChapter(i));
+  const auto epub = std::make_shared<Epub>(chapters);
+  const int spineIndex = 2;
+  const std::string& xhtml = chapters[spineIndex];
+
+  std::cout << "Chapter: " << xhtml.size() << " bytes\n";
+  for (const size_t chunkSize : {size_t{1}, size_t{7}, size_t{1024}}) {
+    checkRoundTrip(epub, spineIndex, xhtml, chunkSize);
+  }
+  epub->streamChunkSize = 0;
+
+  checkXPointer(epub, spineIndex, xhtml, "/body/DocFragment[3]/body/div/p[5]/text().12", "Fifth paragraph", 12,
+                "/body/DocFragment[3]/body/div[1]/p[5]/text().12");
+  // Character 31 is a named entity, one character however long its reference
+  checkXPointer(epub, spineIndex, xhtml, "/body/DocFragment[3]/body/div/p[5]/text().31", "&hellip;", 0,
+                "/body/DocFragment[3]/body/div[1]/p[5]/text().31");
+  checkXPointer(epub, spineIndex, xhtml, "/body/DocFragment[3]/body/div/p[5]/text().32", "&hellip;", 8,
+                "/body/DocFragment[3]/body/div[1]/p[5]/text().32");
+  // Second text node of a nested paragraph, after the inline span closes
+  checkXPointer(epub, spineIndex, xhtml, "/body/DocFragment[3]/body/div/div/p/text()[2].1", "then text.", 0,
+                "/body/DocFragment[3]/body/div[1]/div[1]/p[1]/text()[2].1");
+  // Multibyte characters count once each
+  checkXPointer(epub, spineIndex, xhtml, "/body/DocFragment[3]/body/div/p[4]/text().3", "c\xC3\xB6", 0,
+                "/body/DocFragment[3]/body/div[1]/p[4]/text().3");
+  // A path deeper than the book resolves to the deepest element it matched
+  uint32_t offset = 0;
+  expect(ChapterXPath::toSourceOffset(epub, spineIndex, "/body/DocFragment[3]/body/div/p[2]/em[7]/text().3", &offset) &&
+             offset == xhtml.find("<p>Second"),
+         "partial path resolves to its deepest matched element");
+
+  if (failures > 0) {
+    std::cerr << failures << " check(s) failed\n";
+    return 1;
+  }
+  std::cout << "All checks passed\n";
+  return 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+// Host stand-in for an opened EPUB: spine items are XHTML strings held in memory, streamed out in chunks.
+
+#include <Print.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+class Epub {
+ public:
+  struct SpineEntry {
+    std::string href;
+  };
+
+  explicit Epub(std::vector<std::string> chapters) : chapters(std::move(chapters)) {}
+
+  int getSpineItemsCount() const { return static_cast<int>(chapters.size()); }
+  SpineEntry getSpineItem(const int spineIndex) const { return {std::to_string(spineIndex)}; }
+
+  // The chunk size is overridable so writes can split entities, tags and UTF-8 sequences
+  bool readItemContentsToStream(const std::string& itemHref, Print& out, const size_t chunkSize) const {
+    const std::string& chapter = chapters[std::stoul(itemHref)];
+    const size_t step = streamChunkSize ? streamChunkSize : chunkSize;
+    for (size_t pos = 0; pos < chapter.size(); pos += step) {
+      const size_t len = std::min(step, chapter.size() - pos);
+      out.write(reinterpret_cast<const uint8_t*>(chapter.data() + pos), len);
+    }
+    return true;
+  }
+
+  size_t streamChunkSize = 0;
+
+ private:
+  std::vector<std::string> chapters;
+};